@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "ast.h"
 
 #include <sstream>
+#include <unordered_set>
 
 // -----------------------------------------------------------------------------
 
@@ -49,6 +50,82 @@ ASTUtils::CanonicalizeASTIdentifiable(const ASTIdentifiable& identifiable)
 
 // -----------------------------------------------------------------------------
 
+std::string
+ASTUtils::CanonicalizeASTDeductionTarget(const ASTDeductionTarget& target)
+{
+  std::stringstream stream;
+
+  if (target.isType<ASTDeductionTargetSingular>()) {
+    stream << target.value<ASTDeductionTargetSingular>().name();
+  } else if (target.isType<ASTDeductionTargetArray>()) {
+    const auto& value = target.value<ASTDeductionTargetArray>();
+    stream << value.name() << '[';
+    if (value.hasSizeLiteral()) {
+      stream << value.sizeLiteral();
+    }
+    stream << ']';
+  } else if (target.isType<ASTDeductionTargetComputed>()) {
+    const auto& value = target.value<ASTDeductionTargetComputed>();
+    stream << value.name() << '(';
+    const auto& arguments = value.arguments();
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      if (i > 0) {
+        stream << ", ";
+      }
+      stream << CanonicalizeASTDeductionTarget(arguments[i]);
+    }
+    stream << ')';
+  }
+
+  return stream.str();
+}
+
+// -----------------------------------------------------------------------------
+
+std::string
+ASTUtils::CanonicalizeASTPremiseDefn(const ASTPremiseDefn& premiseDefn)
+{
+  std::stringstream stream;
+
+  if (premiseDefn.isType<ASTInferencePremiseDefn>()) {
+    const auto& value = premiseDefn.value<ASTInferencePremiseDefn>();
+    stream << CanonicalizeASTIdentifiable(value.source()) << " : "
+           << CanonicalizeASTDeductionTarget(value.deductionTarget());
+    // Premises within the while-clause are canonicalized on their own.
+    if (value.hasWhileClause()) {
+      stream << " while { ... }";
+    }
+  } else if (premiseDefn.isType<ASTInferenceEqualityDefn>()) {
+    const auto& value = premiseDefn.value<ASTInferenceEqualityDefn>();
+    stream << CanonicalizeASTDeductionTarget(value.lhs()) << ' ';
+    switch (value.oprt()) {
+      case EqualityOperator::OPERATOR_EQ:
+        stream << '=';
+        break;
+      case EqualityOperator::OPERATOR_NEQ:
+        stream << "!=";
+        break;
+      case EqualityOperator::OPERATOR_LT:
+        stream << '<';
+        break;
+      case EqualityOperator::OPERATOR_LTE:
+        stream << "<=";
+        break;
+    }
+    stream << ' ' << CanonicalizeASTDeductionTarget(value.rhs());
+    if (value.hasRangeClause()) {
+      const auto& rangeClause = value.rangeClause();
+      stream << " inrange " << rangeClause.lhsIdx() << ".."
+             << rangeClause.rhsIdx() << ".."
+             << CanonicalizeASTDeductionTarget(rangeClause.deductionTarget());
+    }
+  }
+
+  return stream.str();
+}
+
+// -----------------------------------------------------------------------------
+
 bool
 ASTUtils::AreTargetsCompatible(const ASTDeductionTarget& lhs,
                                const ASTDeductionTarget& rhs)
@@ -232,3 +309,323 @@ ASTUtils::HasIncompatibleTargetInTable(const ASTDeductionTarget& target,
 }
 
 // -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+static bool
+HasArrayTargetDeclarationWithSizeLiteral(const ASTPremiseDefnList& premiseDefns)
+{
+  for (const auto& premiseDefn : premiseDefns) {
+    if (!premiseDefn.isType<ASTInferencePremiseDefn>()) {
+      continue;
+    }
+    const auto& value = premiseDefn.value<ASTInferencePremiseDefn>();
+    const auto& deductionTarget = value.deductionTarget();
+    if (deductionTarget.isType<ASTDeductionTargetArray>() &&
+        deductionTarget.value<ASTDeductionTargetArray>().hasSizeLiteral()) {
+      return true;
+    }
+    if (value.hasWhileClause() &&
+        HasArrayTargetDeclarationWithSizeLiteral(
+            value.whileClause().premiseDefns())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ASTUtils::HasArrayTargetDeclarationWithSizeLiteral(
+    const ASTInferenceGroup& inferenceGroup)
+{
+  for (const auto& inferenceDefn : inferenceGroup.inferenceDefns()) {
+    if (::HasArrayTargetDeclarationWithSizeLiteral(
+            inferenceDefn.premiseDefns())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+static bool
+HasSubtypeComparison(const ASTPremiseDefnList& premiseDefns)
+{
+  for (const auto& premiseDefn : premiseDefns) {
+    if (premiseDefn.isType<ASTInferenceEqualityDefn>()) {
+      const auto oprt = premiseDefn.value<ASTInferenceEqualityDefn>().oprt();
+      if (oprt == EqualityOperator::OPERATOR_LT ||
+          oprt == EqualityOperator::OPERATOR_LTE) {
+        return true;
+      }
+    } else if (premiseDefn.isType<ASTInferencePremiseDefn>()) {
+      const auto& value = premiseDefn.value<ASTInferencePremiseDefn>();
+      if (value.hasWhileClause() &&
+          HasSubtypeComparison(value.whileClause().premiseDefns())) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ASTUtils::HasSubtypeComparison(const ASTInferenceGroup& inferenceGroup)
+{
+  for (const auto& inferenceDefn : inferenceGroup.inferenceDefns()) {
+    if (::HasSubtypeComparison(inferenceDefn.premiseDefns())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ASTUtils::HaveSameArgumentTypes(const ASTInferenceDefn& lhs,
+                                const ASTInferenceDefn& rhs)
+{
+  const auto& lhsArgs = lhs.arguments();
+  const auto& rhsArgs = rhs.arguments();
+  if (lhsArgs.size() != rhsArgs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhsArgs.size(); ++i) {
+    if (lhsArgs[i].typeName() != rhsArgs[i].typeName()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ASTUtils::HaveSameArguments(const ASTInferenceDefn& lhs,
+                            const ASTInferenceDefn& rhs)
+{
+  if (!HaveSameArgumentTypes(lhs, rhs)) {
+    return false;
+  }
+  const auto& lhsArgs = lhs.arguments();
+  const auto& rhsArgs = rhs.arguments();
+  for (size_t i = 0; i < lhsArgs.size(); ++i) {
+    if (lhsArgs[i].name() != rhsArgs[i].name()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ASTUtils::HaveSameGlobalDecls(const ASTInferenceDefn& lhs,
+                              const ASTInferenceDefn& rhs)
+{
+  const auto& lhsDecls = lhs.globalDecls();
+  const auto& rhsDecls = rhs.globalDecls();
+  if (lhsDecls.size() != rhsDecls.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhsDecls.size(); ++i) {
+    if (lhsDecls[i].name() != rhsDecls[i].name()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ASTUtils::AreTargetsEqual(const ASTDeductionTarget& lhs,
+                          const ASTDeductionTarget& rhs)
+{
+  if (lhs.isType<ASTDeductionTargetSingular>() &&
+      rhs.isType<ASTDeductionTargetSingular>()) {
+    return lhs.value<ASTDeductionTargetSingular>().name() ==
+           rhs.value<ASTDeductionTargetSingular>().name();
+  } else if (lhs.isType<ASTDeductionTargetArray>() &&
+             rhs.isType<ASTDeductionTargetArray>()) {
+    const auto& lhs_val = lhs.value<ASTDeductionTargetArray>();
+    const auto& rhs_val = rhs.value<ASTDeductionTargetArray>();
+    if (lhs_val.name() != rhs_val.name() ||
+        lhs_val.hasSizeLiteral() != rhs_val.hasSizeLiteral()) {
+      return false;
+    }
+    return !lhs_val.hasSizeLiteral() ||
+           lhs_val.sizeLiteral() == rhs_val.sizeLiteral();
+  } else if (lhs.isType<ASTDeductionTargetComputed>() &&
+             rhs.isType<ASTDeductionTargetComputed>()) {
+    const auto& lhs_val = lhs.value<ASTDeductionTargetComputed>();
+    const auto& rhs_val = rhs.value<ASTDeductionTargetComputed>();
+    if (lhs_val.name() != rhs_val.name() ||
+        lhs_val.arguments().size() != rhs_val.arguments().size()) {
+      return false;
+    }
+    for (size_t i = 0; i < lhs_val.arguments().size(); ++i) {
+      if (!AreTargetsEqual(lhs_val.arguments()[i], rhs_val.arguments()[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+static bool
+ArePremiseDefnListsEqual(const ASTPremiseDefnList& lhs,
+                         const ASTPremiseDefnList& rhs)
+{
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    if (!ASTUtils::ArePremiseDefnsEqual(lhs[i], rhs[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ASTUtils::ArePremiseDefnsEqual(const ASTPremiseDefn& lhs,
+                               const ASTPremiseDefn& rhs)
+{
+  if (lhs.isType<ASTInferencePremiseDefn>() &&
+      rhs.isType<ASTInferencePremiseDefn>()) {
+    const auto& lhs_val = lhs.value<ASTInferencePremiseDefn>();
+    const auto& rhs_val = rhs.value<ASTInferencePremiseDefn>();
+    if (CanonicalizeASTIdentifiable(lhs_val.source()) !=
+            CanonicalizeASTIdentifiable(rhs_val.source()) ||
+        !AreTargetsEqual(lhs_val.deductionTarget(),
+                         rhs_val.deductionTarget()) ||
+        lhs_val.hasWhileClause() != rhs_val.hasWhileClause()) {
+      return false;
+    }
+    return !lhs_val.hasWhileClause() ||
+           ::ArePremiseDefnListsEqual(lhs_val.whileClause().premiseDefns(),
+                                      rhs_val.whileClause().premiseDefns());
+  } else if (lhs.isType<ASTInferenceEqualityDefn>() &&
+             rhs.isType<ASTInferenceEqualityDefn>()) {
+    const auto& lhs_val = lhs.value<ASTInferenceEqualityDefn>();
+    const auto& rhs_val = rhs.value<ASTInferenceEqualityDefn>();
+    if (lhs_val.oprt() != rhs_val.oprt() ||
+        !AreTargetsEqual(lhs_val.lhs(), rhs_val.lhs()) ||
+        !AreTargetsEqual(lhs_val.rhs(), rhs_val.rhs()) ||
+        lhs_val.hasRangeClause() != rhs_val.hasRangeClause()) {
+      return false;
+    }
+    if (!lhs_val.hasRangeClause()) {
+      return true;
+    }
+    const auto& lhsRange = lhs_val.rangeClause();
+    const auto& rhsRange = rhs_val.rangeClause();
+    return lhsRange.lhsIdx() == rhsRange.lhsIdx() &&
+           lhsRange.rhsIdx() == rhsRange.rhsIdx() &&
+           AreTargetsEqual(lhsRange.deductionTarget(),
+                           rhsRange.deductionTarget());
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+static void
+CollectImportedInferenceGroups(
+    const ASTModule& module, std::unordered_set<const ASTModule*>* visited,
+    std::vector<const ASTInferenceGroup*>* inferenceGroups)
+{
+  for (const auto& import : module.imports()) {
+    const ASTModule* importedModule = import.module();
+    if (!importedModule || !visited->insert(importedModule).second) {
+      continue;
+    }
+    for (const auto& inferenceGroup : importedModule->inferenceGroups()) {
+      inferenceGroups->push_back(&inferenceGroup);
+    }
+    ::CollectImportedInferenceGroups(*importedModule, visited,
+                                     inferenceGroups);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+std::vector<const ASTInferenceGroup*>
+ASTUtils::GetImportedInferenceGroups(const ASTModule& module)
+{
+  std::unordered_set<const ASTModule*> visited;
+  std::vector<const ASTInferenceGroup*> inferenceGroups;
+  ::CollectImportedInferenceGroups(module, &visited, &inferenceGroups);
+  return inferenceGroups;
+}
+
+// -----------------------------------------------------------------------------
+
+static void
+CollectImportedFilepaths(const ASTModule& module,
+                         std::unordered_set<const ASTModule*>* visited,
+                         std::unordered_set<std::string>* filepathSet,
+                         std::vector<std::string>* filepaths)
+{
+  for (const auto& import : module.imports()) {
+    // The same module can be imported from files with the same content.
+    if (!import.filepath().empty() &&
+        filepathSet->insert(import.filepath()).second) {
+      filepaths->push_back(import.filepath());
+    }
+    const ASTModule* importedModule = import.module();
+    if (importedModule && visited->insert(importedModule).second) {
+      ::CollectImportedFilepaths(*importedModule, visited, filepathSet,
+                                 filepaths);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+std::vector<std::string>
+ASTUtils::GetImportedFilepaths(const ASTModule& module)
+{
+  std::unordered_set<const ASTModule*> visited;
+  std::unordered_set<std::string> filepathSet;
+  std::vector<std::string> filepaths;
+  ::CollectImportedFilepaths(module, &visited, &filepathSet, &filepaths);
+  return filepaths;
+}
+
+// -----------------------------------------------------------------------------
+
+const ASTInferenceDefn*
+ASTUtils::FindInferenceDefn(const ASTInferenceGroup& inferenceGroup,
+                            const std::string& name)
+{
+  for (const ASTInferenceGroup* group = &inferenceGroup; group;
+       group = group->base()) {
+    for (const auto& inferenceDefn : group->inferenceDefns()) {
+      if (inferenceDefn.name() == name) {
+        return &inferenceDefn;
+      }
+    }
+  }
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
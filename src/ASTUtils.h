@@ -28,6 +28,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 typedef std::unordered_map<std::string, const ASTDeductionTarget*> TargetTable;
 
@@ -38,6 +39,10 @@ class ASTUtils
 public:
   static std::string CanonicalizeASTIdentifiable(const ASTIdentifiable&);
 
+  static std::string CanonicalizeASTDeductionTarget(const ASTDeductionTarget&);
+
+  static std::string CanonicalizeASTPremiseDefn(const ASTPremiseDefn&);
+
   static bool AreTargetsCompatible(const ASTDeductionTarget&,
                                    const ASTDeductionTarget&);
 
@@ -56,4 +61,47 @@ public:
 
   static bool HasIncompatibleTargetInTable(const ASTDeductionTarget&,
                                            const TargetTable&);
+
+  static bool HasArrayTargetDeclarationWithSizeLiteral(
+      const ASTInferenceGroup&);
+
+  /**
+   * Whether any premise of a group compares types with `<` or `<=`.
+   */
+  static bool HasSubtypeComparison(const ASTInferenceGroup&);
+
+  static bool HaveSameArgumentTypes(const ASTInferenceDefn&,
+                                    const ASTInferenceDefn&);
+
+  static bool HaveSameArguments(const ASTInferenceDefn&,
+                                const ASTInferenceDefn&);
+
+  static bool HaveSameGlobalDecls(const ASTInferenceDefn&,
+                                  const ASTInferenceDefn&);
+
+  static bool AreTargetsEqual(const ASTDeductionTarget&,
+                              const ASTDeductionTarget&);
+
+  static bool ArePremiseDefnsEqual(const ASTPremiseDefn&,
+                                   const ASTPremiseDefn&);
+
+  /**
+   * The inference groups of the modules imported by a module, directly or
+   * not, each listed once.
+   */
+  static std::vector<const ASTInferenceGroup*> GetImportedInferenceGroups(
+      const ASTModule&);
+
+  /**
+   * The paths of the files imported by a module, directly or not, each
+   * listed once.
+   */
+  static std::vector<std::string> GetImportedFilepaths(const ASTModule&);
+
+  /**
+   * Find the inference definition with the given name in a group, or else
+   * in its bases.
+   */
+  static const ASTInferenceDefn* FindInferenceDefn(const ASTInferenceGroup&,
+                                                   const std::string&);
 };
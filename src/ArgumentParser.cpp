@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "variant_static_visitor.h"
 #include "version.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -138,7 +139,10 @@ ArgumentParser::addParameter(const char* name, const char shorthand,
       .value = CmdlOptionValue(),
       .dst = reinterpret_cast<void*>(res),
   };
-  _shorthandMap[shorthand] = name;
+  // Options without a shorthand are only recognized by name.
+  if (shorthand) {
+    _shorthandMap[shorthand] = name;
+  }
   _opts[name] = opts;
 }
 
@@ -226,9 +230,13 @@ ArgumentParser::optionProvided(const char* name) const
 bool
 ArgumentParser::__checkParameters() const
 {
-  // Check if the short-hand map count matches with the number of options.
-  // If not, it means there are short-hands that are duplicate.
-  if (_shorthandMap.size() != _opts.size()) {
+  // Check if the short-hand map count matches with the number of options
+  // with a short-hand. If not, it means there are short-hands that are
+  // duplicate.
+  const auto shorthandCount =
+      std::count_if(_opts.begin(), _opts.end(),
+                    [](const auto& pair) { return pair.second.shorthand; });
+  if (_shorthandMap.size() != static_cast<size_t>(shorthandCount)) {
     return false;
   }
 
@@ -356,7 +364,9 @@ ArgumentParser::__printHelp(Stream& stream) const
     const auto& option = pair.second;
     const auto& defaultValue = option.defaultValue.value;
 
-    stream << HELP_MENU_SINGLE_DASH << option.shorthand << ", ";
+    if (option.shorthand) {
+      stream << HELP_MENU_SINGLE_DASH << option.shorthand << ", ";
+    }
     stream << HELP_MENU_DOUBLE_DASH << name;
     if (!defaultValue.is<bool>()) {
       stream << HELP_MENU_VALUE_PLACEHOLDER;
@@ -435,16 +445,15 @@ ArgumentParser::__parseArgs(int argc, char** argv)
         return false;
       }
     } else if (s.find("-") == 0) {
-      std::string shorthand = s.substr(1);
-      if (shorthand.size() != 1) {
-        return false;
-      }
-      const char c = shorthand[0];
-      const auto iter = _shorthandMap.find(c);
-      if (iter == _shorthandMap.end()) {
-        return false;
+      std::string key = s.substr(1);
+      // Names of options are also accepted after a single dash, as in `-MD`.
+      if (key.size() == 1) {
+        const auto iter = _shorthandMap.find(key[0]);
+        if (iter == _shorthandMap.end()) {
+          return false;
+        }
+        key = iter->second;
       }
-      std::string key = iter->second;
       if (!__registerCmdlOption(key, argc, argv)) {
         return false;
       }
@@ -28,6 +28,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 // -----------------------------------------------------------------------------
 
+// Default maximum size of the output cache, in MiB.
+#define SNOWLAKE_DEFAULT_CACHE_MAX_SIZE 1024
+
+// -----------------------------------------------------------------------------
+
 CmdlDriver::CmdlDriver()
   : _opts()
 {
@@ -66,6 +71,52 @@ CmdlDriver::run(int argc, char** argv)
   argparser.addBooleanParameter("no-annotation-comments", 'n',
                                 "Suppress annotation comments", false,
                                 &_opts.suppressAnnotationComments, false);
+  argparser.addBooleanParameter(
+      "policy-template", 'p',
+      "Synthesize header-only class templates parameterized on a policy type",
+      false, &_opts.usePolicyTemplate, false);
+  argparser.addBooleanParameter(
+      "cold-failure-paths", 'c',
+      "Route failed premises through an out-of-line cold handler per method",
+      false, &_opts.useColdFailurePaths, false);
+  argparser.addBooleanParameter(
+      "emit-instrumentation", 'i',
+      "Emit per-rule performance counters and tracing hooks", false,
+      &_opts.emitInstrumentation, false);
+  argparser.addBooleanParameter(
+      "simd-scanner", 'm',
+      "Scan the input with the hand-written vectorized scanner", false,
+      &_opts.useSimdScanner, false);
+  argparser.addBooleanParameter(
+      "recursive-descent", 'r',
+      "Parse the input with the hand-written recursive-descent parser", false,
+      &_opts.useRecursiveDescentParser, false);
+  argparser.addUint32Parameter(
+      "shards", '\0',
+      "Number of .cpp files to split the definitions of each group across",
+      false, &_opts.shards, 1);
+  argparser.addBooleanParameter(
+      "light-headers", '\0',
+      "Keep the header of each group to its class declaration, and move the "
+      "rest to an implementation-detail header",
+      false, &_opts.useLightHeaders, false);
+  argparser.addBooleanParameter(
+      "MD", '\0',
+      "Write a Makefile-style depfile of the inputs read and files written",
+      false, &_opts.emitDepfile, false);
+  argparser.addStringParameter(
+      "MF", '\0',
+      "Path of the depfile, which implies --MD. Defaults to the input name "
+      "with the .d extension in the output path",
+      false, &_opts.depfilePath);
+  argparser.addStringParameter(
+      "cache-dir", '\0',
+      "Directory of the output cache, which may be shared by many processes",
+      false, &_opts.cacheDirpath);
+  argparser.addUint64Parameter("cache-max-size", '\0',
+                               "Maximum size of the output cache in MiB",
+                               false, &_opts.cacheMaxSize,
+                               SNOWLAKE_DEFAULT_CACHE_MAX_SIZE);
   argparser.setMinimumPositionalArgsRequired(1);
 
   const bool res = argparser.parseArgs(argc, argv);
@@ -76,6 +127,26 @@ CmdlDriver::run(int argc, char** argv)
 
   _opts.inputPath = argparser.positionalArgs().front();
 
+  if (!_opts.depfilePath.empty()) {
+    _opts.emitDepfile = true;
+  } else if (_opts.emitDepfile) {
+    // Named after the input, in the output path.
+    const auto slashPos = _opts.inputPath.find_last_of('/');
+    std::string stem = slashPos == std::string::npos
+                           ? _opts.inputPath
+                           : _opts.inputPath.substr(slashPos + 1);
+    const auto dotPos = stem.find_last_of('.');
+    if (dotPos != std::string::npos && dotPos > 0) {
+      stem.resize(dotPos);
+    }
+    _opts.depfilePath = _opts.outputPath;
+    if (!_opts.depfilePath.empty() && _opts.depfilePath.back() != '/') {
+      _opts.depfilePath.push_back('/');
+    }
+    _opts.depfilePath.append(stem);
+    _opts.depfilePath.append(".d");
+  }
+
   return true;
 }
 
@@ -22,6 +22,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 class CmdlDriver
@@ -37,8 +38,20 @@ public:
     bool verbose;
     bool silent;
     bool suppressAnnotationComments;
+    bool usePolicyTemplate;
+    bool useColdFailurePaths;
+    bool emitInstrumentation;
+    bool useLightHeaders;
+    bool useSimdScanner;
+    bool useRecursiveDescentParser;
+    bool emitDepfile;
+    uint32_t shards;
+    // In MiB.
+    uint64_t cacheMaxSize;
     std::string inputPath;
     std::string outputPath;
+    std::string depfilePath;
+    std::string cacheDirpath;
   };
 
   const Options& options() const;
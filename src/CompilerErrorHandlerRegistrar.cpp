@@ -39,6 +39,14 @@ CompilerErrorHandlerRegistrar::RegisterScopedCompilerErrorHandler(
 
 // -----------------------------------------------------------------------------
 
+CompilerErrorHandler
+CompilerErrorHandlerRegistrar::RegisteredCompilerErrorHandler()
+{
+  return _registeredHandler;
+}
+
+// -----------------------------------------------------------------------------
+
 void
 CompilerErrorHandlerRegistrar::RegisterCompilerError(CompilerError&& error)
 {
@@ -58,6 +66,8 @@ CompilerErrorHandlerRegistrar::UnregisterScopedCompilerErrorHandler()
 
 ScopedCompilerErrorHandlerRegister::ScopedCompilerErrorHandlerRegister(
     CompilerErrorHandler handler)
+  : _previousHandler(
+        CompilerErrorHandlerRegistrar::RegisteredCompilerErrorHandler())
 {
   CompilerErrorHandlerRegistrar::RegisterScopedCompilerErrorHandler(handler);
 }
@@ -66,7 +76,8 @@ ScopedCompilerErrorHandlerRegister::ScopedCompilerErrorHandlerRegister(
 
 ScopedCompilerErrorHandlerRegister::~ScopedCompilerErrorHandlerRegister()
 {
-  CompilerErrorHandlerRegistrar::UnregisterScopedCompilerErrorHandler();
+  CompilerErrorHandlerRegistrar::RegisterScopedCompilerErrorHandler(
+      _previousHandler);
 }
 
 // -----------------------------------------------------------------------------
@@ -34,6 +34,8 @@ class CompilerErrorHandlerRegistrar
 public:
   static void RegisterScopedCompilerErrorHandler(CompilerErrorHandler);
 
+  static CompilerErrorHandler RegisteredCompilerErrorHandler();
+
   static void RegisterCompilerError(CompilerError&&);
 
   static void UnregisterScopedCompilerErrorHandler();
@@ -42,9 +44,16 @@ private:
   static CompilerErrorHandler _registeredHandler;
 };
 
+/**
+ * Registers a handler for the duration of a scope, and restores the one
+ * registered before it on exit, so that scopes can nest.
+ */
 struct ScopedCompilerErrorHandlerRegister
 {
   explicit ScopedCompilerErrorHandlerRegister(CompilerErrorHandler);
 
   ~ScopedCompilerErrorHandlerRegister();
+
+private:
+  CompilerErrorHandler _previousHandler;
 };
@@ -0,0 +1,259 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "ModuleCache.h"
+
+#include "ASTUtils.h"
+#include "CompilerErrorHandlerRegistrar.h"
+#include "ImportErrorCategory.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+// -----------------------------------------------------------------------------
+
+#define SNOWLAKE_MODULE_FILE_EXT ".sl"
+
+// -----------------------------------------------------------------------------
+
+struct ModuleCache::Entry
+{
+  ASTModule module;
+  // Set while the module and its own imports load, to detect cycles.
+  bool loading;
+  // Whether the module, and those it imports, parsed and analyzed cleanly.
+  bool valid;
+};
+
+// -----------------------------------------------------------------------------
+
+static uint64_t
+HashBytes(uint64_t hash, const std::string& bytes)
+{
+  // 64-bit FNV-1a.
+  for (const char c : bytes) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+// -----------------------------------------------------------------------------
+
+ModuleCache::ModuleCache()
+  : _opts()
+  , _entries()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+ModuleCache::ModuleCache(const Options& opts)
+  : _opts(opts)
+  , _entries()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+ModuleCache::~ModuleCache()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ModuleCache::resolveImports(ASTModule* module, const std::string& dirpath)
+{
+  bool res = true;
+
+  for (auto& import : module->imports()) {
+    const ASTModule* importedModule = load(import, dirpath);
+    if (!importedModule) {
+      res = false;
+      continue;
+    }
+    import.setFilepath(GetImportPath(import.name(), dirpath));
+    import.setModule(importedModule);
+  }
+
+  BindBaseInferenceGroups(module);
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+ModuleCache::size() const
+{
+  return _entries.size();
+}
+
+// -----------------------------------------------------------------------------
+
+/* static */
+std::string
+ModuleCache::GetImportPath(const std::string& name, const std::string& dirpath)
+{
+  std::string filepath(dirpath);
+  if (!filepath.empty() && filepath.back() != '/') {
+    filepath.push_back('/');
+  }
+  for (const char c : name) {
+    filepath.push_back(c == '.' ? '/' : c);
+  }
+  filepath.append(SNOWLAKE_MODULE_FILE_EXT);
+  return filepath;
+}
+
+// -----------------------------------------------------------------------------
+
+/* static */
+std::string
+ModuleCache::GetDirectoryOfPath(const std::string& filepath)
+{
+  const auto pos = filepath.find_last_of('/');
+  if (pos == std::string::npos) {
+    return std::string();
+  }
+  return pos == 0 ? std::string(1, '/') : filepath.substr(0, pos);
+}
+
+// -----------------------------------------------------------------------------
+
+const ASTModule*
+ModuleCache::load(const ASTImport& import, const std::string& dirpath)
+{
+  const std::string filepath = GetImportPath(import.name(), dirpath);
+
+  std::ifstream infile(filepath.c_str());
+  if (!infile.good()) {
+    char buf[1024] = {0};
+    snprintf(buf, sizeof(buf), "Failed to open imported module \"%s\" (%s).",
+             import.name().c_str(), filepath.c_str());
+    handleErrorWithMessageAndCode(buf, kImportModuleNotFoundError);
+    return nullptr;
+  }
+  const std::string input((std::istreambuf_iterator<char>(infile)),
+                          std::istreambuf_iterator<char>());
+  infile.close();
+
+  // The imports of the module resolve against its own directory.
+  const std::string moduleDirpath = GetDirectoryOfPath(filepath);
+
+  uint64_t key = 14695981039346656037ULL;
+  key = HashBytes(key, moduleDirpath);
+  key = HashBytes(key, std::string(1, '\0'));
+  key = HashBytes(key, input);
+
+  {
+    const auto itr = _entries.find(key);
+    if (itr != _entries.cend()) {
+      const Entry& entry = *itr->second;
+      if (entry.loading) {
+        char buf[1024] = {0};
+        snprintf(buf, sizeof(buf), "Cyclic import of module \"%s\" (%s).",
+                 import.name().c_str(), filepath.c_str());
+        handleErrorWithMessageAndCode(buf, kImportCyclicImportError);
+        return nullptr;
+      }
+      // The errors of an invalid module were reported when it was loaded.
+      return entry.valid ? &entry.module : nullptr;
+    }
+  }
+
+  auto& entry = _entries[key];
+  entry.reset(new Entry{ASTModule(), true, false});
+
+  // Report the errors of the imported module as such.
+  CompilerErrorHandler previousHandler =
+      CompilerErrorHandlerRegistrar::RegisteredCompilerErrorHandler();
+  ScopedCompilerErrorHandlerRegister scopedCompilerErrorHandlerRegister(
+      [&](CompilerError error) -> void {
+        if (previousHandler) {
+          previousHandler(CompilerError{
+              .type = error.type,
+              .code = error.code,
+              .msg = "In module imported from \"" + filepath + "\": " +
+                     error.msg,
+              .categoryName = error.categoryName,
+              .categoryMessage = error.categoryMessage});
+        }
+      });
+
+  ParserDriver parser(_opts.parserOpts);
+  parser.inputFile() = filepath;
+  bool res = parser.parseFromString(input.c_str()) == 0;
+  if (res) {
+    entry->module = std::move(parser.module());
+    res = resolveImports(&entry->module, moduleDirpath);
+  }
+  if (res) {
+    SemanticAnalyzer semaAnalyzer(_opts.semaOpts);
+    res = semaAnalyzer.run(entry->module);
+  }
+
+  entry->loading = false;
+  entry->valid = res;
+
+  return res ? &entry->module : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+/* static */
+void
+ModuleCache::BindBaseInferenceGroups(ASTModule* module)
+{
+  std::unordered_map<std::string, const ASTInferenceGroup*> importedGroups;
+  for (const auto* inferenceGroup :
+       ASTUtils::GetImportedInferenceGroups(*module)) {
+    importedGroups.emplace(inferenceGroup->name(), inferenceGroup);
+  }
+
+  // Bases that are not among the imported groups are left unbound, for
+  // semantic analysis to report.
+  for (auto& inferenceGroup : module->inferenceGroups()) {
+    if (inferenceGroup.baseName().empty()) {
+      continue;
+    }
+    const auto itr = importedGroups.find(inferenceGroup.baseName());
+    inferenceGroup.setBase(itr != importedGroups.cend() ? itr->second
+                                                        : nullptr);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+ModuleCache::handleErrorWithMessageAndCode(const char* msg,
+                                           CompilerError::Code code)
+{
+  CompilerErrorHandlerRegistrar::RegisterCompilerError(
+      ImportErrorCategory::CreateCompilerErrorWithTypeAndMessage(
+          CompilerError::Type::Error, code, msg));
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,96 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include "SemanticAnalyzer.h"
+#include "ast.h"
+#include "parser/ParserDriver.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Loads the modules imported by a module.
+ *
+ * Each imported module is read, parsed and analyzed once, however many
+ * modules import it, and kept for the lifetime of the cache. Modules are
+ * keyed by the hash of their content and of the directory their own imports
+ * are resolved against, so that a file imported under different names is
+ * loaded once, and that a change to a file loads it again.
+ */
+class ModuleCache
+{
+public:
+  struct Options
+  {
+    ParserDriver::Options parserOpts;
+    SemanticAnalyzer::Options semaOpts;
+  };
+
+  ModuleCache();
+
+  explicit ModuleCache(const Options&);
+
+  ~ModuleCache();
+
+  /**
+   * Load the modules imported by a module read from the given directory, and
+   * bind the bases of its inference groups to the imported groups they name.
+   * `import a.b;` refers to the file "a/b.sl" relative to that directory.
+   * Return true on success.
+   */
+  bool resolveImports(ASTModule*, const std::string& dirpath);
+
+  /**
+   * Number of modules loaded.
+   */
+  size_t size() const;
+
+  /**
+   * Path of the file referred to by an import, relative to a directory.
+   */
+  static std::string GetImportPath(const std::string& name,
+                                   const std::string& dirpath);
+
+  /**
+   * Directory of a file, against which the imports of the module it holds
+   * resolve.
+   */
+  static std::string GetDirectoryOfPath(const std::string& filepath);
+
+private:
+  struct Entry;
+
+  const ASTModule* load(const ASTImport&, const std::string& dirpath);
+
+  static void BindBaseInferenceGroups(ASTModule*);
+
+  void handleErrorWithMessageAndCode(const char*, CompilerError::Code);
+
+  Options _opts;
+  std::unordered_map<uint64_t, std::unique_ptr<Entry>> _entries;
+};
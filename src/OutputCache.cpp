@@ -0,0 +1,480 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "OutputCache.h"
+
+#include "parser/Scanner.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
+
+// -----------------------------------------------------------------------------
+
+#define OUTPUT_CACHE_SHARD_COUNT 16
+
+#define OUTPUT_CACHE_TMP_DIRNAME "tmp"
+
+#define OUTPUT_CACHE_KEY_FILENAME "key"
+
+#define OUTPUT_CACHE_MANIFEST_FILENAME "manifest"
+
+// Temporary directories left behind by processes that died while storing an
+// entry are removed once they are this many seconds old.
+#define OUTPUT_CACHE_STALE_TMP_DIR_AGE 3600
+
+// -----------------------------------------------------------------------------
+
+static uint64_t
+HashBytes(uint64_t hash, const std::string& bytes)
+{
+  // 64-bit FNV-1a.
+  for (const char c : bytes) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+// -----------------------------------------------------------------------------
+
+static bool
+readFile(const std::string& filepath, std::string* content)
+{
+  std::ifstream ifs(filepath);
+  if (!ifs.good()) {
+    return false;
+  }
+  content->assign(std::istreambuf_iterator<char>(ifs),
+                  std::istreambuf_iterator<char>());
+  return !ifs.bad();
+}
+
+// -----------------------------------------------------------------------------
+
+static bool
+writeFile(const std::string& filepath, const std::string& content)
+{
+  std::ofstream ofs(filepath, std::ofstream::out);
+  if (!ofs.good()) {
+    return false;
+  }
+  ofs << content;
+  ofs.close();
+  return ofs.good();
+}
+
+// -----------------------------------------------------------------------------
+
+static std::vector<std::string>
+listDir(const std::string& dirpath)
+{
+  std::vector<std::string> names;
+  DIR* dir = opendir(dirpath.c_str());
+  if (dir) {
+    while (const dirent* ent = readdir(dir)) {
+      if (strcmp(ent->d_name, ".") != 0 && strcmp(ent->d_name, "..") != 0) {
+        names.emplace_back(ent->d_name);
+      }
+    }
+    closedir(dir);
+  }
+  return names;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Removes a directory and the files in it. Entries hold no subdirectories.
+ */
+static void
+removeDir(const std::string& dirpath)
+{
+  for (const auto& name : listDir(dirpath)) {
+    unlink((dirpath + "/" + name).c_str());
+  }
+  rmdir(dirpath.c_str());
+}
+
+// -----------------------------------------------------------------------------
+
+static bool
+cloneOrCopyFile(const std::string& srcFilepath, const std::string& dstFilepath)
+{
+  const int srcFd = open(srcFilepath.c_str(), O_RDONLY);
+  if (srcFd < 0) {
+    return false;
+  }
+  const int dstFd =
+      open(dstFilepath.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
+  if (dstFd < 0) {
+    close(srcFd);
+    return false;
+  }
+
+  bool res = false;
+#ifdef FICLONE
+  // Share the blocks of the file on file systems that support it.
+  res = ioctl(dstFd, FICLONE, srcFd) == 0;
+#endif
+  if (!res) {
+    res = true;
+    char buf[65536];
+    while (res) {
+      const ssize_t n = read(srcFd, buf, sizeof(buf));
+      if (n == 0) {
+        break;
+      }
+      if (n < 0) {
+        res = errno == EINTR;
+        continue;
+      }
+      for (ssize_t offset = 0; res && offset < n;) {
+        const ssize_t written = write(dstFd, buf + offset, n - offset);
+        if (written < 0) {
+          res = errno == EINTR;
+        } else {
+          offset += written;
+        }
+      }
+    }
+  }
+
+  res = close(dstFd) == 0 && res;
+  close(srcFd);
+  if (!res) {
+    unlink(dstFilepath.c_str());
+  }
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+static bool
+linkOrCopyFile(const std::string& srcFilepath, const std::string& dstFilepath)
+{
+  // Hard links fail across file systems, such as between a local output path
+  // and a cache on a network file system.
+  return link(srcFilepath.c_str(), dstFilepath.c_str()) == 0 ||
+         cloneOrCopyFile(srcFilepath, dstFilepath);
+}
+
+// -----------------------------------------------------------------------------
+
+OutputCache::OutputCache(const Options& opts)
+  : _opts(opts)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+OutputCache::fetch(const std::string& key, const std::string& outputPath,
+                   std::vector<std::string>* outputFilepaths) const
+{
+  const std::string entryName = GetEntryName(key);
+  const std::string entryDirpath =
+      getShardDirpath(entryName) + "/" + entryName;
+
+  std::string storedKey;
+  if (!readFile(entryDirpath + "/" OUTPUT_CACHE_KEY_FILENAME, &storedKey) ||
+      storedKey != key) {
+    return false;
+  }
+  std::string manifest;
+  if (!readFile(entryDirpath + "/" OUTPUT_CACHE_MANIFEST_FILENAME,
+                &manifest)) {
+    return false;
+  }
+
+  // Each line of the manifest holds the hash of a file and its name.
+  std::vector<std::string> filenames;
+  for (size_t pos = 0, end = 0;
+       (end = manifest.find('\n', pos)) != std::string::npos; pos = end + 1) {
+    const std::string line = manifest.substr(pos, end - pos);
+    const auto sep = line.find(' ');
+    std::string content;
+    if (sep == std::string::npos ||
+        !readFile(entryDirpath + "/" + std::to_string(filenames.size()),
+                  &content)) {
+      return false;
+    }
+    // Outputs are hard links to the files of the entry, which writing to an
+    // output in place would modify.
+    if (line.compare(0, sep, GetEntryName(content)) != 0) {
+      removeEntry(entryDirpath);
+      return false;
+    }
+    filenames.push_back(line.substr(sep + 1));
+  }
+
+  std::string dirpath(outputPath);
+  if (!dirpath.empty() && dirpath.back() != '/') {
+    dirpath.push_back('/');
+  }
+
+  // A file is written under a temporary name and renamed over the output,
+  // so that the output is never seen partially written. Should the entry be
+  // evicted meanwhile, the files are synthesized as on a miss.
+  std::vector<std::string> filepaths;
+  for (const auto& filename : filenames) {
+    std::string filepath = dirpath + filename;
+    const std::string srcFilepath =
+        entryDirpath + "/" + std::to_string(filepaths.size());
+    // Renaming a link over the file it links to leaves both in place.
+    struct stat srcSt, dstSt;
+    if (stat(srcFilepath.c_str(), &srcSt) != 0 ||
+        stat(filepath.c_str(), &dstSt) != 0 || srcSt.st_dev != dstSt.st_dev ||
+        srcSt.st_ino != dstSt.st_ino) {
+      const std::string tmpFilepath = dirpath + "." + filename + "." +
+                                      std::to_string(getpid()) + ".tmp";
+      unlink(tmpFilepath.c_str());
+      if (!linkOrCopyFile(srcFilepath, tmpFilepath) ||
+          rename(tmpFilepath.c_str(), filepath.c_str()) != 0) {
+        unlink(tmpFilepath.c_str());
+        return false;
+      }
+    }
+    // A link keeps the time the entry was stored at, which may predate the
+    // inputs, so that build tools would consider the output out of date.
+    // The time of the manifest alone orders the entries for eviction.
+    if (utimensat(AT_FDCWD, filepath.c_str(), nullptr, 0) != 0) {
+      return false;
+    }
+    filepaths.push_back(std::move(filepath));
+  }
+
+  // Mark the entry as recently used.
+  utimensat(AT_FDCWD,
+            (entryDirpath + "/" OUTPUT_CACHE_MANIFEST_FILENAME).c_str(),
+            nullptr, 0);
+
+  outputFilepaths->insert(outputFilepaths->end(), filepaths.begin(),
+                          filepaths.end());
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+OutputCache::store(const std::string& key,
+                   const std::vector<std::string>& filepaths) const
+{
+  const std::string entryName = GetEntryName(key);
+  const std::string shardDirpath = getShardDirpath(entryName);
+  const std::string entryDirpath = shardDirpath + "/" + entryName;
+
+  // Directories created by other processes in the meantime are fine.
+  mkdir(_opts.dirpath.c_str(), 0777);
+  mkdir(shardDirpath.c_str(), 0777);
+  mkdir((_opts.dirpath + "/" OUTPUT_CACHE_TMP_DIRNAME).c_str(), 0777);
+
+  std::string tmpDirpath =
+      _opts.dirpath + "/" OUTPUT_CACHE_TMP_DIRNAME "/" + entryName + ".XXXXXX";
+  if (!mkdtemp(&tmpDirpath[0])) {
+    return false;
+  }
+  // Let the other users of the cache read the entry.
+  chmod(tmpDirpath.c_str(), 0755);
+
+  bool res = true;
+  std::string manifest;
+  for (size_t i = 0; res && i < filepaths.size(); ++i) {
+    const std::string filepath = tmpDirpath + "/" + std::to_string(i);
+    std::string content;
+    res = linkOrCopyFile(filepaths[i], filepath) && readFile(filepath, &content);
+    manifest.append(GetEntryName(content));
+    manifest.push_back(' ');
+    const auto pos = filepaths[i].find_last_of('/');
+    manifest.append(pos == std::string::npos ? filepaths[i]
+                                             : filepaths[i].substr(pos + 1));
+    manifest.push_back('\n');
+  }
+  res = res &&
+        writeFile(tmpDirpath + "/" OUTPUT_CACHE_KEY_FILENAME, key) &&
+        writeFile(tmpDirpath + "/" OUTPUT_CACHE_MANIFEST_FILENAME, manifest);
+
+  if (res && rename(tmpDirpath.c_str(), entryDirpath.c_str()) != 0) {
+    // Another process stored the entry first.
+    res = errno == EEXIST || errno == ENOTEMPTY;
+    removeDir(tmpDirpath);
+  } else if (!res) {
+    removeDir(tmpDirpath);
+  }
+
+  if (res) {
+    evict(shardDirpath);
+    removeStaleTemporaryDirs();
+  }
+
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+/* static */
+std::string
+OutputCache::GetEntryName(const std::string& key)
+{
+  char buf[32] = {0};
+  snprintf(buf, sizeof(buf), "%016llx",
+           static_cast<unsigned long long>(
+               HashBytes(14695981039346656037ULL, key)));
+  return buf;
+}
+
+// -----------------------------------------------------------------------------
+
+/* static */
+std::string
+OutputCache::NormalizeInput(const std::string& input)
+{
+  std::string normalizedInput;
+  Scanner scanner(input.data(), input.size());
+  Scanner::Token token;
+  for (scanner.scan(&token); token.kind != yy::Parser::token::END;
+       scanner.scan(&token)) {
+    if (!normalizedInput.empty()) {
+      normalizedInput.push_back(' ');
+    }
+    // Leading zeros do not change the value of a literal.
+    if (token.kind == yy::Parser::token::INTEGER_LITERAL) {
+      normalizedInput.append(std::to_string(token.value));
+    } else {
+      normalizedInput.append(token.text, token.length);
+    }
+  }
+  return normalizedInput;
+}
+
+// -----------------------------------------------------------------------------
+
+std::string
+OutputCache::getShardDirpath(const std::string& entryName) const
+{
+  return _opts.dirpath + "/" + entryName.front();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+OutputCache::evict(const std::string& shardDirpath) const
+{
+  struct EntryInfo
+  {
+    std::string dirpath;
+    struct timespec lastUsed;
+    uint64_t size;
+  };
+
+  std::vector<EntryInfo> entries;
+  uint64_t totalSize = 0;
+  for (const auto& name : listDir(shardDirpath)) {
+    EntryInfo entry{shardDirpath + "/" + name, {0, 0}, 0};
+    struct stat st;
+    // The entry may have just been evicted by another process.
+    if (stat((entry.dirpath + "/" OUTPUT_CACHE_MANIFEST_FILENAME).c_str(),
+             &st) != 0) {
+      continue;
+    }
+    entry.lastUsed = st.st_mtim;
+    for (const auto& filename : listDir(entry.dirpath)) {
+      if (stat((entry.dirpath + "/" + filename).c_str(), &st) == 0) {
+        entry.size += static_cast<uint64_t>(st.st_size);
+      }
+    }
+    totalSize += entry.size;
+    entries.push_back(std::move(entry));
+  }
+
+  const uint64_t maxShardSize = _opts.maxSize / OUTPUT_CACHE_SHARD_COUNT;
+  if (totalSize <= maxShardSize) {
+    return;
+  }
+
+  std::sort(entries.begin(), entries.end(),
+            [](const EntryInfo& lhs, const EntryInfo& rhs) -> bool {
+              if (lhs.lastUsed.tv_sec != rhs.lastUsed.tv_sec) {
+                return lhs.lastUsed.tv_sec < rhs.lastUsed.tv_sec;
+              }
+              return lhs.lastUsed.tv_nsec < rhs.lastUsed.tv_nsec;
+            });
+
+  for (const auto& entry : entries) {
+    if (totalSize <= maxShardSize) {
+      break;
+    }
+    if (removeEntry(entry.dirpath)) {
+      totalSize -= entry.size;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+OutputCache::removeEntry(const std::string& entryDirpath) const
+{
+  // Move the entry out of its shard before removing its files, so that other
+  // processes never find it partially removed.
+  std::string removedDirpath =
+      _opts.dirpath + "/" OUTPUT_CACHE_TMP_DIRNAME "/removed.XXXXXX";
+  if (!mkdtemp(&removedDirpath[0])) {
+    return false;
+  }
+  const bool res = rename(entryDirpath.c_str(), removedDirpath.c_str()) == 0;
+  removeDir(removedDirpath);
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+OutputCache::removeStaleTemporaryDirs() const
+{
+  const std::string tmpDirpath = _opts.dirpath + "/" OUTPUT_CACHE_TMP_DIRNAME;
+  const time_t now = time(nullptr);
+  for (const auto& name : listDir(tmpDirpath)) {
+    const std::string dirpath = tmpDirpath + "/" + name;
+    struct stat st;
+    if (stat(dirpath.c_str(), &st) == 0 &&
+        now - st.st_mtime > OUTPUT_CACHE_STALE_TMP_DIR_AGE) {
+      removeDir(dirpath);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,97 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Content-addressable store of synthesized files, in a directory shared by
+ * any number of processes, possibly on different hosts.
+ *
+ * Each entry holds the files synthesized for a key, and the key itself, so
+ * that entries whose keys only share a hash are told apart. Entries are
+ * written to a temporary directory and renamed into place, and are never
+ * modified afterwards, so that a process reading an entry sees either all of
+ * it or none of it. Files are fetched as hard links where possible, and an
+ * entry whose files no longer match the hashes recorded for them, having
+ * been written to through such a link, is removed.
+ *
+ * Entries are spread over 16 shards named after the first digit of their
+ * hash, each bounded to a 16th of the maximum size, and the least recently
+ * used entries of a shard are evicted when it grows beyond that.
+ */
+class OutputCache
+{
+public:
+  struct Options
+  {
+    std::string dirpath;
+    // In bytes.
+    uint64_t maxSize;
+  };
+
+  explicit OutputCache(const Options&);
+
+  /**
+   * Link, or copy, the files stored for a key into the output path, and
+   * append their paths to `outputFilepaths`. The files fetched are touched,
+   * so that they are newer than the inputs they were synthesized from.
+   * Return true on a hit.
+   */
+  bool fetch(const std::string& key, const std::string& outputPath,
+             std::vector<std::string>* outputFilepaths) const;
+
+  /**
+   * Store the given files for a key, then evict the least recently used
+   * entries of its shard beyond its size. Return true on success.
+   */
+  bool store(const std::string& key,
+             const std::vector<std::string>& filepaths) const;
+
+  /**
+   * Name of the entry holding the files of a key: the hexadecimal 64-bit
+   * FNV-1a hash of the key.
+   */
+  static std::string GetEntryName(const std::string& key);
+
+  /**
+   * Normalized form of the input of a module: the text of its tokens,
+   * separated by single spaces, so that whitespace and characters the
+   * scanner skips do not change it.
+   */
+  static std::string NormalizeInput(const std::string& input);
+
+private:
+  std::string getShardDirpath(const std::string& entryName) const;
+
+  void evict(const std::string& shardDirpath) const;
+
+  bool removeEntry(const std::string& entryDirpath) const;
+
+  void removeStaleTemporaryDirs() const;
+
+  Options _opts;
+};
@@ -23,18 +23,138 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "ProgramDriver.h"
 
+#include "ASTUtils.h"
 #include "CmdlDriver.h"
 #include "CompilerErrorHandlerRegistrar.h"
 #include "CompilerErrorPrinter.h"
+#include "ModuleCache.h"
+#include "OutputCache.h"
 #include "SemanticAnalyzer.h"
 #include "SynthesisErrorCategory.h"
 #include "Synthesizer.h"
 #include "ast_fwd.h"
 #include "parser/ParserDriver.h"
+#include "version.h"
 
 #include <algorithm>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Writes a path in a Makefile rule, escaping the characters Make and Ninja
+ * would otherwise interpret.
+ */
+static void
+renderDepfilePath(const std::string& path, std::ostream& ofs)
+{
+  for (const char c : path) {
+    if (c == ' ' || c == '#') {
+      ofs << '\\';
+    } else if (c == '$') {
+      ofs << '$';
+    }
+    ofs << c;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Writes a Makefile rule making every file written depend on every file
+ * read, followed by an empty rule for each imported file, so that deleting
+ * one does not break the build.
+ */
+static bool
+writeDepfile(const std::string& depfilePath,
+             const std::vector<std::string>& outputFilepaths,
+             const std::string& inputFilepath,
+             const std::vector<std::string>& importedFilepaths)
+{
+  std::ofstream ofs(depfilePath, std::ofstream::out);
+  if (!ofs.good()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < outputFilepaths.size(); ++i) {
+    if (i) {
+      ofs << ' ';
+    }
+    renderDepfilePath(outputFilepaths[i], ofs);
+  }
+  ofs << ':';
+  ofs << " \\\n  ";
+  renderDepfilePath(inputFilepath, ofs);
+  for (const auto& filepath : importedFilepaths) {
+    ofs << " \\\n  ";
+    renderDepfilePath(filepath, ofs);
+  }
+  ofs << '\n';
+
+  for (const auto& filepath : importedFilepaths) {
+    ofs << '\n';
+    renderDepfilePath(filepath, ofs);
+    ofs << ":\n";
+  }
+
+  ofs.close();
+  return ofs.good();
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Key of the files synthesized from a module in the output cache: the
+ * version of the compiler, the options the synthesized files depend on, and
+ * the normalized input of the module and of every module it imports.
+ */
+static bool
+getOutputCacheKey(const Synthesizer::Options& synthesisOpts,
+                  const ASTModule& module, std::string* key)
+{
+  char buf[1024] = {0};
+  snprintf(buf, sizeof(buf),
+           "%s %s\n"
+           "exception %d\n"
+           "no-annotation-comments %d\n"
+           "policy-template %d\n"
+           "cold-failure-paths %d\n"
+           "emit-instrumentation %d\n"
+           "light-headers %d\n"
+           "shards %u\n",
+           SNOWLAKE_PROG_NAME, SNOWLAKE_VERSION_STRING,
+           synthesisOpts.useException,
+           synthesisOpts.suppressAnnotationComments,
+           synthesisOpts.usePolicyTemplate, synthesisOpts.useColdFailurePaths,
+           synthesisOpts.emitInstrumentation, synthesisOpts.useLightHeaders,
+           std::max(synthesisOpts.shards, 1u));
+  key->assign(buf);
+
+  // The path of the input is part of the synthesized files.
+  std::vector<std::string> filepaths{synthesisOpts.inputFilepath};
+  for (auto& filepath : ASTUtils::GetImportedFilepaths(module)) {
+    filepaths.push_back(std::move(filepath));
+  }
+  for (const auto& filepath : filepaths) {
+    std::ifstream ifs(filepath);
+    if (!ifs.good()) {
+      return false;
+    }
+    const std::string input((std::istreambuf_iterator<char>(ifs)),
+                            std::istreambuf_iterator<char>());
+    key->append(filepath);
+    key->push_back('\n');
+    key->append(OutputCache::NormalizeInput(input));
+    key->push_back('\n');
+  }
+
+  return true;
+}
 
 // -----------------------------------------------------------------------------
 
@@ -79,7 +199,10 @@ ProgramDriver::run(int argc, char** argv)
   // Parsing.
   ParserDriver::Options parserOpts{.traceLexer = cmdlOpts.debugMode,
                                    .traceParser = cmdlOpts.debugMode,
-                                   .suppressErrorMessages = false};
+                                   .suppressErrorMessages = false,
+                                   .useSimdScanner = cmdlOpts.useSimdScanner,
+                                   .useRecursiveDescentParser =
+                                       cmdlOpts.useRecursiveDescentParser};
 
   ParserDriver parser(parserOpts);
   res = parser.parseFromFile(cmdlOpts.inputPath);
@@ -87,13 +210,25 @@ ProgramDriver::run(int argc, char** argv)
     return EXIT_FAILURE;
   }
 
-  const auto& module = parser.module();
+  auto& module = parser.module();
 
-  // Semantic analysis.
   SemanticAnalyzer::Options semaOpts{
       .bailOnFirstError = cmdlOpts.bailOnFirstError,
       .warningsAsErrors = cmdlOpts.warningsAsErrors,
       .verbose = cmdlOpts.debugMode};
+
+  // Imports.
+  // Imported modules are only analyzed: their groups are synthesized along
+  // with the modules that declare them.
+  ModuleCache moduleCache(
+      ModuleCache::Options{.parserOpts = parserOpts, .semaOpts = semaOpts});
+  res = moduleCache.resolveImports(
+      &module, ModuleCache::GetDirectoryOfPath(cmdlOpts.inputPath));
+  if (!res) {
+    return EXIT_FAILURE;
+  }
+
+  // Semantic analysis.
   SemanticAnalyzer semaAnalyzer(semaOpts);
   res = semaAnalyzer.run(module);
   if (!res) {
@@ -104,16 +239,68 @@ ProgramDriver::run(int argc, char** argv)
   Synthesizer::Options synthesisOpts{.useException = false,
                                      .suppressAnnotationComments =
                                          cmdlOpts.suppressAnnotationComments,
+                                     .usePolicyTemplate =
+                                         cmdlOpts.usePolicyTemplate,
+                                     .useColdFailurePaths =
+                                         cmdlOpts.useColdFailurePaths,
+                                     .emitInstrumentation =
+                                         cmdlOpts.emitInstrumentation,
+                                     .useLightHeaders =
+                                         cmdlOpts.useLightHeaders,
+                                     .shards = cmdlOpts.shards,
                                      .inputFilepath = cmdlOpts.inputPath,
                                      .outputPath = cmdlOpts.outputPath};
-  Synthesizer synthesizer(synthesisOpts);
-  res = synthesizer.run(module);
-  if (!res) {
-    if (!cmdlOpts.silent) {
-      fprintf(stderr, "Error: Failed to synthesize output to: %s\n",
-              cmdlOpts.outputPath.c_str());
+  std::vector<std::string> outputFilepaths;
+
+  // Output cache.
+  // Failing to use the cache only costs the time it would have saved.
+  const OutputCache outputCache(OutputCache::Options{
+      .dirpath = cmdlOpts.cacheDirpath,
+      .maxSize = cmdlOpts.cacheMaxSize * 1024 * 1024});
+  std::string outputCacheKey;
+  const bool useOutputCache =
+      !cmdlOpts.cacheDirpath.empty() &&
+      getOutputCacheKey(synthesisOpts, module, &outputCacheKey);
+  const bool outputCacheHit =
+      useOutputCache && outputCache.fetch(outputCacheKey, cmdlOpts.outputPath,
+                                          &outputFilepaths);
+  if (useOutputCache && cmdlOpts.verbose && !cmdlOpts.silent) {
+    std::cout << "Output cache:" << std::endl;
+    std::cout << (outputCacheHit ? "hit " : "miss ")
+              << OutputCache::GetEntryName(outputCacheKey) << std::endl;
+    std::cout << std::endl;
+  }
+
+  if (!outputCacheHit) {
+    Synthesizer synthesizer(synthesisOpts);
+    res = synthesizer.run(module, &outputFilepaths);
+    if (!res) {
+      if (!cmdlOpts.silent) {
+        fprintf(stderr, "Error: Failed to synthesize output to: %s\n",
+                cmdlOpts.outputPath.c_str());
+      }
+      return EXIT_FAILURE;
+    }
+
+    if (useOutputCache && !outputCache.store(outputCacheKey, outputFilepaths) &&
+        !cmdlOpts.silent) {
+      fprintf(stderr, "Warning: Failed to store output in cache: %s\n",
+              cmdlOpts.cacheDirpath.c_str());
+    }
+  }
+
+  // Depfile.
+  if (cmdlOpts.emitDepfile) {
+    res = writeDepfile(cmdlOpts.depfilePath, outputFilepaths,
+                       cmdlOpts.inputPath,
+                       ASTUtils::GetImportedFilepaths(module));
+    if (!res) {
+      if (!cmdlOpts.silent) {
+        fprintf(stderr, "Error: Failed to write depfile to: %s\n",
+                cmdlOpts.depfilePath.c_str());
+      }
+      return EXIT_FAILURE;
     }
-    return EXIT_FAILURE;
   }
 
   // SUCCESS.
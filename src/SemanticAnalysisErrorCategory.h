@@ -59,6 +59,20 @@ struct SemanticAnalysisErrorCategory
         return "incompatible target type";
       case kSemanticAnalysisUnknownPremiseDefnError:
         return "unknown premise definition";
+      case kSemanticAnalysisDuplicateDispatchKeyError:
+        return "duplicate dispatch key";
+      case kSemanticAnalysisIncompatibleDispatchInferenceDefnError:
+        return "incompatible inference definition in dispatch";
+      case kSemanticAnalysisIncompatibleTryAllInferenceDefnError:
+        return "incompatible inference definition in try-all method";
+      case kSemanticAnalysisUnsupportedTypeRuntimeError:
+        return "unsupported type runtime";
+      case kSemanticAnalysisProofCacheWithoutTypeRuntimeError:
+        return "proof cache without type runtime";
+      case kSemanticAnalysisIncompatibleBaseInferenceGroupError:
+        return "incompatible base inference group";
+      case kSemanticAnalysisSubtypeComparisonWithoutSubtypeOracleError:
+        return "subtype comparison without subtype oracle";
       default:
         assert(0 && "Unrecognized error code");
         return "unrecognized error code";
@@ -37,4 +37,11 @@ enum SemanticAnalysisErrorCodes : uint32_t
   kSemanticAnalysisUnknownSymbolError,
   kSemanticAnalysisIncompatibleTargetTypeError,
   kSemanticAnalysisUnknownPremiseDefnError,
+  kSemanticAnalysisDuplicateDispatchKeyError,
+  kSemanticAnalysisIncompatibleDispatchInferenceDefnError,
+  kSemanticAnalysisIncompatibleTryAllInferenceDefnError,
+  kSemanticAnalysisUnsupportedTypeRuntimeError,
+  kSemanticAnalysisProofCacheWithoutTypeRuntimeError,
+  kSemanticAnalysisIncompatibleBaseInferenceGroupError,
+  kSemanticAnalysisSubtypeComparisonWithoutSubtypeOracleError,
 };
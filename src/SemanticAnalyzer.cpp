@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "format_defn.h"
 
 #include <array>
+#include <cstring>
 
 // -----------------------------------------------------------------------------
 
@@ -111,15 +112,47 @@ SemanticAnalyzer::run(const ASTModule& module)
 
 // -----------------------------------------------------------------------------
 
+bool
+SemanticAnalyzer::runOnModule(const ASTModule& module)
+{
+  return previsit(module);
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SemanticAnalyzer::runOnInferenceGroup(const ASTInferenceGroup& inferenceGroup)
+{
+  return previsit(inferenceGroup);
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SemanticAnalyzer::runOnInferenceDefn(const ASTInferenceDefn& inferenceDefn)
+{
+  return previsit(inferenceDefn);
+}
+
+// -----------------------------------------------------------------------------
+
 /* override */
 bool
 SemanticAnalyzer::previsit(const ASTModule& module)
 {
   INIT_RES;
 
-  std::unordered_set<std::string> nameSet;
+  // Imported groups share the namespace of those of the module, since
+  // groups can derive from them by name.
+  std::vector<const ASTInferenceGroup*> inferenceGroups =
+      ASTUtils::GetImportedInferenceGroups(module);
   for (const auto& inferenceGroup : module.inferenceGroups()) {
-    const auto& name = inferenceGroup.name();
+    inferenceGroups.push_back(&inferenceGroup);
+  }
+
+  std::unordered_set<std::string> nameSet;
+  for (const auto* inferenceGroup : inferenceGroups) {
+    const auto& name = inferenceGroup->name();
     if (nameSet.count(name)) {
       ON_ERROR(kSemanticAnalysisDuplicateInferenceGroupIdentifierError,
                "Found multiple inference group with name \"%s\".",
@@ -151,11 +184,53 @@ SemanticAnalyzer::previsit(const ASTInferenceGroup& inferenceGroup)
       } else {
         nameSet.insert(field);
       }
+
+      if (field == SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME &&
+          environmentDefn.value() !=
+              SNOWLAKE_ENVN_DEFN_VALUE_FOR_SNOWLAKE_TYPE_RUNTIME) {
+        ON_ERROR(kSemanticAnalysisUnsupportedTypeRuntimeError,
+                 "Unsupported type runtime \"%s\".",
+                 environmentDefn.value().c_str());
+      }
     }
 
     if (!checkRequiredEnvDefns(nameSet)) {
       return false;
     }
+
+    // Cached proof results are packed with the 32-bit handles of the
+    // Snowlake runtime.
+    if (nameSet.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_PROOF_CACHE) &&
+        !nameSet.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME)) {
+      ON_ERROR(kSemanticAnalysisProofCacheWithoutTypeRuntimeError,
+               "Environment field \"%s\" requires field \"%s\".",
+               SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_PROOF_CACHE,
+               SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME);
+    }
+
+    // Handles of the Snowlake runtime only compare for equality, so subtype
+    // comparisons need an oracle to answer them.
+    if (nameSet.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME) &&
+        !nameSet.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_SUBTYPE_ORACLE) &&
+        ASTUtils::HasSubtypeComparison(inferenceGroup)) {
+      ON_ERROR(kSemanticAnalysisSubtypeComparisonWithoutSubtypeOracleError,
+               "Subtype comparisons with environment field \"%s\" require "
+               "field \"%s\".",
+               SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME,
+               SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_SUBTYPE_ORACLE);
+    }
+
+    if (!inferenceGroup.baseName().empty()) {
+      RETURN_ON_FAILURE(checkBaseInferenceGroup(inferenceGroup));
+    }
+
+    if (!inferenceGroup.dispatchEntries().empty()) {
+      RETURN_ON_FAILURE(checkDispatchEntries(inferenceGroup, nameSet));
+    }
+
+    if (nameSet.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TRY_ALL_METHOD)) {
+      RETURN_ON_FAILURE(checkTryAllInferenceDefns(inferenceGroup));
+    }
   }
 
   // Inference definitions.
@@ -252,7 +327,16 @@ SemanticAnalyzer::checkRequiredEnvDefns(const SymbolSet& envDefns)
       SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CMP_METHOD,
   };
 
+  // The Snowlake runtime supplies the type class and its comparison.
+  const bool hasTypeRuntime =
+      envDefns.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME) > 0;
+
   for (auto defn : mandatoryEnvDefns) {
+    if (hasTypeRuntime &&
+        (strcmp(defn, SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CLASS) == 0 ||
+         strcmp(defn, SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CMP_METHOD) == 0)) {
+      continue;
+    }
     if (envDefns.count(defn) == 0) {
       ON_ERROR(kSemanticAnalysisMissingRequiredEnvironmentDefnFieldError,
                "Missing required environment definition field \"%s\".", defn);
@@ -264,6 +348,164 @@ SemanticAnalyzer::checkRequiredEnvDefns(const SymbolSet& envDefns)
 
 // -----------------------------------------------------------------------------
 
+bool
+SemanticAnalyzer::checkDispatchEntries(const ASTInferenceGroup& inferenceGroup,
+                                       const SymbolSet& envDefns)
+{
+  INIT_RES;
+
+  if (envDefns.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DISPATCH_KEY_CLASS) == 0) {
+    ON_ERROR(kSemanticAnalysisMissingRequiredEnvironmentDefnFieldError,
+             "Missing required environment definition field \"%s\".",
+             SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DISPATCH_KEY_CLASS);
+  }
+
+  // Dispatch reaches the inference definitions of the bases as well, unless
+  // the group redefines them.
+  std::unordered_map<std::string, const ASTInferenceDefn*> inferenceDefns;
+  for (const ASTInferenceGroup* group = &inferenceGroup; group;
+       group = group->base()) {
+    for (const auto& inferenceDefn : group->inferenceDefns()) {
+      inferenceDefns.emplace(inferenceDefn.name(), &inferenceDefn);
+    }
+  }
+
+  // All inference definitions reachable from the dispatch method need to
+  // take the same arguments, since they are invoked with the same ones.
+  const ASTInferenceDefn* firstInferenceDefn = nullptr;
+
+  std::unordered_set<std::string> keySet;
+  for (const auto& dispatchEntry : inferenceGroup.dispatchEntries()) {
+    const auto& key = dispatchEntry.key();
+    if (keySet.count(key)) {
+      ON_ERROR(kSemanticAnalysisDuplicateDispatchKeyError,
+               "Found repeated dispatch key \"%s\".", key.c_str());
+    } else {
+      keySet.insert(key);
+    }
+
+    for (const auto& name : dispatchEntry.inferenceNames()) {
+      const auto itr = inferenceDefns.find(name);
+      if (itr == inferenceDefns.cend()) {
+        ON_ERROR(kSemanticAnalysisUnknownSymbolError,
+                 "Unknown inference \"%s\" used in dispatch key \"%s\".",
+                 name.c_str(), key.c_str());
+        continue;
+      }
+
+      const ASTInferenceDefn* inferenceDefn = itr->second;
+      if (!firstInferenceDefn) {
+        firstInferenceDefn = inferenceDefn;
+        continue;
+      }
+
+      if (!ASTUtils::HaveSameArgumentTypes(*firstInferenceDefn,
+                                           *inferenceDefn)) {
+        ON_ERROR(kSemanticAnalysisIncompatibleDispatchInferenceDefnError,
+                 "Arguments of inference \"%s\" do not match with those of "
+                 "inference \"%s\" in dispatch.",
+                 name.c_str(), firstInferenceDefn->name().c_str());
+      }
+    }
+  }
+
+  DEFAULT_RETURN;
+}
+
+// -----------------------------------------------------------------------------
+
+static const std::string*
+GetEnvironmentDefnValue(const ASTInferenceGroup& inferenceGroup,
+                        const char* field)
+{
+  for (const auto& environmentDefn : inferenceGroup.environmentDefns()) {
+    if (environmentDefn.field() == field) {
+      return &environmentDefn.value();
+    }
+  }
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SemanticAnalyzer::checkBaseInferenceGroup(
+    const ASTInferenceGroup& inferenceGroup)
+{
+  INIT_RES;
+
+  const ASTInferenceGroup* base = inferenceGroup.base();
+  if (!base) {
+    ON_ERROR(kSemanticAnalysisUnknownSymbolError,
+             "Unknown base inference group \"%s\".",
+             inferenceGroup.baseName().c_str());
+    DEFAULT_RETURN;
+  }
+
+  // The class synthesized for the group derives from that of its base, and
+  // dispatches to the inherited inference methods, which prove types of the
+  // same class, in the same context.
+  static const std::array<const char*, 3> sharedEnvDefns = {
+      SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CLASS,
+      SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME,
+      SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_CONTEXT_CLASS,
+  };
+
+  for (auto field : sharedEnvDefns) {
+    const std::string* value = GetEnvironmentDefnValue(inferenceGroup, field);
+    const std::string* baseValue = GetEnvironmentDefnValue(*base, field);
+    if ((value == nullptr) != (baseValue == nullptr) ||
+        (value && *value != *baseValue)) {
+      ON_ERROR(kSemanticAnalysisIncompatibleBaseInferenceGroupError,
+               "Environment field \"%s\" of inference group \"%s\" does not "
+               "match with that of base inference group \"%s\".",
+               field, inferenceGroup.name().c_str(), base->name().c_str());
+    }
+  }
+
+  const std::string* clsName = GetEnvironmentDefnValue(
+      inferenceGroup, SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_CLASS);
+  const std::string* baseClsName =
+      GetEnvironmentDefnValue(*base, SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_CLASS);
+  if (clsName && baseClsName && *clsName == *baseClsName) {
+    ON_ERROR(kSemanticAnalysisIncompatibleBaseInferenceGroupError,
+             "Inference group \"%s\" has the same class name \"%s\" as its "
+             "base inference group \"%s\".",
+             inferenceGroup.name().c_str(), clsName->c_str(),
+             base->name().c_str());
+  }
+
+  DEFAULT_RETURN;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SemanticAnalyzer::checkTryAllInferenceDefns(
+    const ASTInferenceGroup& inferenceGroup)
+{
+  INIT_RES;
+
+  // The try-all method passes its own arguments to every inference
+  // definition in the group, and shares the premises they have in common,
+  // so the arguments need to match by name as well as by type.
+  const auto& inferenceDefns = inferenceGroup.inferenceDefns();
+  for (size_t i = 1; i < inferenceDefns.size(); ++i) {
+    if (!ASTUtils::HaveSameArguments(inferenceDefns.front(),
+                                     inferenceDefns[i])) {
+      ON_ERROR(kSemanticAnalysisIncompatibleTryAllInferenceDefnError,
+               "Arguments of inference \"%s\" do not match with those of "
+               "inference \"%s\" in try-all method.",
+               inferenceDefns[i].name().c_str(),
+               inferenceDefns.front().name().c_str());
+    }
+  }
+
+  DEFAULT_RETURN;
+}
+
+// -----------------------------------------------------------------------------
+
 template <>
 bool
 SemanticAnalyzer::recursivePremiseDefnCheck(const ASTInferencePremiseDefn& defn,
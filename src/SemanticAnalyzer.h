@@ -52,6 +52,15 @@ public:
 
   bool run(const ASTModule&);
 
+  /**
+   * Run the checks of a module, of an inference group or of an inference
+   * definition on their own, without those of the nodes they contain, to
+   * reanalyze only the parts of a module that have changed.
+   */
+  bool runOnModule(const ASTModule&);
+  bool runOnInferenceGroup(const ASTInferenceGroup&);
+  bool runOnInferenceDefn(const ASTInferenceDefn&);
+
   const Options& options() const;
 
 private:
@@ -61,6 +70,12 @@ private:
 
   bool checkRequiredEnvDefns(const SymbolSet&);
 
+  bool checkBaseInferenceGroup(const ASTInferenceGroup&);
+
+  bool checkDispatchEntries(const ASTInferenceGroup&, const SymbolSet&);
+
+  bool checkTryAllInferenceDefns(const ASTInferenceGroup&);
+
   bool recursivePremiseDefnCheck(const ASTPremiseDefn&,
                                  InferenceDefnContextRef);
 
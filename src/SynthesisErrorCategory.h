@@ -41,6 +41,8 @@ struct SynthesisErrorCategory
     switch (code) {
       case kSynthesisInvalidOutputError:
         return "invalid output";
+      case kSynthesisUnsupportedBaseInferenceGroupError:
+        return "unsupported base inference group";
       default:
         assert(0 && "Unrecognized error code");
         return "unrecognized error code";
@@ -27,5 +27,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 enum SynthesisErrorCodes : uint32_t
 {
-  kSynthesisInvalidOutputError = 8
+  kSynthesisInvalidOutputError = 8,
+  kSynthesisUnsupportedBaseInferenceGroupError
 };
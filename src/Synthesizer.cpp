@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "Synthesizer.h"
 
+#include "ASTUtils.h"
 #include "ASTVisitor.h"
 #include "CompilerErrorHandlerRegistrar.h"
 #include "SynthesisErrorCategory.h"
@@ -31,10 +32,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "format_defn.h"
 #include "macros.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdio>
 #include <fstream>
 #include <limits>
+#include <sstream>
 #include <unordered_map>
 #include <vector>
 
@@ -53,13 +56,43 @@ __getIncrementalInt()
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Opens an output file, replacing rather than overwriting an existing file,
+ * which may be a hard link into the output cache.
+ */
+static void
+openOutputFile(const std::string& filepath, std::ofstream* ofs)
+{
+  remove(filepath.c_str());
+  ofs->open(filepath, std::ofstream::out);
+}
+
+// -----------------------------------------------------------------------------
+
 typedef std::unordered_map<std::string, std::string> EnvDefnMap;
 
+typedef std::unordered_map<std::string, IntegerType> FixedCapacityArrayTable;
+
+typedef std::unordered_map<std::string, std::string> ArgumentTypeTable;
+
+typedef std::unordered_map<std::string, size_t> ProofCachePathTable;
+
+typedef std::unordered_map<std::string, uint32_t> RuleIdTable;
+
 // -----------------------------------------------------------------------------
 
 struct InferenceDefinitionSynthesisContext
 {
   uint32_t numPremisesProcessed;
+  uint32_t numPremisesVisited;
+  uint32_t ruleId;
+  uint32_t whileClauseDepth;
+  std::string siteName;
+  std::string failureHandlerName;
+  bool failureHandlerUsed;
+  SymbolSet globals;
+  FixedCapacityArrayTable fixedCapacityArrays;
+  ArgumentTypeTable argumentTypes;
 
   InferenceDefinitionSynthesisContext();
 
@@ -72,12 +105,29 @@ struct InferenceGroupSynthesisContext
 {
   std::string clsName;
   std::string typeCls;
+  std::string typeArrayCls;
+  std::string contextCls;
+  bool hasFixedCapacityArrays;
   EnvDefnMap envDefnMap;
   std::ofstream headerFileOfs;
-  std::ofstream cppFileOfs;
+  // Only open with light headers.
+  std::ofstream detailHeaderFileOfs;
+  // One per shard.
+  std::vector<std::ofstream> cppFileOfsList;
+  // Definitions of the .cpp files, in order, distributed across the shards
+  // once the group is synthesized.
+  std::vector<std::string> cppDefns;
+  std::stringstream defnOfs;
   size_t headerFileIndentLvl;
-  size_t cppFileIndentLvl;
+  size_t defnIndentLvl;
   uint32_t nameId;
+  std::string failureLabel;
+  bool failureLabelUsed;
+  // While-clauses being synthesized whose annotations are torn down by
+  // method calls, innermost last.
+  std::vector<const ASTInferencePremiseDefn*> pendingTeardowns;
+  ProofCachePathTable proofCachePaths;
+  RuleIdTable ruleIds;
   InferenceDefinitionSynthesisContext currentInferenceDefnContext;
 
   InferenceGroupSynthesisContext();
@@ -86,6 +136,24 @@ struct InferenceGroupSynthesisContext
 
 // -----------------------------------------------------------------------------
 
+/**
+ * Node of the decision tree that merges the inference definitions of a group
+ * by the premises they have in common, so that each shared premise is only
+ * evaluated once. An inner node holds a run of premises shared by every
+ * inference definition below it, taken from the first of them. A leaf holds
+ * the inference definition whose proposition is returned.
+ */
+struct DecisionTreeNode
+{
+  const ASTInferenceDefn* inferenceDefn;
+  size_t premiseBegin;
+  size_t premiseEnd;
+  bool isLeaf;
+  std::vector<DecisionTreeNode> children;
+};
+
+// -----------------------------------------------------------------------------
+
 template <typename T>
 struct ScopedIndentationGuard
 {
@@ -111,7 +179,8 @@ private:
 class SynthesizerImpl : public ASTVisitor
 {
 public:
-  SynthesizerImpl(const Synthesizer::Options&);
+  SynthesizerImpl(const Synthesizer::Options&,
+                  std::vector<std::string>* outputFilepaths);
 
   bool run(const ASTModule&);
 
@@ -133,12 +202,14 @@ private:
 
   std::string getClassNameFromEnvDefn(const EnvDefnMap&);
 
+  std::string getTypeArrayClassFromEnvDefn(const EnvDefnMap&);
+
   enum class DeductionTargetArraySynthesisMode : uint32_t
   {
     AS_SINGULAR = 0x01,
     AS_ARRAY = 0x02,
     AS_RAW_POINTER_ARRAY = 0x04,
-    AS_STD_VECTOR = 0x08,
+    AS_DECLARATION = 0x08,
   };
 
   void
@@ -147,6 +218,100 @@ private:
   void synthesizeInferencePremiseDefnWithoutWhileClause(
       const ASTInferencePremiseDefn&);
 
+  bool isProofCacheable(const ASTInferencePremiseDefn&) const;
+
+  void synthesizeCachedProof(const ASTInferencePremiseDefn&);
+
+  size_t getProofCachePathId(const ASTIdentifiable&);
+
+  void synthesizeProofCachePathCount();
+
+  void synthesizeCppFiles();
+
+  void synthesizeDescribeFailureMethod(const ASTInferenceGroup&);
+
+  void synthesizeRuleCounters(const ASTInferenceGroup&);
+
+  void synthesizeDumpInstrumentationMethod(const ASTInferenceGroup&);
+
+  void synthesizeRuleInstrumentation();
+
+  void synthesizePremiseInstrumentation();
+
+  void collectPremiseDescriptions(const ASTPremiseDefnList&,
+                                  std::vector<std::string>*);
+
+  void renderStringLiteral(const std::string&, std::ostream&);
+
+  bool isArgumentRooted(const ASTIdentifiable&) const;
+
+  bool hasResetSiteParameter() const;
+
+  void renderResetSiteParameter(bool isDeclaration, std::ostream&);
+
+  void synthesizeDependencySiteReset(bool onRequest);
+
+  bool isDispatchedWithoutSiteReset(const ASTInferenceGroup&,
+                                    const std::string& inferenceDefnName);
+
+  void synthesizeDependencyRecord(const ASTIdentifiable&);
+
+  void synthesizeInlineMethodDefinitionOpening(const ASTInferenceDefn&);
+
+  void synthesizeBatchMethod(const ASTInferenceDefn&);
+
+  void synthesizeBatchMethodParameters(const ASTInferenceDefn&, std::ostream&);
+
+  void synthesizeBatchMethodBody(const ASTInferenceDefn&, size_t indentLvl,
+                                 std::ostream&);
+
+  void synthesizeFailureHandler();
+
+  void synthesizeDispatchMethod(const ASTInferenceGroup&);
+
+  void synthesizeTryAllMethod(const ASTInferenceGroup&);
+
+  void buildDecisionTree(const ASTInferenceGroup&, DecisionTreeNode*);
+
+  void insertIntoDecisionTree(const ASTInferenceDefn&, size_t premiseOffset,
+                              DecisionTreeNode*);
+
+  void synthesizeDecisionTreeNode(const DecisionTreeNode&);
+
+  void synthesizeGroupMethodOpening(const std::string& methodName,
+                                    const std::string* keyCls,
+                                    const ASTInferenceArgumentList&,
+                                    const char* annotationSource);
+
+  void synthesizeGroupMethodClosing();
+
+  void synthesizeGroupMethodSignature(const std::string& methodName,
+                                      const std::string* keyCls,
+                                      const ASTInferenceArgumentList&,
+                                      bool isDeclaration, std::ostream&);
+
+  void synthesizeDispatchCall(const std::string& inferenceDefnName,
+                              const ASTInferenceArgumentList&,
+                              const char* errorArgument, bool keepSite);
+
+  void synthesizeBatchedRangeComparison(const ASTInferenceEqualityDefn&,
+                                        const std::string&,
+                                        const IntegerType* tripCount);
+
+  void synthesizeUnrolledRangeComparison(const ASTInferenceEqualityDefn&,
+                                         const IntegerType tripCount);
+
+  void initializeInferenceDefnContext(const ASTInferenceDefn&);
+
+  void collectFixedCapacityArrays(const ASTPremiseDefnList&,
+                                  FixedCapacityArrayTable*);
+
+  bool getStaticRangeTripCount(const ASTInferenceEqualityDefn&,
+                               IntegerType* tripCount) const;
+
+  void renderRangeClauseSize(const ASTRangeClause&, const IntegerType*,
+                             std::ostream&);
+
   void synthesizeArgumentList(const ASTInferenceArgumentList&, std::ostream&);
 
   void synthesizeDeductionTarget(const ASTDeductionTarget&,
@@ -160,16 +325,30 @@ private:
 
   void synthesizeEqualityOperator(const EqualityOperator, std::ostream&);
 
+  void synthesizeFailedTypeComparison(const ASTInferenceEqualityDefn&,
+                                      const std::string& lhsIdx,
+                                      const std::string& rhsIdx);
+
   void renderIndentation(const size_t, std::ostream&);
 
   void renderIndentationInHeaderFile();
 
-  void renderIndentationInCppFile();
+  void renderIndentationInDefn();
+
+  void renderPolicyQualifier(std::ostream&);
+
+  void renderContextParameter(bool hasMoreParameters, std::ostream&);
+
+  void renderPolicyQualifiedName(const std::string&, std::ostream&);
 
   void renderCustomInclude(const char*, std::ostream&);
 
   void renderSystemHeaderIncludes(std::ostream&);
 
+  void renderRuntimeHeaderIncludes(std::ostream&);
+
+  void renderLightHeaderIncludes(std::ostream&);
+
   template <typename Iterator>
   void __renderSystemHeaderIncludes(Iterator first, Iterator last,
                                     std::ostream&);
@@ -188,13 +367,35 @@ private:
       const std::string& inferenceDefnName, std::ostream&,
       bool isHeaderFile = false);
 
+  void renderGroupMethodAnnotationComment(const char* annotationSource,
+                                          std::ostream&,
+                                          bool isHeaderFile = false);
+
   void renderInferencePremiseAnnotationComment();
 
-  void renderErrorHandling();
+  void renderDecisionTreeLeafAnnotationComment(
+      const std::string& inferenceDefnName);
+
+  void renderAnnotationScopeSetup(const ASTInferencePremiseDefn&,
+                                  const std::string& annotationStackName,
+                                  const std::string& scopeName);
+
+  bool useColdFailurePath() const;
+
+  bool useLightHeaders() const;
 
-  void indentCppFile();
+  void renderFailureConditionOpening();
 
-  void dedentCppFile();
+  void renderFailureConditionClosing();
+
+  void renderErrorHandling(const char* errorCode, const std::string& lhsIdx,
+                           const std::string& rhsIdx);
+
+  void renderErrorCodeAssignmentAndReturn(const char* errorCode);
+
+  void indentDefn();
+
+  void dedentDefn();
 
   bool initializeAndSynthesizeErrorCodeFiles();
 
@@ -202,8 +403,13 @@ private:
 
   std::string __getNextVarName();
 
+  std::string __getNextLabelName();
+
+  std::string __getNextScopeName();
+
 private:
   const Synthesizer::Options& _opts;
+  std::vector<std::string>* _outputFilepaths;
   InferenceGroupSynthesisContext _context;
 };
 
@@ -226,7 +432,16 @@ Synthesizer::Synthesizer(const Options& opts)
 bool
 Synthesizer::run(const ASTModule& module) const
 {
-  SynthesizerImpl impl(_opts);
+  return run(module, nullptr);
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+Synthesizer::run(const ASTModule& module,
+                 std::vector<std::string>* outputFilepaths) const
+{
+  SynthesizerImpl impl(_opts, outputFilepaths);
   return impl.run(module);
 }
 
@@ -234,6 +449,15 @@ Synthesizer::run(const ASTModule& module) const
 
 InferenceDefinitionSynthesisContext::InferenceDefinitionSynthesisContext()
   : numPremisesProcessed(0)
+  , numPremisesVisited(0)
+  , ruleId(0)
+  , whileClauseDepth(0)
+  , siteName()
+  , failureHandlerName()
+  , failureHandlerUsed(false)
+  , globals()
+  , fixedCapacityArrays()
+  , argumentTypes()
 {
 }
 
@@ -243,6 +467,15 @@ void
 InferenceDefinitionSynthesisContext::reset()
 {
   numPremisesProcessed = 0;
+  numPremisesVisited = 0;
+  ruleId = 0;
+  whileClauseDepth = 0;
+  siteName.clear();
+  failureHandlerName.clear();
+  failureHandlerUsed = false;
+  globals.clear();
+  fixedCapacityArrays.clear();
+  argumentTypes.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -250,12 +483,23 @@ InferenceDefinitionSynthesisContext::reset()
 InferenceGroupSynthesisContext::InferenceGroupSynthesisContext()
   : clsName()
   , typeCls()
+  , typeArrayCls()
+  , contextCls()
+  , hasFixedCapacityArrays(false)
   , envDefnMap()
   , headerFileOfs()
-  , cppFileOfs()
+  , detailHeaderFileOfs()
+  , cppFileOfsList()
+  , cppDefns()
+  , defnOfs()
   , headerFileIndentLvl(0)
-  , cppFileIndentLvl(0)
+  , defnIndentLvl(0)
   , nameId(0)
+  , failureLabel()
+  , failureLabelUsed(false)
+  , pendingTeardowns()
+  , proofCachePaths()
+  , ruleIds()
   , currentInferenceDefnContext()
 {
 }
@@ -265,13 +509,18 @@ InferenceGroupSynthesisContext::InferenceGroupSynthesisContext()
 InferenceGroupSynthesisContext::~InferenceGroupSynthesisContext()
 {
   headerFileOfs.close();
-  cppFileOfs.close();
+  detailHeaderFileOfs.close();
+  for (auto& cppFileOfs : cppFileOfsList) {
+    cppFileOfs.close();
+  }
 }
 
 // -----------------------------------------------------------------------------
 
-SynthesizerImpl::SynthesizerImpl(const Synthesizer::Options& opts)
+SynthesizerImpl::SynthesizerImpl(const Synthesizer::Options& opts,
+                                 std::vector<std::string>* outputFilepaths)
   : _opts(opts)
+  , _outputFilepaths(outputFilepaths)
   , _context()
 {
 }
@@ -300,6 +549,20 @@ SynthesizerImpl::previsit(const ASTInferenceGroup& inferenceGroup)
   const auto typeCls =
       envDefnMap.at(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CLASS);
 
+  // The class of a group with a base derives from that of the base, which
+  // is synthesized along with the module that declares it.
+  std::string baseClsName;
+  if (const ASTInferenceGroup* base = inferenceGroup.base()) {
+    if (_opts.usePolicyTemplate) {
+      handleErrorWithMessageAndCode(
+          "Policy templates do not support base inference groups",
+          kSynthesisUnsupportedBaseInferenceGroupError);
+      return false;
+    }
+    baseClsName =
+        getClassNameFromEnvDefn(getEnvnDefnMapFromInferenceGroup(*base));
+  }
+
   // Create header file.
   std::string headerFilepath(_opts.outputPath);
   if (!headerFilepath.empty() && headerFilepath.back() != FORWARD_SLASH) {
@@ -308,31 +571,94 @@ SynthesizerImpl::previsit(const ASTInferenceGroup& inferenceGroup)
   headerFilepath.append(clsName);
   headerFilepath.append(HEADER_FILE_EXT);
 
-  _context.headerFileOfs.open(headerFilepath, std::ofstream::out);
+  openOutputFile(headerFilepath, &_context.headerFileOfs);
   if (!_context.headerFileOfs.good()) {
     handleErrorWithMessageAndCode("Failed to create output .h file",
                                   kSynthesisInvalidOutputError);
     return false;
   }
+  if (_outputFilepaths) {
+    _outputFilepaths->push_back(std::move(headerFilepath));
+  }
 
-  // Create .cpp file.
-  std::string cppFilepath(_opts.outputPath);
-  if (!cppFilepath.empty() && cppFilepath.back() != FORWARD_SLASH) {
-    cppFilepath.push_back(FORWARD_SLASH);
+  // Create implementation-detail header file, which holds what the header
+  // file leaves out with light headers.
+  if (useLightHeaders()) {
+    std::string detailHeaderFilepath(_opts.outputPath);
+    if (!detailHeaderFilepath.empty() &&
+        detailHeaderFilepath.back() != FORWARD_SLASH) {
+      detailHeaderFilepath.push_back(FORWARD_SLASH);
+    }
+    detailHeaderFilepath.append(clsName);
+    detailHeaderFilepath.append(DETAIL_HEADER_FILENAME_SUFFIX);
+    detailHeaderFilepath.append(HEADER_FILE_EXT);
+
+    openOutputFile(detailHeaderFilepath, &_context.detailHeaderFileOfs);
+    if (!_context.detailHeaderFileOfs.good()) {
+      handleErrorWithMessageAndCode("Failed to create output detail .h file",
+                                    kSynthesisInvalidOutputError);
+      return false;
+    }
+    if (_outputFilepaths) {
+      _outputFilepaths->push_back(std::move(detailHeaderFilepath));
+    }
   }
-  cppFilepath.append(clsName);
-  cppFilepath.append(CPP_FILE_EXT);
 
-  _context.cppFileOfs.open(cppFilepath, std::ofstream::out);
-  if (!_context.cppFileOfs.good()) {
-    handleErrorWithMessageAndCode("Failed to create output .cpp file",
-                                  kSynthesisInvalidOutputError);
-    return false;
+  // Create .cpp files, one per shard, suffixed with its index when there are
+  // several.
+  // Policy templates are header-only, so there is no .cpp file to create.
+  _context.cppFileOfsList.clear();
+  _context.cppDefns.clear();
+  if (!_opts.usePolicyTemplate) {
+    const uint32_t shards = std::max(_opts.shards, 1u);
+    for (uint32_t i = 0; i < shards; ++i) {
+      std::string cppFilepath(_opts.outputPath);
+      if (!cppFilepath.empty() && cppFilepath.back() != FORWARD_SLASH) {
+        cppFilepath.push_back(FORWARD_SLASH);
+      }
+      cppFilepath.append(clsName);
+      if (shards > 1) {
+        cppFilepath.push_back('_');
+        cppFilepath.append(std::to_string(i));
+      }
+      cppFilepath.append(CPP_FILE_EXT);
+
+      _context.cppFileOfsList.emplace_back();
+      openOutputFile(cppFilepath, &_context.cppFileOfsList.back());
+      if (!_context.cppFileOfsList.back().good()) {
+        handleErrorWithMessageAndCode("Failed to create output .cpp file",
+                                      kSynthesisInvalidOutputError);
+        return false;
+      }
+      if (_outputFilepaths) {
+        _outputFilepaths->push_back(std::move(cppFilepath));
+      }
+    }
   }
 
   _context.clsName = std::move(clsName);
   _context.typeCls = std::move(typeCls);
+  _context.typeArrayCls = getTypeArrayClassFromEnvDefn(envDefnMap);
+  {
+    const auto itr =
+        envDefnMap.find(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_CONTEXT_CLASS);
+    _context.contextCls =
+        itr != envDefnMap.cend() ? itr->second : std::string();
+  }
+  _context.hasFixedCapacityArrays =
+      ASTUtils::HasArrayTargetDeclarationWithSizeLiteral(inferenceGroup);
   _context.envDefnMap = std::move(envDefnMap);
+  _context.proofCachePaths.clear();
+
+  // Failure records identify inference definitions by their position in
+  // the group.
+  _context.ruleIds.clear();
+  {
+    const auto& inferenceDefns = inferenceGroup.inferenceDefns();
+    for (uint32_t i = 0; i < inferenceDefns.size(); ++i) {
+      _context.ruleIds.emplace(inferenceDefns[i].name(), i);
+    }
+  }
 
   // Write to header file.
   {
@@ -344,11 +670,30 @@ SynthesizerImpl::previsit(const ASTInferenceGroup& inferenceGroup)
     headerFileOfsRef << CPP_NEWLINE;
     headerFileOfsRef << CPP_PRAGMA_ONCE << CPP_NEWLINE;
     headerFileOfsRef << CPP_NEWLINE;
-    renderSystemHeaderIncludes(_context.headerFileOfs);
-    headerFileOfsRef << CPP_NEWLINE;
+    if (useLightHeaders()) {
+      renderLightHeaderIncludes(headerFileOfsRef);
+    } else {
+      renderSystemHeaderIncludes(headerFileOfsRef);
+      headerFileOfsRef << CPP_NEWLINE;
+      renderRuntimeHeaderIncludes(headerFileOfsRef);
+    }
+    if (!baseClsName.empty()) {
+      renderCustomInclude(baseClsName.c_str(), _context.headerFileOfs);
+      headerFileOfsRef << CPP_NEWLINE;
+    }
     renderClassAnnotationComment(headerFileOfsRef);
+    if (_opts.usePolicyTemplate) {
+      headerFileOfsRef << CPP_TEMPLATE_KEYWORD << CPP_SPACE << '<'
+                       << CPP_TYPENAME_KEYWORD << CPP_SPACE
+                       << SYNTHESIZED_POLICY_TEMPLATE_PARAMETER_NAME << '>';
+      headerFileOfsRef << CPP_NEWLINE;
+    }
     headerFileOfsRef << CPP_CLASS_KEYWORD << ' ';
     headerFileOfsRef << _context.clsName;
+    if (!baseClsName.empty()) {
+      headerFileOfsRef << CPP_SPACE << CPP_COLON << CPP_SPACE
+                       << CPP_PUBLIC_KEYWORD << CPP_SPACE << baseClsName;
+    }
     headerFileOfsRef << CPP_NEWLINE;
     headerFileOfsRef << CPP_OPEN_BRACE;
     headerFileOfsRef << CPP_NEWLINE;
@@ -356,17 +701,39 @@ SynthesizerImpl::previsit(const ASTInferenceGroup& inferenceGroup)
     headerFileOfsRef << CPP_NEWLINE;
   }
 
-  // Write to .cpp file.
-  {
-    auto& cppFileOfsRef = _context.cppFileOfs;
+  // Write to implementation-detail header file.
+  if (useLightHeaders()) {
+    auto& detailHeaderFileOfsRef = _context.detailHeaderFileOfs;
+    detailHeaderFileOfsRef << SYNTHESIZED_AUTHORING_COMMENT_BLOCK;
+    detailHeaderFileOfsRef << CPP_NEWLINE;
+    detailHeaderFileOfsRef << CPP_NEWLINE;
+    renderInputSourceAnnotationComment(detailHeaderFileOfsRef);
+    detailHeaderFileOfsRef << CPP_NEWLINE;
+    detailHeaderFileOfsRef << CPP_PRAGMA_ONCE << CPP_NEWLINE;
+    detailHeaderFileOfsRef << CPP_NEWLINE;
+    renderCustomInclude(_context.clsName.c_str(), detailHeaderFileOfsRef);
+    detailHeaderFileOfsRef << CPP_NEWLINE;
+    renderSystemHeaderIncludes(detailHeaderFileOfsRef);
+    detailHeaderFileOfsRef << CPP_NEWLINE;
+    renderRuntimeHeaderIncludes(detailHeaderFileOfsRef);
+  }
+
+  // Write to .cpp files.
+  for (auto& cppFileOfsRef : _context.cppFileOfsList) {
     cppFileOfsRef << SYNTHESIZED_AUTHORING_COMMENT_BLOCK;
     cppFileOfsRef << CPP_NEWLINE;
     cppFileOfsRef << CPP_NEWLINE;
     renderInputSourceAnnotationComment(cppFileOfsRef);
     cppFileOfsRef << CPP_NEWLINE;
-    renderCustomInclude(_context.clsName.c_str(), _context.cppFileOfs);
+    if (useLightHeaders()) {
+      renderCustomInclude(
+          (_context.clsName + DETAIL_HEADER_FILENAME_SUFFIX).c_str(),
+          cppFileOfsRef);
+    } else {
+      renderCustomInclude(_context.clsName.c_str(), cppFileOfsRef);
+    }
     renderCustomInclude(SYNTHESIZED_ERROR_CODE_HEADER_FILENAME_BASE,
-                        _context.cppFileOfs);
+                        cppFileOfsRef);
   }
 
   return true;
@@ -376,8 +743,31 @@ SynthesizerImpl::previsit(const ASTInferenceGroup& inferenceGroup)
 
 /* virtual */
 bool
-SynthesizerImpl::postvisit(const ASTInferenceGroup&)
+SynthesizerImpl::postvisit(const ASTInferenceGroup& inferenceGroup)
 {
+  if (!inferenceGroup.dispatchEntries().empty()) {
+    synthesizeDispatchMethod(inferenceGroup);
+  }
+
+  if (_context.envDefnMap.count(
+          SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TRY_ALL_METHOD)) {
+    synthesizeTryAllMethod(inferenceGroup);
+  }
+
+  if (_context.envDefnMap.count(
+          SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_FAILURE_RECORD)) {
+    synthesizeDescribeFailureMethod(inferenceGroup);
+  }
+
+  if (_opts.emitInstrumentation) {
+    synthesizeRuleCounters(inferenceGroup);
+    synthesizeDumpInstrumentationMethod(inferenceGroup);
+  }
+
+  if (_context.envDefnMap.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_PROOF_CACHE)) {
+    synthesizeProofCachePathCount();
+  }
+
   // Write closing };
   {
     auto& headerFileOfs = _context.headerFileOfs;
@@ -386,16 +776,17 @@ SynthesizerImpl::postvisit(const ASTInferenceGroup&)
     headerFileOfs << CPP_NEWLINE;
   }
 
-  // Close and release header file stream.
+  // Close and release header file streams.
   if (_context.headerFileOfs.good()) {
     _context.headerFileOfs.close();
   }
-
-  // Close and release .cpp file stream.
-  if (_context.cppFileOfs.good()) {
-    _context.cppFileOfs.close();
+  if (_context.detailHeaderFileOfs.is_open()) {
+    _context.detailHeaderFileOfs.close();
   }
 
+  // Write and release .cpp file streams.
+  synthesizeCppFiles();
+
   return true;
 }
 
@@ -405,6 +796,15 @@ SynthesizerImpl::postvisit(const ASTInferenceGroup&)
 bool
 SynthesizerImpl::previsit(const ASTInferenceDefn& inferenceDefn)
 {
+  initializeInferenceDefnContext(inferenceDefn);
+
+  if (_opts.usePolicyTemplate) {
+    synthesizeInlineMethodDefinitionOpening(inferenceDefn);
+    synthesizeRuleInstrumentation();
+    synthesizeDependencySiteReset(true /** onRequest */);
+    return true;
+  }
+
   // Synthesize member function declaration.
   {
     ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
@@ -413,14 +813,22 @@ SynthesizerImpl::previsit(const ASTInferenceDefn& inferenceDefn)
     renderInferenceDefinitionMethodAnnotationComment(
         inferenceDefn.name(), headerFileOfs, true /** isHeaderFile */);
     renderIndentationInHeaderFile();
+    // Methods keep no state of their own when given a context.
+    if (!_context.contextCls.empty()) {
+      headerFileOfs << CPP_STATIC_KEYWORD << CPP_SPACE;
+    }
     headerFileOfs << _context.typeCls << CPP_SPACE;
     headerFileOfs << inferenceDefn.name();
     headerFileOfs << CPP_OPEN_PAREN;
+    renderContextParameter(!inferenceDefn.arguments().empty() ||
+                               !_opts.useException,
+                           headerFileOfs);
     synthesizeArgumentList(inferenceDefn.arguments(), _context.headerFileOfs);
     if (!_opts.useException) {
       headerFileOfs << CPP_COMA << CPP_SPACE;
       headerFileOfs << CPP_STD_ERROR_CODE << CPP_STAR;
     }
+    renderResetSiteParameter(true /** isDeclaration */, headerFileOfs);
     headerFileOfs << CPP_CLOSE_PAREN;
     headerFileOfs << CPP_SEMICOLON;
     headerFileOfs << CPP_NEWLINE;
@@ -429,30 +837,36 @@ SynthesizerImpl::previsit(const ASTInferenceDefn& inferenceDefn)
 
   // Synthesize member function definition.
   {
-    auto& cppFileOfs = _context.cppFileOfs;
-    cppFileOfs << CPP_NEWLINE;
+    auto& defnOfs = _context.defnOfs;
+    defnOfs << CPP_NEWLINE;
     renderInferenceDefinitionMethodAnnotationComment(inferenceDefn.name(),
-                                                     cppFileOfs);
-    cppFileOfs << _context.typeCls << CPP_NEWLINE;
-    cppFileOfs << _context.clsName;
-    cppFileOfs << CPP_COLON << CPP_COLON;
-    cppFileOfs << inferenceDefn.name();
-    cppFileOfs << CPP_OPEN_PAREN;
-    synthesizeArgumentList(inferenceDefn.arguments(), _context.cppFileOfs);
+                                                     defnOfs);
+    defnOfs << _context.typeCls << CPP_NEWLINE;
+    defnOfs << _context.clsName;
+    defnOfs << CPP_COLON << CPP_COLON;
+    defnOfs << inferenceDefn.name();
+    defnOfs << CPP_OPEN_PAREN;
+    renderContextParameter(!inferenceDefn.arguments().empty() ||
+                               !_opts.useException,
+                           defnOfs);
+    synthesizeArgumentList(inferenceDefn.arguments(), _context.defnOfs);
     if (!_opts.useException) {
-      cppFileOfs << CPP_COMA << CPP_SPACE;
-      cppFileOfs << CPP_STD_ERROR_CODE << CPP_STAR;
-      cppFileOfs << CPP_SPACE
-                 << SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME;
+      defnOfs << CPP_COMA << CPP_SPACE;
+      defnOfs << CPP_STD_ERROR_CODE << CPP_STAR;
+      defnOfs << CPP_SPACE << SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME;
     }
-    cppFileOfs << CPP_CLOSE_PAREN;
-    cppFileOfs << CPP_NEWLINE;
-    cppFileOfs << CPP_OPEN_BRACE;
-    cppFileOfs << CPP_NEWLINE;
+    renderResetSiteParameter(false /** isDeclaration */, defnOfs);
+    defnOfs << CPP_CLOSE_PAREN;
+    defnOfs << CPP_NEWLINE;
+    defnOfs << CPP_OPEN_BRACE;
+    defnOfs << CPP_NEWLINE;
 
-    indentCppFile();
+    indentDefn();
   }
 
+  synthesizeRuleInstrumentation();
+  synthesizeDependencySiteReset(true /** onRequest */);
+
   return true;
 }
 
@@ -460,13 +874,35 @@ SynthesizerImpl::previsit(const ASTInferenceDefn& inferenceDefn)
 
 /* virtual */
 bool
-SynthesizerImpl::postvisit(const ASTInferenceDefn&)
+SynthesizerImpl::postvisit(const ASTInferenceDefn& inferenceDefn)
 {
-  dedentCppFile();
+  dedentDefn();
+
+  auto& defnOfs = _context.defnOfs;
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE;
+  defnOfs << CPP_NEWLINE;
+
+  if (_context.currentInferenceDefnContext.failureHandlerUsed) {
+    synthesizeFailureHandler();
+  }
+
+  // Flush the synthesized method definition to its destination.
+  // Policy templates define their methods inline in the class template.
+  if (_opts.usePolicyTemplate) {
+    defnOfs << CPP_NEWLINE;
+    _context.headerFileOfs << defnOfs.str();
+    dedentDefn();
+  } else {
+    _context.cppDefns.push_back(defnOfs.str());
+  }
+  defnOfs.str(std::string());
 
-  auto& cppFileOfs = _context.cppFileOfs;
-  cppFileOfs << CPP_CLOSE_BRACE;
-  cppFileOfs << CPP_NEWLINE;
+  // Batches report an error per call site, so they need error codes.
+  if (!_context.contextCls.empty() && !_opts.useException &&
+      inferenceDefn.arguments().size() == 1) {
+    synthesizeBatchMethod(inferenceDefn);
+  }
 
   _context.currentInferenceDefnContext.reset();
 
@@ -481,8 +917,12 @@ SynthesizerImpl::previsit(const ASTInferencePremiseDefn& premiseDefn)
 {
   const bool hasWhileClause = premiseDefn.hasWhileClause();
 
+  ++_context.currentInferenceDefnContext.numPremisesVisited;
+
   renderInferencePremiseAnnotationComment();
 
+  synthesizePremiseInstrumentation();
+
   if (hasWhileClause) {
     synthesizeInferencePremiseDefnWithWhileClause(premiseDefn);
   } else {
@@ -508,100 +948,108 @@ SynthesizerImpl::postvisit(const ASTInferencePremiseDefn& premiseDefn)
 bool
 SynthesizerImpl::previsit(const ASTInferenceEqualityDefn& premiseDefn)
 {
-  const auto& typeCmpMethodName =
-      _context.envDefnMap.at(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CMP_METHOD);
-
   const bool hasRangeClause = premiseDefn.hasRangeClause();
 
+  ++_context.currentInferenceDefnContext.numPremisesVisited;
+
+  synthesizePremiseInstrumentation();
+
+  // Trip count of the range clause, if statically known from the
+  // size literals of the array targets involved.
+  IntegerType staticTripCount = 0;
+  const IntegerType* tripCount = nullptr;
+
+  if (hasRangeClause) {
+    if (getStaticRangeTripCount(premiseDefn, &staticTripCount)) {
+      tripCount = &staticTripCount;
+      if (staticTripCount <= SYNTHESIZER_RANGE_CLAUSE_UNROLL_THRESHOLD) {
+        synthesizeUnrolledRangeComparison(premiseDefn, staticTripCount);
+        return true;
+      }
+    }
+
+    const auto itr = _context.envDefnMap.find(
+        SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RANGE_CMP_METHOD);
+    if (itr != _context.envDefnMap.cend()) {
+      synthesizeBatchedRangeComparison(premiseDefn, itr->second, tripCount);
+      return true;
+    }
+  }
+
   static const char var1 = 'i';
   static const char var2 = 'j';
 
-  auto& cppFileOfs = _context.cppFileOfs;
+  auto& defnOfs = _context.defnOfs;
 
   if (hasRangeClause) {
     const auto& rangeClause = premiseDefn.rangeClause();
 
-    renderIndentationInCppFile();
+    renderIndentationInDefn();
 
-    cppFileOfs << CPP_FOR_KEYWORD << CPP_SPACE << CPP_OPEN_PAREN;
+    defnOfs << CPP_FOR_KEYWORD << CPP_SPACE << CPP_OPEN_PAREN;
 
     // For-loop initializers.
     {
-      cppFileOfs << CPP_SIZE_T << CPP_SPACE << var1 << CPP_SPACE << CPP_ASSIGN
+      defnOfs << CPP_SIZE_T << CPP_SPACE << var1 << CPP_SPACE << CPP_ASSIGN
                  << CPP_SPACE << rangeClause.lhsIdx();
-      cppFileOfs << CPP_COMA << CPP_SPACE;
-      cppFileOfs << CPP_SIZE_T << CPP_SPACE << var2 << CPP_SPACE << CPP_ASSIGN
-                 << CPP_SPACE << rangeClause.rhsIdx();
-      cppFileOfs << CPP_SEMICOLON << CPP_SPACE;
+      defnOfs << CPP_COMA << CPP_SPACE;
+      defnOfs << var2 << CPP_SPACE << CPP_ASSIGN << CPP_SPACE
+                 << rangeClause.rhsIdx();
+      defnOfs << CPP_SEMICOLON << CPP_SPACE;
     }
 
     // For-loop termination predicates.
     {
-      cppFileOfs << var1 << CPP_SPACE << CPP_LESS_THAN << CPP_SPACE;
-      synthesizeDeductionTarget(rangeClause.deductionTarget(),
-                                DeductionTargetArraySynthesisMode::AS_SINGULAR,
-                                _context.cppFileOfs);
-      cppFileOfs << CPP_DOT_SIZE << CPP_SEMICOLON << CPP_SPACE;
+      defnOfs << var1 << CPP_SPACE << CPP_LESS_THAN << CPP_SPACE;
+      renderRangeClauseSize(rangeClause, tripCount, _context.defnOfs);
+      defnOfs << CPP_SEMICOLON << CPP_SPACE;
     }
 
     // For-loop increments.
     {
-      cppFileOfs << CPP_INCREMENT_OPERATOR << var1;
-      cppFileOfs << CPP_COMA << CPP_SPACE;
-      cppFileOfs << CPP_INCREMENT_OPERATOR << var2;
+      defnOfs << CPP_INCREMENT_OPERATOR << var1;
+      defnOfs << CPP_COMA << CPP_SPACE;
+      defnOfs << CPP_INCREMENT_OPERATOR << var2;
     }
 
-    cppFileOfs << CPP_CLOSE_PAREN << CPP_SPACE << CPP_OPEN_BRACE;
-    cppFileOfs << CPP_NEWLINE;
+    defnOfs << CPP_CLOSE_PAREN << CPP_SPACE << CPP_OPEN_BRACE;
+    defnOfs << CPP_NEWLINE;
   }
 
   // Synthesize premise body.
   {
     if (hasRangeClause) {
-      indentCppFile();
+      indentDefn();
     }
 
-    renderIndentationInCppFile();
-    cppFileOfs << CPP_IF << CPP_SPACE << CPP_OPEN_PAREN;
-    cppFileOfs << CPP_NEGATION;
-    cppFileOfs << typeCmpMethodName << CPP_OPEN_PAREN;
-    synthesizeDeductionTarget(premiseDefn.lhs(),
-                              DeductionTargetArraySynthesisMode::AS_SINGULAR,
-                              _context.cppFileOfs);
-    if (hasRangeClause) {
-      _context.cppFileOfs << CPP_OPEN_BRACKET << var1 << CPP_CLOSE_BRACKET;
-    }
-    cppFileOfs << CPP_COMA << CPP_SPACE;
-    synthesizeDeductionTarget(premiseDefn.rhs(),
-                              DeductionTargetArraySynthesisMode::AS_SINGULAR,
-                              _context.cppFileOfs);
-    if (hasRangeClause) {
-      _context.cppFileOfs << CPP_OPEN_BRACKET << var2 << CPP_CLOSE_BRACKET;
-    }
-    cppFileOfs << CPP_COMA << CPP_SPACE;
-    synthesizeEqualityOperator(premiseDefn.oprt(), _context.cppFileOfs);
-    cppFileOfs << CPP_CLOSE_PAREN;
-    cppFileOfs << CPP_CLOSE_PAREN << CPP_SPACE << CPP_OPEN_BRACE;
-    cppFileOfs << CPP_NEWLINE;
+    renderIndentationInDefn();
+    renderFailureConditionOpening();
+    synthesizeFailedTypeComparison(
+        premiseDefn, hasRangeClause ? std::string(1, var1) : std::string(),
+        hasRangeClause ? std::string(1, var2) : std::string());
+    renderFailureConditionClosing();
 
     // Body of if statement
     {
-      ScopedIndentationGuard scopedIndentation(_context.cppFileIndentLvl);
-      renderErrorHandling();
+      ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+      renderErrorHandling(
+          SYNTHESIZED_ERROR_CODE_TYPE_COMPARISON_FAILED,
+          hasRangeClause ? std::string(1, var1) : std::string(),
+          hasRangeClause ? std::string(1, var2) : std::string());
     }
 
-    renderIndentationInCppFile();
-    cppFileOfs << CPP_CLOSE_BRACE;
-    cppFileOfs << CPP_NEWLINE;
+    renderIndentationInDefn();
+    defnOfs << CPP_CLOSE_BRACE;
+    defnOfs << CPP_NEWLINE;
 
     if (hasRangeClause) {
-      dedentCppFile();
+      dedentDefn();
     }
   }
 
   if (hasRangeClause) {
-    renderIndentationInCppFile();
-    cppFileOfs << CPP_CLOSE_BRACE << CPP_NEWLINE << CPP_NEWLINE;
+    renderIndentationInDefn();
+    defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE << CPP_NEWLINE;
   }
 
   return true;
@@ -619,6 +1067,15 @@ SynthesizerImpl::getEnvnDefnMapFromInferenceGroup(
     envDefnMap[envnDefn.field()] = envnDefn.value();
   }
 
+  // The Snowlake runtime supplies the type class and its comparison,
+  // unless specified otherwise.
+  if (envDefnMap.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME)) {
+    envDefnMap.emplace(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CLASS,
+                       SYNTHESIZED_RUNTIME_TYPE_CLASS_NAME);
+    envDefnMap.emplace(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CMP_METHOD,
+                       SYNTHESIZED_RUNTIME_TYPE_CMP_METHOD_NAME);
+  }
+
   return envDefnMap;
 }
 
@@ -639,59 +1096,102 @@ SynthesizerImpl::getClassNameFromEnvDefn(const EnvDefnMap& envDefnMap)
 
 // -----------------------------------------------------------------------------
 
+std::string
+SynthesizerImpl::getTypeArrayClassFromEnvDefn(const EnvDefnMap& envDefnMap)
+{
+  const auto itr =
+      envDefnMap.find(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ARRAY_CLASS);
+  if (itr == envDefnMap.cend()) {
+    return std::string();
+  }
+  return itr->second;
+}
+
+// -----------------------------------------------------------------------------
+
 void
 SynthesizerImpl::synthesizeInferencePremiseDefnWithWhileClause(
     const ASTInferencePremiseDefn& premiseDefn)
 {
   SYNTHESIZER_ASSERT(premiseDefn.hasWhileClause());
 
-  auto& cppFileOfs = _context.cppFileOfs;
+  auto& defnOfs = _context.defnOfs;
+
+  // With an annotation stack, the annotation is scoped by a guard that
+  // also rolls it back when a failed premise leaves the method early.
+  const auto annotationStackItr = _context.envDefnMap.find(
+      SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ANNOTATION_STACK);
+  const bool useAnnotationStack =
+      annotationStackItr != _context.envDefnMap.cend();
+  const auto scopeName =
+      useAnnotationStack ? __getNextScopeName() : std::string();
 
   // Type annotation setup fixture.
   {
-    cppFileOfs << CPP_NEWLINE;
-
-    const auto& typeAnnotationSetupMethod = _context.envDefnMap.at(
-        SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ANNOTATION_SETUP_METHOD);
+    defnOfs << CPP_NEWLINE;
 
     // Synthesize type annotation setup comment.
-    renderIndentationInCppFile();
-    cppFileOfs << SYNTHESIZED_TYPE_ANNOTATION_SETUP_COMMENT << CPP_NEWLINE;
+    renderIndentationInDefn();
+    defnOfs << SYNTHESIZED_TYPE_ANNOTATION_SETUP_COMMENT << CPP_NEWLINE;
+
+    synthesizeDependencyRecord(premiseDefn.source());
 
     // Synthesize type annotation setup code.
-    renderTypeAnnotationSetupTeardownFixture(
-        premiseDefn, typeAnnotationSetupMethod, _context.cppFileOfs);
+    if (useAnnotationStack) {
+      renderAnnotationScopeSetup(premiseDefn, annotationStackItr->second,
+                                 scopeName);
+    } else {
+      const auto& typeAnnotationSetupMethod = _context.envDefnMap.at(
+          SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ANNOTATION_SETUP_METHOD);
+      renderTypeAnnotationSetupTeardownFixture(
+          premiseDefn, typeAnnotationSetupMethod, _context.defnOfs);
+    }
 
-    cppFileOfs << CPP_NEWLINE;
+    defnOfs << CPP_NEWLINE;
   }
 
   // Synthesize body of while-clause.
   {
     const auto& whileClause = premiseDefn.whileClause();
 
+    ++_context.currentInferenceDefnContext.whileClauseDepth;
+    if (!useAnnotationStack) {
+      _context.pendingTeardowns.push_back(&premiseDefn);
+    }
     for (const auto& defn : whileClause.premiseDefns()) {
       // FIXME: This const_cast here is not ideal.
       // Also because we have to make the `visit` members in `ASTVisitor`
       // protected instead of private.
       (const_cast<SynthesizerImpl*>(this))->visit(defn);
     }
+    if (!useAnnotationStack) {
+      _context.pendingTeardowns.pop_back();
+    }
+    --_context.currentInferenceDefnContext.whileClauseDepth;
   }
 
   // Type annotation teardown fixture.
   {
-    const auto& typeAnnotationTeardownMethod = _context.envDefnMap.at(
-        SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ANNOTATION_TEARDOWN_METHOD);
-
     // Synthesize type annotation teardown comment.
-    renderIndentationInCppFile();
-    cppFileOfs << SYNTHESIZED_TYPE_ANNOTATION_TEARDOWN_COMMENT << CPP_NEWLINE;
+    renderIndentationInDefn();
+    defnOfs << SYNTHESIZED_TYPE_ANNOTATION_TEARDOWN_COMMENT << CPP_NEWLINE;
 
     // Synthesize type annotation teardown code.
-    renderTypeAnnotationSetupTeardownFixture(
-        premiseDefn, typeAnnotationTeardownMethod, _context.cppFileOfs);
+    if (useAnnotationStack) {
+      renderIndentationInDefn();
+      defnOfs << scopeName << CPP_DOT
+              << SYNTHESIZED_ANNOTATION_SCOPE_ROLLBACK_METHOD_NAME
+              << CPP_OPEN_PAREN << CPP_CLOSE_PAREN << CPP_SEMICOLON
+              << CPP_NEWLINE;
+    } else {
+      const auto& typeAnnotationTeardownMethod = _context.envDefnMap.at(
+          SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ANNOTATION_TEARDOWN_METHOD);
+      renderTypeAnnotationSetupTeardownFixture(
+          premiseDefn, typeAnnotationTeardownMethod, _context.defnOfs);
+    }
   }
 
-  cppFileOfs << CPP_NEWLINE;
+  defnOfs << CPP_NEWLINE;
 }
 
 // -----------------------------------------------------------------------------
@@ -703,10 +1203,12 @@ SynthesizerImpl::synthesizeInferencePremiseDefnWithoutWhileClause(
   const auto& proofMethodName =
       _context.envDefnMap.at(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_PROOF_METHOD);
 
-  auto& cppFileOfs = _context.cppFileOfs;
+  auto& defnOfs = _context.defnOfs;
 
   const auto& deductionTarget = premiseDefn.deductionTarget();
 
+  synthesizeDependencyRecord(premiseDefn.source());
+
   // Synthesize deduction.
   if (deductionTarget.isType<ASTDeductionTargetComputed>()) {
     /**
@@ -722,154 +1224,1725 @@ SynthesizerImpl::synthesizeInferencePremiseDefnWithoutWhileClause(
 
     const auto name1 = __getNextVarName();
 
-    renderIndentationInCppFile();
-    cppFileOfs << typeCls << CPP_SPACE << name1 << CPP_SPACE << CPP_ASSIGN
+    renderIndentationInDefn();
+    defnOfs << typeCls << CPP_SPACE << name1 << CPP_SPACE << CPP_ASSIGN
                << CPP_SPACE;
     synthesizeDeductionTarget(deductionTarget,
                               DeductionTargetArraySynthesisMode::AS_SINGULAR,
-                              _context.cppFileOfs);
-    cppFileOfs << CPP_SEMICOLON << CPP_NEWLINE;
+                              _context.defnOfs);
+    defnOfs << CPP_SEMICOLON << CPP_NEWLINE;
 
     const auto name2 = __getNextVarName();
-    renderIndentationInCppFile();
-    cppFileOfs << typeCls << CPP_SPACE << name2 << CPP_SPACE << CPP_ASSIGN
+    renderIndentationInDefn();
+    defnOfs << typeCls << CPP_SPACE << name2 << CPP_SPACE << CPP_ASSIGN
                << CPP_SPACE;
-    cppFileOfs << proofMethodName << CPP_OPEN_PAREN;
-    synthesizeIdentifiable(premiseDefn.source(), _context.cppFileOfs);
-    cppFileOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
-
-    renderIndentationInCppFile();
-    cppFileOfs << CPP_IF << CPP_SPACE << CPP_OPEN_PAREN;
-    cppFileOfs << CPP_NEGATION;
-    cppFileOfs << type_cmp_method_name << CPP_OPEN_PAREN;
-    cppFileOfs << name1 << CPP_COMA << CPP_SPACE << name2 << CPP_COMA
+    renderPolicyQualifiedName(proofMethodName, defnOfs);
+    defnOfs << CPP_OPEN_PAREN;
+    synthesizeIdentifiable(premiseDefn.source(), _context.defnOfs);
+    defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+
+    renderIndentationInDefn();
+    renderFailureConditionOpening();
+    defnOfs << CPP_NEGATION;
+    renderPolicyQualifiedName(type_cmp_method_name, defnOfs);
+    defnOfs << CPP_OPEN_PAREN;
+    defnOfs << name1 << CPP_COMA << CPP_SPACE << name2 << CPP_COMA
                << CPP_SPACE << CPP_STD_EQUAL_TO_DEFAULT_INSTANTIATION;
-    cppFileOfs << CPP_CLOSE_PAREN << CPP_CLOSE_PAREN << CPP_SPACE
-               << CPP_OPEN_BRACE << CPP_NEWLINE;
+    defnOfs << CPP_CLOSE_PAREN;
+    renderFailureConditionClosing();
 
     // Body of if-statement.
     {
-      ScopedIndentationGuard scopedIndentation(_context.cppFileIndentLvl);
-      renderErrorHandling();
+      ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+      renderErrorHandling(SYNTHESIZED_ERROR_CODE_INFERRED_TYPE_MISMATCH,
+                          std::string(), std::string());
     }
 
-    renderIndentationInCppFile();
-    cppFileOfs << CPP_CLOSE_BRACE;
-    cppFileOfs << CPP_NEWLINE;
+    renderIndentationInDefn();
+    defnOfs << CPP_CLOSE_BRACE;
+    defnOfs << CPP_NEWLINE;
+  } else if (isProofCacheable(premiseDefn)) {
+    synthesizeCachedProof(premiseDefn);
   } else {
-    renderIndentationInCppFile();
-    synthesizeDeductionTargetForDeclaration(premiseDefn.deductionTarget(),
-                                            _context.cppFileOfs);
-    cppFileOfs << CPP_SPACE << CPP_ASSIGN << CPP_SPACE;
-    cppFileOfs << proofMethodName << CPP_OPEN_PAREN;
-    synthesizeIdentifiable(premiseDefn.source(), _context.cppFileOfs);
-    cppFileOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON;
-    cppFileOfs << CPP_NEWLINE;
+    const auto& deductionTarget = premiseDefn.deductionTarget();
+    renderIndentationInDefn();
+    synthesizeDeductionTargetForDeclaration(deductionTarget, _context.defnOfs);
+    if (deductionTarget.isType<ASTDeductionTargetArray>() &&
+        deductionTarget.value<ASTDeductionTargetArray>().hasSizeLiteral()) {
+      // Fixed-capacity arrays are passed to the proof method as a
+      // (pointer, count) pair to fill, so that no allocation takes place.
+      const auto& name = deductionTarget.value<ASTDeductionTargetArray>().name();
+      defnOfs << CPP_SEMICOLON << CPP_NEWLINE;
+      renderIndentationInDefn();
+      renderPolicyQualifiedName(proofMethodName, defnOfs);
+      defnOfs << CPP_OPEN_PAREN;
+      synthesizeIdentifiable(premiseDefn.source(), _context.defnOfs);
+      defnOfs << CPP_COMA << CPP_SPACE << name << CPP_DOT_DATA;
+      defnOfs << CPP_COMA << CPP_SPACE << name << CPP_DOT_SIZE;
+      defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON;
+    } else {
+      defnOfs << CPP_SPACE << CPP_ASSIGN << CPP_SPACE;
+      renderPolicyQualifiedName(proofMethodName, defnOfs);
+      defnOfs << CPP_OPEN_PAREN;
+      synthesizeIdentifiable(premiseDefn.source(), _context.defnOfs);
+      defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON;
+    }
+    defnOfs << CPP_NEWLINE;
   }
 
-  cppFileOfs << CPP_NEWLINE;
+  defnOfs << CPP_NEWLINE;
 }
 
 // -----------------------------------------------------------------------------
 
-void
-SynthesizerImpl::synthesizeArgumentList(const ASTInferenceArgumentList& args,
-                                        std::ostream& ofsRef)
+bool
+SynthesizerImpl::isProofCacheable(
+    const ASTInferencePremiseDefn& premiseDefn) const
 {
-  for (size_t i = 0; i < args.size(); ++i) {
-    const auto& arg = args[i];
-    ofsRef << CPP_CONST_KEYWORD << CPP_SPACE << arg.typeName() << CPP_AMPERSAND
-           << CPP_SPACE << arg.name();
-    if (i + 1 < args.size()) {
-      ofsRef << CPP_COMA << CPP_SPACE;
-    }
+  if (!_context.envDefnMap.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_PROOF_CACHE)) {
+    return false;
+  }
+
+  const auto& inferenceDefnContext = _context.currentInferenceDefnContext;
+
+  // Proofs within while-clauses depend on the type annotations in effect.
+  if (inferenceDefnContext.whileClauseDepth > 0) {
+    return false;
+  }
+
+  if (!premiseDefn.deductionTarget().isType<ASTDeductionTargetSingular>()) {
+    return false;
   }
+
+  return isArgumentRooted(premiseDefn.source());
 }
 
 // -----------------------------------------------------------------------------
 
-void
-SynthesizerImpl::synthesizeDeductionTarget(
-    const ASTDeductionTarget& deductionTarget,
-    const DeductionTargetArraySynthesisMode arrayMode, std::ostream& ofsRef)
+bool
+SynthesizerImpl::isArgumentRooted(const ASTIdentifiable& identifiable) const
 {
-  if (deductionTarget.isType<ASTDeductionTargetSingular>()) {
-    const auto& value = deductionTarget.value<ASTDeductionTargetSingular>();
-    ofsRef << value.name();
-  } else if (deductionTarget.isType<ASTDeductionTargetArray>()) {
-    const auto& value = deductionTarget.value<ASTDeductionTargetArray>();
-    // clang-format off
-    switch (arrayMode) {
-      case DeductionTargetArraySynthesisMode::AS_ARRAY:
-        {
-          if (value.hasSizeLiteral()) {
-            ofsRef << value.name();
-            ofsRef << CPP_OPEN_BRACKET;
-            ofsRef << value.sizeLiteral();
-            ofsRef << CPP_CLOSE_BRACKET;
-          } else {
-            // If the target does not have a size literal,
-            // then just render it as a raw pointer star.
-            ofsRef << CPP_STAR;
-            ofsRef << value.name();
-          }
-        }
-        break;
-      case DeductionTargetArraySynthesisMode::AS_RAW_POINTER_ARRAY:
-        {
-          ofsRef << CPP_STAR;
-          ofsRef << value.name();
-        }
-        break;
-      case DeductionTargetArraySynthesisMode::AS_SINGULAR:
-        {
-          ofsRef << value.name();
-        }
-        break;
-      case DeductionTargetArraySynthesisMode::AS_STD_VECTOR:
-        {
-          const auto& typeCls = _context.typeCls;
-          ofsRef << "std::vector<" << typeCls << '>' << CPP_SPACE << value.name();
-        }
-        break;
-      default:
-        break;
-    }
-    // clang-format on
-  } else if (deductionTarget.isType<ASTDeductionTargetComputed>()) {
-    const auto& value = deductionTarget.value<ASTDeductionTargetComputed>();
-    ofsRef << value.name();
-    ofsRef << CPP_OPEN_PAREN;
-    const auto& arguments = value.arguments();
-    for (size_t i = 0; i < arguments.size(); ++i) {
-      synthesizeDeductionTarget(
-          arguments[i], DeductionTargetArraySynthesisMode::AS_SINGULAR, ofsRef);
-      if (i + 1 < arguments.size()) {
-        ofsRef << CPP_COMA << CPP_SPACE;
-      }
-    }
-    ofsRef << CPP_CLOSE_PAREN;
-  } else {
-    SYNTHESIZER_ASSERT(0 && "Unknown type of deduction target.");
-  }
+  // Only arguments have an identity that outlives the synthesized call.
+  const auto& identifiers = identifiable.identifiers();
+  return !identifiers.empty() &&
+         _context.currentInferenceDefnContext.argumentTypes.count(
+             identifiers.front().value());
 }
 
 // -----------------------------------------------------------------------------
 
-void
-SynthesizerImpl::synthesizeDeductionTargetForDeclaration(
-    const ASTDeductionTarget& deductionTarget, std::ostream& ofsRef)
+bool
+SynthesizerImpl::hasResetSiteParameter() const
+{
+  return _context.envDefnMap.count(
+             SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DEPENDENCY_GRAPH) &&
+         !_context.currentInferenceDefnContext.siteName.empty();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::renderResetSiteParameter(bool isDeclaration,
+                                          std::ostream& ofsRef)
+{
+  if (!hasResetSiteParameter()) {
+    return;
+  }
+
+  // The site name is that of the first argument, so the parameter always
+  // follows another one.
+  ofsRef << CPP_COMA << CPP_SPACE << CPP_BOOL << CPP_SPACE
+         << SYNTHESIZED_RESET_SITE_PARAMETER_NAME;
+  if (isDeclaration) {
+    ofsRef << CPP_SPACE << CPP_ASSIGN << CPP_SPACE << CPP_TRUE;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeDependencySiteReset(bool onRequest)
+{
+  const auto itr = _context.envDefnMap.find(
+      SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DEPENDENCY_GRAPH);
+  const auto& siteName = _context.currentInferenceDefnContext.siteName;
+  if (itr == _context.envDefnMap.cend() || siteName.empty()) {
+    return;
+  }
+
+  // Dependencies recorded by a previous check of the site are superseded.
+  // Inference definitions tried in turn by the dispatch method leave the
+  // reset to it, so that the site also depends on the nodes consulted by
+  // the ones that failed.
+  auto& defnOfs = _context.defnOfs;
+  if (onRequest) {
+    renderIndentationInDefn();
+    defnOfs << CPP_IF << CPP_SPACE << CPP_OPEN_PAREN
+            << SYNTHESIZED_RESET_SITE_PARAMETER_NAME << CPP_CLOSE_PAREN
+            << CPP_SPACE << CPP_OPEN_BRACE << CPP_NEWLINE;
+    indentDefn();
+  }
+  renderIndentationInDefn();
+  renderPolicyQualifiedName(itr->second, defnOfs);
+  defnOfs << CPP_DOT << SYNTHESIZED_DEPENDENCY_GRAPH_BEGIN_SITE_METHOD_NAME;
+  defnOfs << CPP_OPEN_PAREN << CPP_AMPERSAND << siteName << CPP_CLOSE_PAREN;
+  defnOfs << CPP_SEMICOLON << CPP_NEWLINE;
+  if (onRequest) {
+    dedentDefn();
+    renderIndentationInDefn();
+    defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+  }
+  defnOfs << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SynthesizerImpl::isDispatchedWithoutSiteReset(
+    const ASTInferenceGroup& inferenceGroup,
+    const std::string& inferenceDefnName)
+{
+  const auto itr = _context.envDefnMap.find(
+      SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DEPENDENCY_GRAPH);
+  if (itr == _context.envDefnMap.cend()) {
+    return false;
+  }
+
+  // An inherited inference definition takes the parameter only if its group
+  // tracks dependencies, and leaves the reset to the dispatch method only if
+  // it records them into the same graph.
+  for (const ASTInferenceGroup* group = &inferenceGroup; group;
+       group = group->base()) {
+    for (const auto& inferenceDefn : group->inferenceDefns()) {
+      if (inferenceDefn.name() != inferenceDefnName) {
+        continue;
+      }
+      const auto envDefnMap = getEnvnDefnMapFromInferenceGroup(*group);
+      const auto groupItr =
+          envDefnMap.find(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DEPENDENCY_GRAPH);
+      return !inferenceDefn.arguments().empty() &&
+             groupItr != envDefnMap.cend() && groupItr->second == itr->second;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeDependencyRecord(const ASTIdentifiable& source)
+{
+  const auto itr = _context.envDefnMap.find(
+      SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DEPENDENCY_GRAPH);
+  const auto& siteName = _context.currentInferenceDefnContext.siteName;
+  if (itr == _context.envDefnMap.cend() || siteName.empty() ||
+      !isArgumentRooted(source)) {
+    return;
+  }
+
+  // e.g. deps.record(&call, &call.callee);
+  auto& defnOfs = _context.defnOfs;
+  renderIndentationInDefn();
+  renderPolicyQualifiedName(itr->second, defnOfs);
+  defnOfs << CPP_DOT << SYNTHESIZED_DEPENDENCY_GRAPH_RECORD_METHOD_NAME;
+  defnOfs << CPP_OPEN_PAREN << CPP_AMPERSAND << siteName << CPP_COMA
+          << CPP_SPACE << CPP_AMPERSAND;
+  synthesizeIdentifiable(source, defnOfs);
+  defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeCachedProof(
+    const ASTInferencePremiseDefn& premiseDefn)
+{
+  const auto& proofMethodName =
+      _context.envDefnMap.at(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_PROOF_METHOD);
+  const auto& proofCacheName =
+      _context.envDefnMap.at(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_PROOF_CACHE);
+
+  const auto& source = premiseDefn.source();
+  const auto& name =
+      premiseDefn.deductionTarget().value<ASTDeductionTargetSingular>().name();
+  const auto& argumentName = source.identifiers().front().value();
+  const size_t pathId = getProofCachePathId(source);
+
+  auto& defnOfs = _context.defnOfs;
+
+  // The proof method is only invoked on a cache miss, e.g.
+  //   if (!cache.lookup(0, &call, &CalleeType)) {
+  //       CalleeType = proveType(call.callee);
+  //       cache.insert(0, &call, CalleeType);
+  //   }
+  renderIndentationInDefn();
+  synthesizeDeductionTargetForDeclaration(premiseDefn.deductionTarget(),
+                                          defnOfs);
+  defnOfs << CPP_SEMICOLON << CPP_NEWLINE;
+
+  renderIndentationInDefn();
+  defnOfs << CPP_IF << CPP_SPACE << CPP_OPEN_PAREN << CPP_NEGATION;
+  renderPolicyQualifiedName(proofCacheName, defnOfs);
+  defnOfs << CPP_DOT << SYNTHESIZED_PROOF_CACHE_LOOKUP_METHOD_NAME;
+  defnOfs << CPP_OPEN_PAREN << pathId << CPP_COMA << CPP_SPACE;
+  defnOfs << CPP_AMPERSAND << argumentName << CPP_COMA << CPP_SPACE;
+  defnOfs << CPP_AMPERSAND << name << CPP_CLOSE_PAREN;
+  defnOfs << CPP_CLOSE_PAREN << CPP_SPACE << CPP_OPEN_BRACE << CPP_NEWLINE;
+
+  {
+    ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+
+    renderIndentationInDefn();
+    defnOfs << name << CPP_SPACE << CPP_ASSIGN << CPP_SPACE;
+    renderPolicyQualifiedName(proofMethodName, defnOfs);
+    defnOfs << CPP_OPEN_PAREN;
+    synthesizeIdentifiable(source, defnOfs);
+    defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+
+    renderIndentationInDefn();
+    renderPolicyQualifiedName(proofCacheName, defnOfs);
+    defnOfs << CPP_DOT << SYNTHESIZED_PROOF_CACHE_INSERT_METHOD_NAME;
+    defnOfs << CPP_OPEN_PAREN << pathId << CPP_COMA << CPP_SPACE;
+    defnOfs << CPP_AMPERSAND << argumentName << CPP_COMA << CPP_SPACE;
+    defnOfs << name << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+  }
+
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+SynthesizerImpl::getProofCachePathId(const ASTIdentifiable& source)
+{
+  const auto& identifiers = source.identifiers();
+
+  // Paths are told apart by the type of the argument they start from,
+  // so that inference definitions of the group share the results of
+  // identical paths regardless of how they name their arguments.
+  std::string path(_context.currentInferenceDefnContext.argumentTypes.at(
+      identifiers.front().value()));
+  for (size_t i = 1; i < identifiers.size(); ++i) {
+    path.push_back(CPP_DOT);
+    path.append(identifiers[i].value());
+  }
+
+  auto& proofCachePaths = _context.proofCachePaths;
+  const auto itr = proofCachePaths.find(path);
+  if (itr != proofCachePaths.cend()) {
+    return itr->second;
+  }
+
+  const size_t pathId = proofCachePaths.size();
+  proofCachePaths.emplace(std::move(path), pathId);
+  return pathId;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeProofCachePathCount()
+{
+  ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
+
+  auto& headerFileOfs = _context.headerFileOfs;
+  renderIndentationInHeaderFile();
+  headerFileOfs << CPP_STATIC_KEYWORD << CPP_SPACE << CPP_CONSTEXPR_KEYWORD
+                << CPP_SPACE << CPP_SIZE_T << CPP_SPACE
+                << SYNTHESIZED_PROOF_CACHE_PATH_COUNT_NAME << CPP_SPACE
+                << CPP_ASSIGN << CPP_SPACE << _context.proofCachePaths.size()
+                << CPP_SEMICOLON << CPP_NEWLINE;
+  headerFileOfs << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeCppFiles()
+{
+  auto& cppFileOfsList = _context.cppFileOfsList;
+  auto& cppDefns = _context.cppDefns;
+
+  // Each definition goes to the shard its middle falls in, by size, so that
+  // shards hold runs of definitions of about the same size, in the order of
+  // the input, and that changing a definition seldom moves any other to
+  // another shard.
+  size_t totalSize = 0;
+  for (const auto& cppDefn : cppDefns) {
+    totalSize += cppDefn.size();
+  }
+  size_t offset = 0;
+  for (const auto& cppDefn : cppDefns) {
+    const size_t middle = offset + cppDefn.size() / 2;
+    const size_t shard = std::min(middle * cppFileOfsList.size() / totalSize,
+                                  cppFileOfsList.size() - 1);
+    cppFileOfsList[shard] << cppDefn;
+    offset += cppDefn.size();
+  }
+  cppDefns.clear();
+
+  for (auto& cppFileOfs : cppFileOfsList) {
+    if (cppFileOfs.good()) {
+      cppFileOfs.close();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeDescribeFailureMethod(
+    const ASTInferenceGroup& inferenceGroup)
+{
+  auto& defnOfs = _context.defnOfs;
+
+  // Failure records are only turned into messages on request, from the
+  // source text of the premises, e.g.
+  //   static std::string describeFailure(const sl::runtime::FailureRecord&);
+  if (_opts.usePolicyTemplate) {
+    indentDefn();
+    renderIndentationInDefn();
+    defnOfs << CPP_STATIC_KEYWORD << CPP_SPACE << CPP_STD_STRING << CPP_SPACE;
+  } else {
+    {
+      ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
+
+      auto& headerFileOfs = _context.headerFileOfs;
+      renderIndentationInHeaderFile();
+      headerFileOfs << CPP_STATIC_KEYWORD << CPP_SPACE << CPP_STD_STRING
+                    << CPP_SPACE << SYNTHESIZED_DESCRIBE_FAILURE_METHOD_NAME
+                    << CPP_OPEN_PAREN << CPP_CONST_KEYWORD << CPP_SPACE
+                    << SYNTHESIZED_RUNTIME_FAILURE_RECORD_CLASS_NAME
+                    << CPP_AMPERSAND << CPP_CLOSE_PAREN << CPP_SEMICOLON
+                    << CPP_NEWLINE;
+      headerFileOfs << CPP_NEWLINE;
+    }
+
+    defnOfs << CPP_NEWLINE;
+    defnOfs << CPP_STD_STRING << CPP_NEWLINE;
+    defnOfs << _context.clsName << CPP_COLON << CPP_COLON;
+  }
+  defnOfs << SYNTHESIZED_DESCRIBE_FAILURE_METHOD_NAME << CPP_OPEN_PAREN
+          << CPP_CONST_KEYWORD << CPP_SPACE
+          << SYNTHESIZED_RUNTIME_FAILURE_RECORD_CLASS_NAME << CPP_AMPERSAND
+          << CPP_SPACE << SYNTHESIZED_DESCRIBE_FAILURE_PARAMETER_NAME
+          << CPP_CLOSE_PAREN << CPP_NEWLINE;
+  renderIndentationInDefn();
+  defnOfs << CPP_OPEN_BRACE << CPP_NEWLINE;
+  indentDefn();
+
+  const auto& inferenceDefns = inferenceGroup.inferenceDefns();
+
+  // Source text of the premises of each inference definition, in the order
+  // of the premise indices of failure records.
+  std::vector<size_t> premiseCounts;
+  for (const auto& inferenceDefn : inferenceDefns) {
+    std::vector<std::string> descriptions;
+    collectPremiseDescriptions(inferenceDefn.premiseDefns(), &descriptions);
+    premiseCounts.push_back(descriptions.size());
+    if (descriptions.empty()) {
+      continue;
+    }
+
+    renderIndentationInDefn();
+    defnOfs << CPP_STATIC_KEYWORD << CPP_SPACE << CPP_CONST_KEYWORD
+            << CPP_SPACE << "char" << CPP_STAR << CPP_SPACE
+            << CPP_CONST_KEYWORD << CPP_SPACE << inferenceDefn.name()
+            << SYNTHESIZED_DESCRIBE_FAILURE_PREMISES_SUFFIX << CPP_OPEN_BRACKET
+            << CPP_CLOSE_BRACKET << CPP_SPACE << CPP_ASSIGN << CPP_SPACE
+            << CPP_OPEN_BRACE << CPP_NEWLINE;
+    {
+      ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+      for (const auto& description : descriptions) {
+        renderIndentationInDefn();
+        renderStringLiteral(description, defnOfs);
+        defnOfs << CPP_COMA << CPP_NEWLINE;
+      }
+    }
+    renderIndentationInDefn();
+    defnOfs << CPP_CLOSE_BRACE << CPP_SEMICOLON << CPP_NEWLINE;
+    defnOfs << CPP_NEWLINE;
+  }
+
+  renderIndentationInDefn();
+  defnOfs << CPP_STATIC_KEYWORD << CPP_SPACE << CPP_CONST_KEYWORD << CPP_SPACE
+          << SYNTHESIZED_RUNTIME_FAILURE_RULE_INFO_CLASS_NAME << CPP_SPACE
+          << SYNTHESIZED_DESCRIBE_FAILURE_RULES_VARIABLE_NAME
+          << CPP_OPEN_BRACKET << CPP_CLOSE_BRACKET << CPP_SPACE << CPP_ASSIGN
+          << CPP_SPACE << CPP_OPEN_BRACE << CPP_NEWLINE;
+  {
+    ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+    for (size_t i = 0; i < inferenceDefns.size(); ++i) {
+      const auto& name = inferenceDefns[i].name();
+      renderIndentationInDefn();
+      defnOfs << CPP_OPEN_BRACE;
+      renderStringLiteral(name, defnOfs);
+      defnOfs << CPP_COMA << CPP_SPACE;
+      if (premiseCounts[i] > 0) {
+        defnOfs << name << SYNTHESIZED_DESCRIBE_FAILURE_PREMISES_SUFFIX;
+      } else {
+        defnOfs << "nullptr";
+      }
+      defnOfs << CPP_COMA << CPP_SPACE << premiseCounts[i];
+      defnOfs << CPP_CLOSE_BRACE << CPP_COMA << CPP_NEWLINE;
+    }
+  }
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_SEMICOLON << CPP_NEWLINE;
+  defnOfs << CPP_NEWLINE;
+
+  renderIndentationInDefn();
+  defnOfs << CPP_RETURN_KEYWORD << CPP_SPACE
+          << SYNTHESIZED_RUNTIME_DESCRIBE_FAILURE_METHOD_NAME << CPP_OPEN_PAREN
+          << SYNTHESIZED_DESCRIBE_FAILURE_PARAMETER_NAME << CPP_COMA
+          << CPP_SPACE;
+  renderStringLiteral(_opts.inputFilepath, defnOfs);
+  defnOfs << CPP_COMA << CPP_SPACE
+          << SYNTHESIZED_DESCRIBE_FAILURE_RULES_VARIABLE_NAME << CPP_COMA
+          << CPP_SPACE << inferenceDefns.size() << CPP_CLOSE_PAREN
+          << CPP_SEMICOLON << CPP_NEWLINE;
+
+  dedentDefn();
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+
+  if (_opts.usePolicyTemplate) {
+    defnOfs << CPP_NEWLINE;
+    _context.headerFileOfs << defnOfs.str();
+    dedentDefn();
+  } else {
+    _context.cppDefns.push_back(defnOfs.str());
+  }
+  defnOfs.str(std::string());
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeRuleCounters(const ASTInferenceGroup& inferenceGroup)
+{
+  ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
+
+  // One set of counters per inference definition, indexed by rule id, e.g.
+  //   inline static sl::runtime::RuleCounters ruleCounters[3];
+  // With light headers, the counters are of an incomplete type in the header
+  // file, so they are defined in the .cpp file instead.
+  auto& headerFileOfs = _context.headerFileOfs;
+  renderIndentationInHeaderFile();
+  if (!useLightHeaders()) {
+    headerFileOfs << CPP_INLINE_KEYWORD << CPP_SPACE;
+  }
+  headerFileOfs << CPP_STATIC_KEYWORD << CPP_SPACE
+                << SYNTHESIZED_RUNTIME_RULE_COUNTERS_CLASS_NAME << CPP_SPACE
+                << SYNTHESIZED_RULE_COUNTERS_VARIABLE_NAME << CPP_OPEN_BRACKET
+                << inferenceGroup.inferenceDefns().size() << CPP_CLOSE_BRACKET
+                << CPP_SEMICOLON << CPP_NEWLINE;
+  headerFileOfs << CPP_NEWLINE;
+
+  if (useLightHeaders()) {
+    auto& defnOfs = _context.defnOfs;
+    defnOfs << CPP_NEWLINE;
+    defnOfs << SYNTHESIZED_RUNTIME_RULE_COUNTERS_CLASS_NAME << CPP_SPACE
+            << _context.clsName << CPP_COLON << CPP_COLON
+            << SYNTHESIZED_RULE_COUNTERS_VARIABLE_NAME << CPP_OPEN_BRACKET
+            << inferenceGroup.inferenceDefns().size() << CPP_CLOSE_BRACKET
+            << CPP_SEMICOLON << CPP_NEWLINE;
+    _context.cppDefns.push_back(defnOfs.str());
+    defnOfs.str(std::string());
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeDumpInstrumentationMethod(
+    const ASTInferenceGroup& inferenceGroup)
+{
+  auto& defnOfs = _context.defnOfs;
+
+  // Writes the counters of every rule, e.g.
+  //   static void dumpInstrumentation(std::ostream&);
+  if (_opts.usePolicyTemplate) {
+    indentDefn();
+    renderIndentationInDefn();
+    defnOfs << CPP_STATIC_KEYWORD << CPP_SPACE << "void" << CPP_SPACE;
+  } else {
+    {
+      ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
+
+      auto& headerFileOfs = _context.headerFileOfs;
+      renderIndentationInHeaderFile();
+      headerFileOfs << CPP_STATIC_KEYWORD << CPP_SPACE << "void" << CPP_SPACE
+                    << SYNTHESIZED_DUMP_INSTRUMENTATION_METHOD_NAME
+                    << CPP_OPEN_PAREN << CPP_STD_OSTREAM << CPP_AMPERSAND
+                    << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+      headerFileOfs << CPP_NEWLINE;
+    }
+
+    defnOfs << CPP_NEWLINE;
+    defnOfs << "void" << CPP_NEWLINE;
+    defnOfs << _context.clsName << CPP_COLON << CPP_COLON;
+  }
+  defnOfs << SYNTHESIZED_DUMP_INSTRUMENTATION_METHOD_NAME << CPP_OPEN_PAREN
+          << CPP_STD_OSTREAM << CPP_AMPERSAND << CPP_SPACE
+          << SYNTHESIZED_DUMP_INSTRUMENTATION_PARAMETER_NAME << CPP_CLOSE_PAREN
+          << CPP_NEWLINE;
+  renderIndentationInDefn();
+  defnOfs << CPP_OPEN_BRACE << CPP_NEWLINE;
+  indentDefn();
+
+  const auto& inferenceDefns = inferenceGroup.inferenceDefns();
+
+  renderIndentationInDefn();
+  defnOfs << CPP_STATIC_KEYWORD << CPP_SPACE << CPP_CONST_KEYWORD << CPP_SPACE
+          << "char" << CPP_STAR << CPP_SPACE << CPP_CONST_KEYWORD << CPP_SPACE
+          << SYNTHESIZED_DUMP_INSTRUMENTATION_NAMES_VARIABLE_NAME
+          << CPP_OPEN_BRACKET << CPP_CLOSE_BRACKET << CPP_SPACE << CPP_ASSIGN
+          << CPP_SPACE << CPP_OPEN_BRACE << CPP_NEWLINE;
+  {
+    ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+    for (const auto& inferenceDefn : inferenceDefns) {
+      renderIndentationInDefn();
+      renderStringLiteral(inferenceDefn.name(), defnOfs);
+      defnOfs << CPP_COMA << CPP_NEWLINE;
+    }
+  }
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_SEMICOLON << CPP_NEWLINE;
+  defnOfs << CPP_NEWLINE;
+
+  renderIndentationInDefn();
+  defnOfs << SYNTHESIZED_RUNTIME_DUMP_RULE_COUNTERS_METHOD_NAME
+          << CPP_OPEN_PAREN << SYNTHESIZED_DUMP_INSTRUMENTATION_PARAMETER_NAME
+          << CPP_COMA << CPP_SPACE;
+  renderStringLiteral(_context.clsName, defnOfs);
+  defnOfs << CPP_COMA << CPP_SPACE
+          << SYNTHESIZED_DUMP_INSTRUMENTATION_NAMES_VARIABLE_NAME << CPP_COMA
+          << CPP_SPACE << SYNTHESIZED_RULE_COUNTERS_VARIABLE_NAME << CPP_COMA
+          << CPP_SPACE << inferenceDefns.size() << CPP_CLOSE_PAREN
+          << CPP_SEMICOLON << CPP_NEWLINE;
+
+  dedentDefn();
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+
+  if (_opts.usePolicyTemplate) {
+    defnOfs << CPP_NEWLINE;
+    _context.headerFileOfs << defnOfs.str();
+    dedentDefn();
+  } else {
+    _context.cppDefns.push_back(defnOfs.str());
+  }
+  defnOfs.str(std::string());
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeRuleInstrumentation()
+{
+  if (!_opts.emitInstrumentation) {
+    return;
+  }
+
+  // Counts the call and the cycles spent in the method, e.g.
+  //   SL_INSTRUMENT_RULE(ruleCounters, 0);
+  auto& defnOfs = _context.defnOfs;
+  renderIndentationInDefn();
+  defnOfs << SYNTHESIZED_INSTRUMENT_RULE_MACRO_NAME << CPP_OPEN_PAREN
+          << SYNTHESIZED_RULE_COUNTERS_VARIABLE_NAME << CPP_COMA << CPP_SPACE
+          << _context.currentInferenceDefnContext.ruleId << CPP_CLOSE_PAREN
+          << CPP_SEMICOLON << CPP_NEWLINE << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizePremiseInstrumentation()
+{
+  if (!_opts.emitInstrumentation) {
+    return;
+  }
+
+  // Tracing hook of the premise, e.g.
+  //   SL_INSTRUMENT_PREMISE(0, 2);
+  const auto& inferenceDefnContext = _context.currentInferenceDefnContext;
+  auto& defnOfs = _context.defnOfs;
+  renderIndentationInDefn();
+  defnOfs << SYNTHESIZED_INSTRUMENT_PREMISE_MACRO_NAME << CPP_OPEN_PAREN
+          << inferenceDefnContext.ruleId << CPP_COMA << CPP_SPACE
+          << inferenceDefnContext.numPremisesVisited - 1 << CPP_CLOSE_PAREN
+          << CPP_SEMICOLON << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::collectPremiseDescriptions(
+    const ASTPremiseDefnList& premiseDefns,
+    std::vector<std::string>* descriptions)
+{
+  // A premise with a while-clause precedes the premises within it, as it
+  // does when premises are visited.
+  for (const auto& premiseDefn : premiseDefns) {
+    descriptions->push_back(ASTUtils::CanonicalizeASTPremiseDefn(premiseDefn));
+    if (premiseDefn.isType<ASTInferencePremiseDefn>()) {
+      const auto& value = premiseDefn.value<ASTInferencePremiseDefn>();
+      if (value.hasWhileClause()) {
+        collectPremiseDescriptions(value.whileClause().premiseDefns(),
+                                   descriptions);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::renderStringLiteral(const std::string& value,
+                                     std::ostream& ofsRef)
+{
+  ofsRef << CPP_DOUBLE_QUOTE;
+  for (const char c : value) {
+    if (c == CPP_DOUBLE_QUOTE || c == '\\') {
+      ofsRef << '\\';
+    }
+    ofsRef << c;
+  }
+  ofsRef << CPP_DOUBLE_QUOTE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeBatchedRangeComparison(
+    const ASTInferenceEqualityDefn& premiseDefn,
+    const std::string& typeRangeCmpMethodName, const IntegerType* tripCount)
+{
+  SYNTHESIZER_ASSERT(premiseDefn.hasRangeClause());
+
+  const auto& rangeClause = premiseDefn.rangeClause();
+
+  auto& defnOfs = _context.defnOfs;
+
+  // A single call compares the whole range, instead of one call per element:
+  //   cmpTypeRange(lhs, lhsIdx, rhs, rhsIdx, count, op)
+  renderIndentationInDefn();
+  renderFailureConditionOpening();
+  defnOfs << CPP_NEGATION;
+  renderPolicyQualifiedName(typeRangeCmpMethodName, defnOfs);
+  defnOfs << CPP_OPEN_PAREN;
+  synthesizeDeductionTarget(premiseDefn.lhs(),
+                            DeductionTargetArraySynthesisMode::AS_SINGULAR,
+                            defnOfs);
+  defnOfs << CPP_COMA << CPP_SPACE << rangeClause.lhsIdx();
+  defnOfs << CPP_COMA << CPP_SPACE;
+  synthesizeDeductionTarget(premiseDefn.rhs(),
+                            DeductionTargetArraySynthesisMode::AS_SINGULAR,
+                            defnOfs);
+  defnOfs << CPP_COMA << CPP_SPACE << rangeClause.rhsIdx();
+  defnOfs << CPP_COMA << CPP_SPACE;
+
+  // Number of elements compared, matching the bound of the per-element loop.
+  if (tripCount) {
+    defnOfs << *tripCount;
+  } else {
+    std::stringstream sizeExpr;
+    renderRangeClauseSize(rangeClause, nullptr, sizeExpr);
+
+    if (rangeClause.lhsIdx() == 0) {
+      defnOfs << sizeExpr.str();
+    } else {
+      defnOfs << CPP_OPEN_PAREN << sizeExpr.str() << " > "
+              << rangeClause.lhsIdx() << " ? " << sizeExpr.str() << " - "
+              << rangeClause.lhsIdx() << " : 0" << CPP_CLOSE_PAREN;
+    }
+  }
+
+  defnOfs << CPP_COMA << CPP_SPACE;
+  synthesizeEqualityOperator(premiseDefn.oprt(), defnOfs);
+  defnOfs << CPP_CLOSE_PAREN;
+  renderFailureConditionClosing();
+
+  // Body of if statement
+  {
+    ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+    renderErrorHandling(SYNTHESIZED_ERROR_CODE_TYPE_COMPARISON_FAILED,
+                        std::string(), std::string());
+  }
+
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeUnrolledRangeComparison(
+    const ASTInferenceEqualityDefn& premiseDefn, const IntegerType tripCount)
+{
+  SYNTHESIZER_ASSERT(premiseDefn.hasRangeClause());
+
+  if (tripCount == 0) {
+    return;
+  }
+
+  const auto& rangeClause = premiseDefn.rangeClause();
+
+  auto& defnOfs = _context.defnOfs;
+
+  // All element comparisons are folded into a single condition, e.g.
+  //   if (!cmpType(lhs[0], rhs[1], op) ||
+  //       !cmpType(lhs[1], rhs[2], op)) {
+  renderIndentationInDefn();
+  renderFailureConditionOpening();
+  for (IntegerType k = 0; k < tripCount; ++k) {
+    if (k > 0) {
+      defnOfs << " ||" << CPP_NEWLINE;
+      renderIndentationInDefn();
+      defnOfs << CPP_INDENTATION;
+    }
+    synthesizeFailedTypeComparison(
+        premiseDefn, std::to_string(rangeClause.lhsIdx() + k),
+        std::to_string(rangeClause.rhsIdx() + k));
+  }
+  renderFailureConditionClosing();
+
+  // Body of if statement
+  {
+    ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+    renderErrorHandling(SYNTHESIZED_ERROR_CODE_TYPE_COMPARISON_FAILED,
+                        std::string(), std::string());
+  }
+
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::initializeInferenceDefnContext(
+    const ASTInferenceDefn& inferenceDefn)
+{
+  auto& inferenceDefnContext = _context.currentInferenceDefnContext;
+
+  inferenceDefnContext.failureHandlerName =
+      inferenceDefn.name() + SYNTHESIZED_FAILURE_HANDLER_SUFFIX;
+  inferenceDefnContext.ruleId = _context.ruleIds.at(inferenceDefn.name());
+
+  for (const auto& decl : inferenceDefn.globalDecls()) {
+    inferenceDefnContext.globals.insert(decl.name());
+  }
+
+  for (const auto& argument : inferenceDefn.arguments()) {
+    inferenceDefnContext.argumentTypes[argument.name()] = argument.typeName();
+  }
+
+  // The first argument identifies the site the inference definition checks.
+  if (!inferenceDefn.arguments().empty()) {
+    inferenceDefnContext.siteName = inferenceDefn.arguments().front().name();
+  }
+
+  collectFixedCapacityArrays(inferenceDefn.premiseDefns(),
+                             &inferenceDefnContext.fixedCapacityArrays);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::collectFixedCapacityArrays(
+    const ASTPremiseDefnList& premiseDefns, FixedCapacityArrayTable* table)
+{
+  for (const auto& premiseDefn : premiseDefns) {
+    if (!premiseDefn.isType<ASTInferencePremiseDefn>()) {
+      continue;
+    }
+    const auto& value = premiseDefn.value<ASTInferencePremiseDefn>();
+    const auto& deductionTarget = value.deductionTarget();
+    if (deductionTarget.isType<ASTDeductionTargetArray>()) {
+      const auto& target = deductionTarget.value<ASTDeductionTargetArray>();
+      if (target.hasSizeLiteral()) {
+        (*table)[target.name()] = target.sizeLiteral();
+      }
+    }
+    if (value.hasWhileClause()) {
+      collectFixedCapacityArrays(value.whileClause().premiseDefns(), table);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SynthesizerImpl::getStaticRangeTripCount(
+    const ASTInferenceEqualityDefn& premiseDefn, IntegerType* tripCount) const
+{
+  SYNTHESIZER_ASSERT(premiseDefn.hasRangeClause());
+
+  const auto& table = _context.currentInferenceDefnContext.fixedCapacityArrays;
+
+  const auto getDeclaredSize = [&table](const ASTDeductionTarget& target,
+                                        IntegerType* size) -> bool {
+    if (!target.isType<ASTDeductionTargetArray>()) {
+      return false;
+    }
+    const auto itr = table.find(target.value<ASTDeductionTargetArray>().name());
+    if (itr == table.cend()) {
+      return false;
+    }
+    *size = itr->second;
+    return true;
+  };
+
+  const auto& rangeClause = premiseDefn.rangeClause();
+
+  IntegerType lhsSize = 0;
+  IntegerType rhsSize = 0;
+  IntegerType rangeSize = 0;
+  if (!getDeclaredSize(premiseDefn.lhs(), &lhsSize) ||
+      !getDeclaredSize(premiseDefn.rhs(), &rhsSize) ||
+      !getDeclaredSize(rangeClause.deductionTarget(), &rangeSize)) {
+    return false;
+  }
+
+  const IntegerType lhsIdx = rangeClause.lhsIdx();
+  const IntegerType rhsIdx = rangeClause.rhsIdx();
+  const IntegerType count = rangeSize > lhsIdx ? rangeSize - lhsIdx : 0;
+
+  // Leave ranges that overrun either side to the runtime loop,
+  // rather than unrolling out-of-bounds accesses.
+  if (lhsIdx + count > lhsSize || rhsIdx + count > rhsSize) {
+    return false;
+  }
+
+  *tripCount = count;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::renderRangeClauseSize(const ASTRangeClause& rangeClause,
+                                       const IntegerType* tripCount,
+                                       std::ostream& ofsRef)
+{
+  if (tripCount) {
+    ofsRef << rangeClause.lhsIdx() + *tripCount;
+  } else {
+    synthesizeDeductionTarget(rangeClause.deductionTarget(),
+                              DeductionTargetArraySynthesisMode::AS_SINGULAR,
+                              ofsRef);
+    ofsRef << CPP_DOT_SIZE;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeDispatchMethod(
+    const ASTInferenceGroup& inferenceGroup)
+{
+  const auto& dispatchEntries = inferenceGroup.dispatchEntries();
+  SYNTHESIZER_ASSERT(!dispatchEntries.empty());
+
+  // Semantic analysis guarantees that all dispatched inference definitions
+  // take the same arguments, so the dispatch method takes those of the first,
+  // which may be inherited from a base.
+  const ASTInferenceDefn* firstInferenceDefn = ASTUtils::FindInferenceDefn(
+      inferenceGroup, dispatchEntries.front().inferenceNames().front());
+  SYNTHESIZER_ASSERT(firstInferenceDefn);
+
+  const auto& arguments = firstInferenceDefn->arguments();
+  const auto& keyCls = _context.envDefnMap.at(
+      SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DISPATCH_KEY_CLASS);
+
+  std::string methodName(SYNTHESIZER_DEFAULT_DISPATCH_METHOD_NAME);
+  {
+    const auto itr = _context.envDefnMap.find(
+        SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DISPATCH_METHOD);
+    if (itr != _context.envDefnMap.cend()) {
+      methodName = itr->second;
+    }
+  }
+
+  synthesizeGroupMethodOpening(methodName, &keyCls, arguments,
+                               "dispatch definitions");
+
+  auto& defnOfs = _context.defnOfs;
+
+  // A switch over the dispatch key, which the host compiler lowers
+  // into a jump table for dense keys.
+  renderIndentationInDefn();
+  defnOfs << CPP_SWITCH_KEYWORD << CPP_SPACE << CPP_OPEN_PAREN
+          << SYNTHESIZED_DISPATCH_KEY_PARAMETER_NAME << CPP_CLOSE_PAREN
+          << CPP_SPACE << CPP_OPEN_BRACE << CPP_NEWLINE;
+
+  for (const auto& dispatchEntry : dispatchEntries) {
+    ScopedIndentationGuard caseIndentation(_context.defnIndentLvl);
+    renderIndentationInDefn();
+    defnOfs << CPP_CASE_KEYWORD << CPP_SPACE << keyCls << CPP_COLON
+            << CPP_COLON << dispatchEntry.key() << CPP_COLON << CPP_NEWLINE;
+
+    ScopedIndentationGuard bodyIndentation(_context.defnIndentLvl);
+
+    // Rules sharing the same key are tried in order, until one succeeds.
+    // They check the same site, which depends on the nodes consulted by
+    // every one of them, so it is reset once before trying the first.
+    const auto& inferenceNames = dispatchEntry.inferenceNames();
+    const bool sharesSite = inferenceNames.size() > 1 && !arguments.empty();
+    if (sharesSite) {
+      _context.currentInferenceDefnContext.siteName = arguments.front().name();
+      synthesizeDependencySiteReset(false /** onRequest */);
+      _context.currentInferenceDefnContext.siteName.clear();
+    }
+
+    for (size_t i = 0; i + 1 < inferenceNames.size(); ++i) {
+      const bool keepSite =
+          sharesSite &&
+          isDispatchedWithoutSiteReset(inferenceGroup, inferenceNames[i]);
+      renderIndentationInDefn();
+      if (_opts.useException) {
+        defnOfs << CPP_TRY_KEYWORD << CPP_SPACE << CPP_OPEN_BRACE
+                << CPP_NEWLINE;
+        {
+          ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+          synthesizeDispatchCall(inferenceNames[i], arguments, nullptr,
+                                 keepSite);
+        }
+        renderIndentationInDefn();
+        defnOfs << CPP_CLOSE_BRACE << CPP_SPACE << CPP_CATCH_ALL << CPP_SPACE
+                << CPP_OPEN_BRACE << CPP_NEWLINE;
+        renderIndentationInDefn();
+        defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+        continue;
+      }
+
+      defnOfs << CPP_OPEN_BRACE << CPP_NEWLINE;
+      {
+        ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+        renderIndentationInDefn();
+        defnOfs << CPP_STD_ERROR_CODE << CPP_SPACE
+                << SYNTHESIZED_DISPATCH_ERROR_VARIABLE_NAME << CPP_SEMICOLON
+                << CPP_NEWLINE;
+        renderIndentationInDefn();
+        defnOfs << CPP_CONST_KEYWORD << CPP_SPACE << _context.typeCls
+                << CPP_SPACE << SYNTHESIZED_DISPATCH_RESULT_VARIABLE_NAME
+                << CPP_SPACE << CPP_ASSIGN << CPP_SPACE;
+        defnOfs << inferenceNames[i] << CPP_OPEN_PAREN;
+        if (!_context.contextCls.empty()) {
+          defnOfs << SYNTHESIZED_CONTEXT_PARAMETER_NAME << CPP_COMA
+                  << CPP_SPACE;
+        }
+        for (const auto& argument : arguments) {
+          defnOfs << argument.name() << CPP_COMA << CPP_SPACE;
+        }
+        defnOfs << CPP_AMPERSAND << SYNTHESIZED_DISPATCH_ERROR_VARIABLE_NAME;
+        if (keepSite) {
+          defnOfs << CPP_COMA << CPP_SPACE << CPP_FALSE;
+        }
+        defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+        renderIndentationInDefn();
+        defnOfs << CPP_IF << CPP_SPACE << CPP_OPEN_PAREN << CPP_NEGATION
+                << SYNTHESIZED_DISPATCH_ERROR_VARIABLE_NAME << CPP_CLOSE_PAREN
+                << CPP_SPACE << CPP_OPEN_BRACE << CPP_NEWLINE;
+        {
+          ScopedIndentationGuard nestedIndentation(_context.defnIndentLvl);
+          renderIndentationInDefn();
+          defnOfs << CPP_RETURN_KEYWORD << CPP_SPACE
+                  << SYNTHESIZED_DISPATCH_RESULT_VARIABLE_NAME << CPP_SEMICOLON
+                  << CPP_NEWLINE;
+        }
+        renderIndentationInDefn();
+        defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+      }
+      renderIndentationInDefn();
+      defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+    }
+
+    const bool keepSite =
+        sharesSite &&
+        isDispatchedWithoutSiteReset(inferenceGroup, inferenceNames.back());
+    synthesizeDispatchCall(inferenceNames.back(), arguments,
+                           SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME,
+                           keepSite);
+  }
+
+  {
+    ScopedIndentationGuard caseIndentation(_context.defnIndentLvl);
+    renderIndentationInDefn();
+    defnOfs << CPP_DEFAULT_KEYWORD << CPP_COLON << CPP_NEWLINE;
+    ScopedIndentationGuard bodyIndentation(_context.defnIndentLvl);
+    renderIndentationInDefn();
+    defnOfs << CPP_BREAK_KEYWORD << CPP_SEMICOLON << CPP_NEWLINE;
+  }
+
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+  defnOfs << CPP_NEWLINE;
+
+  synthesizeGroupMethodClosing();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeTryAllMethod(const ASTInferenceGroup& inferenceGroup)
+{
+  static const ASTInferenceArgumentList noArguments;
+
+  const auto& methodName =
+      _context.envDefnMap.at(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TRY_ALL_METHOD);
+
+  // Semantic analysis guarantees that all inference definitions in the group
+  // take the same arguments, so the try-all method takes those of the first.
+  const auto& inferenceDefns = inferenceGroup.inferenceDefns();
+  const auto& arguments =
+      inferenceDefns.empty() ? noArguments : inferenceDefns.front().arguments();
+
+  DecisionTreeNode root{nullptr, 0, 0, false, {}};
+  buildDecisionTree(inferenceGroup, &root);
+
+  synthesizeGroupMethodOpening(methodName, nullptr, arguments,
+                               "inference definitions");
+
+  if (!inferenceDefns.empty()) {
+    initializeInferenceDefnContext(inferenceDefns.front());
+    synthesizeDependencySiteReset(false /** onRequest */);
+  }
+
+  for (const auto& child : root.children) {
+    synthesizeDecisionTreeNode(child);
+  }
+  _context.defnOfs << CPP_NEWLINE;
+
+  _context.currentInferenceDefnContext.reset();
+
+  synthesizeGroupMethodClosing();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::buildDecisionTree(const ASTInferenceGroup& inferenceGroup,
+                                   DecisionTreeNode* root)
+{
+  for (const auto& inferenceDefn : inferenceGroup.inferenceDefns()) {
+    insertIntoDecisionTree(inferenceDefn, 0, root);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::insertIntoDecisionTree(const ASTInferenceDefn& inferenceDefn,
+                                        size_t premiseOffset,
+                                        DecisionTreeNode* node)
+{
+  const auto& premiseDefns = inferenceDefn.premiseDefns();
+  const size_t premiseCount = premiseDefns.size();
+
+  if (premiseOffset == premiseCount) {
+    node->children.push_back(
+        DecisionTreeNode{&inferenceDefn, premiseCount, premiseCount, true, {}});
+    return;
+  }
+
+  // Only the last branch may be extended, so that inference definitions
+  // are still tried in the order they are declared.
+  if (!node->children.empty()) {
+    auto& last = node->children.back();
+    if (!last.isLeaf &&
+        ASTUtils::HaveSameGlobalDecls(*last.inferenceDefn, inferenceDefn)) {
+      const auto& sharedPremiseDefns = last.inferenceDefn->premiseDefns();
+
+      size_t n = 0;
+      while (last.premiseBegin + n < last.premiseEnd &&
+             premiseOffset + n < premiseCount &&
+             ASTUtils::ArePremiseDefnsEqual(
+                 sharedPremiseDefns[last.premiseBegin + n],
+                 premiseDefns[premiseOffset + n])) {
+        ++n;
+      }
+
+      if (n > 0) {
+        // Split the branch where the two inference definitions diverge.
+        if (last.premiseBegin + n < last.premiseEnd) {
+          DecisionTreeNode tail{last.inferenceDefn, last.premiseBegin + n,
+                                last.premiseEnd, false,
+                                std::move(last.children)};
+          last.premiseEnd = last.premiseBegin + n;
+          last.children.clear();
+          last.children.push_back(std::move(tail));
+        }
+        insertIntoDecisionTree(inferenceDefn, premiseOffset + n, &last);
+        return;
+      }
+    }
+  }
+
+  DecisionTreeNode branch{&inferenceDefn, premiseOffset, premiseCount, false,
+                          {}};
+  branch.children.push_back(
+      DecisionTreeNode{&inferenceDefn, premiseCount, premiseCount, true, {}});
+  node->children.push_back(std::move(branch));
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeDecisionTreeNode(const DecisionTreeNode& node)
+{
+  auto& defnOfs = _context.defnOfs;
+  auto& inferenceDefnContext = _context.currentInferenceDefnContext;
+
+  // Premises are synthesized in the scope of the inference definition
+  // they were taken from.
+  inferenceDefnContext.reset();
+  initializeInferenceDefnContext(*node.inferenceDefn);
+
+  if (node.isLeaf) {
+    renderDecisionTreeLeafAnnotationComment(node.inferenceDefn->name());
+    visit(node.inferenceDefn->propositionDefn());
+    return;
+  }
+
+  const auto label = __getNextLabelName();
+
+  renderIndentationInDefn();
+  defnOfs << CPP_OPEN_BRACE << CPP_NEWLINE;
+  indentDefn();
+
+  // A failed premise skips the rest of this branch, including the
+  // branches nested within it.
+  bool labelUsed = false;
+  {
+    _context.failureLabel = label;
+    _context.failureLabelUsed = false;
+
+    inferenceDefnContext.numPremisesProcessed = node.premiseBegin;
+    inferenceDefnContext.numPremisesVisited = node.premiseBegin;
+    const auto& premiseDefns = node.inferenceDefn->premiseDefns();
+    for (size_t i = node.premiseBegin; i < node.premiseEnd; ++i) {
+      visit(premiseDefns[i]);
+    }
+
+    labelUsed = _context.failureLabelUsed;
+    _context.failureLabel.clear();
+    _context.failureLabelUsed = false;
+  }
+
+  for (const auto& child : node.children) {
+    synthesizeDecisionTreeNode(child);
+  }
+
+  dedentDefn();
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+
+  if (labelUsed) {
+    renderIndentationInDefn();
+    defnOfs << label << CPP_COLON << CPP_SEMICOLON << CPP_NEWLINE;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeGroupMethodOpening(
+    const std::string& methodName, const std::string* keyCls,
+    const ASTInferenceArgumentList& arguments, const char* annotationSource)
+{
+  auto& defnOfs = _context.defnOfs;
+
+  if (_opts.usePolicyTemplate) {
+    indentDefn();
+    {
+      ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
+      renderGroupMethodAnnotationComment(annotationSource, defnOfs,
+                                         true /** isHeaderFile */);
+    }
+    renderIndentationInDefn();
+    defnOfs << CPP_STATIC_KEYWORD << CPP_SPACE;
+    synthesizeGroupMethodSignature(methodName, keyCls, arguments, false,
+                                   defnOfs);
+  } else {
+    // Synthesize member function declaration.
+    {
+      ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
+
+      auto& headerFileOfs = _context.headerFileOfs;
+      renderGroupMethodAnnotationComment(annotationSource, headerFileOfs,
+                                         true /** isHeaderFile */);
+      renderIndentationInHeaderFile();
+      synthesizeGroupMethodSignature(methodName, keyCls, arguments, true,
+                                     headerFileOfs);
+      headerFileOfs << CPP_SEMICOLON;
+      headerFileOfs << CPP_NEWLINE;
+      headerFileOfs << CPP_NEWLINE;
+    }
+
+    defnOfs << CPP_NEWLINE;
+    renderGroupMethodAnnotationComment(annotationSource, defnOfs);
+    synthesizeGroupMethodSignature(methodName, keyCls, arguments, false,
+                                   defnOfs);
+  }
+
+  renderIndentationInDefn();
+  defnOfs << CPP_OPEN_BRACE << CPP_NEWLINE;
+  indentDefn();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeGroupMethodClosing()
+{
+  auto& defnOfs = _context.defnOfs;
+
+  // No rule applies.
+  if (!_opts.useException) {
+    renderIndentationInDefn();
+    defnOfs << CPP_STAR << SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME
+            << CPP_SPACE << CPP_ASSIGN << CPP_SPACE << CPP_STD_ERROR_CODE
+            << CPP_OPEN_PAREN << SYNTHESIZED_ERROR_CODE_NO_APPLICABLE_RULE
+            << CPP_COMA << CPP_SPACE
+            << SYNTHESIZED_GLOBAL_ERROR_CATEGORY_INSTANCE_NAME
+            << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+  }
+  renderIndentationInDefn();
+  defnOfs << CPP_RETURN_KEYWORD << CPP_SPACE << _context.typeCls
+          << CPP_OPEN_PAREN << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+
+  dedentDefn();
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE;
+  defnOfs << CPP_NEWLINE;
+
+  if (_opts.usePolicyTemplate) {
+    defnOfs << CPP_NEWLINE;
+    _context.headerFileOfs << defnOfs.str();
+    dedentDefn();
+  } else {
+    _context.cppDefns.push_back(defnOfs.str());
+  }
+  defnOfs.str(std::string());
+}
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeGroupMethodSignature(
+    const std::string& methodName, const std::string* keyCls,
+    const ASTInferenceArgumentList& arguments, bool isDeclaration,
+    std::ostream& ofsRef)
+{
+  // Out-of-line definitions put the return type on its own line.
+  const bool isOutOfLineDefn = !isDeclaration && !_opts.usePolicyTemplate;
+
+  if (isDeclaration && !_context.contextCls.empty()) {
+    ofsRef << CPP_STATIC_KEYWORD << CPP_SPACE;
+  }
+  ofsRef << _context.typeCls;
+  if (isOutOfLineDefn) {
+    ofsRef << CPP_NEWLINE;
+    ofsRef << _context.clsName << CPP_COLON << CPP_COLON;
+  } else {
+    ofsRef << CPP_SPACE;
+  }
+  ofsRef << methodName;
+  ofsRef << CPP_OPEN_PAREN;
+  renderContextParameter(keyCls || !arguments.empty() || !_opts.useException,
+                         ofsRef);
+  if (keyCls) {
+    ofsRef << *keyCls << CPP_SPACE << SYNTHESIZED_DISPATCH_KEY_PARAMETER_NAME;
+    if (!arguments.empty()) {
+      ofsRef << CPP_COMA << CPP_SPACE;
+    }
+  }
+  synthesizeArgumentList(arguments, ofsRef);
+  if (!_opts.useException) {
+    if (keyCls || !arguments.empty()) {
+      ofsRef << CPP_COMA << CPP_SPACE;
+    }
+    ofsRef << CPP_STD_ERROR_CODE << CPP_STAR;
+    if (!isDeclaration) {
+      ofsRef << CPP_SPACE << SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME;
+    }
+  }
+  ofsRef << CPP_CLOSE_PAREN;
+  if (!isDeclaration) {
+    ofsRef << CPP_NEWLINE;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeDispatchCall(
+    const std::string& inferenceDefnName,
+    const ASTInferenceArgumentList& arguments, const char* errorArgument,
+    bool keepSite)
+{
+  auto& defnOfs = _context.defnOfs;
+
+  renderIndentationInDefn();
+  defnOfs << CPP_RETURN_KEYWORD << CPP_SPACE << inferenceDefnName
+          << CPP_OPEN_PAREN;
+  if (!_context.contextCls.empty()) {
+    defnOfs << SYNTHESIZED_CONTEXT_PARAMETER_NAME;
+    if (!arguments.empty() || (!_opts.useException && errorArgument)) {
+      defnOfs << CPP_COMA << CPP_SPACE;
+    }
+  }
+  for (size_t i = 0; i < arguments.size(); ++i) {
+    defnOfs << arguments[i].name();
+    if (i + 1 < arguments.size()) {
+      defnOfs << CPP_COMA << CPP_SPACE;
+    }
+  }
+  if (!_opts.useException && errorArgument) {
+    if (!arguments.empty()) {
+      defnOfs << CPP_COMA << CPP_SPACE;
+    }
+    defnOfs << errorArgument;
+  }
+  // The flag follows the arguments, which a site has at least one of.
+  if (keepSite) {
+    defnOfs << CPP_COMA << CPP_SPACE << CPP_FALSE;
+  }
+  defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeBatchMethod(const ASTInferenceDefn& inferenceDefn)
+{
+  ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
+
+  auto& headerFileOfs = _context.headerFileOfs;
+
+  // Call sites are fanned out over the executor, which supplies the context
+  // of the worker each of them runs on, e.g.
+  //   template <typename Executor>
+  //   static void CallInferenceBatch(const Expr* const* call,
+  //       TypeCls* results, std::error_code* errs, size_t count,
+  //       Executor& executor)
+  //   {
+  //       executor.parallelFor(count, [&](size_t i, Context& ctx) {
+  //           results[i] = CallInference(ctx, *call[i], &errs[i]);
+  //       });
+  //   }
+  // With light headers, the template is only declared in the header file,
+  // and defined in the implementation-detail header file.
+  renderIndentationInHeaderFile();
+  headerFileOfs << CPP_TEMPLATE_KEYWORD << CPP_SPACE << '<'
+                << CPP_TYPENAME_KEYWORD << CPP_SPACE
+                << SYNTHESIZED_BATCH_EXECUTOR_TEMPLATE_PARAMETER_NAME << '>'
+                << CPP_NEWLINE;
+
+  renderIndentationInHeaderFile();
+  headerFileOfs << CPP_STATIC_KEYWORD << CPP_SPACE << "void" << CPP_SPACE
+                << inferenceDefn.name() << SYNTHESIZED_BATCH_METHOD_SUFFIX
+                << CPP_OPEN_PAREN;
+  synthesizeBatchMethodParameters(inferenceDefn, headerFileOfs);
+  headerFileOfs << CPP_CLOSE_PAREN;
+
+  if (useLightHeaders()) {
+    headerFileOfs << CPP_SEMICOLON << CPP_NEWLINE;
+    headerFileOfs << CPP_NEWLINE;
+
+    auto& detailHeaderFileOfs = _context.detailHeaderFileOfs;
+    detailHeaderFileOfs << CPP_TEMPLATE_KEYWORD << CPP_SPACE << '<'
+                        << CPP_TYPENAME_KEYWORD << CPP_SPACE
+                        << SYNTHESIZED_BATCH_EXECUTOR_TEMPLATE_PARAMETER_NAME
+                        << '>' << CPP_NEWLINE;
+    detailHeaderFileOfs << "void" << CPP_NEWLINE;
+    detailHeaderFileOfs << _context.clsName << CPP_COLON << CPP_COLON
+                        << inferenceDefn.name()
+                        << SYNTHESIZED_BATCH_METHOD_SUFFIX << CPP_OPEN_PAREN;
+    synthesizeBatchMethodParameters(inferenceDefn, detailHeaderFileOfs);
+    detailHeaderFileOfs << CPP_CLOSE_PAREN << CPP_NEWLINE;
+    synthesizeBatchMethodBody(inferenceDefn, 0, detailHeaderFileOfs);
+    detailHeaderFileOfs << CPP_NEWLINE;
+  } else {
+    headerFileOfs << CPP_NEWLINE;
+    synthesizeBatchMethodBody(inferenceDefn, _context.headerFileIndentLvl,
+                              headerFileOfs);
+    headerFileOfs << CPP_NEWLINE;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeBatchMethodParameters(
+    const ASTInferenceDefn& inferenceDefn, std::ostream& ofsRef)
+{
+  const auto& argument = inferenceDefn.arguments().front();
+
+  ofsRef << CPP_CONST_KEYWORD << CPP_SPACE << argument.typeName() << CPP_STAR
+         << CPP_SPACE << CPP_CONST_KEYWORD << CPP_STAR << CPP_SPACE
+         << argument.name() << CPP_COMA << CPP_SPACE;
+  ofsRef << _context.typeCls << CPP_STAR << CPP_SPACE
+         << SYNTHESIZED_BATCH_RESULTS_PARAMETER_NAME << CPP_COMA << CPP_SPACE;
+  ofsRef << CPP_STD_ERROR_CODE << CPP_STAR << CPP_SPACE
+         << SYNTHESIZED_BATCH_ERRORS_PARAMETER_NAME << CPP_COMA << CPP_SPACE;
+  ofsRef << CPP_SIZE_T << CPP_SPACE << SYNTHESIZED_BATCH_COUNT_PARAMETER_NAME
+         << CPP_COMA << CPP_SPACE;
+  ofsRef << SYNTHESIZED_BATCH_EXECUTOR_TEMPLATE_PARAMETER_NAME << CPP_AMPERSAND
+         << CPP_SPACE << SYNTHESIZED_BATCH_EXECUTOR_PARAMETER_NAME;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeBatchMethodBody(
+    const ASTInferenceDefn& inferenceDefn, const size_t indentLvl,
+    std::ostream& ofsRef)
+{
+  const auto& argument = inferenceDefn.arguments().front();
+
+  renderIndentation(indentLvl, ofsRef);
+  ofsRef << CPP_OPEN_BRACE << CPP_NEWLINE;
+
+  renderIndentation(indentLvl + 1, ofsRef);
+  ofsRef << SYNTHESIZED_BATCH_EXECUTOR_PARAMETER_NAME << CPP_DOT
+         << SYNTHESIZED_BATCH_EXECUTOR_METHOD_NAME << CPP_OPEN_PAREN
+         << SYNTHESIZED_BATCH_COUNT_PARAMETER_NAME << CPP_COMA << CPP_SPACE
+         << "[&]" << CPP_OPEN_PAREN << CPP_SIZE_T << CPP_SPACE
+         << SYNTHESIZED_BATCH_INDEX_VARIABLE_NAME << CPP_COMA << CPP_SPACE
+         << _context.contextCls << CPP_AMPERSAND << CPP_SPACE
+         << SYNTHESIZED_CONTEXT_PARAMETER_NAME << CPP_CLOSE_PAREN << CPP_SPACE
+         << CPP_OPEN_BRACE << CPP_NEWLINE;
+
+  renderIndentation(indentLvl + 2, ofsRef);
+  ofsRef << SYNTHESIZED_BATCH_RESULTS_PARAMETER_NAME << CPP_OPEN_BRACKET
+         << SYNTHESIZED_BATCH_INDEX_VARIABLE_NAME << CPP_CLOSE_BRACKET
+         << CPP_SPACE << CPP_ASSIGN << CPP_SPACE << inferenceDefn.name()
+         << CPP_OPEN_PAREN << SYNTHESIZED_CONTEXT_PARAMETER_NAME << CPP_COMA
+         << CPP_SPACE << CPP_STAR << argument.name() << CPP_OPEN_BRACKET
+         << SYNTHESIZED_BATCH_INDEX_VARIABLE_NAME << CPP_CLOSE_BRACKET
+         << CPP_COMA << CPP_SPACE << CPP_AMPERSAND
+         << SYNTHESIZED_BATCH_ERRORS_PARAMETER_NAME << CPP_OPEN_BRACKET
+         << SYNTHESIZED_BATCH_INDEX_VARIABLE_NAME << CPP_CLOSE_BRACKET
+         << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+
+  renderIndentation(indentLvl + 1, ofsRef);
+  ofsRef << CPP_CLOSE_BRACE << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+
+  renderIndentation(indentLvl, ofsRef);
+  ofsRef << CPP_CLOSE_BRACE << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeFailureHandler()
+{
+  const auto& handlerName =
+      _context.currentInferenceDefnContext.failureHandlerName;
+
+  // Failed premises of the method all return through this handler, so that
+  // the success path stays compact, e.g.
+  //   [[gnu::cold, gnu::noinline]] static TypeCls
+  //   CallInferenceFailure(size_t premise, int error, std::error_code* err);
+  if (!_opts.usePolicyTemplate) {
+    ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
+
+    auto& headerFileOfs = _context.headerFileOfs;
+    renderIndentationInHeaderFile();
+    headerFileOfs << CPP_COLD_FUNCTION_ATTRIBUTES << CPP_SPACE
+                  << CPP_STATIC_KEYWORD << CPP_SPACE << _context.typeCls
+                  << CPP_SPACE << handlerName << CPP_OPEN_PAREN << CPP_SIZE_T
+                  << CPP_COMA << CPP_SPACE << CPP_INT << CPP_COMA << CPP_SPACE
+                  << CPP_STD_ERROR_CODE << CPP_STAR
+                  << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+    headerFileOfs << CPP_NEWLINE;
+  }
+
+  auto& defnOfs = _context.defnOfs;
+  defnOfs << CPP_NEWLINE;
+  if (_opts.usePolicyTemplate) {
+    renderIndentationInDefn();
+    defnOfs << CPP_COLD_FUNCTION_ATTRIBUTES << CPP_SPACE << CPP_STATIC_KEYWORD
+            << CPP_SPACE << _context.typeCls << CPP_SPACE;
+  } else {
+    defnOfs << _context.typeCls << CPP_NEWLINE;
+    defnOfs << _context.clsName << CPP_COLON << CPP_COLON;
+  }
+  defnOfs << handlerName << CPP_OPEN_PAREN << CPP_SIZE_T << " /* "
+          << SYNTHESIZED_FAILURE_PREMISE_PARAMETER_NAME << " */" << CPP_COMA
+          << CPP_SPACE << CPP_INT << CPP_SPACE
+          << SYNTHESIZED_FAILURE_ERROR_PARAMETER_NAME << CPP_COMA << CPP_SPACE
+          << CPP_STD_ERROR_CODE << CPP_STAR << CPP_SPACE
+          << SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME << CPP_CLOSE_PAREN
+          << CPP_NEWLINE;
+  renderIndentationInDefn();
+  defnOfs << CPP_OPEN_BRACE << CPP_NEWLINE;
+  {
+    ScopedIndentationGuard scopedIndentation(_context.defnIndentLvl);
+    renderErrorCodeAssignmentAndReturn(
+        SYNTHESIZED_FAILURE_ERROR_PARAMETER_NAME);
+  }
+  renderIndentationInDefn();
+  defnOfs << CPP_CLOSE_BRACE << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeInlineMethodDefinitionOpening(
+    const ASTInferenceDefn& inferenceDefn)
+{
+  auto& defnOfs = _context.defnOfs;
+
+  // Inline definitions are nested one level within the class template.
+  indentDefn();
+
+  {
+    ScopedIndentationGuard scopedIndentation(_context.headerFileIndentLvl);
+    renderInferenceDefinitionMethodAnnotationComment(
+        inferenceDefn.name(), defnOfs, true /** isHeaderFile */);
+  }
+
+  renderIndentationInDefn();
+  defnOfs << CPP_STATIC_KEYWORD << CPP_SPACE;
+  defnOfs << _context.typeCls << CPP_SPACE;
+  defnOfs << inferenceDefn.name();
+  defnOfs << CPP_OPEN_PAREN;
+  renderContextParameter(
+      !inferenceDefn.arguments().empty() || !_opts.useException, defnOfs);
+  synthesizeArgumentList(inferenceDefn.arguments(), defnOfs);
+  if (!_opts.useException) {
+    defnOfs << CPP_COMA << CPP_SPACE;
+    defnOfs << CPP_STD_ERROR_CODE << CPP_STAR;
+    defnOfs << CPP_SPACE << SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME;
+  }
+  renderResetSiteParameter(true /** isDeclaration */, defnOfs);
+  defnOfs << CPP_CLOSE_PAREN;
+  defnOfs << CPP_NEWLINE;
+  renderIndentationInDefn();
+  defnOfs << CPP_OPEN_BRACE;
+  defnOfs << CPP_NEWLINE;
+
+  indentDefn();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeArgumentList(const ASTInferenceArgumentList& args,
+                                        std::ostream& ofsRef)
+{
+  for (size_t i = 0; i < args.size(); ++i) {
+    const auto& arg = args[i];
+    ofsRef << CPP_CONST_KEYWORD << CPP_SPACE << arg.typeName() << CPP_AMPERSAND
+           << CPP_SPACE << arg.name();
+    if (i + 1 < args.size()) {
+      ofsRef << CPP_COMA << CPP_SPACE;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeDeductionTarget(
+    const ASTDeductionTarget& deductionTarget,
+    const DeductionTargetArraySynthesisMode arrayMode, std::ostream& ofsRef)
+{
+  if (deductionTarget.isType<ASTDeductionTargetSingular>()) {
+    const auto& value = deductionTarget.value<ASTDeductionTargetSingular>();
+    // Globals are provided by the policy type, the same as the operations.
+    if (_context.currentInferenceDefnContext.globals.count(value.name())) {
+      renderPolicyQualifier(ofsRef);
+    }
+    ofsRef << value.name();
+  } else if (deductionTarget.isType<ASTDeductionTargetArray>()) {
+    const auto& value = deductionTarget.value<ASTDeductionTargetArray>();
+    // clang-format off
+    switch (arrayMode) {
+      case DeductionTargetArraySynthesisMode::AS_ARRAY:
+        {
+          if (value.hasSizeLiteral()) {
+            ofsRef << value.name();
+            ofsRef << CPP_OPEN_BRACKET;
+            ofsRef << value.sizeLiteral();
+            ofsRef << CPP_CLOSE_BRACKET;
+          } else {
+            // If the target does not have a size literal,
+            // then just render it as a raw pointer star.
+            ofsRef << CPP_STAR;
+            ofsRef << value.name();
+          }
+        }
+        break;
+      case DeductionTargetArraySynthesisMode::AS_RAW_POINTER_ARRAY:
+        {
+          ofsRef << CPP_STAR;
+          ofsRef << value.name();
+        }
+        break;
+      case DeductionTargetArraySynthesisMode::AS_SINGULAR:
+        {
+          ofsRef << value.name();
+        }
+        break;
+      case DeductionTargetArraySynthesisMode::AS_DECLARATION:
+        {
+          const auto& typeCls = _context.typeCls;
+          if (value.hasSizeLiteral()) {
+            // Fixed-capacity storage, filled in place by the proof method.
+            ofsRef << CPP_STD_ARRAY << '<' << typeCls << CPP_COMA << CPP_SPACE
+                   << value.sizeLiteral() << '>';
+          } else if (!_context.typeArrayCls.empty()) {
+            // User-supplied array type, e.g. a span into a scratch arena.
+            ofsRef << _context.typeArrayCls;
+          } else {
+            ofsRef << CPP_STD_VECTOR << '<' << typeCls << '>';
+          }
+          ofsRef << CPP_SPACE << value.name();
+        }
+        break;
+      default:
+        break;
+    }
+    // clang-format on
+  } else if (deductionTarget.isType<ASTDeductionTargetComputed>()) {
+    const auto& value = deductionTarget.value<ASTDeductionTargetComputed>();
+    renderPolicyQualifier(ofsRef);
+    ofsRef << value.name();
+    ofsRef << CPP_OPEN_PAREN;
+    const auto& arguments = value.arguments();
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      synthesizeDeductionTarget(
+          arguments[i], DeductionTargetArraySynthesisMode::AS_SINGULAR, ofsRef);
+      if (i + 1 < arguments.size()) {
+        ofsRef << CPP_COMA << CPP_SPACE;
+      }
+    }
+    ofsRef << CPP_CLOSE_PAREN;
+  } else {
+    SYNTHESIZER_ASSERT(0 && "Unknown type of deduction target.");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::synthesizeDeductionTargetForDeclaration(
+    const ASTDeductionTarget& deductionTarget, std::ostream& ofsRef)
 {
   const auto& typeCls = _context.typeCls;
 
   if (deductionTarget.isType<ASTDeductionTargetSingular>()) {
-    ofsRef << typeCls << CPP_SPACE;
-    synthesizeDeductionTarget(deductionTarget,
-                              DeductionTargetArraySynthesisMode::AS_STD_VECTOR,
-                              ofsRef);
+    const auto& value = deductionTarget.value<ASTDeductionTargetSingular>();
+    ofsRef << typeCls << CPP_SPACE << value.name();
   } else if (deductionTarget.isType<ASTDeductionTargetArray>()) {
     synthesizeDeductionTarget(deductionTarget,
-                              DeductionTargetArraySynthesisMode::AS_STD_VECTOR,
+                              DeductionTargetArraySynthesisMode::AS_DECLARATION,
                               ofsRef);
   } else {
     SYNTHESIZER_ASSERT(0 && "Unsupported deduction target.");
@@ -919,17 +2992,70 @@ SynthesizerImpl::synthesizeEqualityOperator(const EqualityOperator oprt,
 
 // -----------------------------------------------------------------------------
 
+void
+SynthesizerImpl::synthesizeFailedTypeComparison(
+    const ASTInferenceEqualityDefn& premiseDefn, const std::string& lhsIdx,
+    const std::string& rhsIdx)
+{
+  auto& defnOfs = _context.defnOfs;
+
+  // Subtype checks go straight to the oracle when one is specified, e.g.
+  //   !subtypes.isSubtype(lhs, rhs)
+  // while all other comparisons go through the type comparison method, e.g.
+  //   !cmpType(lhs, rhs, std::equal_to<Type>())
+  const auto itr =
+      _context.envDefnMap.find(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_SUBTYPE_ORACLE);
+  const bool useSubtypeOracle =
+      itr != _context.envDefnMap.cend() &&
+      (premiseDefn.oprt() == EqualityOperator::OPERATOR_LT ||
+       premiseDefn.oprt() == EqualityOperator::OPERATOR_LTE);
+
+  defnOfs << CPP_NEGATION;
+  if (useSubtypeOracle) {
+    renderPolicyQualifiedName(itr->second, defnOfs);
+    defnOfs << CPP_DOT;
+    defnOfs << (premiseDefn.oprt() == EqualityOperator::OPERATOR_LT
+                    ? SYNTHESIZED_SUBTYPE_ORACLE_PROPER_SUBTYPE_METHOD_NAME
+                    : SYNTHESIZED_SUBTYPE_ORACLE_SUBTYPE_METHOD_NAME);
+  } else {
+    renderPolicyQualifiedName(
+        _context.envDefnMap.at(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CMP_METHOD),
+        defnOfs);
+  }
+  defnOfs << CPP_OPEN_PAREN;
+  synthesizeDeductionTarget(premiseDefn.lhs(),
+                            DeductionTargetArraySynthesisMode::AS_SINGULAR,
+                            defnOfs);
+  if (!lhsIdx.empty()) {
+    defnOfs << CPP_OPEN_BRACKET << lhsIdx << CPP_CLOSE_BRACKET;
+  }
+  defnOfs << CPP_COMA << CPP_SPACE;
+  synthesizeDeductionTarget(premiseDefn.rhs(),
+                            DeductionTargetArraySynthesisMode::AS_SINGULAR,
+                            defnOfs);
+  if (!rhsIdx.empty()) {
+    defnOfs << CPP_OPEN_BRACKET << rhsIdx << CPP_CLOSE_BRACKET;
+  }
+  if (!useSubtypeOracle) {
+    defnOfs << CPP_COMA << CPP_SPACE;
+    synthesizeEqualityOperator(premiseDefn.oprt(), defnOfs);
+  }
+  defnOfs << CPP_CLOSE_PAREN;
+}
+
+// -----------------------------------------------------------------------------
+
 /* virtual */
 bool
 SynthesizerImpl::previsit(const ASTPropositionDefn& propositionDefn)
 {
-  renderIndentationInCppFile();
-  auto& cppFileOfs = _context.cppFileOfs;
-  cppFileOfs << CPP_RETURN_KEYWORD << CPP_SPACE;
+  renderIndentationInDefn();
+  auto& defnOfs = _context.defnOfs;
+  defnOfs << CPP_RETURN_KEYWORD << CPP_SPACE;
   synthesizeDeductionTarget(propositionDefn.target(),
                             DeductionTargetArraySynthesisMode::AS_ARRAY,
-                            _context.cppFileOfs);
-  cppFileOfs << CPP_SEMICOLON << CPP_NEWLINE;
+                            _context.defnOfs);
+  defnOfs << CPP_SEMICOLON << CPP_NEWLINE;
 
   return true;
 }
@@ -955,28 +3081,72 @@ SynthesizerImpl::renderIndentationInHeaderFile()
 // -----------------------------------------------------------------------------
 
 void
-SynthesizerImpl::renderIndentationInCppFile()
+SynthesizerImpl::renderIndentationInDefn()
+{
+  renderIndentation(_context.defnIndentLvl, _context.defnOfs);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::indentDefn()
+{
+  ASSERT(_context.defnIndentLvl <
+         std::numeric_limits<decltype(_context.defnIndentLvl)>::max());
+  ++_context.defnIndentLvl;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::dedentDefn()
+{
+  ASSERT(_context.defnIndentLvl >= 1);
+  --_context.defnIndentLvl;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::renderPolicyQualifier(std::ostream& ofsRef)
 {
-  renderIndentation(_context.cppFileIndentLvl, _context.cppFileOfs);
+  // The context holds all the state of the operations, policy or not.
+  if (!_context.contextCls.empty()) {
+    ofsRef << SYNTHESIZED_CONTEXT_PARAMETER_NAME << CPP_DOT;
+  } else if (_opts.usePolicyTemplate) {
+    ofsRef << SYNTHESIZED_POLICY_TEMPLATE_PARAMETER_NAME << CPP_COLON
+           << CPP_COLON;
+  }
 }
 
 // -----------------------------------------------------------------------------
 
 void
-SynthesizerImpl::indentCppFile()
+SynthesizerImpl::renderContextParameter(bool hasMoreParameters,
+                                        std::ostream& ofsRef)
 {
-  ASSERT(_context.cppFileIndentLvl <
-         std::numeric_limits<decltype(_context.cppFileIndentLvl)>::max());
-  ++_context.cppFileIndentLvl;
+  if (_context.contextCls.empty()) {
+    return;
+  }
+  ofsRef << _context.contextCls << CPP_AMPERSAND << CPP_SPACE
+         << SYNTHESIZED_CONTEXT_PARAMETER_NAME;
+  if (hasMoreParameters) {
+    ofsRef << CPP_COMA << CPP_SPACE;
+  }
 }
 
 // -----------------------------------------------------------------------------
 
 void
-SynthesizerImpl::dedentCppFile()
+SynthesizerImpl::renderPolicyQualifiedName(const std::string& name,
+                                           std::ostream& ofsRef)
 {
-  ASSERT(_context.cppFileIndentLvl >= 1);
-  --_context.cppFileIndentLvl;
+  // Names that are qualified already, such as the ones supplied by the
+  // Snowlake runtime, do not belong to the policy.
+  if (name.find("::") == std::string::npos) {
+    renderPolicyQualifier(ofsRef);
+  }
+  ofsRef << name;
 }
 
 // -----------------------------------------------------------------------------
@@ -994,7 +3164,13 @@ SynthesizerImpl::renderCustomInclude(const char* headerName,
 void
 SynthesizerImpl::renderSystemHeaderIncludes(std::ostream& ofsRef)
 {
-  std::vector<const char*> systemHeaders{"cstdlib", "cstddef", "vector"};
+  std::vector<const char*> systemHeaders{"cstdlib", "cstddef"};
+  if (_context.hasFixedCapacityArrays) {
+    systemHeaders.push_back("array");
+  }
+  if (_context.typeArrayCls.empty()) {
+    systemHeaders.push_back("vector");
+  }
   if (_opts.useException) {
     systemHeaders.push_back("exception");
   } else {
@@ -1007,6 +3183,86 @@ SynthesizerImpl::renderSystemHeaderIncludes(std::ostream& ofsRef)
 
 // -----------------------------------------------------------------------------
 
+void
+SynthesizerImpl::renderRuntimeHeaderIncludes(std::ostream& ofsRef)
+{
+  if (_context.envDefnMap.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME)) {
+    renderCustomInclude(SYNTHESIZED_RUNTIME_TYPE_TABLE_HEADER_FILENAME_BASE,
+                        ofsRef);
+    ofsRef << CPP_NEWLINE;
+  }
+  if (_context.envDefnMap.count(
+          SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ANNOTATION_STACK)) {
+    renderCustomInclude(
+        SYNTHESIZED_RUNTIME_ANNOTATION_STACK_HEADER_FILENAME_BASE, ofsRef);
+    ofsRef << CPP_NEWLINE;
+  }
+  if (_context.envDefnMap.count(
+          SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_FAILURE_RECORD)) {
+    renderCustomInclude(SYNTHESIZED_RUNTIME_FAILURE_RECORD_HEADER_FILENAME_BASE,
+                        ofsRef);
+    ofsRef << CPP_NEWLINE;
+  }
+  if (_opts.emitInstrumentation) {
+    renderCustomInclude(
+        SYNTHESIZED_RUNTIME_INSTRUMENTATION_HEADER_FILENAME_BASE, ofsRef);
+    ofsRef << CPP_NEWLINE;
+  }
+  if (_opts.usePolicyTemplate) {
+    renderCustomInclude(SYNTHESIZED_ERROR_CODE_HEADER_FILENAME_BASE, ofsRef);
+    ofsRef << CPP_NEWLINE;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::renderLightHeaderIncludes(std::ostream& ofsRef)
+{
+  // Only what the declarations of the class need. The runtime types they
+  // refer to are forward-declared, and fully included by the
+  // implementation-detail header file, e.g.
+  //   namespace sl {
+  //   namespace runtime {
+  //   class TypeHandle;
+  //   } // namespace runtime
+  //   } // namespace sl
+  std::vector<const char*> systemHeaders{"cstddef"};
+  std::vector<const char*> forwardDecls;
+  if (!_opts.useException) {
+    systemHeaders.push_back("system_error");
+  }
+  if (_context.envDefnMap.count(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME)) {
+    forwardDecls.push_back(SYNTHESIZED_RUNTIME_TYPE_CLASS_FORWARD_DECLARATION);
+  }
+  if (_context.envDefnMap.count(
+          SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_FAILURE_RECORD)) {
+    systemHeaders.push_back("string");
+    forwardDecls.push_back(
+        SYNTHESIZED_RUNTIME_FAILURE_RECORD_CLASS_FORWARD_DECLARATION);
+  }
+  if (_opts.emitInstrumentation) {
+    systemHeaders.push_back("iosfwd");
+    forwardDecls.push_back(
+        SYNTHESIZED_RUNTIME_RULE_COUNTERS_CLASS_FORWARD_DECLARATION);
+  }
+
+  __renderSystemHeaderIncludes(systemHeaders.begin(), systemHeaders.end(),
+                               ofsRef);
+  ofsRef << CPP_NEWLINE;
+
+  if (!forwardDecls.empty()) {
+    ofsRef << SYNTHESIZED_RUNTIME_NAMESPACE_BEGIN;
+    for (const auto forwardDecl : forwardDecls) {
+      ofsRef << forwardDecl << CPP_NEWLINE;
+    }
+    ofsRef << SYNTHESIZED_RUNTIME_NAMESPACE_END;
+    ofsRef << CPP_NEWLINE;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename Iterator>
 void
 SynthesizerImpl::__renderSystemHeaderIncludes(Iterator first, Iterator last,
@@ -1035,11 +3291,12 @@ SynthesizerImpl::renderTypeAnnotationSetupTeardownFixture(
     std::ostream& ofsRef)
 {
   // Synthesize type annotation setup code.
-  renderIndentationInCppFile();
+  renderIndentationInDefn();
+  renderPolicyQualifier(ofsRef);
   ofsRef << methodName << CPP_OPEN_PAREN;
   synthesizeIdentifiable(premiseDefn.source(), ofsRef);
-  auto& cppFileOfs = _context.cppFileOfs;
-  cppFileOfs << CPP_COMA << CPP_SPACE;
+  auto& defnOfs = _context.defnOfs;
+  defnOfs << CPP_COMA << CPP_SPACE;
   // Should assert that this deduction target here is singular form only.
   // [SNOWLAKE-17] Optimize and refine code synthesis pipeline
   synthesizeDeductionTarget(premiseDefn.deductionTarget(),
@@ -1052,24 +3309,177 @@ SynthesizerImpl::renderTypeAnnotationSetupTeardownFixture(
 // -----------------------------------------------------------------------------
 
 void
-SynthesizerImpl::renderErrorHandling()
+SynthesizerImpl::renderAnnotationScopeSetup(
+    const ASTInferencePremiseDefn& premiseDefn,
+    const std::string& annotationStackName, const std::string& scopeName)
+{
+  auto& defnOfs = _context.defnOfs;
+
+  // e.g.
+  //   sl::runtime::AnnotationScope scope0(annotations);
+  //   annotations.push(&call.caller_type, CLS_TYPE);
+  renderIndentationInDefn();
+  defnOfs << SYNTHESIZED_RUNTIME_ANNOTATION_SCOPE_CLASS_NAME << CPP_SPACE
+          << scopeName << CPP_OPEN_PAREN;
+  renderPolicyQualifiedName(annotationStackName, defnOfs);
+  defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+
+  renderIndentationInDefn();
+  renderPolicyQualifiedName(annotationStackName, defnOfs);
+  defnOfs << CPP_DOT << SYNTHESIZED_ANNOTATION_STACK_PUSH_METHOD_NAME
+          << CPP_OPEN_PAREN << CPP_AMPERSAND;
+  synthesizeIdentifiable(premiseDefn.source(), defnOfs);
+  defnOfs << CPP_COMA << CPP_SPACE;
+  synthesizeDeductionTarget(premiseDefn.deductionTarget(),
+                            DeductionTargetArraySynthesisMode::AS_SINGULAR,
+                            defnOfs);
+  defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SynthesizerImpl::useColdFailurePath() const
+{
+  // Within a decision tree, failed premises are an expected way of moving
+  // on to the next branch, rather than a cold path.
+  return _opts.useColdFailurePaths && !_opts.useException &&
+         _context.failureLabel.empty();
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SynthesizerImpl::useLightHeaders() const
+{
+  // Policy templates are header-only, so there is nothing to move out of the
+  // header file.
+  return _opts.useLightHeaders && !_opts.usePolicyTemplate;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::renderFailureConditionOpening()
+{
+  auto& defnOfs = _context.defnOfs;
+
+  defnOfs << CPP_IF << CPP_SPACE << CPP_OPEN_PAREN;
+  if (useColdFailurePath()) {
+    defnOfs << CPP_BUILTIN_EXPECT << CPP_OPEN_PAREN;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::renderFailureConditionClosing()
+{
+  auto& defnOfs = _context.defnOfs;
+
+  if (useColdFailurePath()) {
+    defnOfs << CPP_COMA << CPP_SPACE << '0' << CPP_CLOSE_PAREN;
+  }
+  defnOfs << CPP_CLOSE_PAREN << CPP_SPACE << CPP_OPEN_BRACE << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::renderErrorHandling(const char* errorCode,
+                                     const std::string& lhsIdx,
+                                     const std::string& rhsIdx)
+{
+  auto& defnOfs = _context.defnOfs;
+
+  // Within a decision tree, a failed premise moves on to the next branch,
+  // which must not see the annotations of the while-clauses it leaves.
+  // Annotation scopes are rolled back as the jump leaves their block, while
+  // the other annotations are torn down before it, innermost first.
+  if (!_context.failureLabel.empty()) {
+    const auto& pendingTeardowns = _context.pendingTeardowns;
+    for (auto itr = pendingTeardowns.rbegin(); itr != pendingTeardowns.rend();
+         ++itr) {
+      renderTypeAnnotationSetupTeardownFixture(
+          **itr,
+          _context.envDefnMap.at(
+              SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ANNOTATION_TEARDOWN_METHOD),
+          _context.defnOfs);
+    }
+    renderIndentationInDefn();
+    defnOfs << CPP_GOTO_KEYWORD << CPP_SPACE << _context.failureLabel
+            << CPP_SEMICOLON << CPP_NEWLINE;
+    _context.failureLabelUsed = true;
+    return;
+  }
+
+  auto& inferenceDefnContext = _context.currentInferenceDefnContext;
+  const auto premiseIdx = inferenceDefnContext.numPremisesVisited - 1;
+
+  // Count the failure of the rule, e.g.
+  //   SL_INSTRUMENT_FAILURE(ruleCounters, 0, 2);
+  if (_opts.emitInstrumentation) {
+    renderIndentationInDefn();
+    defnOfs << SYNTHESIZED_INSTRUMENT_FAILURE_MACRO_NAME << CPP_OPEN_PAREN
+            << SYNTHESIZED_RULE_COUNTERS_VARIABLE_NAME << CPP_COMA << CPP_SPACE
+            << inferenceDefnContext.ruleId << CPP_COMA << CPP_SPACE
+            << premiseIdx << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+  }
+
+  // Record what failed, e.g.
+  //   failure.record(0, 2, i, j);
+  const auto failureRecordItr =
+      _context.envDefnMap.find(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_FAILURE_RECORD);
+  if (failureRecordItr != _context.envDefnMap.cend()) {
+    renderIndentationInDefn();
+    renderPolicyQualifiedName(failureRecordItr->second, defnOfs);
+    defnOfs << CPP_DOT << SYNTHESIZED_FAILURE_RECORD_RECORD_METHOD_NAME
+            << CPP_OPEN_PAREN << inferenceDefnContext.ruleId << CPP_COMA
+            << CPP_SPACE << premiseIdx;
+    if (!lhsIdx.empty()) {
+      defnOfs << CPP_COMA << CPP_SPACE << lhsIdx << CPP_COMA << CPP_SPACE
+              << rhsIdx;
+    }
+    defnOfs << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+  }
+
+  // Hand the failure over to the cold handler of the method, e.g.
+  //   return CallInferenceFailure(2, InferenceErrorTypeComparisonFailed, err);
+  if (useColdFailurePath()) {
+    renderIndentationInDefn();
+    defnOfs << CPP_RETURN_KEYWORD << CPP_SPACE
+            << inferenceDefnContext.failureHandlerName << CPP_OPEN_PAREN
+            << premiseIdx << CPP_COMA << CPP_SPACE << errorCode << CPP_COMA
+            << CPP_SPACE << SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME
+            << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
+    inferenceDefnContext.failureHandlerUsed = true;
+    return;
+  }
+
+  renderErrorCodeAssignmentAndReturn(errorCode);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+SynthesizerImpl::renderErrorCodeAssignmentAndReturn(const char* errorCode)
 {
   const auto typeCls =
       _context.envDefnMap.at(SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CLASS);
 
-  auto& cppFileOfs = _context.cppFileOfs;
+  auto& defnOfs = _context.defnOfs;
 
   // Assign to output error parameter.
-  renderIndentationInCppFile();
-  cppFileOfs << CPP_STAR << SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME
+  renderIndentationInDefn();
+  defnOfs << CPP_STAR << SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME
              << CPP_SPACE << CPP_ASSIGN << CPP_SPACE << CPP_STD_ERROR_CODE
-             << CPP_OPEN_PAREN << '0' << CPP_COMA << CPP_SPACE
+             << CPP_OPEN_PAREN << errorCode << CPP_COMA << CPP_SPACE
              << SYNTHESIZED_GLOBAL_ERROR_CATEGORY_INSTANCE_NAME
              << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
 
   // Return default type class instance.
-  renderIndentationInCppFile();
-  cppFileOfs << CPP_RETURN_KEYWORD << CPP_SPACE << typeCls << CPP_OPEN_PAREN
+  renderIndentationInDefn();
+  defnOfs << CPP_RETURN_KEYWORD << CPP_SPACE << typeCls << CPP_OPEN_PAREN
              << CPP_CLOSE_PAREN << CPP_SEMICOLON << CPP_NEWLINE;
 }
 
@@ -1085,7 +3495,8 @@ SynthesizerImpl::initializeAndSynthesizeErrorCodeFiles()
   }
   ecHeaderFilepath.append(SYNTHESIZED_ERROR_CODE_HEADER_FILENAME);
 
-  std::ofstream ecHeaderFileOfs(ecHeaderFilepath, std::ofstream::out);
+  std::ofstream ecHeaderFileOfs;
+  openOutputFile(ecHeaderFilepath, &ecHeaderFileOfs);
   if (!ecHeaderFileOfs.good()) {
     return false;
   }
@@ -1097,11 +3508,17 @@ SynthesizerImpl::initializeAndSynthesizeErrorCodeFiles()
   }
   ecCppFilepath.append(SYNTHESIZED_ERROR_CODE_CPP_FILENAME);
 
-  std::ofstream ecCppFileOfs(ecCppFilepath, std::ofstream::out);
+  std::ofstream ecCppFileOfs;
+  openOutputFile(ecCppFilepath, &ecCppFileOfs);
   if (!ecCppFileOfs.good()) {
     return false;
   }
 
+  if (_outputFilepaths) {
+    _outputFilepaths->push_back(ecHeaderFilepath);
+    _outputFilepaths->push_back(ecCppFilepath);
+  }
+
   // Synthesize header file.
   {
     ecHeaderFileOfs << SYNTHESIZED_AUTHORING_COMMENT_BLOCK << CPP_NEWLINE;
@@ -1204,15 +3621,47 @@ SynthesizerImpl::renderInferenceDefinitionMethodAnnotationComment(
 
 // -----------------------------------------------------------------------------
 
+void
+SynthesizerImpl::renderGroupMethodAnnotationComment(
+    const char* annotationSource, std::ostream& ofs, bool isHeaderFile)
+{
+  if (_opts.suppressAnnotationComments)
+    return;
+
+  if (isHeaderFile)
+    renderIndentation(_context.headerFileIndentLvl, ofs);
+
+  ofs << COMMENT_BLOCK_BEGIN;
+
+  char buf[1024] = {0};
+  snprintf(buf, sizeof(buf),
+           "This method was synthesized from the %s of the \"%s\" rules "
+           "group.",
+           annotationSource, _context.clsName.c_str());
+
+  if (isHeaderFile)
+    renderIndentation(_context.headerFileIndentLvl, ofs);
+
+  ofs << " * ";
+  ofs << buf << '\n';
+
+  if (isHeaderFile)
+    renderIndentation(_context.headerFileIndentLvl, ofs);
+
+  ofs << COMMENT_BLOCK_END;
+}
+
+// -----------------------------------------------------------------------------
+
 void
 SynthesizerImpl::renderInferencePremiseAnnotationComment()
 {
   if (_opts.suppressAnnotationComments)
     return;
 
-  auto& ofs = _context.cppFileOfs;
+  auto& ofs = _context.defnOfs;
 
-  renderIndentationInCppFile();
+  renderIndentationInDefn();
   ofs << "// ";
 
   const auto nth =
@@ -1235,6 +3684,31 @@ SynthesizerImpl::renderInferencePremiseAnnotationComment()
 
 // -----------------------------------------------------------------------------
 
+void
+SynthesizerImpl::renderDecisionTreeLeafAnnotationComment(
+    const std::string& inferenceDefnName)
+{
+  if (_opts.suppressAnnotationComments)
+    return;
+
+  auto& ofs = _context.defnOfs;
+
+  renderIndentationInDefn();
+  ofs << "// ";
+
+  char buf[1024] = {0};
+  snprintf(buf, sizeof(buf),
+           "This corresponds to the proposition in the \"%s\" inference "
+           "definition.",
+           inferenceDefnName.c_str());
+
+  ofs << buf;
+
+  ofs << CPP_NEWLINE;
+}
+
+// -----------------------------------------------------------------------------
+
 void
 SynthesizerImpl::handleErrorWithMessageAndCode(const char* msg,
                                                CompilerError::Code code)
@@ -1254,3 +3728,22 @@ SynthesizerImpl::__getNextVarName()
 }
 
 // -----------------------------------------------------------------------------
+
+std::string
+SynthesizerImpl::__getNextLabelName()
+{
+  static const std::string defaultPrefix(SYNTHESIZED_DECISION_TREE_LABEL_PREFIX);
+  return defaultPrefix + std::to_string(_context.nameId++);
+}
+
+// -----------------------------------------------------------------------------
+
+std::string
+SynthesizerImpl::__getNextScopeName()
+{
+  static const std::string defaultPrefix(
+      SYNTHESIZED_ANNOTATION_SCOPE_VARIABLE_PREFIX);
+  return defaultPrefix + std::to_string(_context.nameId++);
+}
+
+// -----------------------------------------------------------------------------
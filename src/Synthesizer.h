@@ -25,7 +25,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "ast_fwd.h"
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 class Synthesizer
 {
@@ -34,6 +36,15 @@ public:
   {
     bool useException;
     bool suppressAnnotationComments;
+    bool usePolicyTemplate;
+    bool useColdFailurePaths;
+    bool emitInstrumentation;
+    // Keeps the header file of each group to the declarations of its class,
+    // and moves the rest to an implementation-detail header file.
+    bool useLightHeaders;
+    // Number of .cpp files the definitions of each group are split across.
+    // 0 and 1 both synthesize a single .cpp file.
+    uint32_t shards;
     std::string inputFilepath;
     std::string outputPath;
   };
@@ -44,6 +55,11 @@ public:
 
   bool run(const ASTModule&) const;
 
+  /**
+   * Also appends the paths of the files written to `outputFilepaths`.
+   */
+  bool run(const ASTModule&, std::vector<std::string>* outputFilepaths) const;
+
 private:
   Options _opts;
 };
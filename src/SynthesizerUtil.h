@@ -28,8 +28,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define FORWARD_SLASH '/'
 #define HEADER_FILE_EXT ".h"
 #define CPP_FILE_EXT ".cpp"
+#define DETAIL_HEADER_FILENAME_SUFFIX "Detail"
 #define CPP_PRAGMA_ONCE "#pragma once"
 #define CPP_CLASS_KEYWORD "class"
+#define CPP_TEMPLATE_KEYWORD "template"
+#define CPP_TYPENAME_KEYWORD "typename"
+#define CPP_STATIC_KEYWORD "static"
+#define CPP_CONSTEXPR_KEYWORD "constexpr"
+#define CPP_INLINE_KEYWORD "inline"
 #define CPP_OPEN_BRACE '{'
 #define CPP_CLOSE_BRACE '}'
 #define CPP_OPEN_PAREN '('
@@ -52,16 +58,34 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define CPP_IF "if"
 #define CPP_RETURN_KEYWORD "return"
 #define CPP_FOR_KEYWORD "for"
+#define CPP_SWITCH_KEYWORD "switch"
+#define CPP_CASE_KEYWORD "case"
+#define CPP_DEFAULT_KEYWORD "default"
+#define CPP_BREAK_KEYWORD "break"
+#define CPP_TRY_KEYWORD "try"
+#define CPP_GOTO_KEYWORD "goto"
+#define CPP_CATCH_ALL "catch (...)"
 #define CPP_SIZE_T "size_t"
+#define CPP_INT "int"
+#define CPP_BOOL "bool"
+#define CPP_FALSE "false"
+#define CPP_TRUE "true"
 #define CPP_LESS_THAN "<"
 #define CPP_DOT_SIZE ".size()"
+#define CPP_DOT_DATA ".data()"
+#define CPP_STD_ARRAY "std::array"
+#define CPP_STD_VECTOR "std::vector"
 #define CPP_INCREMENT_OPERATOR "++"
 #define CPP_INCLUDE_DIRECTIVE "#include"
 #define CPP_INCLUDE_DIRECTIVE_PREFIX "#include <"
 #define CPP_DOUBLE_QUOTE '"'
 #define CPP_STD_ERROR_CODE "std::error_code"
+#define CPP_STD_STRING "std::string"
+#define CPP_STD_OSTREAM "std::ostream"
 #define CPP_NEGATION '!'
 #define CPP_STD_EQUAL_TO_DEFAULT_INSTANTIATION "std::equal_to<>()"
+#define CPP_BUILTIN_EXPECT "__builtin_expect"
+#define CPP_COLD_FUNCTION_ATTRIBUTES "[[gnu::cold, gnu::noinline]]"
 #define CPP_NEWLINE '\n'
 
 #define COMMENT_BLOCK_BEGIN "/**\n"
@@ -72,12 +96,145 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #define SYNTHESIZER_DEFAULT_ERROR_OUTPUT_PARAMETER_NAME "err"
 
+#define SYNTHESIZER_RANGE_CLAUSE_UNROLL_THRESHOLD 8
+
+#define SYNTHESIZED_POLICY_TEMPLATE_PARAMETER_NAME "Policy"
+
+#define SYNTHESIZER_DEFAULT_DISPATCH_METHOD_NAME "dispatch"
+
+#define SYNTHESIZED_DISPATCH_KEY_PARAMETER_NAME "dispatchKey"
+
+#define SYNTHESIZED_DISPATCH_ERROR_VARIABLE_NAME "ec"
+
+#define SYNTHESIZED_DISPATCH_RESULT_VARIABLE_NAME "res"
+
+#define SYNTHESIZED_DECISION_TREE_LABEL_PREFIX "next"
+
+#define SYNTHESIZED_ANNOTATION_SCOPE_VARIABLE_PREFIX "scope"
+
+#define SYNTHESIZED_FAILURE_HANDLER_SUFFIX "Failure"
+
+#define SYNTHESIZED_FAILURE_PREMISE_PARAMETER_NAME "premise"
+
+#define SYNTHESIZED_FAILURE_ERROR_PARAMETER_NAME "error"
+
 #define SYNTHESIZED_AUTHORING_COMMENT_BLOCK                                    \
   "/**\n"                                                                      \
   " * Auto-generated by Snowlake compiler (version " SNOWLAKE_VERSION_STRING   \
   ").\n"                                                                       \
   " */"
 
+#define SYNTHESIZED_RUNTIME_NAMESPACE_BEGIN                                    \
+  "namespace sl {\n"                                                           \
+  "namespace runtime {\n"
+
+#define SYNTHESIZED_RUNTIME_NAMESPACE_END                                      \
+  "} // namespace runtime\n"                                                   \
+  "} // namespace sl\n"
+
+#define SYNTHESIZED_RUNTIME_TYPE_TABLE_HEADER_FILENAME_BASE "runtime/TypeTable"
+
+#define SYNTHESIZED_RUNTIME_TYPE_CLASS_NAME "sl::runtime::TypeHandle"
+
+#define SYNTHESIZED_RUNTIME_TYPE_CLASS_FORWARD_DECLARATION "class TypeHandle;"
+
+#define SYNTHESIZED_RUNTIME_TYPE_CMP_METHOD_NAME "sl::runtime::cmpType"
+
+#define SYNTHESIZED_RUNTIME_FAILURE_RECORD_HEADER_FILENAME_BASE               \
+  "runtime/FailureRecord"
+
+#define SYNTHESIZED_RUNTIME_FAILURE_RECORD_CLASS_NAME                          \
+  "sl::runtime::FailureRecord"
+
+#define SYNTHESIZED_RUNTIME_FAILURE_RECORD_CLASS_FORWARD_DECLARATION           \
+  "struct FailureRecord;"
+
+#define SYNTHESIZED_RUNTIME_FAILURE_RULE_INFO_CLASS_NAME                       \
+  "sl::runtime::FailureRuleInfo"
+
+#define SYNTHESIZED_RUNTIME_DESCRIBE_FAILURE_METHOD_NAME                       \
+  "sl::runtime::describeFailure"
+
+#define SYNTHESIZED_FAILURE_RECORD_RECORD_METHOD_NAME "record"
+
+#define SYNTHESIZED_DESCRIBE_FAILURE_METHOD_NAME "describeFailure"
+
+#define SYNTHESIZED_DESCRIBE_FAILURE_PARAMETER_NAME "record"
+
+#define SYNTHESIZED_DESCRIBE_FAILURE_RULES_VARIABLE_NAME "rules"
+
+#define SYNTHESIZED_DESCRIBE_FAILURE_PREMISES_SUFFIX "Premises"
+
+#define SYNTHESIZED_RUNTIME_INSTRUMENTATION_HEADER_FILENAME_BASE              \
+  "runtime/Instrumentation"
+
+#define SYNTHESIZED_RUNTIME_RULE_COUNTERS_CLASS_NAME                           \
+  "sl::runtime::RuleCounters"
+
+#define SYNTHESIZED_RUNTIME_RULE_COUNTERS_CLASS_FORWARD_DECLARATION            \
+  "struct RuleCounters;"
+
+#define SYNTHESIZED_RUNTIME_DUMP_RULE_COUNTERS_METHOD_NAME                     \
+  "sl::runtime::dumpRuleCounters"
+
+#define SYNTHESIZED_INSTRUMENT_RULE_MACRO_NAME "SL_INSTRUMENT_RULE"
+
+#define SYNTHESIZED_INSTRUMENT_PREMISE_MACRO_NAME "SL_INSTRUMENT_PREMISE"
+
+#define SYNTHESIZED_INSTRUMENT_FAILURE_MACRO_NAME "SL_INSTRUMENT_FAILURE"
+
+#define SYNTHESIZED_RULE_COUNTERS_VARIABLE_NAME "ruleCounters"
+
+#define SYNTHESIZED_DUMP_INSTRUMENTATION_METHOD_NAME "dumpInstrumentation"
+
+#define SYNTHESIZED_DUMP_INSTRUMENTATION_PARAMETER_NAME "os"
+
+#define SYNTHESIZED_DUMP_INSTRUMENTATION_NAMES_VARIABLE_NAME "names"
+
+#define SYNTHESIZED_RUNTIME_ANNOTATION_STACK_HEADER_FILENAME_BASE              \
+  "runtime/AnnotationStack"
+
+#define SYNTHESIZED_RUNTIME_ANNOTATION_SCOPE_CLASS_NAME                        \
+  "sl::runtime::AnnotationScope"
+
+#define SYNTHESIZED_ANNOTATION_STACK_PUSH_METHOD_NAME "push"
+
+#define SYNTHESIZED_ANNOTATION_SCOPE_ROLLBACK_METHOD_NAME "rollback"
+
+#define SYNTHESIZED_SUBTYPE_ORACLE_SUBTYPE_METHOD_NAME "isSubtype"
+
+#define SYNTHESIZED_SUBTYPE_ORACLE_PROPER_SUBTYPE_METHOD_NAME "isProperSubtype"
+
+#define SYNTHESIZED_PROOF_CACHE_LOOKUP_METHOD_NAME "lookup"
+
+#define SYNTHESIZED_PROOF_CACHE_INSERT_METHOD_NAME "insert"
+
+#define SYNTHESIZED_PROOF_CACHE_PATH_COUNT_NAME "ProofCachePathCount"
+
+#define SYNTHESIZED_DEPENDENCY_GRAPH_BEGIN_SITE_METHOD_NAME "beginSite"
+
+#define SYNTHESIZED_DEPENDENCY_GRAPH_RECORD_METHOD_NAME "record"
+
+#define SYNTHESIZED_RESET_SITE_PARAMETER_NAME "resetSite"
+
+#define SYNTHESIZED_CONTEXT_PARAMETER_NAME "ctx"
+
+#define SYNTHESIZED_BATCH_METHOD_SUFFIX "Batch"
+
+#define SYNTHESIZED_BATCH_RESULTS_PARAMETER_NAME "results"
+
+#define SYNTHESIZED_BATCH_ERRORS_PARAMETER_NAME "errs"
+
+#define SYNTHESIZED_BATCH_COUNT_PARAMETER_NAME "count"
+
+#define SYNTHESIZED_BATCH_INDEX_VARIABLE_NAME "i"
+
+#define SYNTHESIZED_BATCH_EXECUTOR_TEMPLATE_PARAMETER_NAME "Executor"
+
+#define SYNTHESIZED_BATCH_EXECUTOR_PARAMETER_NAME "executor"
+
+#define SYNTHESIZED_BATCH_EXECUTOR_METHOD_NAME "parallelFor"
+
 #define SYNTHESIZED_ERROR_CODE_HEADER_FILENAME_BASE "InferenceErrorDefn"
 
 #define SYNTHESIZED_ERROR_CODE_HEADER_FILENAME "InferenceErrorDefn.h"
@@ -89,6 +246,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
   "{\n"                                                                        \
   "    InferenceErrorInferredTypeMismatch = 0x01,\n"                           \
   "    InferenceErrorTypeComparisonFailed,\n"                                  \
+  "    InferenceErrorNoApplicableRule,\n"                                      \
   "};\n"                                                                       \
   "\n"                                                                         \
   "class InferenceErrorCategory;\n"                                            \
@@ -108,6 +266,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
   "                return \"Inferred type does not match with expected.\";\n"  \
   "            case InferenceErrorTypeComparisonFailed:\n"                     \
   "                return \"Type comparison failed.\";\n"                      \
+  "            case InferenceErrorNoApplicableRule:\n"                         \
+  "                return \"No applicable inference rule.\";\n"                \
   "            default:\n"                                                     \
   "                return \"Inference failed (unknown error).\";\n"            \
   "        }\n"                                                                \
@@ -119,6 +279,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #define SYNTHESIZED_ERROR_CATEGORY_CLASS_NAME "InferenceErrorCategory"
 
+#define SYNTHESIZED_ERROR_CODE_INFERRED_TYPE_MISMATCH                          \
+  "InferenceErrorInferredTypeMismatch"
+
+#define SYNTHESIZED_ERROR_CODE_TYPE_COMPARISON_FAILED                          \
+  "InferenceErrorTypeComparisonFailed"
+
+#define SYNTHESIZED_ERROR_CODE_NO_APPLICABLE_RULE "InferenceErrorNoApplicableRule"
+
 #define SYNTHESIZED_GLOBAL_ERROR_CATEGORY_INSTANCE_NAME                        \
   "inference_error_category"
 
@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <cstdlib>
 #include <string>
+#include <utility>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -38,14 +39,17 @@ typedef uint64_t IntegerType;
 
 // -----------------------------------------------------------------------------
 
+typedef std::vector<StringType> StringList;
 typedef std::vector<ASTIdentifier> ASTIdentifierList;
 typedef std::vector<ASTDeductionTarget> ASTDeductionTargetList;
 typedef std::vector<ASTPremiseDefn> ASTPremiseDefnList;
 typedef std::vector<ASTInferenceArgument> ASTInferenceArgumentList;
 typedef std::vector<ASTGlobalDecl> ASTGlobalDeclList;
 typedef std::vector<ASTEnvironmentDefn> ASTEnvironmentDefnList;
+typedef std::vector<ASTDispatchEntry> ASTDispatchEntryList;
 typedef std::vector<ASTInferenceDefn> ASTInferenceDefnList;
 typedef std::vector<ASTInferenceGroup> ASTInferenceGroupList;
+typedef std::vector<ASTImport> ASTImportList;
 
 // -----------------------------------------------------------------------------
 
@@ -74,7 +78,7 @@ public:
   }
 
   ASTIdentifier(StringType&& value)
-    : _value(value)
+    : _value(std::move(value))
   {
   }
 
@@ -98,7 +102,7 @@ public:
   }
 
   ASTIdentifiable(ASTIdentifierList&& identifiers)
-    : _identifiers(identifiers)
+    : _identifiers(std::move(identifiers))
   {
   }
 
@@ -107,6 +111,11 @@ public:
     _identifiers.emplace_back(element);
   }
 
+  void add(ASTIdentifier&& element)
+  {
+    _identifiers.emplace_back(std::move(element));
+  }
+
   const ASTIdentifierList& identifiers() const
   {
     return _identifiers;
@@ -127,7 +136,7 @@ public:
   }
 
   explicit ASTDeductionTargetSingular(StringType&& name)
-    : _name(name)
+    : _name(std::move(name))
   {
   }
 
@@ -152,13 +161,13 @@ public:
   }
 
   explicit ASTDeductionTargetArray(StringType&& name)
-    : _name(name)
+    : _name(std::move(name))
     , _arraySize()
   {
   }
 
   ASTDeductionTargetArray(StringType&& name, IntegerType arraySize)
-    : _name(name)
+    : _name(std::move(name))
     , _arraySize(arraySize)
   {
   }
@@ -196,8 +205,8 @@ public:
 
   ASTDeductionTargetComputed(StringType&& name,
                              ASTDeductionTargetList&& arguments)
-    : _name(name)
-    , _arguments(arguments)
+    : _name(std::move(name))
+    , _arguments(std::move(arguments))
   {
   }
 
@@ -227,17 +236,17 @@ public:
   }
 
   ASTDeductionTarget(ASTDeductionTargetSingular&& value)
-    : _value(value)
+    : _value(std::move(value))
   {
   }
 
   ASTDeductionTarget(ASTDeductionTargetArray&& value)
-    : _value(value)
+    : _value(std::move(value))
   {
   }
 
   ASTDeductionTarget(ASTDeductionTargetComputed&& value)
-    : _value(value)
+    : _value(std::move(value))
   {
   }
 
@@ -270,7 +279,7 @@ public:
   }
 
   ASTPropositionDefn(ASTDeductionTarget&& target)
-    : _target(target)
+    : _target(std::move(target))
   {
   }
 
@@ -299,7 +308,7 @@ public:
                  ASTDeductionTarget&& deductionTarget)
     : _lhsIdx(lhsIdx)
     , _rhsIdx(rhsIdx)
-    , _deductionTarget(deductionTarget)
+    , _deductionTarget(std::move(deductionTarget))
   {
   }
 
@@ -338,18 +347,18 @@ public:
 
   ASTInferenceEqualityDefn(ASTDeductionTarget&& lhs, ASTDeductionTarget&& rhs,
                            EqualityOperator oprt)
-    : _lhs(lhs)
-    , _rhs(rhs)
+    : _lhs(std::move(lhs))
+    , _rhs(std::move(rhs))
     , _oprt(oprt)
   {
   }
 
   ASTInferenceEqualityDefn(ASTDeductionTarget&& lhs, ASTDeductionTarget&& rhs,
                            EqualityOperator oprt, ASTRangeClause&& rangeClause)
-    : _lhs(lhs)
-    , _rhs(rhs)
+    : _lhs(std::move(lhs))
+    , _rhs(std::move(rhs))
     , _oprt(oprt)
-    , _rangeClause(rangeClause)
+    , _rangeClause(std::move(rangeClause))
   {
   }
 
@@ -396,7 +405,7 @@ public:
   }
 
   explicit ASTWhileClause(ASTPremiseDefnList&& premiseDefns)
-    : _premiseDefns(premiseDefns)
+    : _premiseDefns(std::move(premiseDefns))
   {
   }
 
@@ -423,8 +432,8 @@ public:
 
   ASTInferencePremiseDefn(ASTIdentifiable&& source,
                           ASTDeductionTarget&& deductionTarget)
-    : _source(source)
-    , _deductionTarget(deductionTarget)
+    : _source(std::move(source))
+    , _deductionTarget(std::move(deductionTarget))
     , _whileClause()
   {
   }
@@ -432,9 +441,9 @@ public:
   ASTInferencePremiseDefn(ASTIdentifiable&& source,
                           ASTDeductionTarget&& deductionTarget,
                           ASTWhileClause&& whileClause)
-    : _source(source)
-    , _deductionTarget(deductionTarget)
-    , _whileClause(whileClause)
+    : _source(std::move(source))
+    , _deductionTarget(std::move(deductionTarget))
+    , _whileClause(std::move(whileClause))
   {
   }
 
@@ -475,12 +484,12 @@ public:
   }
 
   ASTPremiseDefn(ASTInferencePremiseDefn&& defn)
-    : _value(defn)
+    : _value(std::move(defn))
   {
   }
 
   ASTPremiseDefn(ASTInferenceEqualityDefn&& defn)
-    : _value(defn)
+    : _value(std::move(defn))
   {
   }
 
@@ -513,8 +522,8 @@ public:
   }
 
   ASTInferenceArgument(StringType&& name, StringType&& typeName)
-    : _name(name)
-    , _typeName(typeName)
+    : _name(std::move(name))
+    , _typeName(std::move(typeName))
   {
   }
 
@@ -544,7 +553,7 @@ public:
   }
 
   ASTGlobalDecl(StringType&& name)
-    : _name(name)
+    : _name(std::move(name))
   {
   }
 
@@ -575,11 +584,11 @@ public:
                    ASTInferenceArgumentList&& arguments,
                    ASTPremiseDefnList&& premiseDefns,
                    ASTPropositionDefn&& propositionDefn)
-    : _name(name)
-    , _globalDecls(globalDecls)
-    , _arguments(arguments)
-    , _premiseDefns(premiseDefns)
-    , _propositionDefn(propositionDefn)
+    : _name(std::move(name))
+    , _globalDecls(std::move(globalDecls))
+    , _arguments(std::move(arguments))
+    , _premiseDefns(std::move(premiseDefns))
+    , _propositionDefn(std::move(propositionDefn))
   {
   }
 
@@ -628,8 +637,8 @@ public:
   }
 
   ASTEnvironmentDefn(StringType&& field, StringType&& value)
-    : _field(field)
-    , _value(value)
+    : _field(std::move(field))
+    , _value(std::move(value))
   {
   }
 
@@ -650,22 +659,86 @@ private:
 
 // -----------------------------------------------------------------------------
 
+class ASTDispatchEntry : public ASTNode
+{
+public:
+  ASTDispatchEntry()
+    : _key()
+    , _inferenceNames()
+  {
+  }
+
+  ASTDispatchEntry(StringType&& key, StringList&& inferenceNames)
+    : _key(std::move(key))
+    , _inferenceNames(std::move(inferenceNames))
+  {
+  }
+
+  const StringType& key() const
+  {
+    return _key;
+  }
+
+  const StringList& inferenceNames() const
+  {
+    return _inferenceNames;
+  }
+
+private:
+  StringType _key;
+  StringList _inferenceNames;
+};
+
+// -----------------------------------------------------------------------------
+
 class ASTInferenceGroup : public ASTNode
 {
 public:
   ASTInferenceGroup()
     : _name()
+    , _baseName()
     , _environmentDefns()
+    , _dispatchEntries()
     , _inferenceDefns()
+    , _base(nullptr)
   {
   }
 
   ASTInferenceGroup(StringType&& name,
                     ASTEnvironmentDefnList&& environmentDefns,
                     ASTInferenceDefnList&& inferenceDefns)
-    : _name(name)
-    , _environmentDefns(environmentDefns)
-    , _inferenceDefns(inferenceDefns)
+    : _name(std::move(name))
+    , _baseName()
+    , _environmentDefns(std::move(environmentDefns))
+    , _dispatchEntries()
+    , _inferenceDefns(std::move(inferenceDefns))
+    , _base(nullptr)
+  {
+  }
+
+  ASTInferenceGroup(StringType&& name,
+                    ASTEnvironmentDefnList&& environmentDefns,
+                    ASTDispatchEntryList&& dispatchEntries,
+                    ASTInferenceDefnList&& inferenceDefns)
+    : _name(std::move(name))
+    , _baseName()
+    , _environmentDefns(std::move(environmentDefns))
+    , _dispatchEntries(std::move(dispatchEntries))
+    , _inferenceDefns(std::move(inferenceDefns))
+    , _base(nullptr)
+  {
+  }
+
+  ASTInferenceGroup(StringType&& name, StringType&& baseName,
+                    ASTEnvironmentDefnList&& environmentDefns,
+                    ASTDispatchEntryList&& dispatchEntries,
+                    ASTInferenceDefnList&& inferenceDefns)
+    : _name(std::move(name))
+    , _baseName(std::move(baseName))
+    , _environmentDefns(std::move(environmentDefns))
+    , _dispatchEntries(std::move(dispatchEntries))
+    , _inferenceDefns(std::move(inferenceDefns))
+    , _base(nullptr)
   {
   }
 
@@ -674,20 +747,123 @@ public:
     return _name;
   }
 
+  /**
+   * Name of the imported group this group derives from, if any.
+   */
+  const StringType& baseName() const
+  {
+    return _baseName;
+  }
+
+  /**
+   * The imported group named by `baseName()`, once imports are resolved.
+   */
+  const ASTInferenceGroup* base() const
+  {
+    return _base;
+  }
+
+  void setBase(const ASTInferenceGroup* base)
+  {
+    _base = base;
+  }
+
   const ASTEnvironmentDefnList& environmentDefns() const
   {
     return _environmentDefns;
   }
 
+  ASTEnvironmentDefnList& environmentDefns()
+  {
+    return _environmentDefns;
+  }
+
+  const ASTDispatchEntryList& dispatchEntries() const
+  {
+    return _dispatchEntries;
+  }
+
+  ASTDispatchEntryList& dispatchEntries()
+  {
+    return _dispatchEntries;
+  }
+
   const ASTInferenceDefnList& inferenceDefns() const
   {
     return _inferenceDefns;
   }
 
+  ASTInferenceDefnList& inferenceDefns()
+  {
+    return _inferenceDefns;
+  }
+
 private:
   StringType _name;
+  StringType _baseName;
   ASTEnvironmentDefnList _environmentDefns;
+  ASTDispatchEntryList _dispatchEntries;
   ASTInferenceDefnList _inferenceDefns;
+  const ASTInferenceGroup* _base;
+};
+
+// -----------------------------------------------------------------------------
+
+class ASTImport : public ASTNode
+{
+public:
+  ASTImport()
+    : _name()
+    , _filepath()
+    , _module(nullptr)
+  {
+  }
+
+  explicit ASTImport(StringType&& name)
+    : _name(std::move(name))
+    , _filepath()
+    , _module(nullptr)
+  {
+  }
+
+  /**
+   * Dotted name of the imported module, relative to the importing one.
+   */
+  const StringType& name() const
+  {
+    return _name;
+  }
+
+  /**
+   * Path of the file of the imported module, once imports are resolved.
+   */
+  const StringType& filepath() const
+  {
+    return _filepath;
+  }
+
+  void setFilepath(StringType&& filepath)
+  {
+    _filepath = std::move(filepath);
+  }
+
+  /**
+   * The imported module, once imports are resolved.
+   */
+  const ASTModule* module() const
+  {
+    return _module;
+  }
+
+  void setModule(const ASTModule* module)
+  {
+    _module = module;
+  }
+
+private:
+  StringType _name;
+  StringType _filepath;
+  const ASTModule* _module;
 };
 
 // -----------------------------------------------------------------------------
@@ -696,13 +872,31 @@ class ASTModule : public ASTNode
 {
 public:
   ASTModule()
-    : _inferenceGroups()
+    : _imports()
+    , _inferenceGroups()
   {
   }
 
   explicit ASTModule(ASTInferenceGroupList&& inferenceGroups)
-    : _inferenceGroups(inferenceGroups)
+    : _imports()
+    , _inferenceGroups(std::move(inferenceGroups))
+  {
+  }
+
+  ASTModule(ASTImportList&& imports, ASTInferenceGroupList&& inferenceGroups)
+    : _imports(std::move(imports))
+    , _inferenceGroups(std::move(inferenceGroups))
+  {
+  }
+
+  const ASTImportList& imports() const
+  {
+    return _imports;
+  }
+
+  ASTImportList& imports()
   {
+    return _imports;
   }
 
   const ASTInferenceGroupList& inferenceGroups() const
@@ -716,6 +910,7 @@ public:
   }
 
 private:
+  ASTImportList _imports;
   ASTInferenceGroupList _inferenceGroups;
 };
 
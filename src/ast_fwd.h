@@ -29,8 +29,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 class ASTNode;
 class ASTModule;
+class ASTImport;
 class ASTInferenceGroup;
 class ASTEnvironmentDefn;
+class ASTDispatchEntry;
 class ASTInferenceDefn;
 class ASTGlobalDecl;
 class ASTInferenceArgument;
@@ -48,6 +48,70 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 #define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_CMP_METHOD "TypeCmpMethod"
 
+/**
+ * Key name for inference group environment definition
+ * "type array class" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ARRAY_CLASS "TypeArrayClass"
+
+/**
+ * Key name for inference group environment definition
+ * "type range comparison method" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RANGE_CMP_METHOD                  \
+  "TypeRangeCmpMethod"
+
+/**
+ * Key name for inference group environment definition
+ * "dispatch key class" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DISPATCH_KEY_CLASS "DispatchKeyClass"
+
+/**
+ * Key name for inference group environment definition
+ * "dispatch method" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DISPATCH_METHOD "DispatchMethod"
+
+/**
+ * Key name for inference group environment definition
+ * "try-all method" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TRY_ALL_METHOD "TryAllMethod"
+
+/**
+ * Key name for inference group environment definition
+ * "subtype oracle" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_SUBTYPE_ORACLE "SubtypeOracle"
+
+/**
+ * Key name for inference group environment definition "proof cache" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_PROOF_CACHE "ProofCache"
+
+/**
+ * Key name for inference group environment definition
+ * "dependency graph" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_DEPENDENCY_GRAPH "DependencyGraph"
+
+/**
+ * Key name for inference group environment definition "context class" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_CONTEXT_CLASS "ContextClass"
+
+/**
+ * Key name for inference group environment definition "type runtime" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_RUNTIME "TypeRuntime"
+
+/**
+ * Value of the "type runtime" field that selects the Snowlake runtime
+ * library for the representation and comparison of types.
+ */
+#define SNOWLAKE_ENVN_DEFN_VALUE_FOR_SNOWLAKE_TYPE_RUNTIME "snowlake"
+
 /**
  * Key name for inference group environment definition
  * "type annotation setup method" field.
@@ -61,3 +125,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 #define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ANNOTATION_TEARDOWN_METHOD        \
   "TypeAnnotationTeardownMethod"
+
+/**
+ * Key name for inference group environment definition
+ * "type annotation stack" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_TYPE_ANNOTATION_STACK                  \
+  "TypeAnnotationStack"
+
+/**
+ * Key name for inference group environment definition
+ * "failure record" field.
+ */
+#define SNOWLAKE_ENVN_DEFN_KEY_NAME_FOR_FAILURE_RECORD "FailureRecord"
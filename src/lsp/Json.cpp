@@ -0,0 +1,594 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "Json.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+// -----------------------------------------------------------------------------
+
+JsonValue::JsonValue()
+  : _type(Type::Null)
+  , _bool(false)
+  , _number(0)
+  , _string()
+  , _array()
+  , _object()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::JsonValue(bool value)
+  : JsonValue()
+{
+  _type = Type::Bool;
+  _bool = value;
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::JsonValue(int value)
+  : JsonValue(static_cast<double>(value))
+{
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::JsonValue(size_t value)
+  : JsonValue(static_cast<double>(value))
+{
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::JsonValue(double value)
+  : JsonValue()
+{
+  _type = Type::Number;
+  _number = value;
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::JsonValue(const char* value)
+  : JsonValue(std::string(value))
+{
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::JsonValue(std::string value)
+  : JsonValue()
+{
+  _type = Type::String;
+  _string = std::move(value);
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::JsonValue(Array value)
+  : JsonValue()
+{
+  _type = Type::Array;
+  _array = std::move(value);
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::JsonValue(Object value)
+  : JsonValue()
+{
+  _type = Type::Object;
+  _object = std::move(value);
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::Type
+JsonValue::type() const
+{
+  return _type;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+JsonValue::isNull() const
+{
+  return _type == Type::Null;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+JsonValue::asBool() const
+{
+  return _bool;
+}
+
+// -----------------------------------------------------------------------------
+
+double
+JsonValue::asNumber() const
+{
+  return _number;
+}
+
+// -----------------------------------------------------------------------------
+
+const std::string&
+JsonValue::asString() const
+{
+  return _string;
+}
+
+// -----------------------------------------------------------------------------
+
+const JsonValue::Array&
+JsonValue::asArray() const
+{
+  return _array;
+}
+
+// -----------------------------------------------------------------------------
+
+const JsonValue::Object&
+JsonValue::asObject() const
+{
+  return _object;
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::Array&
+JsonValue::asArray()
+{
+  return _array;
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue::Object&
+JsonValue::asObject()
+{
+  return _object;
+}
+
+// -----------------------------------------------------------------------------
+
+const JsonValue&
+JsonValue::operator[](const std::string& key) const
+{
+  static const JsonValue null;
+
+  if (_type != Type::Object) {
+    return null;
+  }
+
+  auto itr = _object.find(key);
+  return itr != _object.end() ? itr->second : null;
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue&
+JsonValue::operator[](const std::string& key)
+{
+  if (_type == Type::Null) {
+    _type = Type::Object;
+  }
+
+  return _object[key];
+}
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+class JsonParser
+{
+public:
+  JsonParser(const char* text, size_t length)
+    : _cur(text)
+    , _end(text + length)
+  {
+  }
+
+  bool parse(JsonValue* value)
+  {
+    if (!parseValue(value, 0)) {
+      return false;
+    }
+    skipBlanks();
+    return _cur == _end;
+  }
+
+private:
+  enum
+  {
+    MAX_DEPTH = 256
+  };
+
+  void skipBlanks()
+  {
+    while (_cur != _end &&
+           (*_cur == ' ' || *_cur == '\t' || *_cur == '\n' || *_cur == '\r')) {
+      ++_cur;
+    }
+  }
+
+  bool accept(char c)
+  {
+    skipBlanks();
+    if (_cur != _end && *_cur == c) {
+      ++_cur;
+      return true;
+    }
+    return false;
+  }
+
+  bool acceptWord(const char* word)
+  {
+    const char* cur = _cur;
+    for (; *word; ++word, ++cur) {
+      if (cur == _end || *cur != *word) {
+        return false;
+      }
+    }
+    _cur = cur;
+    return true;
+  }
+
+  bool parseValue(JsonValue* value, size_t depth)
+  {
+    skipBlanks();
+    if (_cur == _end || depth > MAX_DEPTH) {
+      return false;
+    }
+
+    switch (*_cur) {
+      case '{':
+        return parseObject(value, depth);
+      case '[':
+        return parseArray(value, depth);
+      case '"': {
+        std::string str;
+        if (!parseString(&str)) {
+          return false;
+        }
+        *value = JsonValue(std::move(str));
+        return true;
+      }
+      case 't':
+        *value = JsonValue(true);
+        return acceptWord("true");
+      case 'f':
+        *value = JsonValue(false);
+        return acceptWord("false");
+      case 'n':
+        *value = JsonValue();
+        return acceptWord("null");
+      default:
+        return parseNumber(value);
+    }
+  }
+
+  bool parseObject(JsonValue* value, size_t depth)
+  {
+    ++_cur;
+    JsonValue::Object object;
+    if (!accept('}')) {
+      do {
+        skipBlanks();
+        std::string key;
+        if (_cur == _end || *_cur != '"' || !parseString(&key) ||
+            !accept(':') || !parseValue(&object[key], depth + 1)) {
+          return false;
+        }
+      } while (accept(','));
+      if (!accept('}')) {
+        return false;
+      }
+    }
+    *value = JsonValue(std::move(object));
+    return true;
+  }
+
+  bool parseArray(JsonValue* value, size_t depth)
+  {
+    ++_cur;
+    JsonValue::Array array;
+    if (!accept(']')) {
+      do {
+        array.emplace_back();
+        if (!parseValue(&array.back(), depth + 1)) {
+          return false;
+        }
+      } while (accept(','));
+      if (!accept(']')) {
+        return false;
+      }
+    }
+    *value = JsonValue(std::move(array));
+    return true;
+  }
+
+  bool parseHex4(unsigned* code)
+  {
+    if (_end - _cur < 4) {
+      return false;
+    }
+    *code = 0;
+    for (int i = 0; i < 4; ++i, ++_cur) {
+      const char c = *_cur;
+      *code <<= 4;
+      if (c >= '0' && c <= '9') {
+        *code |= c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        *code |= c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        *code |= c - 'A' + 10;
+      } else {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static void appendUtf8(unsigned code, std::string* str)
+  {
+    if (code < 0x80) {
+      str->push_back(static_cast<char>(code));
+    } else if (code < 0x800) {
+      str->push_back(static_cast<char>(0xC0 | (code >> 6)));
+      str->push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else if (code < 0x10000) {
+      str->push_back(static_cast<char>(0xE0 | (code >> 12)));
+      str->push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+      str->push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else {
+      str->push_back(static_cast<char>(0xF0 | (code >> 18)));
+      str->push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+      str->push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+      str->push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+  }
+
+  bool parseString(std::string* str)
+  {
+    ++_cur;
+    while (_cur != _end) {
+      const char c = *_cur++;
+      if (c == '"') {
+        return true;
+      }
+      if (static_cast<unsigned char>(c) < 0x20) {
+        return false;
+      }
+      if (c != '\\') {
+        str->push_back(c);
+        continue;
+      }
+      if (_cur == _end) {
+        return false;
+      }
+      switch (*_cur++) {
+        case '"':
+          str->push_back('"');
+          break;
+        case '\\':
+          str->push_back('\\');
+          break;
+        case '/':
+          str->push_back('/');
+          break;
+        case 'b':
+          str->push_back('\b');
+          break;
+        case 'f':
+          str->push_back('\f');
+          break;
+        case 'n':
+          str->push_back('\n');
+          break;
+        case 'r':
+          str->push_back('\r');
+          break;
+        case 't':
+          str->push_back('\t');
+          break;
+        case 'u': {
+          unsigned code;
+          if (!parseHex4(&code)) {
+            return false;
+          }
+          // Surrogate pairs encode the code points past the BMP.
+          if (code >= 0xD800 && code < 0xDC00 && _end - _cur >= 6 &&
+              _cur[0] == '\\' && _cur[1] == 'u') {
+            const char* save = _cur;
+            _cur += 2;
+            unsigned low;
+            if (parseHex4(&low) && low >= 0xDC00 && low < 0xE000) {
+              code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+            } else {
+              _cur = save;
+            }
+          }
+          appendUtf8(code, str);
+          break;
+        }
+        default:
+          return false;
+      }
+    }
+    return false;
+  }
+
+  bool parseNumber(JsonValue* value)
+  {
+    const char* begin = _cur;
+    if (_cur != _end && *_cur == '-') {
+      ++_cur;
+    }
+    if (_cur == _end || *_cur < '0' || *_cur > '9') {
+      return false;
+    }
+    while (_cur != _end &&
+           ((*_cur >= '0' && *_cur <= '9') || *_cur == '.' || *_cur == 'e' ||
+            *_cur == 'E' || *_cur == '+' || *_cur == '-')) {
+      ++_cur;
+    }
+
+    const std::string text(begin, _cur);
+    char* end = nullptr;
+    const double number = strtod(text.c_str(), &end);
+    if (end != text.c_str() + text.size()) {
+      return false;
+    }
+    *value = JsonValue(number);
+    return true;
+  }
+
+private:
+  const char* _cur;
+  const char* _end;
+};
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
+/* static */
+bool
+JsonValue::Parse(const char* text, size_t length, JsonValue* value)
+{
+  JsonParser parser(text, length);
+  return parser.parse(value);
+}
+
+// -----------------------------------------------------------------------------
+
+std::string
+JsonValue::serialize() const
+{
+  std::string res;
+  serialize(&res);
+  return res;
+}
+
+// -----------------------------------------------------------------------------
+
+static void
+serializeString(const std::string& str, std::string* out)
+{
+  out->push_back('"');
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        out->append("\\\"");
+        break;
+      case '\\':
+        out->append("\\\\");
+        break;
+      case '\n':
+        out->append("\\n");
+        break;
+      case '\r':
+        out->append("\\r");
+        break;
+      case '\t':
+        out->append("\\t");
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[8] = {0};
+          snprintf(buf, sizeof(buf), "\\u%04x", c);
+          out->append(buf);
+        } else {
+          out->push_back(c);
+        }
+    }
+  }
+  out->push_back('"');
+}
+
+// -----------------------------------------------------------------------------
+
+void
+JsonValue::serialize(std::string* out) const
+{
+  switch (_type) {
+    case Type::Null:
+      out->append("null");
+      break;
+    case Type::Bool:
+      out->append(_bool ? "true" : "false");
+      break;
+    case Type::Number: {
+      char buf[32] = {0};
+      if (std::isfinite(_number) && _number == std::floor(_number) &&
+          std::fabs(_number) < 1e15) {
+        snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(_number));
+      } else if (std::isfinite(_number)) {
+        snprintf(buf, sizeof(buf), "%.17g", _number);
+      } else {
+        snprintf(buf, sizeof(buf), "null");
+      }
+      out->append(buf);
+      break;
+    }
+    case Type::String:
+      serializeString(_string, out);
+      break;
+    case Type::Array: {
+      out->push_back('[');
+      for (size_t i = 0; i < _array.size(); ++i) {
+        if (i) {
+          out->push_back(',');
+        }
+        _array[i].serialize(out);
+      }
+      out->push_back(']');
+      break;
+    }
+    case Type::Object: {
+      out->push_back('{');
+      bool first = true;
+      for (const auto& member : _object) {
+        if (!first) {
+          out->push_back(',');
+        }
+        first = false;
+        serializeString(member.first, out);
+        out->push_back(':');
+        member.second.serialize(out);
+      }
+      out->push_back('}');
+      break;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,105 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * JSON value, as exchanged with the client of the language server.
+ *
+ * Numbers are kept as doubles, which hold exactly the integers LSP uses.
+ */
+class JsonValue
+{
+public:
+  enum class Type
+  {
+    Null,
+    Bool,
+    Number,
+    String,
+    Array,
+    Object
+  };
+
+  typedef std::vector<JsonValue> Array;
+  typedef std::map<std::string, JsonValue> Object;
+
+  JsonValue();
+  JsonValue(bool);
+  JsonValue(int);
+  JsonValue(size_t);
+  JsonValue(double);
+  JsonValue(const char*);
+  JsonValue(std::string);
+  JsonValue(Array);
+  JsonValue(Object);
+
+  Type type() const;
+
+  bool isNull() const;
+
+  bool asBool() const;
+  double asNumber() const;
+  const std::string& asString() const;
+  const Array& asArray() const;
+  const Object& asObject() const;
+
+  Array& asArray();
+  Object& asObject();
+
+  /**
+   * Member `key` of an object, or a null value when there is none, or when
+   * this is not an object.
+   */
+  const JsonValue& operator[](const std::string& key) const;
+
+  /**
+   * Member `key` of an object, inserted if there is none. A null value
+   * becomes an empty object first.
+   */
+  JsonValue& operator[](const std::string& key);
+
+  /**
+   * Returns true if `text` holds exactly one JSON value, and stores it in
+   * `value`.
+   */
+  static bool Parse(const char* text, size_t length, JsonValue* value);
+
+  std::string serialize() const;
+
+private:
+  void serialize(std::string*) const;
+
+private:
+  Type _type;
+  bool _bool;
+  double _number;
+  std::string _string;
+  Array _array;
+  Object _object;
+};
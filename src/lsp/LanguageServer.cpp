@@ -0,0 +1,1125 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "LanguageServer.h"
+
+#include "CompilerErrorHandlerRegistrar.h"
+#include "ModuleCache.h"
+#include "SemanticAnalyzer.h"
+#include "Synthesizer.h"
+#include "ast.h"
+#include "parser/ParserDriver.h"
+#include "parser/ParserErrorCodes.h"
+#include "parser/Scanner.h"
+#include "version.h"
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+// -----------------------------------------------------------------------------
+
+// Error codes of JSON-RPC and LSP.
+#define LSP_ERROR_INVALID_REQUEST -32600
+#define LSP_ERROR_METHOD_NOT_FOUND -32601
+#define LSP_ERROR_INVALID_PARAMS -32602
+#define LSP_ERROR_SERVER_NOT_INITIALIZED -32002
+#define LSP_ERROR_REQUEST_FAILED -32803
+
+// Diagnostic severities of LSP.
+#define LSP_SEVERITY_ERROR 1
+#define LSP_SEVERITY_WARNING 2
+
+// -----------------------------------------------------------------------------
+
+#define DIAGNOSTIC_SOURCE "snowlake"
+
+// -----------------------------------------------------------------------------
+
+#define FILE_URI_SCHEME "file://"
+
+// -----------------------------------------------------------------------------
+
+typedef Scanner::Token Token;
+typedef yy::Parser::token Tokens;
+
+// -----------------------------------------------------------------------------
+
+struct LanguageServer::Document
+{
+  Document()
+    : parser(ParserDriver::Options{.traceLexer = false,
+                                   .traceParser = false,
+                                   .suppressErrorMessages = true,
+                                   .useSimdScanner = true,
+                                   .useRecursiveDescentParser = true})
+    , dirpath()
+    , parsed(false)
+    , lineStarts()
+    , reparsedParts()
+    , moduleErrors()
+    , groupErrors()
+    , defnErrors()
+  {
+  }
+
+  ParserDriver parser;
+
+  // Directory the imports of the module resolve against.
+  std::string dirpath;
+
+  // Whether the last parse succeeded. Semantic analysis only runs on
+  // modules without syntax errors.
+  bool parsed;
+
+  // Offsets of the first character of each line.
+  std::vector<size_t> lineStarts;
+
+  // Parts of the module reparsed since the last analysis.
+  std::vector<ParserDriver::ReparsedPart> reparsedParts;
+
+  // Semantic errors of the module, of each group, and of each inference
+  // definition of each group.
+  std::vector<CompilerError> moduleErrors;
+  std::vector<std::vector<CompilerError>> groupErrors;
+  std::vector<std::vector<std::vector<CompilerError>>> defnErrors;
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * The directory of the file a `file://` URI refers to, or the current
+ * directory for any other URI.
+ */
+static std::string
+directoryOfUri(const std::string& uri)
+{
+  const size_t schemeLen = strlen(FILE_URI_SCHEME);
+  if (uri.compare(0, schemeLen, FILE_URI_SCHEME) != 0) {
+    return std::string();
+  }
+  return ModuleCache::GetDirectoryOfPath(uri.substr(schemeLen));
+}
+
+// -----------------------------------------------------------------------------
+
+static void
+computeLineStarts(const std::string& text, std::vector<size_t>* lineStarts)
+{
+  lineStarts->assign(1, 0);
+  for (const char* cur = text.data(), *end = text.data() + text.size();
+       (cur = static_cast<const char*>(memchr(cur, '\n', end - cur)));) {
+    ++cur;
+    lineStarts->push_back(static_cast<size_t>(cur - text.data()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static void
+updateLineStarts(const ParserDriver::TextEdit& edit,
+                 std::vector<size_t>* lineStarts)
+{
+  const size_t editEnd = edit.offset + edit.length;
+
+  // Lines starting within the replaced text go, those starting within the
+  // new text come, and those after it move.
+  auto first = std::upper_bound(lineStarts->begin(), lineStarts->end(),
+                                edit.offset);
+  auto last = std::upper_bound(first, lineStarts->end(), editEnd);
+
+  std::vector<size_t> inserted;
+  for (size_t i = 0; i < edit.text.size(); ++i) {
+    if (edit.text[i] == '\n') {
+      inserted.push_back(edit.offset + i + 1);
+    }
+  }
+
+  for (auto itr = last; itr != lineStarts->end(); ++itr) {
+    *itr = *itr - edit.length + edit.text.size();
+  }
+
+  const size_t firstIdx = static_cast<size_t>(first - lineStarts->begin());
+  lineStarts->erase(first, last);
+  lineStarts->insert(lineStarts->begin() + firstIdx, inserted.begin(),
+                     inserted.end());
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns the number of UTF-16 code units of the UTF-8 character starting
+ * with byte `c`, or 0 if `c` continues a character.
+ */
+static size_t
+utf16Length(char c)
+{
+  const unsigned char byte = static_cast<unsigned char>(c);
+  if ((byte & 0xC0) == 0x80) {
+    return 0;
+  }
+  return byte >= 0xF0 ? 2 : 1;
+}
+
+// -----------------------------------------------------------------------------
+
+static size_t
+lineEndOf(const LanguageServer::Document& document, size_t line)
+{
+  return line + 1 < document.lineStarts.size()
+             ? document.lineStarts[line + 1] - 1
+             : document.parser.input().size();
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns the offset of an LSP position, whose character counts UTF-16 code
+ * units, clamped to the document.
+ */
+static size_t
+offsetOfPosition(const LanguageServer::Document& document,
+                 const JsonValue& position)
+{
+  const auto& input = document.parser.input();
+  const double line = position["line"].asNumber();
+  if (line < 0) {
+    return 0;
+  }
+  if (line >= document.lineStarts.size()) {
+    return input.size();
+  }
+
+  const size_t lineIdx = static_cast<size_t>(line);
+  const size_t lineEnd = lineEndOf(document, lineIdx);
+  const double character = position["character"].asNumber();
+
+  size_t offset = document.lineStarts[lineIdx];
+  for (size_t units = 0; offset < lineEnd; ++offset) {
+    units += utf16Length(input[offset]);
+    if (units > character) {
+      break;
+    }
+  }
+  // Do not stop within a character.
+  while (offset < lineEnd && !utf16Length(input[offset])) {
+    ++offset;
+  }
+
+  return offset;
+}
+
+// -----------------------------------------------------------------------------
+
+static JsonValue
+positionOfOffset(const LanguageServer::Document& document, size_t offset)
+{
+  const auto& input = document.parser.input();
+  offset = std::min(offset, input.size());
+
+  const auto& lineStarts = document.lineStarts;
+  const size_t line = static_cast<size_t>(
+      std::upper_bound(lineStarts.begin(), lineStarts.end(), offset) -
+      lineStarts.begin() - 1);
+
+  size_t character = 0;
+  for (size_t i = lineStarts[line]; i < offset; ++i) {
+    character += utf16Length(input[i]);
+  }
+
+  JsonValue position;
+  position["line"] = line;
+  position["character"] = character;
+  return position;
+}
+
+// -----------------------------------------------------------------------------
+
+static JsonValue
+rangeOf(const LanguageServer::Document& document, size_t begin, size_t end)
+{
+  JsonValue range;
+  range["start"] = positionOfOffset(document, begin);
+  range["end"] = positionOfOffset(document, end);
+  return range;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns the offset of a location of the parser, whose lines and columns
+ * count from 1, and whose columns count bytes.
+ */
+static size_t
+offsetOfLocation(const LanguageServer::Document& document,
+                 const yy::position& position)
+{
+  if (position.line < 1) {
+    return 0;
+  }
+  const size_t line = static_cast<size_t>(position.line) - 1;
+  if (line >= document.lineStarts.size()) {
+    return document.parser.input().size();
+  }
+  const size_t column =
+      position.column > 1 ? static_cast<size_t>(position.column) - 1 : 0;
+  return std::min(document.lineStarts[line] + column,
+                  lineEndOf(document, line));
+}
+
+// -----------------------------------------------------------------------------
+
+static std::vector<Token>
+tokenize(const std::string& input, const SourceSpan& span)
+{
+  std::vector<Token> tokens;
+  Scanner scanner(input.data() + span.begin, span.end - span.begin);
+  Token token;
+  for (scanner.scan(&token); token.kind != Tokens::END; scanner.scan(&token)) {
+    tokens.push_back(token);
+  }
+  return tokens;
+}
+
+// -----------------------------------------------------------------------------
+
+static bool
+isIdentifier(const Token& token, const Token& other)
+{
+  return token.kind == Tokens::IDENTIFIER &&
+         other.kind == Tokens::IDENTIFIER && token.length == other.length &&
+         !memcmp(token.text, other.text, token.length);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns the range of the `inference NAME` header of an inference
+ * definition.
+ */
+static JsonValue
+inferenceDefnHeaderRange(const LanguageServer::Document& document,
+                         const SourceSpan& span)
+{
+  const auto& input = document.parser.input();
+  const auto tokens = tokenize(input, span);
+  size_t end = span.begin;
+  if (tokens.size() > 1 && tokens[1].kind == Tokens::IDENTIFIER) {
+    end = static_cast<size_t>(tokens[1].text - input.data()) +
+          tokens[1].length;
+  }
+  return rangeOf(document, span.begin, end);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns the range of the sections of a group, without the blanks around
+ * them, or of the `{` before them if there are none.
+ */
+static JsonValue
+groupSectionsRange(const LanguageServer::Document& document,
+                   const SourceSpan& span)
+{
+  const auto& input = document.parser.input();
+  size_t begin = span.begin;
+  size_t end = span.end;
+  while (begin < end && isspace(static_cast<unsigned char>(input[begin]))) {
+    ++begin;
+  }
+  while (end > begin && isspace(static_cast<unsigned char>(input[end - 1]))) {
+    --end;
+  }
+  if (begin == end && begin > 0) {
+    return rangeOf(document, span.begin - 1, span.begin);
+  }
+  return rangeOf(document, begin, end);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Finds the inference definition of the module whose span contains
+ * `offset`, or the sections of a group when `*defnIdx` is set past its
+ * inference definitions.
+ * Return false if `offset` is in neither.
+ */
+static bool
+findSpan(const SourceIndex& sourceIndex, size_t offset, size_t* groupIdx,
+         size_t* defnIdx)
+{
+  auto group = std::upper_bound(
+      sourceIndex.begin(), sourceIndex.end(), offset,
+      [](size_t offset, const SourceGroupSpans& spans) {
+        return offset < spans.sections.begin;
+      });
+  if (group == sourceIndex.begin()) {
+    return false;
+  }
+  --group;
+
+  const auto& defns = group->inferenceDefns;
+  *groupIdx = static_cast<size_t>(group - sourceIndex.begin());
+
+  if (offset <= group->sections.end) {
+    *defnIdx = defns.size();
+    return true;
+  }
+
+  auto defn = std::upper_bound(defns.begin(), defns.end(), offset,
+                               [](size_t offset, const SourceSpan& span) {
+                                 return offset < span.begin;
+                               });
+  if (defn == defns.begin() || offset > (defn - 1)->end) {
+    return false;
+  }
+  *defnIdx = static_cast<size_t>(defn - 1 - defns.begin());
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns the index of the identifier at `offset` in `tokens`, or
+ * `tokens.size()` if there is none.
+ */
+static size_t
+findIdentifier(const std::string& input, const std::vector<Token>& tokens,
+               size_t offset)
+{
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    const auto& token = tokens[i];
+    if (token.kind != Tokens::IDENTIFIER) {
+      continue;
+    }
+    const size_t begin = static_cast<size_t>(token.text - input.data());
+    if (begin <= offset && offset <= begin + token.length) {
+      return i;
+    }
+  }
+  return tokens.size();
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns the index of the token declaring the identifier `tokens[idx]` in
+ * an inference definition, or `tokens.size()` if there is none.
+ *
+ * Globals and arguments are declared in their sections, and deduction
+ * targets by the first premise they are the target of. Since the sections
+ * come in this order, the declaration of a name is the first of the tokens
+ * declaring it.
+ */
+static size_t
+findDeclaration(const std::vector<Token>& tokens, size_t idx)
+{
+  // Members of identifiables are not declared.
+  if (idx > 0 && tokens[idx - 1].kind == Tokens::DOT) {
+    return tokens.size();
+  }
+
+  int section = Tokens::END;
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    const auto kind = tokens[i].kind;
+    if (kind == Tokens::KEYWORD_GLOBALS || kind == Tokens::KEYWORD_ARGUMENTS ||
+        kind == Tokens::KEYWORD_PREMISES ||
+        kind == Tokens::KEYWORD_PROPOSITION) {
+      section = kind;
+      continue;
+    }
+    if (!isIdentifier(tokens[i], tokens[idx])) {
+      continue;
+    }
+
+    bool declaration = false;
+    switch (section) {
+      case Tokens::KEYWORD_GLOBALS:
+        declaration = true;
+        break;
+      case Tokens::KEYWORD_ARGUMENTS:
+        declaration =
+            i + 1 < tokens.size() && tokens[i + 1].kind == Tokens::COLON;
+        break;
+      case Tokens::KEYWORD_PREMISES:
+        declaration = i > 0 && tokens[i - 1].kind == Tokens::COLON;
+        break;
+      default:
+        break;
+    }
+    if (declaration) {
+      return i;
+    }
+  }
+
+  return tokens.size();
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns whether the identifier `tokens[idx]` of the sections of a group
+ * names an inference definition in a dispatch entry.
+ */
+static bool
+isDispatchedInferenceName(const std::vector<Token>& tokens, size_t idx)
+{
+  bool inDispatchSet = false;
+  for (size_t i = 0; i < idx; ++i) {
+    if (tokens[i].kind == Tokens::IDENTIFIER && tokens[i].length == 8 &&
+        !memcmp(tokens[i].text, "dispatch", 8) && i + 2 < tokens.size() &&
+        tokens[i + 1].kind == Tokens::COLON &&
+        tokens[i + 2].kind == Tokens::LBRACKET) {
+      inDispatchSet = true;
+    }
+  }
+
+  const auto prevKind = idx > 0 ? tokens[idx - 1].kind : Tokens::END;
+  return inDispatchSet &&
+         (prevKind == Tokens::COLON || prevKind == Tokens::COMMA) &&
+         (idx + 1 == tokens.size() || tokens[idx + 1].kind != Tokens::COLON);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename Fn>
+static std::vector<CompilerError>
+collectErrors(Fn fn)
+{
+  std::vector<CompilerError> errors;
+  ScopedCompilerErrorHandlerRegister handler(
+      [&errors](CompilerError error) { errors.push_back(std::move(error)); });
+  fn();
+  return errors;
+}
+
+// -----------------------------------------------------------------------------
+
+static JsonValue
+makeDiagnostic(JsonValue range, int severity, CompilerError::Code code,
+               const std::string& message)
+{
+  JsonValue diagnostic;
+  diagnostic["range"] = std::move(range);
+  diagnostic["severity"] = severity;
+  diagnostic["code"] = static_cast<size_t>(code);
+  diagnostic["source"] = DIAGNOSTIC_SOURCE;
+  diagnostic["message"] = message;
+  return diagnostic;
+}
+
+// -----------------------------------------------------------------------------
+
+static void
+appendDiagnostics(const std::vector<CompilerError>& errors,
+                  const JsonValue& range, JsonValue::Array* diagnostics)
+{
+  for (const auto& error : errors) {
+    diagnostics->push_back(makeDiagnostic(
+        range,
+        error.type == CompilerError::Type::Warning ? LSP_SEVERITY_WARNING
+                                                   : LSP_SEVERITY_ERROR,
+        error.code, error.msg));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+static JsonValue
+makeNotification(const char* method, JsonValue params)
+{
+  JsonValue notification;
+  notification["jsonrpc"] = "2.0";
+  notification["method"] = method;
+  notification["params"] = std::move(params);
+  return notification;
+}
+
+// -----------------------------------------------------------------------------
+
+static JsonValue
+makeResponse(const JsonValue& id, JsonValue result)
+{
+  JsonValue response;
+  response["jsonrpc"] = "2.0";
+  response["id"] = id;
+  response["result"] = std::move(result);
+  return response;
+}
+
+// -----------------------------------------------------------------------------
+
+static JsonValue
+makeError(int code, const std::string& message)
+{
+  JsonValue error;
+  error["code"] = code;
+  error["message"] = message;
+  return error;
+}
+
+// -----------------------------------------------------------------------------
+
+static JsonValue
+makeErrorResponse(const JsonValue& id, JsonValue error)
+{
+  JsonValue response;
+  response["jsonrpc"] = "2.0";
+  response["id"] = id;
+  response["error"] = std::move(error);
+  return response;
+}
+
+// -----------------------------------------------------------------------------
+
+LanguageServer::LanguageServer()
+  : _documents()
+  , _moduleCache(new ModuleCache(ModuleCache::Options{
+        .parserOpts = ParserDriver::Options{.traceLexer = false,
+                                            .traceParser = false,
+                                            .suppressErrorMessages = false,
+                                            .useSimdScanner = true,
+                                            .useRecursiveDescentParser = true},
+        .semaOpts = SemanticAnalyzer::Options{.bailOnFirstError = false,
+                                              .warningsAsErrors = false,
+                                              .verbose = false}}))
+  , _initialized(false)
+  , _shutdown(false)
+{
+}
+
+// -----------------------------------------------------------------------------
+
+LanguageServer::~LanguageServer()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+int
+LanguageServer::exitCode() const
+{
+  return _shutdown ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+LanguageServer::handleMessage(const JsonValue& message,
+                              std::vector<JsonValue>* out)
+{
+  const auto& method = message["method"];
+  if (method.type() != JsonValue::Type::String) {
+    // Responses to requests of the server, which sends none.
+    return true;
+  }
+
+  const auto& name = method.asString();
+  const auto& id = message["id"];
+  const auto& params = message["params"];
+  const bool isRequest = message.asObject().count("id");
+
+  if (name == "exit") {
+    return false;
+  }
+
+  if (!_initialized && name != "initialize") {
+    if (isRequest) {
+      out->push_back(makeErrorResponse(
+          id, makeError(LSP_ERROR_SERVER_NOT_INITIALIZED,
+                        "Server not initialized")));
+    }
+    return true;
+  }
+
+  if (_shutdown) {
+    if (isRequest) {
+      out->push_back(makeErrorResponse(
+          id, makeError(LSP_ERROR_INVALID_REQUEST, "Server shut down")));
+    }
+    return true;
+  }
+
+  if (name == "initialize") {
+    if (_initialized) {
+      out->push_back(makeErrorResponse(
+          id,
+          makeError(LSP_ERROR_INVALID_REQUEST, "Server already initialized")));
+    } else {
+      _initialized = true;
+      out->push_back(makeResponse(id, initialize(params)));
+    }
+  } else if (name == "shutdown") {
+    _shutdown = true;
+    out->push_back(makeResponse(id, JsonValue()));
+  } else if (name == "textDocument/didOpen") {
+    didOpen(params, out);
+  } else if (name == "textDocument/didChange") {
+    didChange(params, out);
+  } else if (name == "textDocument/didClose") {
+    didClose(params, out);
+  } else if (name == "textDocument/definition") {
+    out->push_back(makeResponse(id, definition(params)));
+  } else if (name == "snowlake/synthesisPreview") {
+    JsonValue error;
+    JsonValue result = synthesisPreview(params, &error);
+    if (!error.isNull()) {
+      out->push_back(makeErrorResponse(id, std::move(error)));
+    } else {
+      out->push_back(makeResponse(id, std::move(result)));
+    }
+  } else if (isRequest) {
+    out->push_back(makeErrorResponse(
+        id, makeError(LSP_ERROR_METHOD_NOT_FOUND, "Unsupported method \"" +
+                                                      name + "\"")));
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue
+LanguageServer::initialize(const JsonValue& /* params */)
+{
+  JsonValue result;
+
+  auto& capabilities = result["capabilities"];
+  capabilities["textDocumentSync"]["openClose"] = true;
+  // Incremental.
+  capabilities["textDocumentSync"]["change"] = 2;
+  capabilities["definitionProvider"] = true;
+
+  result["serverInfo"]["name"] = "snowlake-lsp";
+  result["serverInfo"]["version"] = SNOWLAKE_VERSION_STRING;
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+LanguageServer::didOpen(const JsonValue& params, std::vector<JsonValue>* out)
+{
+  const auto& textDocument = params["textDocument"];
+  const auto& uri = textDocument["uri"].asString();
+
+  auto& document = _documents[uri];
+  document.reset(new Document());
+  document->dirpath = directoryOfUri(uri);
+
+  auto& parser = document->parser;
+  document->parsed =
+      parser.parseFromString(textDocument["text"].asString().c_str()) == 0;
+  computeLineStarts(parser.input(), &document->lineStarts);
+  document->reparsedParts.push_back(parser.reparsedPart());
+
+  analyze(document.get());
+  publishDiagnostics(uri, *document, out);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+LanguageServer::didChange(const JsonValue& params, std::vector<JsonValue>* out)
+{
+  const auto& uri = params["textDocument"]["uri"].asString();
+  Document* document = findDocument(params);
+  if (!document) {
+    return;
+  }
+
+  auto& parser = document->parser;
+  for (const auto& change : params["contentChanges"].asArray()) {
+    ParserDriver::TextEdit edit{0, parser.input().size(),
+                                change["text"].asString()};
+    const auto& range = change["range"];
+    if (!range.isNull()) {
+      size_t begin = offsetOfPosition(*document, range["start"]);
+      size_t end = offsetOfPosition(*document, range["end"]);
+      if (end < begin) {
+        std::swap(begin, end);
+      }
+      edit.offset = begin;
+      edit.length = end - begin;
+    }
+
+    document->parsed = parser.reparse(edit) == 0;
+    updateLineStarts(edit, &document->lineStarts);
+    document->reparsedParts.push_back(parser.reparsedPart());
+  }
+
+  analyze(document);
+  publishDiagnostics(uri, *document, out);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+LanguageServer::didClose(const JsonValue& params, std::vector<JsonValue>* out)
+{
+  const auto& uri = params["textDocument"]["uri"].asString();
+  _documents.erase(uri);
+
+  JsonValue diagnostics;
+  diagnostics["uri"] = uri;
+  diagnostics["diagnostics"] = JsonValue::Array();
+  out->push_back(
+      makeNotification("textDocument/publishDiagnostics", diagnostics));
+}
+
+// -----------------------------------------------------------------------------
+
+JsonValue
+LanguageServer::definition(const JsonValue& params)
+{
+  const Document* document = findDocument(params);
+  if (!document || !document->parsed) {
+    return JsonValue();
+  }
+
+  const auto& input = document->parser.input();
+  const auto& sourceIndex = document->parser.sourceIndex();
+  const size_t offset = offsetOfPosition(*document, params["position"]);
+
+  size_t groupIdx = 0;
+  size_t defnIdx = 0;
+  if (!findSpan(sourceIndex, offset, &groupIdx, &defnIdx)) {
+    return JsonValue();
+  }
+
+  const auto& defnSpans = sourceIndex[groupIdx].inferenceDefns;
+  const bool inSections = defnIdx == defnSpans.size();
+  const auto tokens = tokenize(
+      input, inSections ? sourceIndex[groupIdx].sections : defnSpans[defnIdx]);
+
+  const size_t idx = findIdentifier(input, tokens, offset);
+  if (idx == tokens.size()) {
+    return JsonValue();
+  }
+
+  JsonValue location;
+  location["uri"] = params["textDocument"]["uri"];
+
+  if (inSections) {
+    if (!isDispatchedInferenceName(tokens, idx)) {
+      return JsonValue();
+    }
+    const std::string name(tokens[idx].text, tokens[idx].length);
+    const auto& inferenceDefns =
+        document->parser.module().inferenceGroups()[groupIdx].inferenceDefns();
+    for (size_t i = 0; i < inferenceDefns.size(); ++i) {
+      if (inferenceDefns[i].name() == name) {
+        location["range"] = inferenceDefnHeaderRange(*document, defnSpans[i]);
+        return location;
+      }
+    }
+    return JsonValue();
+  }
+
+  const size_t declIdx = findDeclaration(tokens, idx);
+  if (declIdx == tokens.size()) {
+    return JsonValue();
+  }
+
+  const size_t begin =
+      static_cast<size_t>(tokens[declIdx].text - input.data());
+  location["range"] =
+      rangeOf(*document, begin, begin + tokens[declIdx].length);
+  return location;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Synthesizes the group of the inference definition at the position of the
+ * request, with only that inference definition and without dispatch
+ * entries, into a temporary directory, and returns the files synthesized.
+ */
+JsonValue
+LanguageServer::synthesisPreview(const JsonValue& params, JsonValue* error)
+{
+  const Document* document = findDocument(params);
+  if (!document) {
+    *error = makeError(LSP_ERROR_INVALID_PARAMS, "Unknown document");
+    return JsonValue();
+  }
+  if (!document->parsed) {
+    *error = makeError(LSP_ERROR_REQUEST_FAILED, "Document has syntax errors");
+    return JsonValue();
+  }
+
+  const auto& sourceIndex = document->parser.sourceIndex();
+  const size_t offset = offsetOfPosition(*document, params["position"]);
+
+  size_t groupIdx = 0;
+  size_t defnIdx = 0;
+  if (!findSpan(sourceIndex, offset, &groupIdx, &defnIdx) ||
+      defnIdx == sourceIndex[groupIdx].inferenceDefns.size()) {
+    return JsonValue();
+  }
+
+  const auto& inferenceGroup =
+      document->parser.module().inferenceGroups()[groupIdx];
+  const auto& inferenceDefn = inferenceGroup.inferenceDefns()[defnIdx];
+
+  ASTInferenceDefnList inferenceDefns;
+  inferenceDefns.push_back(inferenceDefn);
+  ASTInferenceGroupList inferenceGroups;
+  inferenceGroups.emplace_back(
+      StringType(inferenceGroup.name()),
+      ASTEnvironmentDefnList(inferenceGroup.environmentDefns()),
+      std::move(inferenceDefns));
+  const ASTModule module(std::move(inferenceGroups));
+
+  SemanticAnalyzer::Options semaOpts{
+      .bailOnFirstError = true, .warningsAsErrors = false, .verbose = false};
+  SemanticAnalyzer semaAnalyzer(semaOpts);
+  bool res = false;
+  auto errors = collectErrors([&] { res = semaAnalyzer.run(module); });
+  if (!res) {
+    *error = makeError(LSP_ERROR_REQUEST_FAILED,
+                       errors.empty() ? "Semantic analysis failed"
+                                      : errors.front().msg);
+    return JsonValue();
+  }
+
+  const char* tmpDir = getenv("TMPDIR");
+  std::string outputPath(tmpDir && *tmpDir ? tmpDir : "/tmp");
+  outputPath.append("/snowlake-lsp-XXXXXX");
+  if (!mkdtemp(&outputPath[0])) {
+    *error = makeError(LSP_ERROR_REQUEST_FAILED,
+                       "Failed to create output directory");
+    return JsonValue();
+  }
+
+  Synthesizer::Options synthesisOpts{.useException = false,
+                                     .suppressAnnotationComments = false,
+                                     .usePolicyTemplate = false,
+                                     .useColdFailurePaths = false,
+                                     .emitInstrumentation = false,
+                                     .useLightHeaders = false,
+                                     .shards = 1,
+                                     .inputFilepath =
+                                         params["textDocument"]["uri"]
+                                             .asString(),
+                                     .outputPath = outputPath};
+  Synthesizer synthesizer(synthesisOpts);
+  errors = collectErrors([&] { res = synthesizer.run(module); });
+
+  // Read back, and remove, the files synthesized.
+  std::map<std::string, std::string> files;
+  if (DIR* dir = opendir(outputPath.c_str())) {
+    while (const dirent* entry = readdir(dir)) {
+      const std::string name(entry->d_name);
+      if (name == "." || name == "..") {
+        continue;
+      }
+      const std::string filepath = outputPath + "/" + name;
+      std::ifstream ifs(filepath);
+      std::stringstream ss;
+      ss << ifs.rdbuf();
+      files[name] = ss.str();
+      unlink(filepath.c_str());
+    }
+    closedir(dir);
+  }
+  rmdir(outputPath.c_str());
+
+  if (!res) {
+    *error = makeError(LSP_ERROR_REQUEST_FAILED,
+                       errors.empty() ? "Synthesis failed" : errors.front().msg);
+    return JsonValue();
+  }
+
+  JsonValue result;
+  result["inference"] = inferenceDefn.name();
+  result["files"] = JsonValue::Array();
+  for (auto& file : files) {
+    JsonValue entry;
+    entry["name"] = file.first;
+    entry["text"] = std::move(file.second);
+    result["files"].asArray().push_back(std::move(entry));
+  }
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+
+LanguageServer::Document*
+LanguageServer::findDocument(const JsonValue& params)
+{
+  auto itr = _documents.find(params["textDocument"]["uri"].asString());
+  return itr != _documents.end() ? itr->second.get() : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Reanalyzes the parts of the module of a document reparsed since its last
+ * analysis: an inference definition, along with the checks of its group
+ * that span its inference definitions, the sections of a group, or the
+ * whole module.
+ */
+void
+LanguageServer::analyze(Document* document)
+{
+  auto reparsedParts = std::move(document->reparsedParts);
+  document->reparsedParts.clear();
+
+  if (!document->parsed) {
+    document->moduleErrors.clear();
+    document->groupErrors.clear();
+    document->defnErrors.clear();
+    return;
+  }
+
+  auto& module = document->parser.module();
+  const auto& inferenceGroups = module.inferenceGroups();
+
+  SemanticAnalyzer::Options semaOpts{
+      .bailOnFirstError = false, .warningsAsErrors = false, .verbose = false};
+  SemanticAnalyzer semaAnalyzer(semaOpts);
+
+  auto analyzeGroup = [&](size_t groupIdx) {
+    document->groupErrors[groupIdx] = collectErrors([&] {
+      semaAnalyzer.runOnInferenceGroup(inferenceGroups[groupIdx]);
+    });
+  };
+  auto analyzeDefn = [&](size_t groupIdx, size_t defnIdx) {
+    document->defnErrors[groupIdx][defnIdx] = collectErrors([&] {
+      semaAnalyzer.runOnInferenceDefn(
+          inferenceGroups[groupIdx].inferenceDefns()[defnIdx]);
+    });
+  };
+
+  const bool reparsedModule =
+      document->groupErrors.size() != inferenceGroups.size() ||
+      std::any_of(reparsedParts.begin(), reparsedParts.end(),
+                  [](const ParserDriver::ReparsedPart& part) {
+                    return part.kind ==
+                           ParserDriver::ReparsedPart::Kind::Module;
+                  });
+
+  // Imports only change along with the whole module, and imported modules
+  // are loaded once, unless their files change.
+  if (reparsedModule) {
+    document->moduleErrors = collectErrors([&] {
+      _moduleCache->resolveImports(&module, document->dirpath);
+      semaAnalyzer.runOnModule(module);
+    });
+    document->groupErrors.clear();
+    document->groupErrors.resize(inferenceGroups.size());
+    document->defnErrors.clear();
+    document->defnErrors.resize(inferenceGroups.size());
+    for (size_t groupIdx = 0; groupIdx < inferenceGroups.size(); ++groupIdx) {
+      analyzeGroup(groupIdx);
+      document->defnErrors[groupIdx].resize(
+          inferenceGroups[groupIdx].inferenceDefns().size());
+      for (size_t defnIdx = 0;
+           defnIdx < inferenceGroups[groupIdx].inferenceDefns().size();
+           ++defnIdx) {
+        analyzeDefn(groupIdx, defnIdx);
+      }
+    }
+    return;
+  }
+
+  for (const auto& part : reparsedParts) {
+    switch (part.kind) {
+      case ParserDriver::ReparsedPart::Kind::InferenceDefn:
+        analyzeDefn(part.groupIdx, part.defnIdx);
+        analyzeGroup(part.groupIdx);
+        break;
+      case ParserDriver::ReparsedPart::Kind::GroupSections:
+        analyzeGroup(part.groupIdx);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+LanguageServer::publishDiagnostics(const std::string& uri,
+                                   const Document& document,
+                                   std::vector<JsonValue>* out) const
+{
+  JsonValue::Array diagnostics;
+
+  for (const auto& syntaxError : document.parser.syntaxErrors()) {
+    const size_t begin =
+        offsetOfLocation(document, syntaxError.location.begin);
+    const size_t end = std::max(
+        begin, offsetOfLocation(document, syntaxError.location.end));
+    diagnostics.push_back(makeDiagnostic(rangeOf(document, begin, end),
+                                         LSP_SEVERITY_ERROR,
+                                         kParserInvalidSyntaxError,
+                                         syntaxError.message));
+  }
+
+  if (document.parsed) {
+    const auto& sourceIndex = document.parser.sourceIndex();
+
+    appendDiagnostics(document.moduleErrors, rangeOf(document, 0, 0),
+                      &diagnostics);
+
+    for (size_t groupIdx = 0; groupIdx < document.groupErrors.size() &&
+                              groupIdx < sourceIndex.size();
+         ++groupIdx) {
+      const auto& spans = sourceIndex[groupIdx];
+      if (!document.groupErrors[groupIdx].empty()) {
+        appendDiagnostics(document.groupErrors[groupIdx],
+                          groupSectionsRange(document, spans.sections),
+                          &diagnostics);
+      }
+
+      const auto& defnErrors = document.defnErrors[groupIdx];
+      for (size_t defnIdx = 0; defnIdx < defnErrors.size() &&
+                               defnIdx < spans.inferenceDefns.size();
+           ++defnIdx) {
+        if (!defnErrors[defnIdx].empty()) {
+          appendDiagnostics(
+              defnErrors[defnIdx],
+              inferenceDefnHeaderRange(document, spans.inferenceDefns[defnIdx]),
+              &diagnostics);
+        }
+      }
+    }
+  }
+
+  JsonValue params;
+  params["uri"] = uri;
+  params["diagnostics"] = std::move(diagnostics);
+  out->push_back(makeNotification("textDocument/publishDiagnostics", params));
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,99 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include "Json.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class ModuleCache;
+
+/**
+ * Language server for Snowlake inference definitions, speaking the Language
+ * Server Protocol.
+ *
+ * Each open document keeps its parser, which reparses only the inference
+ * definition or group sections an edit falls in, and the semantic
+ * diagnostics of each of its inference definitions and groups, of which
+ * only those of the reparsed parts are computed again. Imports resolve
+ * against the directory of the document, and imported modules are loaded
+ * once for all documents.
+ *
+ * Besides diagnostics, the server answers `textDocument/definition` for
+ * deduction targets, globals, arguments and the inference definitions named
+ * in dispatch entries, and the `snowlake/synthesisPreview` request, with
+ * the C++ synthesized for the inference definition at a position.
+ */
+class LanguageServer
+{
+public:
+  LanguageServer();
+  ~LanguageServer();
+
+  /**
+   * Handles a message from the client, and appends the responses and
+   * notifications to send back to `out`.
+   * Return false once the client has asked the server to exit.
+   */
+  bool handleMessage(const JsonValue& message, std::vector<JsonValue>* out);
+
+  /**
+   * Exit code of the server, which is 0 only if it was shut down before
+   * exiting.
+   */
+  int exitCode() const;
+
+  /**
+   * State of an open document.
+   */
+  struct Document;
+
+private:
+
+  JsonValue initialize(const JsonValue& params);
+
+  void didOpen(const JsonValue& params, std::vector<JsonValue>* out);
+  void didChange(const JsonValue& params, std::vector<JsonValue>* out);
+  void didClose(const JsonValue& params, std::vector<JsonValue>* out);
+
+  JsonValue definition(const JsonValue& params);
+
+  JsonValue synthesisPreview(const JsonValue& params, JsonValue* error);
+
+  Document* findDocument(const JsonValue& params);
+
+  void analyze(Document*);
+
+  void publishDiagnostics(const std::string& uri, const Document&,
+                          std::vector<JsonValue>* out) const;
+
+private:
+  std::map<std::string, std::unique_ptr<Document>> _documents;
+  std::unique_ptr<ModuleCache> _moduleCache;
+  bool _initialized;
+  bool _shutdown;
+};
@@ -0,0 +1,110 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "LanguageServer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Reads the next message from stdin, framed with a `Content-Length` header
+ * as LSP prescribes.
+ * Return false at the end of the input.
+ */
+static bool
+readMessage(std::string* body)
+{
+  size_t contentLength = 0;
+  bool hasContentLength = false;
+
+  char line[1024];
+  while (fgets(line, sizeof(line), stdin)) {
+    if (!strcmp(line, "\r\n") || !strcmp(line, "\n")) {
+      if (!hasContentLength) {
+        continue;
+      }
+      body->resize(contentLength);
+      return fread(&(*body)[0], 1, contentLength, stdin) == contentLength;
+    }
+
+    static const char kContentLength[] = "Content-Length:";
+    if (!strncasecmp(line, kContentLength, sizeof(kContentLength) - 1)) {
+      contentLength = strtoul(line + sizeof(kContentLength) - 1, nullptr, 10);
+      hasContentLength = true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+static void
+writeMessage(const JsonValue& message)
+{
+  const std::string body = message.serialize();
+  fprintf(stdout, "Content-Length: %zu\r\n\r\n", body.size());
+  fwrite(body.data(), 1, body.size(), stdout);
+  fflush(stdout);
+}
+
+// -----------------------------------------------------------------------------
+
+int
+main(int /* argc */, char** /* argv */)
+{
+  LanguageServer server;
+
+  std::string body;
+  std::vector<JsonValue> out;
+  while (readMessage(&body)) {
+    JsonValue message;
+    bool res = true;
+    if (!JsonValue::Parse(body.data(), body.size(), &message) ||
+        message.type() != JsonValue::Type::Object) {
+      JsonValue response;
+      response["jsonrpc"] = "2.0";
+      response["id"] = JsonValue();
+      response["error"]["code"] = -32700;
+      response["error"]["message"] = "Parse error";
+      out.push_back(std::move(response));
+    } else {
+      res = server.handleMessage(message, &out);
+    }
+
+    for (const auto& outMessage : out) {
+      writeMessage(outMessage);
+    }
+    out.clear();
+
+    if (!res) {
+      break;
+    }
+  }
+
+  return server.exitCode();
+}
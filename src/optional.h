@@ -54,9 +54,14 @@ public:
   {
   }
 
+  optional(T&& val)
+    : m_value(std::move(val))
+  {
+  }
+
   optional& operator=(T&& value)
   {
-    m_value = value;
+    m_value = std::move(value);
     return *this;
   }
 
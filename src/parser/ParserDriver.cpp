@@ -25,13 +25,18 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../CompilerErrorHandlerRegistrar.h"
 #include "ParserErrorCategory.h"
 #include "ParserErrorCodes.h"
+#include "RecursiveDescentParser.h"
+#include "Scanner.h"
 #include "lex.yy.hh"
 #include "parser.tab.hh"
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iterator>
 #include <sstream>
+#include <utility>
 
 // -----------------------------------------------------------------------------
 
@@ -54,12 +59,38 @@ private:
 
 // -----------------------------------------------------------------------------
 
+static bool
+isBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n';
+}
+
+// -----------------------------------------------------------------------------
+
+yy::Parser::symbol_type
+yylex(ParserDriver& driver)
+{
+  if (driver._scanner) {
+    return driver._scanner->next();
+  }
+  return yyflexlex(driver);
+}
+
+// -----------------------------------------------------------------------------
+
 ParserDriver::ParserDriver()
   : _opts(ParserDriver::Options{.traceLexer = false,
                                 .traceParser = false,
-                                .suppressErrorMessages = false})
+                                .suppressErrorMessages = false,
+                                .useSimdScanner = false,
+                                .useRecursiveDescentParser = false})
   , _inputFile()
+  , _input()
+  , _sourceIndex()
+  , _reparsedPart()
+  , _syntaxErrors()
   , _module()
+  , _scanner(nullptr)
 {
 }
 
@@ -68,7 +99,12 @@ ParserDriver::ParserDriver()
 ParserDriver::ParserDriver(Options opts)
   : _opts(opts)
   , _inputFile()
+  , _input()
+  , _sourceIndex()
+  , _reparsedPart()
+  , _syntaxErrors()
   , _module()
+  , _scanner(nullptr)
 {
 }
 
@@ -128,6 +164,38 @@ ParserDriver::setSuppressErrorMessages(bool val)
 
 // -----------------------------------------------------------------------------
 
+bool
+ParserDriver::useSimdScanner() const
+{
+  return _opts.useSimdScanner;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+ParserDriver::setUseSimdScanner(bool val)
+{
+  _opts.useSimdScanner = val;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ParserDriver::useRecursiveDescentParser() const
+{
+  return _opts.useRecursiveDescentParser;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+ParserDriver::setUseRecursiveDescentParser(bool val)
+{
+  _opts.useRecursiveDescentParser = val;
+}
+
+// -----------------------------------------------------------------------------
+
 int
 ParserDriver::parseFromFile(const std::string& filepath)
 {
@@ -138,10 +206,10 @@ ParserDriver::parseFromFile(const std::string& filepath)
                                   kParserBadInputError);
     return -1;
   }
-  std::string fileContent((std::istreambuf_iterator<char>(infile)),
-                          std::istreambuf_iterator<char>());
+  _input.assign((std::istreambuf_iterator<char>(infile)),
+                std::istreambuf_iterator<char>());
   infile.close();
-  return parseFromString(fileContent.c_str());
+  return parseInput();
 }
 
 // -----------------------------------------------------------------------------
@@ -149,11 +217,241 @@ ParserDriver::parseFromFile(const std::string& filepath)
 int
 ParserDriver::parseFromString(const char* input)
 {
-  ParserBuffer buf(input);
+  _input.assign(input);
+  return parseInput();
+}
+
+// -----------------------------------------------------------------------------
+
+int
+ParserDriver::reparse(const TextEdit& edit)
+{
+  if (edit.offset > _input.size() ||
+      edit.length > _input.size() - edit.offset) {
+    handleErrorWithMessageAndCode("Edit out of range of input",
+                                  kParserBadInputError);
+    return -1;
+  }
+
+  if (!_sourceIndex.empty()) {
+    const size_t editEnd = edit.offset + edit.length;
+    auto contains = [&](const SourceSpan& span) {
+      return span.begin <= edit.offset && editEnd <= span.end;
+    };
+
+    // The last group that starts before the edit.
+    auto group = std::upper_bound(
+        _sourceIndex.begin(), _sourceIndex.end(), edit.offset,
+        [](size_t offset, const SourceGroupSpans& spans) {
+          return offset < spans.sections.begin;
+        });
+
+    if (group == _sourceIndex.begin()) {
+      if (reparseSpan(edit, nullptr, 0, 0)) {
+        return 0;
+      }
+    } else {
+      --group;
+      const size_t groupIdx =
+          static_cast<size_t>(group - _sourceIndex.begin());
+      const auto& defns = group->inferenceDefns;
+
+      // The last inference definition of the group that starts at or
+      // before the edit.
+      auto defn = std::upper_bound(
+          defns.begin(), defns.end(), edit.offset,
+          [](size_t offset, const SourceSpan& span) {
+            return offset < span.begin;
+          });
+
+      if (contains(group->sections)) {
+        if (reparseSpan(edit, &group->sections, groupIdx, defns.size())) {
+          return 0;
+        }
+      } else if (defn == defns.begin()) {
+        if (reparseSpan(edit, nullptr, groupIdx, 0)) {
+          return 0;
+        }
+      } else {
+        --defn;
+        const size_t defnIdx = static_cast<size_t>(defn - defns.begin());
+        if (reparseSpan(edit, contains(*defn) ? &*defn : nullptr, groupIdx,
+                        defnIdx)) {
+          return 0;
+        }
+      }
+    }
+  }
+
+  _input.replace(edit.offset, edit.length, edit.text);
+
+  return parseInput();
+}
+
+// -----------------------------------------------------------------------------
+
+const std::string&
+ParserDriver::input() const
+{
+  return _input;
+}
+
+// -----------------------------------------------------------------------------
+
+const ParserDriver::ReparsedPart&
+ParserDriver::reparsedPart() const
+{
+  return _reparsedPart;
+}
+
+// -----------------------------------------------------------------------------
+
+const std::vector<ParserDriver::SyntaxError>&
+ParserDriver::syntaxErrors() const
+{
+  return _syntaxErrors;
+}
+
+// -----------------------------------------------------------------------------
+
+const SourceIndex&
+ParserDriver::sourceIndex() const
+{
+  return _sourceIndex;
+}
+
+// -----------------------------------------------------------------------------
+
+int
+ParserDriver::parseInput()
+{
+  _sourceIndex.clear();
+  _reparsedPart = ReparsedPart{ReparsedPart::Kind::Module, 0, 0};
+  _syntaxErrors.clear();
+
+  if (useRecursiveDescentParser()) {
+    RecursiveDescentParser parser(_input.data(), _input.size(), *this);
+    parser.setSourceIndex(&_sourceIndex);
+    const int res = parser.parse();
+    if (res) {
+      _sourceIndex.clear();
+    }
+    return res;
+  }
+
+  if (useSimdScanner()) {
+    Scanner scanner(_input.data(), _input.size());
+    _scanner = &scanner;
+    const int res = parse();
+    _scanner = nullptr;
+    return res;
+  }
+
+  ParserBuffer buf(_input.c_str());
 
   // Trace lexer.
   yyset_debug(traceLexer());
 
+  return parse();
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Applies `edit` by reparsing only `span`, the span of the inference
+ * definition `defnIdx` of group `groupIdx`, or of its sections when
+ * `defnIdx` is past its inference definitions. Without a span, the edit
+ * must only change blanks between spans.
+ *
+ * Return false, leaving everything as it was, if the edit cannot be applied
+ * this way.
+ */
+bool
+ParserDriver::reparseSpan(const TextEdit& edit, const SourceSpan* span,
+                          size_t groupIdx, size_t defnIdx)
+{
+  const size_t editEnd = edit.offset + edit.length;
+
+  if (!span) {
+    // Only blanks can change, and must still separate the tokens around
+    // them.
+    const char* removed = _input.data() + edit.offset;
+    if (!std::all_of(removed, removed + edit.length, isBlank) ||
+        !std::all_of(edit.text.begin(), edit.text.end(), isBlank)) {
+      return false;
+    }
+    const bool blankBefore =
+        edit.offset == 0 || isBlank(_input[edit.offset - 1]);
+    const bool blankAfter =
+        editEnd == _input.size() || isBlank(_input[editEnd]);
+    if (!blankBefore && !blankAfter) {
+      return false;
+    }
+  }
+
+  // Wraps around for edits that shorten the input, as do the offsets it is
+  // added to.
+  const size_t delta = edit.text.size() - edit.length;
+
+  if (span) {
+    std::string text(_input, span->begin, edit.offset - span->begin);
+    text += edit.text;
+    text.append(_input, editEnd, span->end - editEnd);
+
+    RecursiveDescentParser parser(text.data(), text.size(), *this);
+    parser.setReportErrors(false);
+
+    auto& inferenceGroup = _module.inferenceGroups()[groupIdx];
+    int res;
+    if (defnIdx < inferenceGroup.inferenceDefns().size()) {
+      res = parser.reparseInferenceDefn(
+          &inferenceGroup.inferenceDefns()[defnIdx]);
+    } else {
+      res = parser.reparseGroupSections(&inferenceGroup.environmentDefns(),
+                                        &inferenceGroup.dispatchEntries());
+    }
+    if (res) {
+      return false;
+    }
+
+    _reparsedPart = ReparsedPart{
+        defnIdx < inferenceGroup.inferenceDefns().size()
+            ? ReparsedPart::Kind::InferenceDefn
+            : ReparsedPart::Kind::GroupSections,
+        groupIdx, defnIdx};
+  } else {
+    _reparsedPart = ReparsedPart{ReparsedPart::Kind::Nothing, 0, 0};
+  }
+
+  _syntaxErrors.clear();
+
+  _input.replace(edit.offset, edit.length, edit.text);
+
+  // Move the spans after the edit.
+  auto shift = [&](SourceSpan* other) {
+    if (other == span) {
+      other->end += delta;
+    } else if (other->begin >= editEnd) {
+      other->begin += delta;
+      other->end += delta;
+    }
+  };
+
+  for (auto& groupSpans : _sourceIndex) {
+    shift(&groupSpans.sections);
+    for (auto& defnSpan : groupSpans.inferenceDefns) {
+      shift(&defnSpan);
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+int
+ParserDriver::parse()
+{
   yy::Parser parser(*this);
 
   // Trace parser.
@@ -190,10 +488,18 @@ ParserDriver::module() const
 
 // -----------------------------------------------------------------------------
 
+ASTModule&
+ParserDriver::module()
+{
+  return _module;
+}
+
+// -----------------------------------------------------------------------------
+
 void
 ParserDriver::setModule(ASTModule&& module)
 {
-  _module = module;
+  _module = std::move(module);
 }
 
 // -----------------------------------------------------------------------------
@@ -212,6 +518,8 @@ ParserDriver::handleErrorWithMessageAndCode(const char* msg,
 void
 ParserDriver::error(const yy::location& l, const std::string& m)
 {
+  _syntaxErrors.push_back(SyntaxError{l, m});
+
   if (!suppressErrorMessages()) {
     std::stringstream ss;
     ss << l;
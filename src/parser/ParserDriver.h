@@ -24,18 +24,27 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "../CompilerError.h"
+#include "RecursiveDescentParser.h"
 #include "ast.h"
 #include "location.hh"
 #include "parser.tab.hh"
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 // Tell Flex the lexer's prototype ...
-#define YY_DECL yy::Parser::symbol_type yylex(ParserDriver& driver)
+#define YY_DECL yy::Parser::symbol_type yyflexlex(ParserDriver& driver)
 
 // ... and declare it for the parser's sake.
 YY_DECL;
 
+// The parser calls `yylex()`, which reads the next token either from the
+// flex scanner or from the hand-written one.
+yy::Parser::symbol_type yylex(ParserDriver& driver);
+
+class Scanner;
+
 class ParserDriver
 {
 public:
@@ -44,6 +53,47 @@ public:
     bool traceLexer;
     bool traceParser;
     bool suppressErrorMessages;
+    bool useSimdScanner;
+    bool useRecursiveDescentParser;
+  };
+
+  /**
+   * Replacement of the `length` bytes at `offset` in the input with `text`.
+   */
+  struct TextEdit
+  {
+    size_t offset;
+    size_t length;
+    std::string text;
+  };
+
+  /**
+   * Part of the module replaced by the last parse: nothing, after an edit of
+   * blanks, an inference definition, the environment definitions and
+   * dispatch section of a group, or the whole module.
+   */
+  struct ReparsedPart
+  {
+    enum class Kind
+    {
+      Nothing,
+      InferenceDefn,
+      GroupSections,
+      Module
+    };
+
+    Kind kind;
+    size_t groupIdx;
+    size_t defnIdx;
+  };
+
+  /**
+   * Syntax error found by the last parse.
+   */
+  struct SyntaxError
+  {
+    yy::location location;
+    std::string message;
   };
 
 public:
@@ -69,6 +119,20 @@ public:
   bool suppressErrorMessages() const;
   void setSuppressErrorMessages(bool);
 
+  /**
+   * Getter and setter for scanning with the hand-written scanner, instead
+   * of the flex one.
+   */
+  bool useSimdScanner() const;
+  void setUseSimdScanner(bool);
+
+  /**
+   * Getter and setter for parsing with the hand-written recursive-descent
+   * parser, instead of the bison one.
+   */
+  bool useRecursiveDescentParser() const;
+  void setUseRecursiveDescentParser(bool);
+
   /**
    * Run the parser on input file.
    * Return 0 on success.
@@ -81,6 +145,43 @@ public:
    */
   int parseFromString(const char*);
 
+  /**
+   * Apply an edit to the input last parsed, and parse it again.
+   *
+   * When the input was parsed with the recursive-descent parser, and the edit
+   * falls within an inference definition, or within the environment
+   * definitions and dispatch section of a group, only that part is reparsed
+   * and replaced in the module, and the rest of the module is left as it
+   * was. Edits of blanks between them are applied without reparsing
+   * anything. Any other edit, or one after which the part does not parse on
+   * its own, reparses the whole input.
+   * Return 0 on success.
+   */
+  int reparse(const TextEdit&);
+
+  /**
+   * The input last parsed, with the edits applied since.
+   */
+  const std::string& input() const;
+
+  /**
+   * Getter for the part of the module replaced by the last parse.
+   */
+  const ReparsedPart& reparsedPart() const;
+
+  /**
+   * Getter for the syntax errors found by the last parse, whether or not
+   * their messages are suppressed.
+   */
+  const std::vector<SyntaxError>& syntaxErrors() const;
+
+  /**
+   * Getter for the extents of the parts of the module that can be reparsed
+   * on their own. Empty unless the input was parsed with the
+   * recursive-descent parser.
+   */
+  const SourceIndex& sourceIndex() const;
+
   /**
    * The name of the file being parsed.
    * Used later to pass the file name to the location tracker.
@@ -92,6 +193,7 @@ public:
    * Getter and setter for module.
    */
   const ASTModule& module() const;
+  ASTModule& module();
   void setModule(ASTModule&&);
 
   /**
@@ -101,10 +203,24 @@ public:
   void error(const std::string& m);
 
 private:
+  friend yy::Parser::symbol_type yylex(ParserDriver&);
+
+  int parse();
+
+  int parseInput();
+
+  bool reparseSpan(const TextEdit&, const SourceSpan* span, size_t groupIdx,
+                   size_t defnIdx);
+
   void handleErrorWithMessageAndCode(const char*, CompilerError::Code);
 
 private:
   Options _opts;
   std::string _inputFile;
+  std::string _input;
+  SourceIndex _sourceIndex;
+  ReparsedPart _reparsedPart;
+  std::vector<SyntaxError> _syntaxErrors;
   ASTModule _module;
+  Scanner* _scanner;
 };
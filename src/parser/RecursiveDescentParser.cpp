@@ -0,0 +1,969 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "RecursiveDescentParser.h"
+
+#include "ParserDriver.h"
+#include "parser.tab.hh"
+
+#include <algorithm>
+#include <utility>
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// -----------------------------------------------------------------------------
+
+typedef yy::Parser::token Tokens;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Name of a token as it appears in the syntax errors of the bison parser.
+ */
+std::string
+tokenName(Tokens::token_kind_type kind)
+{
+  return yy::Parser::symbol_name(yy::Parser::by_kind(kind).kind());
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Most tokens listed as expected in a syntax error, beyond which bison lists
+ * none of them.
+ */
+const size_t kMaxExpectedTokenCount = 4;
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace */
+
+// -----------------------------------------------------------------------------
+
+RecursiveDescentParser::RecursiveDescentParser(const char* input,
+                                               size_t length,
+                                               ParserDriver& driver)
+  : _driver(driver)
+  , _input(input)
+  , _scanner(input, length)
+  , _token()
+  , _next()
+  , _hasNext(false)
+  , _recovering(false)
+  , _reportErrors(true)
+  , _errorCount(0)
+  , _sourceIndex(nullptr)
+  , _prevEnd(0)
+{
+  _scanner.scan(&_token);
+}
+
+// -----------------------------------------------------------------------------
+
+int
+RecursiveDescentParser::parse()
+{
+  ASTImportList imports;
+  ASTInferenceGroupList inferenceGroups;
+
+  // Imports come before any group.
+  while (_token.kind == Tokens::IDENTIFIER) {
+    if (!parseImport(&imports)) {
+      synchronize();
+    }
+  }
+
+  while (_token.kind != Tokens::END) {
+    if (_token.kind != Tokens::KEYWORD_GROUP) {
+      // Only the end of the input is expected, once the groups have been
+      // reduced, as in the bison parser.
+      error({Tokens::END});
+      skip();
+    } else if (parseInferenceGroup(&inferenceGroups)) {
+      continue;
+    }
+    // Nothing outside of a group can be recovered, so skip to the next one.
+    while (_token.kind != Tokens::END &&
+           _token.kind != Tokens::KEYWORD_GROUP) {
+      skip();
+    }
+  }
+
+  if (_errorCount) {
+    return 1;
+  }
+
+  _driver.setModule(ASTModule(std::move(imports), std::move(inferenceGroups)));
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+int
+RecursiveDescentParser::reparseInferenceDefn(ASTInferenceDefn* inferenceDefn)
+{
+  ASTInferenceDefnList inferenceDefns;
+
+  if (_token.kind != Tokens::KEYWORD_INFERENCE) {
+    error({Tokens::KEYWORD_INFERENCE});
+    return 1;
+  }
+
+  if (!parseInferenceDefn(&inferenceDefns) || !expect(Tokens::END) ||
+      _errorCount) {
+    return 1;
+  }
+
+  *inferenceDefn = std::move(inferenceDefns.front());
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+int
+RecursiveDescentParser::reparseGroupSections(
+    ASTEnvironmentDefnList* environmentDefns,
+    ASTDispatchEntryList* dispatchEntries)
+{
+  ASTEnvironmentDefnList newEnvironmentDefns;
+  ASTDispatchEntryList newDispatchEntries;
+
+  parseGroupSections(&newEnvironmentDefns, &newDispatchEntries);
+
+  if (!expect(Tokens::END) || _errorCount) {
+    return 1;
+  }
+
+  *environmentDefns = std::move(newEnvironmentDefns);
+  *dispatchEntries = std::move(newDispatchEntries);
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+RecursiveDescentParser::setSourceIndex(SourceIndex* sourceIndex)
+{
+  _sourceIndex = sourceIndex;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::reportErrors() const
+{
+  return _reportErrors;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+RecursiveDescentParser::setReportErrors(bool val)
+{
+  _reportErrors = val;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseImport(ASTImportList* imports)
+{
+  const yy::location location = _token.location;
+
+  StringType keyword;
+  StringType name;
+  if (!expectIdentifier(&keyword) || !expectIdentifier(&name)) {
+    return false;
+  }
+
+  while (accept(Tokens::DOT)) {
+    StringType component;
+    if (!expectIdentifier(&component)) {
+      return false;
+    }
+    name += '.';
+    name += component;
+  }
+
+  if (!expectEither(Tokens::DOT, Tokens::SEMICOLON)) {
+    return false;
+  }
+
+  // "import" is a contextual keyword, so that it remains usable as an
+  // identifier everywhere else.
+  if (keyword != "import") {
+    error(location,
+          "syntax error, unexpected \"" + keyword + "\", expecting import");
+    return false;
+  }
+
+  imports->emplace_back(std::move(name));
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseInferenceGroup(
+    ASTInferenceGroupList* inferenceGroups)
+{
+  advance();
+
+  StringType name;
+  if (!expectIdentifier(&name)) {
+    return false;
+  }
+
+  StringType baseName;
+  if (accept(Tokens::COLON)) {
+    if (!expectIdentifier(&baseName) || !expect(Tokens::LBRACE)) {
+      return false;
+    }
+  } else if (!expect(Tokens::LBRACE)) {
+    return false;
+  }
+
+  SourceGroupSpans spans;
+  spans.sections.begin = _prevEnd;
+
+  ASTEnvironmentDefnList environmentDefns;
+  ASTDispatchEntryList dispatchEntries;
+  parseGroupSections(&environmentDefns, &dispatchEntries);
+
+  spans.sections.end = offsetOf(_token);
+
+  ASTInferenceDefnList inferenceDefns;
+
+  while (_token.kind != Tokens::RBRACE && _token.kind != Tokens::END &&
+         _token.kind != Tokens::KEYWORD_GROUP) {
+    if (_token.kind != Tokens::KEYWORD_INFERENCE) {
+      error({Tokens::KEYWORD_INFERENCE, Tokens::RBRACE});
+    } else {
+      SourceSpan span{offsetOf(_token), 0};
+      if (parseInferenceDefn(&inferenceDefns)) {
+        if (_sourceIndex) {
+          span.end = _prevEnd;
+          spans.inferenceDefns.push_back(span);
+        }
+        continue;
+      }
+    }
+    if (synchronize() || _token.kind == Tokens::KEYWORD_INFERENCE) {
+      continue;
+    }
+    if (_token.kind == Tokens::RBRACKET) {
+      skip();
+      continue;
+    }
+    // A `}` either ends the failed inference, or the group itself.
+    if (_token.kind == Tokens::RBRACE &&
+        (peek().kind == Tokens::KEYWORD_INFERENCE ||
+         peek().kind == Tokens::RBRACE)) {
+      skip();
+    }
+  }
+
+  if (!expect(Tokens::RBRACE, {Tokens::KEYWORD_INFERENCE})) {
+    return false;
+  }
+
+  inferenceGroups->emplace_back(std::move(name), std::move(baseName),
+                                std::move(environmentDefns),
+                                std::move(dispatchEntries),
+                                std::move(inferenceDefns));
+
+  if (_sourceIndex) {
+    _sourceIndex->push_back(std::move(spans));
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+RecursiveDescentParser::parseGroupSections(
+    ASTEnvironmentDefnList* environmentDefns,
+    ASTDispatchEntryList* dispatchEntries)
+{
+  bool hasDispatch = false;
+
+  // Environment definitions, and the dispatch section that may follow them.
+  while (_token.kind == Tokens::IDENTIFIER && !hasDispatch) {
+    if (parseGroupSection(environmentDefns, dispatchEntries, &hasDispatch)) {
+      continue;
+    }
+    if (synchronize()) {
+      continue;
+    }
+    if (_token.kind != Tokens::RBRACKET) {
+      break;
+    }
+    // The end of a dispatch section.
+    skip();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseGroupSection(
+    ASTEnvironmentDefnList* environmentDefns,
+    ASTDispatchEntryList* dispatchEntries, bool* hasDispatch)
+{
+  const yy::location location = _token.location;
+
+  StringType field;
+  if (!expectIdentifier(&field) || !expect(Tokens::COLON)) {
+    return false;
+  }
+
+  if (_token.kind != Tokens::LBRACKET) {
+    StringType value;
+    if (!expectIdentifier(&value, {Tokens::LBRACKET}) ||
+        !expect(Tokens::SEMICOLON)) {
+      return false;
+    }
+    environmentDefns->emplace_back(std::move(field), std::move(value));
+    return true;
+  }
+
+  *hasDispatch = true;
+
+  advance();
+
+  if (!parseList(Tokens::RBRACKET,
+                 [this, dispatchEntries]() {
+                   return parseDispatchEntry(dispatchEntries);
+                 }) ||
+      !expect(Tokens::RBRACKET)) {
+    return false;
+  }
+
+  // "dispatch" is a contextual keyword, so that it remains usable as an
+  // identifier everywhere else. As in the bison parser, the name of the
+  // section is checked once the whole section has been parsed.
+  if (field != "dispatch") {
+    error(location,
+          "syntax error, unexpected section \"" + field +
+              "\", expecting dispatch");
+    return false;
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseDispatchEntry(
+    ASTDispatchEntryList* dispatchEntries)
+{
+  StringType key;
+  if (!expectIdentifier(&key, {Tokens::RBRACKET}) ||
+      !expect(Tokens::COLON)) {
+    return false;
+  }
+
+  StringList inferenceNames;
+  do {
+    StringType inferenceName;
+    if (!expectIdentifier(&inferenceName)) {
+      return false;
+    }
+    inferenceNames.push_back(std::move(inferenceName));
+  } while (accept(Tokens::COMMA));
+
+  if (!expectEither(Tokens::COMMA, Tokens::SEMICOLON)) {
+    return false;
+  }
+
+  dispatchEntries->emplace_back(std::move(key), std::move(inferenceNames));
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseInferenceDefn(
+    ASTInferenceDefnList* inferenceDefns)
+{
+  advance();
+
+  StringType name;
+  if (!expectIdentifier(&name) || !expect(Tokens::LBRACE)) {
+    return false;
+  }
+
+  ASTGlobalDeclList globalDecls;
+  if (_token.kind == Tokens::KEYWORD_GLOBALS &&
+      !parseGlobalDeclSet(&globalDecls) && !recoverSection()) {
+    return false;
+  }
+
+  ASTInferenceArgumentList arguments;
+  if (!parseArgumentSet(&arguments) && !recoverSection()) {
+    return false;
+  }
+
+  ASTPremiseDefnList premiseDefns;
+  if (!parsePremiseSet(&premiseDefns) && !recoverSection()) {
+    return false;
+  }
+
+  ASTPropositionDefn propositionDefn;
+  if (!parsePropositionDefn(&propositionDefn) && !synchronize()) {
+    return false;
+  }
+
+  if (!expect(Tokens::RBRACE)) {
+    return false;
+  }
+
+  inferenceDefns->emplace_back(std::move(name), std::move(globalDecls),
+                               std::move(arguments), std::move(premiseDefns),
+                               std::move(propositionDefn));
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseGlobalDeclSet(ASTGlobalDeclList* globalDecls)
+{
+  advance();
+
+  if (!expect(Tokens::COLON) || !expect(Tokens::LBRACKET)) {
+    return false;
+  }
+
+  do {
+    StringType name;
+    if (!expectIdentifier(&name)) {
+      return false;
+    }
+    globalDecls->emplace_back(std::move(name));
+  } while (accept(Tokens::COMMA));
+
+  return expectEither(Tokens::COMMA, Tokens::RBRACKET);
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseArgumentSet(ASTInferenceArgumentList* arguments)
+{
+  if (!expect(Tokens::KEYWORD_ARGUMENTS) || !expect(Tokens::COLON) ||
+      !expect(Tokens::LBRACKET)) {
+    return false;
+  }
+
+  if (accept(Tokens::RBRACKET)) {
+    return true;
+  }
+
+  do {
+    // Only the first argument may also be the end of the list.
+    StringType name;
+    StringType typeName;
+    if (!(arguments->empty() ? expectIdentifier(&name, {Tokens::RBRACKET})
+                             : expectIdentifier(&name)) ||
+        !expect(Tokens::COLON) || !expectIdentifier(&typeName)) {
+      return false;
+    }
+    arguments->emplace_back(std::move(name), std::move(typeName));
+  } while (accept(Tokens::COMMA));
+
+  return expectEither(Tokens::COMMA, Tokens::RBRACKET);
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parsePremiseSet(ASTPremiseDefnList* premiseDefns)
+{
+  if (!expect(Tokens::KEYWORD_PREMISES) || !expect(Tokens::COLON) ||
+      !expect(Tokens::LBRACKET)) {
+    return false;
+  }
+
+  if (!parsePremiseDefnList(Tokens::RBRACKET, premiseDefns)) {
+    return false;
+  }
+
+  return expect(Tokens::RBRACKET);
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parsePremiseDefnList(TokenKind terminator,
+                                             ASTPremiseDefnList* premiseDefns)
+{
+  return parseList(terminator, [this, terminator, premiseDefns]() {
+    return parsePremiseDefn(terminator, premiseDefns);
+  });
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parsePremiseDefn(TokenKind terminator,
+                                         ASTPremiseDefnList* premiseDefns)
+{
+  StringType name;
+  if (!expectIdentifier(&name, {terminator})) {
+    return false;
+  }
+
+  if (_token.kind == Tokens::DOT || _token.kind == Tokens::COLON) {
+    ASTIdentifiable source;
+    source.add(ASTIdentifier(std::move(name)));
+    while (accept(Tokens::DOT)) {
+      StringType member;
+      if (!expectIdentifier(&member)) {
+        return false;
+      }
+      source.add(ASTIdentifier(std::move(member)));
+    }
+
+    ASTDeductionTarget deductionTarget;
+    if (!expect(Tokens::COLON, {Tokens::DOT}) ||
+        !parseDeductionTarget(&deductionTarget)) {
+      return false;
+    }
+
+    if (!accept(Tokens::KEYWORD_WHILE)) {
+      if (!accept(Tokens::SEMICOLON)) {
+        error({Tokens::KEYWORD_WHILE, Tokens::SEMICOLON});
+        return false;
+      }
+      premiseDefns->emplace_back(ASTInferencePremiseDefn(
+          std::move(source), std::move(deductionTarget)));
+      return true;
+    }
+
+    ASTPremiseDefnList whilePremiseDefns;
+    if (!expect(Tokens::LBRACE) ||
+        !parsePremiseDefnList(Tokens::RBRACE, &whilePremiseDefns) ||
+        !expect(Tokens::RBRACE) || !expect(Tokens::SEMICOLON)) {
+      return false;
+    }
+    premiseDefns->emplace_back(ASTInferencePremiseDefn(
+        std::move(source), std::move(deductionTarget),
+        ASTWhileClause(std::move(whilePremiseDefns))));
+    return true;
+  }
+
+  ASTDeductionTarget lhs;
+  EqualityOperator oprt;
+  ASTDeductionTarget rhs;
+  if (!parseDeductionTarget(std::move(name), &lhs) ||
+      !parseEqualityOperator(&oprt) || !parseDeductionTarget(&rhs)) {
+    return false;
+  }
+
+  if (!accept(Tokens::KEYWORD_INRANGE)) {
+    if (!accept(Tokens::SEMICOLON)) {
+      error({Tokens::KEYWORD_INRANGE, Tokens::SEMICOLON});
+      return false;
+    }
+    premiseDefns->emplace_back(
+        ASTInferenceEqualityDefn(std::move(lhs), std::move(rhs), oprt));
+    return true;
+  }
+
+  IntegerType lhsIdx = 0;
+  IntegerType rhsIdx = 0;
+  ASTDeductionTarget rangeTarget;
+  if (!parseIntegerLiteral(&lhsIdx) || !expect(Tokens::ELLIPSIS) ||
+      !parseIntegerLiteral(&rhsIdx) || !expect(Tokens::ELLIPSIS) ||
+      !parseDeductionTarget(&rangeTarget) || !expect(Tokens::SEMICOLON)) {
+    return false;
+  }
+  premiseDefns->emplace_back(ASTInferenceEqualityDefn(
+      std::move(lhs), std::move(rhs), oprt,
+      ASTRangeClause(lhsIdx, rhsIdx, std::move(rangeTarget))));
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parsePropositionDefn(
+    ASTPropositionDefn* propositionDefn)
+{
+  ASTDeductionTarget deductionTarget;
+  if (!expect(Tokens::KEYWORD_PROPOSITION) || !expect(Tokens::COLON) ||
+      !parseDeductionTarget(&deductionTarget) ||
+      !expect(Tokens::SEMICOLON)) {
+    return false;
+  }
+
+  *propositionDefn = ASTPropositionDefn(std::move(deductionTarget));
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseDeductionTarget(
+    ASTDeductionTarget* deductionTarget)
+{
+  StringType name;
+  if (!expectIdentifier(&name)) {
+    return false;
+  }
+  return parseDeductionTarget(std::move(name), deductionTarget);
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseDeductionTarget(
+    StringType&& name, ASTDeductionTarget* deductionTarget)
+{
+  if (accept(Tokens::LBRACKET)) {
+    if (accept(Tokens::RBRACKET)) {
+      *deductionTarget =
+          ASTDeductionTarget(ASTDeductionTargetArray(std::move(name)));
+      return true;
+    }
+    IntegerType arraySize = 0;
+    if (!parseIntegerLiteral(&arraySize, {Tokens::RBRACKET}) ||
+        !expect(Tokens::RBRACKET)) {
+      return false;
+    }
+    *deductionTarget = ASTDeductionTarget(
+        ASTDeductionTargetArray(std::move(name), arraySize));
+    return true;
+  }
+
+  if (accept(Tokens::LPAREN)) {
+    ASTDeductionTargetList arguments;
+    if (!accept(Tokens::RPAREN)) {
+      do {
+        // Only the first argument may also be the end of the list.
+        StringType argumentName;
+        if (!(arguments.empty()
+                  ? expectIdentifier(&argumentName, {Tokens::RPAREN})
+                  : expectIdentifier(&argumentName))) {
+          return false;
+        }
+        arguments.emplace_back();
+        if (!parseDeductionTarget(std::move(argumentName),
+                                  &arguments.back())) {
+          return false;
+        }
+      } while (accept(Tokens::COMMA));
+      if (!expectEither(Tokens::COMMA, Tokens::RPAREN)) {
+        return false;
+      }
+    }
+    *deductionTarget = ASTDeductionTarget(
+        ASTDeductionTargetComputed(std::move(name), std::move(arguments)));
+    return true;
+  }
+
+  *deductionTarget =
+      ASTDeductionTarget(ASTDeductionTargetSingular(std::move(name)));
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseEqualityOperator(EqualityOperator* oprt)
+{
+  switch (_token.kind) {
+    case Tokens::OPERATOR_EQ:
+      *oprt = EqualityOperator::OPERATOR_EQ;
+      break;
+    case Tokens::OPERATOR_NEQ:
+      *oprt = EqualityOperator::OPERATOR_NEQ;
+      break;
+    case Tokens::OPERATOR_LT:
+      *oprt = EqualityOperator::OPERATOR_LT;
+      break;
+    case Tokens::OPERATOR_LTE:
+      *oprt = EqualityOperator::OPERATOR_LTE;
+      break;
+    default:
+      error({Tokens::OPERATOR_EQ, Tokens::OPERATOR_NEQ, Tokens::OPERATOR_LT,
+             Tokens::OPERATOR_LTE});
+      return false;
+  }
+
+  advance();
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::parseIntegerLiteral(
+    IntegerType* value, std::initializer_list<TokenKind> alternatives)
+{
+  if (_token.kind != Tokens::INTEGER_LITERAL) {
+    std::vector<TokenKind> expected(alternatives);
+    expected.push_back(Tokens::INTEGER_LITERAL);
+    error(expected);
+    return false;
+  }
+
+  *value = _token.value;
+
+  advance();
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename ParseItem>
+bool
+RecursiveDescentParser::parseList(TokenKind terminator, ParseItem parseItem)
+{
+  while (_token.kind != terminator) {
+    if (parseItem()) {
+      continue;
+    }
+    if (!synchronize() && _token.kind != terminator) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::synchronize()
+{
+  // Depth of the `{` and `[` skipped so far, whose closing tokens and
+  // `;` belong to the skipped tokens rather than to the enclosing construct.
+  size_t depth = 0;
+  for (;;) {
+    switch (_token.kind) {
+      case Tokens::LBRACKET:
+      case Tokens::LBRACE:
+        ++depth;
+        skip();
+        break;
+      case Tokens::SEMICOLON:
+        skip();
+        if (depth == 0) {
+          return true;
+        }
+        break;
+      case Tokens::RBRACKET:
+      case Tokens::RBRACE:
+        if (depth == 0) {
+          return false;
+        }
+        --depth;
+        skip();
+        break;
+      case Tokens::KEYWORD_GROUP:
+      case Tokens::KEYWORD_INFERENCE:
+      case Tokens::END:
+        return false;
+      default:
+        skip();
+        break;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::recoverSection()
+{
+  if (synchronize()) {
+    return true;
+  }
+  if (_token.kind == Tokens::RBRACKET) {
+    skip();
+    return true;
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+RecursiveDescentParser::advance()
+{
+  // A token has been matched, so the parser has recovered from any error.
+  _recovering = false;
+  skip();
+}
+
+// -----------------------------------------------------------------------------
+
+void
+RecursiveDescentParser::skip()
+{
+  _prevEnd = offsetOf(_token) + _token.length;
+
+  if (_hasNext) {
+    _token = _next;
+    _hasNext = false;
+  } else {
+    _scanner.scan(&_token);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+const RecursiveDescentParser::Token&
+RecursiveDescentParser::peek()
+{
+  if (!_hasNext) {
+    _scanner.scan(&_next);
+    _hasNext = true;
+  }
+  return _next;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::accept(TokenKind kind)
+{
+  if (_token.kind != kind) {
+    return false;
+  }
+  advance();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::expect(TokenKind kind,
+                               std::initializer_list<TokenKind> alternatives)
+{
+  if (accept(kind)) {
+    return true;
+  }
+  std::vector<TokenKind> expected(alternatives);
+  expected.push_back(kind);
+  error(expected);
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::expectEither(TokenKind alternative, TokenKind kind)
+{
+  if (accept(kind)) {
+    return true;
+  }
+  error({alternative, kind});
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+RecursiveDescentParser::expectIdentifier(
+    StringType* value, std::initializer_list<TokenKind> alternatives)
+{
+  if (_token.kind != Tokens::IDENTIFIER) {
+    std::vector<TokenKind> expected(alternatives);
+    expected.push_back(Tokens::IDENTIFIER);
+    error(expected);
+    return false;
+  }
+  value->assign(_token.text, _token.length);
+  advance();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+RecursiveDescentParser::offsetOf(const Token& token) const
+{
+  return static_cast<size_t>(token.text - _input);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+RecursiveDescentParser::error(std::vector<TokenKind> expected)
+{
+  std::string msg("syntax error, unexpected ");
+  msg += tokenName(_token.kind);
+
+  // Token kinds are numbered in the order of their declaration.
+  std::sort(expected.begin(), expected.end());
+  expected.erase(std::unique(expected.begin(), expected.end()),
+                 expected.end());
+
+  if (expected.size() <= kMaxExpectedTokenCount) {
+    const char* separator = ", expecting ";
+    for (const auto kind : expected) {
+      msg += separator;
+      msg += tokenName(kind);
+      separator = " or ";
+    }
+  }
+
+  error(_token.location, msg);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+RecursiveDescentParser::error(const yy::location& location,
+                              const std::string& msg)
+{
+  ++_errorCount;
+
+  if (_recovering) {
+    return;
+  }
+  _recovering = true;
+
+  if (_reportErrors) {
+    _driver.error(location, msg);
+  }
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,222 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include "Scanner.h"
+#include "ast.h"
+#include "location.hh"
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+class ParserDriver;
+
+/**
+ * Extent of a construct in the input, in bytes.
+ */
+struct SourceSpan
+{
+  size_t begin;
+  size_t end;
+};
+
+/**
+ * Extents of the parts of a group that can be reparsed on their own: the
+ * environment definitions and dispatch section together, and each of the
+ * inference definitions.
+ */
+struct SourceGroupSpans
+{
+  SourceSpan sections;
+  std::vector<SourceSpan> inferenceDefns;
+};
+
+typedef std::vector<SourceGroupSpans> SourceIndex;
+
+/**
+ * Hand-written recursive-descent parser for the same grammar as parser.yy,
+ * reading tokens from `Scanner`.
+ *
+ * Nodes are constructed in place in the lists that hold them, rather than
+ * being copied up through the parser's value stack. On a syntax error, the
+ * parser skips ahead to the next `;`, `]` or `}` and carries on, so that
+ * every syntax error in the input is reported in one pass. Errors that
+ * follow another before any token has been matched again are assumed to be
+ * caused by it, and are not reported.
+ *
+ * The input must outlive the parser.
+ */
+class RecursiveDescentParser
+{
+public:
+  RecursiveDescentParser(const char* input, size_t length, ParserDriver&);
+
+  /**
+   * Parse the input, and on success, set the module of the driver.
+   * Return 0 on success.
+   */
+  int parse();
+
+  /**
+   * Parse the input as a single inference definition.
+   * Return 0 on success.
+   */
+  int reparseInferenceDefn(ASTInferenceDefn*);
+
+  /**
+   * Parse the input as the environment definitions and dispatch section of a
+   * group.
+   * Return 0 on success.
+   */
+  int reparseGroupSections(ASTEnvironmentDefnList*, ASTDispatchEntryList*);
+
+  /**
+   * Record the extents of the groups parsed by `parse()` in `sourceIndex`.
+   */
+  void setSourceIndex(SourceIndex*);
+
+  /**
+   * Getter and setter for reporting syntax errors to the driver. They are
+   * still counted when not reported.
+   */
+  bool reportErrors() const;
+  void setReportErrors(bool);
+
+private:
+  typedef Scanner::Token Token;
+  typedef Scanner::TokenKind TokenKind;
+
+  bool parseImport(ASTImportList*);
+
+  bool parseInferenceGroup(ASTInferenceGroupList*);
+
+  void parseGroupSections(ASTEnvironmentDefnList*, ASTDispatchEntryList*);
+
+  bool parseGroupSection(ASTEnvironmentDefnList*, ASTDispatchEntryList*,
+                         bool* hasDispatch);
+
+  bool parseDispatchEntry(ASTDispatchEntryList*);
+
+  bool parseInferenceDefn(ASTInferenceDefnList*);
+
+  bool parseGlobalDeclSet(ASTGlobalDeclList*);
+
+  bool parseArgumentSet(ASTInferenceArgumentList*);
+
+  bool parsePremiseSet(ASTPremiseDefnList*);
+
+  bool parsePremiseDefnList(TokenKind terminator, ASTPremiseDefnList*);
+
+  bool parsePremiseDefn(TokenKind terminator, ASTPremiseDefnList*);
+
+  bool parsePropositionDefn(ASTPropositionDefn*);
+
+  bool parseDeductionTarget(ASTDeductionTarget*);
+
+  bool parseDeductionTarget(StringType&& name, ASTDeductionTarget*);
+
+  bool parseEqualityOperator(EqualityOperator*);
+
+  bool parseIntegerLiteral(IntegerType*,
+                           std::initializer_list<TokenKind> alternatives = {});
+
+  /**
+   * Parses items with `parseItem` until `terminator`, recovering from the
+   * items that fail at the next `;`. Return false if recovery ends up
+   * anywhere else but at `terminator`.
+   */
+  template <typename ParseItem>
+  bool parseList(TokenKind terminator, ParseItem parseItem);
+
+  /**
+   * Skip ahead to the end of the construct that has failed to parse. Stops
+   * after a `;`, or before a `]`, `}`, a keyword that starts a group or an
+   * inference, or the end of the input. Blocks opened by the skipped tokens
+   * are skipped whole. Return true if it stopped after a `;`.
+   */
+  bool synchronize();
+
+  /**
+   * Recover from a failed section of an inference. Return true if the next
+   * section can be parsed.
+   */
+  bool recoverSection();
+
+  /**
+   * Move past the current token, which has been matched.
+   */
+  void advance();
+
+  /**
+   * Move past the current token, which is discarded while recovering.
+   */
+  void skip();
+
+  const Token& peek();
+
+  bool accept(TokenKind);
+
+  /**
+   * Expect `kind`, where any of `alternatives` could also have followed,
+   * and are expected as well in the error reported otherwise.
+   */
+  bool expect(TokenKind kind,
+              std::initializer_list<TokenKind> alternatives = {});
+
+  /**
+   * Expect `kind`, at the end of a list whose items could also have been
+   * continued by `alternative`.
+   */
+  bool expectEither(TokenKind alternative, TokenKind kind);
+
+  bool expectIdentifier(StringType*,
+                        std::initializer_list<TokenKind> alternatives = {});
+
+  size_t offsetOf(const Token&) const;
+
+  /**
+   * Report the current token as unexpected. As bison does, the tokens
+   * expected are listed in the order of their declaration, and only if
+   * there are at most 4 of them.
+   */
+  void error(std::vector<TokenKind> expected);
+
+  void error(const yy::location&, const std::string&);
+
+private:
+  ParserDriver& _driver;
+  const char* _input;
+  Scanner _scanner;
+  Token _token;
+  Token _next;
+  bool _hasNext;
+  bool _recovering;
+  bool _reportErrors;
+  size_t _errorCount;
+  SourceIndex* _sourceIndex;
+  // End of the last token moved past.
+  size_t _prevEnd;
+};
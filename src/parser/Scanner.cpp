@@ -0,0 +1,461 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "Scanner.h"
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// -----------------------------------------------------------------------------
+
+typedef yy::Parser::token Tokens;
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Keywords, at the index given by `hashKeyword()` of their text.
+ */
+struct Keyword
+{
+  const char* text;
+  size_t length;
+  Tokens::token_kind_type token;
+};
+
+const size_t KEYWORD_TABLE_SIZE = 16;
+
+const size_t MIN_KEYWORD_LENGTH = 5;
+
+const size_t MAX_KEYWORD_LENGTH = 11;
+
+const Keyword KEYWORD_TABLE[KEYWORD_TABLE_SIZE] = {
+    {"inrange", 7, Tokens::KEYWORD_INRANGE},
+    {"proposition", 11, Tokens::KEYWORD_PROPOSITION},
+    {"inference", 9, Tokens::KEYWORD_INFERENCE},
+    {nullptr, 0, Tokens::YYUNDEF},
+    {nullptr, 0, Tokens::YYUNDEF},
+    {"group", 5, Tokens::KEYWORD_GROUP},
+    {"globals", 7, Tokens::KEYWORD_GLOBALS},
+    {"premises", 8, Tokens::KEYWORD_PREMISES},
+    {"arguments", 9, Tokens::KEYWORD_ARGUMENTS},
+    {nullptr, 0, Tokens::YYUNDEF},
+    {nullptr, 0, Tokens::YYUNDEF},
+    {nullptr, 0, Tokens::YYUNDEF},
+    {nullptr, 0, Tokens::YYUNDEF},
+    {nullptr, 0, Tokens::YYUNDEF},
+    {"while", 5, Tokens::KEYWORD_WHILE},
+    {"environment", 11, Tokens::KEYWORD_ENVIRONMENT},
+};
+
+// -----------------------------------------------------------------------------
+
+inline size_t
+hashKeyword(const char* text, size_t length)
+{
+  const auto last = static_cast<unsigned char>(text[length - 1]);
+  return (length + last * 5) & (KEYWORD_TABLE_SIZE - 1);
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Classes of characters that are skipped in runs. Each tests a single
+ * character, and, where vector instructions are available, every byte of a
+ * vector at once, setting the bytes that belong to the class to 0xFF.
+ */
+
+#if defined(__SSE2__)
+inline __m128i
+inRange(__m128i v, char lo, char hi)
+{
+  const __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+  return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(hi - lo)), offset);
+}
+#endif
+
+#if defined(__AVX2__)
+inline __m256i
+inRange(__m256i v, char lo, char hi)
+{
+  const __m256i offset = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+  return _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(hi - lo)),
+                           offset);
+}
+#endif
+
+struct BlankClass
+{
+  static bool test(char c)
+  {
+    return c == ' ' || c == '\t';
+  }
+
+#if defined(__SSE2__)
+  static __m128i test(__m128i v)
+  {
+    return _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                        _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+  }
+#endif
+
+#if defined(__AVX2__)
+  static __m256i test(__m256i v)
+  {
+    return _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                           _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')));
+  }
+#endif
+};
+
+struct NewlineClass
+{
+  static bool test(char c)
+  {
+    return c == '\n';
+  }
+
+#if defined(__SSE2__)
+  static __m128i test(__m128i v)
+  {
+    return _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'));
+  }
+#endif
+
+#if defined(__AVX2__)
+  static __m256i test(__m256i v)
+  {
+    return _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'));
+  }
+#endif
+};
+
+struct IdentifierClass
+{
+  static bool test(char c)
+  {
+    const auto u = static_cast<unsigned char>(c);
+    return static_cast<unsigned char>((u | 0x20) - 'a') < 26 ||
+           static_cast<unsigned char>(u - '0') < 10 || u == '_';
+  }
+
+#if defined(__SSE2__)
+  static __m128i test(__m128i v)
+  {
+    // Setting bit 5 folds upper case letters onto lower case ones.
+    const __m128i letter =
+        inRange(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+    const __m128i digit = inRange(v, '0', '9');
+    const __m128i underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+    return _mm_or_si128(_mm_or_si128(letter, digit), underscore);
+  }
+#endif
+
+#if defined(__AVX2__)
+  static __m256i test(__m256i v)
+  {
+    const __m256i letter =
+        inRange(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z');
+    const __m256i digit = inRange(v, '0', '9');
+    const __m256i underscore = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+    return _mm256_or_si256(_mm256_or_si256(letter, digit), underscore);
+  }
+#endif
+};
+
+struct DigitClass
+{
+  static bool test(char c)
+  {
+    return static_cast<unsigned char>(c - '0') < 10;
+  }
+
+#if defined(__SSE2__)
+  static __m128i test(__m128i v)
+  {
+    return inRange(v, '0', '9');
+  }
+#endif
+
+#if defined(__AVX2__)
+  static __m256i test(__m256i v)
+  {
+    return inRange(v, '0', '9');
+  }
+#endif
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Returns the first character from `p` on that is not in the class.
+ */
+template <typename CharClass>
+const char*
+skipWhile(const char* p, const char* end)
+{
+#if defined(__AVX2__)
+  while (end - p >= 32) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const auto mask =
+        static_cast<uint32_t>(_mm256_movemask_epi8(CharClass::test(v)));
+    if (mask != 0xFFFFFFFFu) {
+      return p + __builtin_ctz(~mask);
+    }
+    p += 32;
+  }
+#endif
+
+#if defined(__SSE2__)
+  while (end - p >= 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const auto mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(CharClass::test(v)));
+    if (mask != 0xFFFFu) {
+      return p + __builtin_ctz(~mask);
+    }
+    p += 16;
+  }
+#endif
+
+  while (p != end && CharClass::test(*p)) {
+    ++p;
+  }
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
+Scanner::Scanner(const char* input, size_t length)
+  : _cur(input)
+  , _end(input + length)
+  , _loc()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Scanner::scan(Token* token)
+{
+  _loc.step();
+
+  while (_cur != _end) {
+    const char c = *_cur;
+
+    if (BlankClass::test(c)) {
+      const char* p = skipWhile<BlankClass>(_cur, _end);
+      _loc.columns(static_cast<int>(p - _cur));
+      _loc.step();
+      _cur = p;
+      continue;
+    }
+
+    if (NewlineClass::test(c)) {
+      const char* p = skipWhile<NewlineClass>(_cur, _end);
+      _loc.lines(static_cast<int>(p - _cur));
+      _loc.step();
+      _cur = p;
+      continue;
+    }
+
+    if (IdentifierClass::test(c) && !DigitClass::test(c)) {
+      scanIdentifierOrKeyword(token);
+      return;
+    }
+
+    if (DigitClass::test(c)) {
+      scanIntegerLiteral(token);
+      return;
+    }
+
+    // Punctuation and operators, longest match first.
+    const char n = _cur + 1 != _end ? _cur[1] : '\0';
+    switch (c) {
+      case ':':
+        scanPunctuation(Tokens::COLON, 1, token);
+        return;
+      case ';':
+        scanPunctuation(Tokens::SEMICOLON, 1, token);
+        return;
+      case '=':
+        scanPunctuation(Tokens::OPERATOR_EQ, 1, token);
+        return;
+      case '!':
+        if (n == '=') {
+          scanPunctuation(Tokens::OPERATOR_NEQ, 2, token);
+          return;
+        }
+        break;
+      case '<':
+        if (n == '=') {
+          scanPunctuation(Tokens::OPERATOR_LTE, 2, token);
+        } else {
+          scanPunctuation(Tokens::OPERATOR_LT, 1, token);
+        }
+        return;
+      case '.':
+        if (n == '.') {
+          scanPunctuation(Tokens::ELLIPSIS, 2, token);
+        } else {
+          scanPunctuation(Tokens::DOT, 1, token);
+        }
+        return;
+      case ',':
+        scanPunctuation(Tokens::COMMA, 1, token);
+        return;
+      case '[':
+        scanPunctuation(Tokens::LBRACKET, 1, token);
+        return;
+      case ']':
+        scanPunctuation(Tokens::RBRACKET, 1, token);
+        return;
+      case '{':
+        scanPunctuation(Tokens::LBRACE, 1, token);
+        return;
+      case '}':
+        scanPunctuation(Tokens::RBRACE, 1, token);
+        return;
+      case '(':
+        scanPunctuation(Tokens::LPAREN, 1, token);
+        return;
+      case ')':
+        scanPunctuation(Tokens::RPAREN, 1, token);
+        return;
+      default:
+        break;
+    }
+
+    // Bad characters are ignored, but still count towards the location of
+    // the next token, as they do with the flex scanner.
+    _loc.columns(1);
+    ++_cur;
+  }
+
+  token->kind = Tokens::END;
+  token->text = _cur;
+  token->length = 0;
+  token->location = _loc;
+}
+
+// -----------------------------------------------------------------------------
+
+yy::Parser::symbol_type
+Scanner::next()
+{
+  Token token;
+  scan(&token);
+
+  switch (token.kind) {
+    case Tokens::IDENTIFIER:
+      return yy::Parser::make_IDENTIFIER(
+          std::string(token.text, token.length), token.location);
+    case Tokens::INTEGER_LITERAL:
+      return yy::Parser::make_INTEGER_LITERAL(token.value, token.location);
+    default:
+      return yy::Parser::symbol_type(token.kind, token.location);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Scanner::scanIdentifierOrKeyword(Token* token)
+{
+  const char* begin = _cur;
+  _cur = skipWhile<IdentifierClass>(_cur + 1, _end);
+
+  const auto length = static_cast<size_t>(_cur - begin);
+  _loc.columns(static_cast<int>(length));
+
+  token->kind = Tokens::IDENTIFIER;
+  token->text = begin;
+  token->length = length;
+  token->location = _loc;
+
+  if (length >= MIN_KEYWORD_LENGTH && length <= MAX_KEYWORD_LENGTH) {
+    const Keyword& keyword = KEYWORD_TABLE[hashKeyword(begin, length)];
+    if (keyword.length == length && memcmp(keyword.text, begin, length) == 0) {
+      token->kind = keyword.token;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Scanner::scanIntegerLiteral(Token* token)
+{
+  const char* begin = _cur;
+  _cur = skipWhile<DigitClass>(_cur, _end);
+  _loc.columns(static_cast<int>(_cur - begin));
+
+  // Literals out of the range of `long` are read as 0, as with `strtol()`
+  // in the flex scanner.
+  uint64_t value = 0;
+  for (const char* p = begin; p != _cur; ++p) {
+    const auto digit = static_cast<uint64_t>(*p - '0');
+    if (value > (static_cast<uint64_t>(LONG_MAX) - digit) / 10) {
+      value = 0;
+      break;
+    }
+    value = value * 10 + digit;
+  }
+
+  token->kind = Tokens::INTEGER_LITERAL;
+  token->text = begin;
+  token->length = static_cast<size_t>(_cur - begin);
+  token->value = value;
+  token->location = _loc;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+Scanner::scanPunctuation(TokenKind kind, size_t length, Token* token)
+{
+  _loc.columns(static_cast<int>(length));
+
+  token->kind = kind;
+  token->text = _cur;
+  token->length = length;
+  token->location = _loc;
+
+  _cur += length;
+}
+
+// -----------------------------------------------------------------------------
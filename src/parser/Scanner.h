@@ -0,0 +1,83 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include "location.hh"
+#include "parser.tab.hh"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Hand-written scanner producing the same tokens and locations as the flex
+ * scanner in lexer.ll.
+ *
+ * Runs of blanks, newlines and identifier characters are scanned 32 bytes at
+ * a time with AVX2, or 16 bytes at a time with SSE2, depending on the target
+ * the scanner is compiled for, and one byte at a time otherwise. Keywords are
+ * told apart from identifiers with a perfect hash of their length and last
+ * character.
+ *
+ * The input must outlive the scanner.
+ */
+class Scanner
+{
+public:
+  typedef yy::Parser::token::token_kind_type TokenKind;
+
+  struct Token
+  {
+    TokenKind kind;
+    // Text of identifiers, within the input.
+    const char* text;
+    size_t length;
+    // Value of integer literals.
+    uint64_t value;
+    yy::location location;
+  };
+
+  Scanner(const char* input, size_t length);
+
+  /**
+   * Scans the next token, or `END` at the end of the input.
+   */
+  void scan(Token*);
+
+  /**
+   * Returns the next token as a symbol of the bison parser.
+   */
+  yy::Parser::symbol_type next();
+
+private:
+  void scanIdentifierOrKeyword(Token*);
+
+  void scanIntegerLiteral(Token*);
+
+  void scanPunctuation(TokenKind, size_t length, Token*);
+
+private:
+  const char* _cur;
+  const char* _end;
+  yy::location _loc;
+};
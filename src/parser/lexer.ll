@@ -40,6 +40,9 @@ blank [ \t]
 %{
   // Code run each time a pattern is matched.
   # define YY_USER_ACTION loc.columns(yyleng);
+  // Code run on the first call of yylex for each input, so that locations
+  // start over with every input scanned.
+  # define YY_USER_INIT loc.initialize();
 %}
 
 %%
@@ -50,18 +53,18 @@ blank [ \t]
 %}
 
 #keywords
-"group"                                   { return yy::Parser::make_KEYWORD_GROUP(yytext, loc);        }
-"inference"                               { return yy::Parser::make_KEYWORD_INFERENCE(yytext, loc);    }
-"environment"                             { return yy::Parser::make_KEYWORD_ENVIRONMENT(yytext, loc);  }
-"arguments"                               { return yy::Parser::make_KEYWORD_ARGUMENTS(yytext, loc);    }
-"globals"                                 { return yy::Parser::make_KEYWORD_GLOBALS(yytext, loc);      }
-"while"                                   { return yy::Parser::make_KEYWORD_WHILE(yytext, loc);        }
-"inrange"                                 { return yy::Parser::make_KEYWORD_INRANGE(yytext, loc);      }
-"premises"                                { return yy::Parser::make_KEYWORD_PREMISES(yytext, loc);     }
-"proposition"                             { return yy::Parser::make_KEYWORD_PROPOSITION(yytext, loc);  }
+"group"                                   { return yy::Parser::make_KEYWORD_GROUP(loc);                }
+"inference"                               { return yy::Parser::make_KEYWORD_INFERENCE(loc);            }
+"environment"                             { return yy::Parser::make_KEYWORD_ENVIRONMENT(loc);          }
+"arguments"                               { return yy::Parser::make_KEYWORD_ARGUMENTS(loc);            }
+"globals"                                 { return yy::Parser::make_KEYWORD_GLOBALS(loc);              }
+"while"                                   { return yy::Parser::make_KEYWORD_WHILE(loc);                }
+"inrange"                                 { return yy::Parser::make_KEYWORD_INRANGE(loc);              }
+"premises"                                { return yy::Parser::make_KEYWORD_PREMISES(loc);             }
+"proposition"                             { return yy::Parser::make_KEYWORD_PROPOSITION(loc);          }
 
 #identifiers
-[_a-zA-Z][_a-zA-Z0-9]*                    { return yy::Parser::make_IDENTIFIER(yytext, loc); }
+[_a-zA-Z][_a-zA-Z0-9]*                    { return yy::Parser::make_IDENTIFIER(std::string(yytext, yyleng), loc); }
 
 #integer
 {integer} {
@@ -74,43 +77,43 @@ blank [ \t]
 }
 
 #colon
-":"                                       { return yy::Parser::make_COLON(yytext, loc); }
+":"                                       { return yy::Parser::make_COLON(loc); }
 
 #semicolon
-";"                                       { return yy::Parser::make_SEMICOLON(yytext, loc); }
+";"                                       { return yy::Parser::make_SEMICOLON(loc); }
 
 #equal
-"="                                       { return yy::Parser::make_OPERATOR_EQ(yytext, loc); }
+"="                                       { return yy::Parser::make_OPERATOR_EQ(loc); }
 
 #not_equal
-"!="                                      { return yy::Parser::make_OPERATOR_NEQ(yytext, loc); }
+"!="                                      { return yy::Parser::make_OPERATOR_NEQ(loc); }
 
 #less_than
-"<"                                       { return yy::Parser::make_OPERATOR_LT(yytext, loc); }
+"<"                                       { return yy::Parser::make_OPERATOR_LT(loc); }
 
 #no_more_than
-"<="                                      { return yy::Parser::make_OPERATOR_LTE(yytext, loc); }
+"<="                                      { return yy::Parser::make_OPERATOR_LTE(loc); }
 
 #dot
-"."                                       { return yy::Parser::make_DOT(yytext, loc); }
+"."                                       { return yy::Parser::make_DOT(loc); }
 
 #comma
-","                                       { return yy::Parser::make_COMMA(yytext, loc); }
+","                                       { return yy::Parser::make_COMMA(loc); }
 
 #sqaure_brackets
-"["                                       { return yy::Parser::make_LBRACKET(yytext, loc); }
-"]"                                       { return yy::Parser::make_RBRACKET(yytext, loc); }
+"["                                       { return yy::Parser::make_LBRACKET(loc); }
+"]"                                       { return yy::Parser::make_RBRACKET(loc); }
 
 #curly_braces
-"{"                                       { return yy::Parser::make_LBRACE(yytext, loc); }
-"}"                                       { return yy::Parser::make_RBRACE(yytext, loc); }
+"{"                                       { return yy::Parser::make_LBRACE(loc); }
+"}"                                       { return yy::Parser::make_RBRACE(loc); }
 
 #parentheses
-"("                                       { return yy::Parser::make_LPAREN(yytext, loc); }
-")"                                       { return yy::Parser::make_RPAREN(yytext, loc); }
+"("                                       { return yy::Parser::make_LPAREN(loc); }
+")"                                       { return yy::Parser::make_RPAREN(loc); }
 
 #ellipsis
-".."                                      { return yy::Parser::make_ELLIPSIS(yytext, loc); }
+".."                                      { return yy::Parser::make_ELLIPSIS(loc); }
 
 {blank}+                                  {
                                             loc.step();
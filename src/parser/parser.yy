@@ -67,34 +67,36 @@ class ParserDriver;
 }
 
 // Token definition.
-%token <std::string>      KEYWORD_GROUP
-%token <std::string>      KEYWORD_INFERENCE
-%token <std::string>      KEYWORD_ENVIRONMENT
-%token <std::string>      KEYWORD_ARGUMENTS
-%token <std::string>      KEYWORD_GLOBALS
-%token <std::string>      KEYWORD_WHILE
-%token <std::string>      KEYWORD_INRANGE
-%token <std::string>      KEYWORD_PREMISES
-%token <std::string>      KEYWORD_PROPOSITION
+// Keywords and punctuation carry no value, so that the lexer does not
+// allocate a string for each of them.
+%token                    KEYWORD_GROUP
+%token                    KEYWORD_INFERENCE
+%token                    KEYWORD_ENVIRONMENT
+%token                    KEYWORD_ARGUMENTS
+%token                    KEYWORD_GLOBALS
+%token                    KEYWORD_WHILE
+%token                    KEYWORD_INRANGE
+%token                    KEYWORD_PREMISES
+%token                    KEYWORD_PROPOSITION
 
 %token <uint64_t>         INTEGER_LITERAL
 
 %token <std::string>      IDENTIFIER
-%token <std::string>      DOT
-%token <std::string>      COMMA
-%token <std::string>      COLON
-%token <std::string>      SEMICOLON
-%token <std::string>      LBRACKET
-%token <std::string>      RBRACKET
-%token <std::string>      LBRACE
-%token <std::string>      RBRACE
-%token <std::string>      LPAREN
-%token <std::string>      RPAREN
-%token <std::string>      OPERATOR_EQ
-%token <std::string>      OPERATOR_NEQ
-%token <std::string>      OPERATOR_LT
-%token <std::string>      OPERATOR_LTE
-%token <std::string>      ELLIPSIS
+%token                    DOT
+%token                    COMMA
+%token                    COLON
+%token                    SEMICOLON
+%token                    LBRACKET
+%token                    RBRACKET
+%token                    LBRACE
+%token                    RBRACE
+%token                    LPAREN
+%token                    RPAREN
+%token                    OPERATOR_EQ
+%token                    OPERATOR_NEQ
+%token                    OPERATOR_LT
+%token                    OPERATOR_LTE
+%token                    ELLIPSIS
 %token END                0  "end of file"
 
 %type <EqualityOperator> equality_operator;
@@ -121,10 +123,18 @@ class ParserDriver;
 %type <ASTGlobalDeclList> global_decl_set;
 %type <ASTEnvironmentDefn> environment_defn;
 %type <ASTEnvironmentDefnList> environment_defn_list;
+%type <ASTDispatchEntry> dispatch_entry;
+%type <ASTDispatchEntryList> dispatch_entry_list;
+%type <ASTDispatchEntryList> dispatch_set;
+%type <StringList> dispatch_inference_name_list;
 %type <ASTInferenceDefn> inference_defn;
 %type <ASTInferenceDefnList> inference_defn_list;
 %type <ASTInferenceGroup> inference_group;
 %type <ASTInferenceGroupList> inference_group_list;
+%type <std::string> base_inference_group;
+%type <ASTImport> import;
+%type <ASTImportList> import_list;
+%type <std::string> import_name;
 %type <ASTModule> input;
 
 %debug
@@ -135,13 +145,55 @@ class ParserDriver;
 
 input
     :
-        inference_group_list
+        import_list inference_group_list
         {
-            ASTModule module(std::move($1));
+            ASTModule module(std::move($1), std::move($2));
             driver.setModule(std::move(module));
         }
     ;
 
+import_list
+    :
+        {
+            $$ = ASTImportList();
+        }
+    |
+        import_list import
+        {
+            $1.push_back(std::move($2));
+            $$ = std::move($1);
+        }
+    ;
+
+import
+    :
+        IDENTIFIER import_name SEMICOLON
+        {
+            // "import" is a contextual keyword, so that it remains
+            // usable as an identifier everywhere else.
+            if ($1 != "import") {
+                error(@1, "syntax error, unexpected \"" + $1 + "\", expecting import");
+                YYERROR;
+            }
+            $$ = ASTImport(std::move($2));
+        }
+    ;
+
+import_name
+    :
+        IDENTIFIER
+        {
+            $$ = std::move($1);
+        }
+    |
+        import_name DOT IDENTIFIER
+        {
+            $1 += '.';
+            $1 += $3;
+            $$ = std::move($1);
+        }
+    ;
+
 inference_group_list
     :
         {
@@ -150,19 +202,32 @@ inference_group_list
     |
         inference_group_list inference_group
         {
-            $1.push_back($2);
+            $1.push_back(std::move($2));
             $$ = std::move($1);
         }
     ;
 
 inference_group
     :
-        KEYWORD_GROUP IDENTIFIER LBRACE
+        KEYWORD_GROUP IDENTIFIER base_inference_group LBRACE
             environment_defn_list
+            dispatch_set
             inference_defn_list
         RBRACE
         {
-            $$ = ASTInferenceGroup(std::move($2), std::move($4), std::move($5));
+            $$ = ASTInferenceGroup(std::move($2), std::move($3), std::move($5), std::move($6), std::move($7));
+        }
+    ;
+
+base_inference_group
+    :
+        {
+            $$ = StringType();
+        }
+    |
+        COLON IDENTIFIER
+        {
+            $$ = std::move($2);
         }
     ;
 
@@ -174,7 +239,7 @@ environment_defn_list
     |
         environment_defn_list environment_defn
         {
-            $1.push_back($2);
+            $1.push_back(std::move($2));
             $$ = std::move($1);
         }
     ;
@@ -187,6 +252,61 @@ environment_defn
         }
     ;
 
+dispatch_set
+    :
+        {
+            $$ = ASTDispatchEntryList();
+        }
+    |
+        IDENTIFIER COLON LBRACKET dispatch_entry_list RBRACKET
+        {
+            // "dispatch" is a contextual keyword, so that it remains
+            // usable as an identifier everywhere else.
+            if ($1 != "dispatch") {
+                error(@1, "syntax error, unexpected section \"" + $1 + "\", expecting dispatch");
+                YYERROR;
+            }
+            $$ = std::move($4);
+        }
+    ;
+
+dispatch_entry_list
+    :
+        {
+            $$ = ASTDispatchEntryList();
+        }
+    |
+        dispatch_entry_list dispatch_entry
+        {
+            $1.push_back(std::move($2));
+            $$ = std::move($1);
+        }
+    ;
+
+dispatch_entry
+    :
+        IDENTIFIER COLON dispatch_inference_name_list SEMICOLON
+        {
+            $$ = ASTDispatchEntry(std::move($1), std::move($3));
+        }
+    ;
+
+dispatch_inference_name_list
+    :
+        IDENTIFIER
+        {
+            StringList names;
+            names.push_back(std::move($1));
+            $$ = std::move(names);
+        }
+    |
+        dispatch_inference_name_list COMMA IDENTIFIER
+        {
+            $1.push_back(std::move($3));
+            $$ = std::move($1);
+        }
+    ;
+
 inference_defn_list
     :
         {
@@ -195,7 +315,7 @@ inference_defn_list
     |
         inference_defn_list inference_defn
         {
-            $1.push_back($2);
+            $1.push_back(std::move($2));
             $$ = std::move($1);
         }
     ;
@@ -231,13 +351,13 @@ global_decl_list
         global_decl
         {
             ASTGlobalDeclList decls;
-            decls.push_back($1);
+            decls.push_back(std::move($1));
             $$ = std::move(decls);
         }
     |
         global_decl_list COMMA global_decl
         {
-            $1.push_back($3);
+            $1.push_back(std::move($3));
             $$ = std::move($1);
         }
     ;
@@ -268,13 +388,13 @@ argument_list
         inference_argument
         {
             ASTInferenceArgumentList arguments;
-            arguments.push_back($1);
+            arguments.push_back(std::move($1));
             $$ = std::move(arguments);
         }
     |
         argument_list COMMA inference_argument
         {
-            $1.push_back($3);
+            $1.push_back(std::move($3));
             $$ = std::move($1);
         }
     ;
@@ -291,7 +411,7 @@ premise_set
     :
         KEYWORD_PREMISES COLON LBRACKET premise_defn_list RBRACKET
         {
-            $$ = $4;
+            $$ = std::move($4);
         }
     ;
 
@@ -303,7 +423,7 @@ premise_defn_list
     |
         premise_defn_list premise_defn
         {
-            $1.push_back($2);
+            $1.push_back(std::move($2));
             $$ = std::move($1);
         }
     ;
@@ -376,14 +496,14 @@ identifiable
         identifier
         {
             ASTIdentifiable res;
-            res.add($1);
+            res.add(std::move($1));
             $$ = std::move(res);
         }
     |
         identifiable DOT identifier
         {
-            $1.add($3);
-            $$ = $1;
+            $1.add(std::move($3));
+            $$ = std::move($1);
         }
     ;
 
@@ -400,13 +520,13 @@ deduction_target_list
         deduction_target
         {
             ASTDeductionTargetList list;
-            list.push_back($1);
+            list.push_back(std::move($1));
             $$ = std::move(list);
         }
     |
         deduction_target_list COMMA deduction_target
         {
-            $1.push_back($3);
+            $1.push_back(std::move($3));
             $$ = std::move($1);
         }
     ;
@@ -701,6 +701,9 @@ static yy::location loc;
 #line 41 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
   // Code run each time a pattern is matched.
   # define YY_USER_ACTION loc.columns(yyleng);
+  // Code run on the first call of yylex for each input, so that locations
+  // start over with every input scanned.
+  # define YY_USER_INIT loc.initialize();
 #line 704 "lex.yy.cc"
 #line 705 "lex.yy.cc"
 
@@ -1073,47 +1076,47 @@ YY_RULE_SETUP
 case 2:
 YY_RULE_SETUP
 #line 54 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_KEYWORD_GROUP(yytext, loc);        }
+{ return yy::Parser::make_KEYWORD_GROUP(loc);                }
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
 #line 55 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_KEYWORD_INFERENCE(yytext, loc);    }
+{ return yy::Parser::make_KEYWORD_INFERENCE(loc);            }
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
 #line 56 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_KEYWORD_ENVIRONMENT(yytext, loc);  }
+{ return yy::Parser::make_KEYWORD_ENVIRONMENT(loc);          }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
 #line 57 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_KEYWORD_ARGUMENTS(yytext, loc);    }
+{ return yy::Parser::make_KEYWORD_ARGUMENTS(loc);            }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
 #line 58 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_KEYWORD_GLOBALS(yytext, loc);      }
+{ return yy::Parser::make_KEYWORD_GLOBALS(loc);              }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
 #line 59 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_KEYWORD_WHILE(yytext, loc);        }
+{ return yy::Parser::make_KEYWORD_WHILE(loc);                }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
 #line 60 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_KEYWORD_INRANGE(yytext, loc);      }
+{ return yy::Parser::make_KEYWORD_INRANGE(loc);              }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
 #line 61 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_KEYWORD_PREMISES(yytext, loc);     }
+{ return yy::Parser::make_KEYWORD_PREMISES(loc);             }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
 #line 62 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_KEYWORD_PROPOSITION(yytext, loc);  }
+{ return yy::Parser::make_KEYWORD_PROPOSITION(loc);          }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
@@ -1123,7 +1126,7 @@ YY_RULE_SETUP
 case 12:
 YY_RULE_SETUP
 #line 65 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_IDENTIFIER(yytext, loc); }
+{ return yy::Parser::make_IDENTIFIER(std::string(yytext, yyleng), loc); }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
@@ -1150,7 +1153,7 @@ YY_RULE_SETUP
 case 16:
 YY_RULE_SETUP
 #line 78 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_COLON(yytext, loc); }
+{ return yy::Parser::make_COLON(loc); }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
@@ -1160,7 +1163,7 @@ YY_RULE_SETUP
 case 18:
 YY_RULE_SETUP
 #line 81 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_SEMICOLON(yytext, loc); }
+{ return yy::Parser::make_SEMICOLON(loc); }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
@@ -1170,7 +1173,7 @@ YY_RULE_SETUP
 case 20:
 YY_RULE_SETUP
 #line 84 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_OPERATOR_EQ(yytext, loc); }
+{ return yy::Parser::make_OPERATOR_EQ(loc); }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
@@ -1180,7 +1183,7 @@ YY_RULE_SETUP
 case 22:
 YY_RULE_SETUP
 #line 87 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_OPERATOR_NEQ(yytext, loc); }
+{ return yy::Parser::make_OPERATOR_NEQ(loc); }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
@@ -1190,7 +1193,7 @@ YY_RULE_SETUP
 case 24:
 YY_RULE_SETUP
 #line 90 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_OPERATOR_LT(yytext, loc); }
+{ return yy::Parser::make_OPERATOR_LT(loc); }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
@@ -1200,7 +1203,7 @@ YY_RULE_SETUP
 case 26:
 YY_RULE_SETUP
 #line 93 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_OPERATOR_LTE(yytext, loc); }
+{ return yy::Parser::make_OPERATOR_LTE(loc); }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
@@ -1210,7 +1213,7 @@ YY_RULE_SETUP
 case 28:
 YY_RULE_SETUP
 #line 96 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_DOT(yytext, loc); }
+{ return yy::Parser::make_DOT(loc); }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
@@ -1220,7 +1223,7 @@ YY_RULE_SETUP
 case 30:
 YY_RULE_SETUP
 #line 99 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_COMMA(yytext, loc); }
+{ return yy::Parser::make_COMMA(loc); }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
@@ -1230,12 +1233,12 @@ YY_RULE_SETUP
 case 32:
 YY_RULE_SETUP
 #line 102 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_LBRACKET(yytext, loc); }
+{ return yy::Parser::make_LBRACKET(loc); }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
 #line 103 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_RBRACKET(yytext, loc); }
+{ return yy::Parser::make_RBRACKET(loc); }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
@@ -1245,12 +1248,12 @@ YY_RULE_SETUP
 case 35:
 YY_RULE_SETUP
 #line 106 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_LBRACE(yytext, loc); }
+{ return yy::Parser::make_LBRACE(loc); }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 107 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_RBRACE(yytext, loc); }
+{ return yy::Parser::make_RBRACE(loc); }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
@@ -1260,12 +1263,12 @@ YY_RULE_SETUP
 case 38:
 YY_RULE_SETUP
 #line 110 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_LPAREN(yytext, loc); }
+{ return yy::Parser::make_LPAREN(loc); }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 111 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_RPAREN(yytext, loc); }
+{ return yy::Parser::make_RPAREN(loc); }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
@@ -1275,7 +1278,7 @@ YY_RULE_SETUP
 case 41:
 YY_RULE_SETUP
 #line 114 "/Users/x/workspace/snowlake/src/parser/lexer.ll"
-{ return yy::Parser::make_ELLIPSIS(yytext, loc); }
+{ return yy::Parser::make_ELLIPSIS(loc); }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.23-dbd16.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,26 +30,19 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
 
-// First part of user declarations.
 
-#line 37 "parser.tab.cc" // lalr1.cc:404
 
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "parser.tab.hh"
 
-// User implementation prologue.
 
-#line 51 "parser.tab.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 60 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:413
+#line 60 "parser.yy"
 
 // HACK: We need to refer to the header under the source directory
 // from the build directory.
@@ -58,7 +51,7 @@
 #include "../../../src/parser/ParserDriver.h"
 #include "lex.yy.hh"
 
-#line 62 "parser.tab.cc" // lalr1.cc:413
+#line 55 "precompiled/parser.tab.cc"
 
 
 #ifndef YY_
@@ -73,6 +66,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -90,13 +93,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if YYDEBUG
 
@@ -122,15 +122,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !YYDEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !YYDEBUG
 
@@ -142,54 +142,16 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-
 namespace yy {
-#line 148 "parser.tab.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 147 "precompiled/parser.tab.cc"
 
   /// Build a parser object.
   Parser::Parser (ParserDriver& driver_yyarg)
-    :
 #if YYDEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       driver (driver_yyarg)
   {}
@@ -197,32 +159,30 @@ namespace yy {
   Parser::~Parser ()
   {}
 
+  Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  Parser::by_state::by_state ()
+  Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  Parser::by_state::clear ()
+  Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   Parser::by_state::move (by_state& that)
   {
@@ -230,169 +190,316 @@ namespace yy {
     that.clear ();
   }
 
-  inline
-  Parser::by_state::by_state (state_type s)
+  Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  Parser::symbol_number_type
-  Parser::by_state::type_get () const
+  Parser::symbol_kind_type
+  Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   Parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_deduction_target: // deduction_target
+        value.YY_MOVE_OR_COPY< ASTDeductionTarget > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_deduction_target_array: // deduction_target_array
+        value.YY_MOVE_OR_COPY< ASTDeductionTargetArray > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_deduction_target_computed: // deduction_target_computed
+        value.YY_MOVE_OR_COPY< ASTDeductionTargetComputed > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_deduction_target_list: // deduction_target_list
+        value.YY_MOVE_OR_COPY< ASTDeductionTargetList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_deduction_target_singular: // deduction_target_singular
+        value.YY_MOVE_OR_COPY< ASTDeductionTargetSingular > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_dispatch_entry: // dispatch_entry
+        value.YY_MOVE_OR_COPY< ASTDispatchEntry > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_dispatch_set: // dispatch_set
+      case symbol_kind::S_dispatch_entry_list: // dispatch_entry_list
+        value.YY_MOVE_OR_COPY< ASTDispatchEntryList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_environment_defn: // environment_defn
+        value.YY_MOVE_OR_COPY< ASTEnvironmentDefn > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_environment_defn_list: // environment_defn_list
+        value.YY_MOVE_OR_COPY< ASTEnvironmentDefnList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_global_decl: // global_decl
+        value.YY_MOVE_OR_COPY< ASTGlobalDecl > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_global_decl_set: // global_decl_set
+      case symbol_kind::S_global_decl_list: // global_decl_list
+        value.YY_MOVE_OR_COPY< ASTGlobalDeclList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_identifiable: // identifiable
+        value.YY_MOVE_OR_COPY< ASTIdentifiable > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_identifier: // identifier
+        value.YY_MOVE_OR_COPY< ASTIdentifier > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_import: // import
+        value.YY_MOVE_OR_COPY< ASTImport > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_import_list: // import_list
+        value.YY_MOVE_OR_COPY< ASTImportList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_inference_argument: // inference_argument
+        value.YY_MOVE_OR_COPY< ASTInferenceArgument > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_argument_set: // argument_set
+      case symbol_kind::S_argument_list: // argument_list
+        value.YY_MOVE_OR_COPY< ASTInferenceArgumentList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_inference_defn: // inference_defn
+        value.YY_MOVE_OR_COPY< ASTInferenceDefn > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_inference_defn_list: // inference_defn_list
+        value.YY_MOVE_OR_COPY< ASTInferenceDefnList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_premise_type_equality_defn: // premise_type_equality_defn
+        value.YY_MOVE_OR_COPY< ASTInferenceEqualityDefn > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+      case symbol_kind::S_inference_group: // inference_group
+        value.YY_MOVE_OR_COPY< ASTInferenceGroup > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_inference_group_list: // inference_group_list
+        value.YY_MOVE_OR_COPY< ASTInferenceGroupList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_premise_type_inference_defn: // premise_type_inference_defn
+        value.YY_MOVE_OR_COPY< ASTInferencePremiseDefn > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_input: // input
+        value.YY_MOVE_OR_COPY< ASTModule > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_premise_defn: // premise_defn
+        value.YY_MOVE_OR_COPY< ASTPremiseDefn > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_premise_set: // premise_set
+      case symbol_kind::S_premise_defn_list: // premise_defn_list
+        value.YY_MOVE_OR_COPY< ASTPremiseDefnList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_proposition_defn: // proposition_defn
+        value.YY_MOVE_OR_COPY< ASTPropositionDefn > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_range_clause: // range_clause
+        value.YY_MOVE_OR_COPY< ASTRangeClause > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_while_clause: // while_clause
+        value.YY_MOVE_OR_COPY< ASTWhileClause > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_equality_operator: // equality_operator
+        value.YY_MOVE_OR_COPY< EqualityOperator > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_dispatch_inference_name_list: // dispatch_inference_name_list
+        value.YY_MOVE_OR_COPY< StringList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+      case symbol_kind::S_import_name: // import_name
+      case symbol_kind::S_base_inference_group: // base_inference_group
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER_LITERAL: // INTEGER_LITERAL
+        value.YY_MOVE_OR_COPY< uint64_t > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
+
+  Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 54: // deduction_target
-        value.move< ASTDeductionTarget > (that.value);
+      case symbol_kind::S_deduction_target: // deduction_target
+        value.move< ASTDeductionTarget > (YY_MOVE (that.value));
         break;
 
-      case 56: // deduction_target_array
-        value.move< ASTDeductionTargetArray > (that.value);
+      case symbol_kind::S_deduction_target_array: // deduction_target_array
+        value.move< ASTDeductionTargetArray > (YY_MOVE (that.value));
         break;
 
-      case 57: // deduction_target_computed
-        value.move< ASTDeductionTargetComputed > (that.value);
+      case symbol_kind::S_deduction_target_computed: // deduction_target_computed
+        value.move< ASTDeductionTargetComputed > (YY_MOVE (that.value));
         break;
 
-      case 53: // deduction_target_list
-        value.move< ASTDeductionTargetList > (that.value);
+      case symbol_kind::S_deduction_target_list: // deduction_target_list
+        value.move< ASTDeductionTargetList > (YY_MOVE (that.value));
         break;
 
-      case 55: // deduction_target_singular
-        value.move< ASTDeductionTargetSingular > (that.value);
+      case symbol_kind::S_deduction_target_singular: // deduction_target_singular
+        value.move< ASTDeductionTargetSingular > (YY_MOVE (that.value));
         break;
 
-      case 34: // environment_defn
-        value.move< ASTEnvironmentDefn > (that.value);
+      case symbol_kind::S_dispatch_entry: // dispatch_entry
+        value.move< ASTDispatchEntry > (YY_MOVE (that.value));
         break;
 
-      case 33: // environment_defn_list
-        value.move< ASTEnvironmentDefnList > (that.value);
+      case symbol_kind::S_dispatch_set: // dispatch_set
+      case symbol_kind::S_dispatch_entry_list: // dispatch_entry_list
+        value.move< ASTDispatchEntryList > (YY_MOVE (that.value));
         break;
 
-      case 39: // global_decl
-        value.move< ASTGlobalDecl > (that.value);
+      case symbol_kind::S_environment_defn: // environment_defn
+        value.move< ASTEnvironmentDefn > (YY_MOVE (that.value));
         break;
 
-      case 37: // global_decl_set
-      case 38: // global_decl_list
-        value.move< ASTGlobalDeclList > (that.value);
+      case symbol_kind::S_environment_defn_list: // environment_defn_list
+        value.move< ASTEnvironmentDefnList > (YY_MOVE (that.value));
         break;
 
-      case 51: // identifiable
-        value.move< ASTIdentifiable > (that.value);
+      case symbol_kind::S_global_decl: // global_decl
+        value.move< ASTGlobalDecl > (YY_MOVE (that.value));
         break;
 
-      case 52: // identifier
-        value.move< ASTIdentifier > (that.value);
+      case symbol_kind::S_global_decl_set: // global_decl_set
+      case symbol_kind::S_global_decl_list: // global_decl_list
+        value.move< ASTGlobalDeclList > (YY_MOVE (that.value));
         break;
 
-      case 42: // inference_argument
-        value.move< ASTInferenceArgument > (that.value);
+      case symbol_kind::S_identifiable: // identifiable
+        value.move< ASTIdentifiable > (YY_MOVE (that.value));
         break;
 
-      case 40: // argument_set
-      case 41: // argument_list
-        value.move< ASTInferenceArgumentList > (that.value);
+      case symbol_kind::S_identifier: // identifier
+        value.move< ASTIdentifier > (YY_MOVE (that.value));
         break;
 
-      case 36: // inference_defn
-        value.move< ASTInferenceDefn > (that.value);
+      case symbol_kind::S_import: // import
+        value.move< ASTImport > (YY_MOVE (that.value));
         break;
 
-      case 35: // inference_defn_list
-        value.move< ASTInferenceDefnList > (that.value);
+      case symbol_kind::S_import_list: // import_list
+        value.move< ASTImportList > (YY_MOVE (that.value));
         break;
 
-      case 48: // premise_type_equality_defn
-        value.move< ASTInferenceEqualityDefn > (that.value);
+      case symbol_kind::S_inference_argument: // inference_argument
+        value.move< ASTInferenceArgument > (YY_MOVE (that.value));
         break;
 
-      case 32: // inference_group
-        value.move< ASTInferenceGroup > (that.value);
+      case symbol_kind::S_argument_set: // argument_set
+      case symbol_kind::S_argument_list: // argument_list
+        value.move< ASTInferenceArgumentList > (YY_MOVE (that.value));
         break;
 
-      case 31: // inference_group_list
-        value.move< ASTInferenceGroupList > (that.value);
+      case symbol_kind::S_inference_defn: // inference_defn
+        value.move< ASTInferenceDefn > (YY_MOVE (that.value));
         break;
 
-      case 46: // premise_type_inference_defn
-        value.move< ASTInferencePremiseDefn > (that.value);
+      case symbol_kind::S_inference_defn_list: // inference_defn_list
+        value.move< ASTInferenceDefnList > (YY_MOVE (that.value));
         break;
 
-      case 30: // input
-        value.move< ASTModule > (that.value);
+      case symbol_kind::S_premise_type_equality_defn: // premise_type_equality_defn
+        value.move< ASTInferenceEqualityDefn > (YY_MOVE (that.value));
         break;
 
-      case 45: // premise_defn
-        value.move< ASTPremiseDefn > (that.value);
+      case symbol_kind::S_inference_group: // inference_group
+        value.move< ASTInferenceGroup > (YY_MOVE (that.value));
         break;
 
-      case 43: // premise_set
-      case 44: // premise_defn_list
-        value.move< ASTPremiseDefnList > (that.value);
+      case symbol_kind::S_inference_group_list: // inference_group_list
+        value.move< ASTInferenceGroupList > (YY_MOVE (that.value));
         break;
 
-      case 50: // proposition_defn
-        value.move< ASTPropositionDefn > (that.value);
+      case symbol_kind::S_premise_type_inference_defn: // premise_type_inference_defn
+        value.move< ASTInferencePremiseDefn > (YY_MOVE (that.value));
         break;
 
-      case 49: // range_clause
-        value.move< ASTRangeClause > (that.value);
+      case symbol_kind::S_input: // input
+        value.move< ASTModule > (YY_MOVE (that.value));
         break;
 
-      case 47: // while_clause
-        value.move< ASTWhileClause > (that.value);
+      case symbol_kind::S_premise_defn: // premise_defn
+        value.move< ASTPremiseDefn > (YY_MOVE (that.value));
         break;
 
-      case 58: // equality_operator
-        value.move< EqualityOperator > (that.value);
+      case symbol_kind::S_premise_set: // premise_set
+      case symbol_kind::S_premise_defn_list: // premise_defn_list
+        value.move< ASTPremiseDefnList > (YY_MOVE (that.value));
         break;
 
-      case 3: // KEYWORD_GROUP
-      case 4: // KEYWORD_INFERENCE
-      case 5: // KEYWORD_ENVIRONMENT
-      case 6: // KEYWORD_ARGUMENTS
-      case 7: // KEYWORD_GLOBALS
-      case 8: // KEYWORD_WHILE
-      case 9: // KEYWORD_INRANGE
-      case 10: // KEYWORD_PREMISES
-      case 11: // KEYWORD_PROPOSITION
-      case 13: // IDENTIFIER
-      case 14: // DOT
-      case 15: // COMMA
-      case 16: // COLON
-      case 17: // SEMICOLON
-      case 18: // LBRACKET
-      case 19: // RBRACKET
-      case 20: // LBRACE
-      case 21: // RBRACE
-      case 22: // LPAREN
-      case 23: // RPAREN
-      case 24: // OPERATOR_EQ
-      case 25: // OPERATOR_NEQ
-      case 26: // OPERATOR_LT
-      case 27: // OPERATOR_LTE
-      case 28: // ELLIPSIS
-        value.move< std::string > (that.value);
+      case symbol_kind::S_proposition_defn: // proposition_defn
+        value.move< ASTPropositionDefn > (YY_MOVE (that.value));
         break;
 
-      case 12: // INTEGER_LITERAL
-        value.move< uint64_t > (that.value);
+      case symbol_kind::S_range_clause: // range_clause
+        value.move< ASTRangeClause > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_while_clause: // while_clause
+        value.move< ASTWhileClause > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_equality_operator: // equality_operator
+        value.move< EqualityOperator > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_dispatch_inference_name_list: // dispatch_inference_name_list
+        value.move< StringList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+      case symbol_kind::S_import_name: // import_name
+      case symbol_kind::S_base_inference_group: // base_inference_group
+        value.move< std::string > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER_LITERAL: // INTEGER_LITERAL
+        value.move< uint64_t > (YY_MOVE (that.value));
         break;
 
       default:
@@ -400,152 +507,151 @@ namespace yy {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   Parser::stack_symbol_type&
   Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 54: // deduction_target
+      case symbol_kind::S_deduction_target: // deduction_target
         value.copy< ASTDeductionTarget > (that.value);
         break;
 
-      case 56: // deduction_target_array
+      case symbol_kind::S_deduction_target_array: // deduction_target_array
         value.copy< ASTDeductionTargetArray > (that.value);
         break;
 
-      case 57: // deduction_target_computed
+      case symbol_kind::S_deduction_target_computed: // deduction_target_computed
         value.copy< ASTDeductionTargetComputed > (that.value);
         break;
 
-      case 53: // deduction_target_list
+      case symbol_kind::S_deduction_target_list: // deduction_target_list
         value.copy< ASTDeductionTargetList > (that.value);
         break;
 
-      case 55: // deduction_target_singular
+      case symbol_kind::S_deduction_target_singular: // deduction_target_singular
         value.copy< ASTDeductionTargetSingular > (that.value);
         break;
 
-      case 34: // environment_defn
+      case symbol_kind::S_dispatch_entry: // dispatch_entry
+        value.copy< ASTDispatchEntry > (that.value);
+        break;
+
+      case symbol_kind::S_dispatch_set: // dispatch_set
+      case symbol_kind::S_dispatch_entry_list: // dispatch_entry_list
+        value.copy< ASTDispatchEntryList > (that.value);
+        break;
+
+      case symbol_kind::S_environment_defn: // environment_defn
         value.copy< ASTEnvironmentDefn > (that.value);
         break;
 
-      case 33: // environment_defn_list
+      case symbol_kind::S_environment_defn_list: // environment_defn_list
         value.copy< ASTEnvironmentDefnList > (that.value);
         break;
 
-      case 39: // global_decl
+      case symbol_kind::S_global_decl: // global_decl
         value.copy< ASTGlobalDecl > (that.value);
         break;
 
-      case 37: // global_decl_set
-      case 38: // global_decl_list
+      case symbol_kind::S_global_decl_set: // global_decl_set
+      case symbol_kind::S_global_decl_list: // global_decl_list
         value.copy< ASTGlobalDeclList > (that.value);
         break;
 
-      case 51: // identifiable
+      case symbol_kind::S_identifiable: // identifiable
         value.copy< ASTIdentifiable > (that.value);
         break;
 
-      case 52: // identifier
+      case symbol_kind::S_identifier: // identifier
         value.copy< ASTIdentifier > (that.value);
         break;
 
-      case 42: // inference_argument
+      case symbol_kind::S_import: // import
+        value.copy< ASTImport > (that.value);
+        break;
+
+      case symbol_kind::S_import_list: // import_list
+        value.copy< ASTImportList > (that.value);
+        break;
+
+      case symbol_kind::S_inference_argument: // inference_argument
         value.copy< ASTInferenceArgument > (that.value);
         break;
 
-      case 40: // argument_set
-      case 41: // argument_list
+      case symbol_kind::S_argument_set: // argument_set
+      case symbol_kind::S_argument_list: // argument_list
         value.copy< ASTInferenceArgumentList > (that.value);
         break;
 
-      case 36: // inference_defn
+      case symbol_kind::S_inference_defn: // inference_defn
         value.copy< ASTInferenceDefn > (that.value);
         break;
 
-      case 35: // inference_defn_list
+      case symbol_kind::S_inference_defn_list: // inference_defn_list
         value.copy< ASTInferenceDefnList > (that.value);
         break;
 
-      case 48: // premise_type_equality_defn
+      case symbol_kind::S_premise_type_equality_defn: // premise_type_equality_defn
         value.copy< ASTInferenceEqualityDefn > (that.value);
         break;
 
-      case 32: // inference_group
+      case symbol_kind::S_inference_group: // inference_group
         value.copy< ASTInferenceGroup > (that.value);
         break;
 
-      case 31: // inference_group_list
+      case symbol_kind::S_inference_group_list: // inference_group_list
         value.copy< ASTInferenceGroupList > (that.value);
         break;
 
-      case 46: // premise_type_inference_defn
+      case symbol_kind::S_premise_type_inference_defn: // premise_type_inference_defn
         value.copy< ASTInferencePremiseDefn > (that.value);
         break;
 
-      case 30: // input
+      case symbol_kind::S_input: // input
         value.copy< ASTModule > (that.value);
         break;
 
-      case 45: // premise_defn
+      case symbol_kind::S_premise_defn: // premise_defn
         value.copy< ASTPremiseDefn > (that.value);
         break;
 
-      case 43: // premise_set
-      case 44: // premise_defn_list
+      case symbol_kind::S_premise_set: // premise_set
+      case symbol_kind::S_premise_defn_list: // premise_defn_list
         value.copy< ASTPremiseDefnList > (that.value);
         break;
 
-      case 50: // proposition_defn
+      case symbol_kind::S_proposition_defn: // proposition_defn
         value.copy< ASTPropositionDefn > (that.value);
         break;
 
-      case 49: // range_clause
+      case symbol_kind::S_range_clause: // range_clause
         value.copy< ASTRangeClause > (that.value);
         break;
 
-      case 47: // while_clause
+      case symbol_kind::S_while_clause: // while_clause
         value.copy< ASTWhileClause > (that.value);
         break;
 
-      case 58: // equality_operator
+      case symbol_kind::S_equality_operator: // equality_operator
         value.copy< EqualityOperator > (that.value);
         break;
 
-      case 3: // KEYWORD_GROUP
-      case 4: // KEYWORD_INFERENCE
-      case 5: // KEYWORD_ENVIRONMENT
-      case 6: // KEYWORD_ARGUMENTS
-      case 7: // KEYWORD_GLOBALS
-      case 8: // KEYWORD_WHILE
-      case 9: // KEYWORD_INRANGE
-      case 10: // KEYWORD_PREMISES
-      case 11: // KEYWORD_PROPOSITION
-      case 13: // IDENTIFIER
-      case 14: // DOT
-      case 15: // COMMA
-      case 16: // COLON
-      case 17: // SEMICOLON
-      case 18: // LBRACKET
-      case 19: // RBRACKET
-      case 20: // LBRACE
-      case 21: // RBRACE
-      case 22: // LPAREN
-      case 23: // RPAREN
-      case 24: // OPERATOR_EQ
-      case 25: // OPERATOR_NEQ
-      case 26: // OPERATOR_LT
-      case 27: // OPERATOR_LTE
-      case 28: // ELLIPSIS
+      case symbol_kind::S_dispatch_inference_name_list: // dispatch_inference_name_list
+        value.copy< StringList > (that.value);
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+      case symbol_kind::S_import_name: // import_name
+      case symbol_kind::S_base_inference_group: // base_inference_group
         value.copy< std::string > (that.value);
         break;
 
-      case 12: // INTEGER_LITERAL
+      case symbol_kind::S_INTEGER_LITERAL: // INTEGER_LITERAL
         value.copy< uint64_t > (that.value);
         break;
 
@@ -557,9 +663,162 @@ namespace yy {
     return *this;
   }
 
+  Parser::stack_symbol_type&
+  Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_deduction_target: // deduction_target
+        value.move< ASTDeductionTarget > (that.value);
+        break;
+
+      case symbol_kind::S_deduction_target_array: // deduction_target_array
+        value.move< ASTDeductionTargetArray > (that.value);
+        break;
+
+      case symbol_kind::S_deduction_target_computed: // deduction_target_computed
+        value.move< ASTDeductionTargetComputed > (that.value);
+        break;
+
+      case symbol_kind::S_deduction_target_list: // deduction_target_list
+        value.move< ASTDeductionTargetList > (that.value);
+        break;
+
+      case symbol_kind::S_deduction_target_singular: // deduction_target_singular
+        value.move< ASTDeductionTargetSingular > (that.value);
+        break;
+
+      case symbol_kind::S_dispatch_entry: // dispatch_entry
+        value.move< ASTDispatchEntry > (that.value);
+        break;
+
+      case symbol_kind::S_dispatch_set: // dispatch_set
+      case symbol_kind::S_dispatch_entry_list: // dispatch_entry_list
+        value.move< ASTDispatchEntryList > (that.value);
+        break;
+
+      case symbol_kind::S_environment_defn: // environment_defn
+        value.move< ASTEnvironmentDefn > (that.value);
+        break;
+
+      case symbol_kind::S_environment_defn_list: // environment_defn_list
+        value.move< ASTEnvironmentDefnList > (that.value);
+        break;
+
+      case symbol_kind::S_global_decl: // global_decl
+        value.move< ASTGlobalDecl > (that.value);
+        break;
+
+      case symbol_kind::S_global_decl_set: // global_decl_set
+      case symbol_kind::S_global_decl_list: // global_decl_list
+        value.move< ASTGlobalDeclList > (that.value);
+        break;
+
+      case symbol_kind::S_identifiable: // identifiable
+        value.move< ASTIdentifiable > (that.value);
+        break;
+
+      case symbol_kind::S_identifier: // identifier
+        value.move< ASTIdentifier > (that.value);
+        break;
+
+      case symbol_kind::S_import: // import
+        value.move< ASTImport > (that.value);
+        break;
+
+      case symbol_kind::S_import_list: // import_list
+        value.move< ASTImportList > (that.value);
+        break;
+
+      case symbol_kind::S_inference_argument: // inference_argument
+        value.move< ASTInferenceArgument > (that.value);
+        break;
+
+      case symbol_kind::S_argument_set: // argument_set
+      case symbol_kind::S_argument_list: // argument_list
+        value.move< ASTInferenceArgumentList > (that.value);
+        break;
+
+      case symbol_kind::S_inference_defn: // inference_defn
+        value.move< ASTInferenceDefn > (that.value);
+        break;
+
+      case symbol_kind::S_inference_defn_list: // inference_defn_list
+        value.move< ASTInferenceDefnList > (that.value);
+        break;
+
+      case symbol_kind::S_premise_type_equality_defn: // premise_type_equality_defn
+        value.move< ASTInferenceEqualityDefn > (that.value);
+        break;
+
+      case symbol_kind::S_inference_group: // inference_group
+        value.move< ASTInferenceGroup > (that.value);
+        break;
+
+      case symbol_kind::S_inference_group_list: // inference_group_list
+        value.move< ASTInferenceGroupList > (that.value);
+        break;
+
+      case symbol_kind::S_premise_type_inference_defn: // premise_type_inference_defn
+        value.move< ASTInferencePremiseDefn > (that.value);
+        break;
+
+      case symbol_kind::S_input: // input
+        value.move< ASTModule > (that.value);
+        break;
+
+      case symbol_kind::S_premise_defn: // premise_defn
+        value.move< ASTPremiseDefn > (that.value);
+        break;
+
+      case symbol_kind::S_premise_set: // premise_set
+      case symbol_kind::S_premise_defn_list: // premise_defn_list
+        value.move< ASTPremiseDefnList > (that.value);
+        break;
+
+      case symbol_kind::S_proposition_defn: // proposition_defn
+        value.move< ASTPropositionDefn > (that.value);
+        break;
+
+      case symbol_kind::S_range_clause: // range_clause
+        value.move< ASTRangeClause > (that.value);
+        break;
+
+      case symbol_kind::S_while_clause: // while_clause
+        value.move< ASTWhileClause > (that.value);
+        break;
+
+      case symbol_kind::S_equality_operator: // equality_operator
+        value.move< EqualityOperator > (that.value);
+        break;
+
+      case symbol_kind::S_dispatch_inference_name_list: // dispatch_inference_name_list
+        value.move< StringList > (that.value);
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+      case symbol_kind::S_import_name: // import_name
+      case symbol_kind::S_base_inference_group: // base_inference_group
+        value.move< std::string > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER_LITERAL: // INTEGER_LITERAL
+        value.move< uint64_t > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -570,44 +829,45 @@ namespace yy {
 #if YYDEBUG
   template <typename Base>
   void
-  Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    YYUSE (yytype);
-    yyo << ')';
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        YY_USE (yykind);
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  Parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  Parser::yypush_ (const char* m, stack_symbol_type& s)
+  Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  Parser::yypop_ (unsigned n)
+  Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -639,32 +899,37 @@ namespace yy {
   }
 #endif // YYDEBUG
 
-  inline Parser::state_type
+  Parser::state_type
   Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  Parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  Parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  Parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -682,15 +947,15 @@ namespace yy {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This shoud be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
     YYCDEBUG << "Starting parse\n";
 
 
     // User initialization code.
-    #line 50 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:745
+#line 50 "parser.yy"
 {
   // Initialize the initial location.
   if (!driver.inputFile().empty())
@@ -699,55 +964,78 @@ namespace yy {
   }
 }
 
-#line 703 "parser.tab.cc" // lalr1.cc:745
+#line 968 "precompiled/parser.tab.cc"
+
 
     /* Initialize the stack.  The initial state will be set in
        yynewstate, since the latter expects the semantical and the
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (driver));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -764,20 +1052,22 @@ namespace yy {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
@@ -787,597 +1077,733 @@ namespace yy {
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
+      switch (yyr1_[yyn])
     {
-      case 54: // deduction_target
-        yylhs.value.build< ASTDeductionTarget > ();
+      case symbol_kind::S_deduction_target: // deduction_target
+        yylhs.value.emplace< ASTDeductionTarget > ();
+        break;
+
+      case symbol_kind::S_deduction_target_array: // deduction_target_array
+        yylhs.value.emplace< ASTDeductionTargetArray > ();
+        break;
+
+      case symbol_kind::S_deduction_target_computed: // deduction_target_computed
+        yylhs.value.emplace< ASTDeductionTargetComputed > ();
+        break;
+
+      case symbol_kind::S_deduction_target_list: // deduction_target_list
+        yylhs.value.emplace< ASTDeductionTargetList > ();
+        break;
+
+      case symbol_kind::S_deduction_target_singular: // deduction_target_singular
+        yylhs.value.emplace< ASTDeductionTargetSingular > ();
+        break;
+
+      case symbol_kind::S_dispatch_entry: // dispatch_entry
+        yylhs.value.emplace< ASTDispatchEntry > ();
+        break;
+
+      case symbol_kind::S_dispatch_set: // dispatch_set
+      case symbol_kind::S_dispatch_entry_list: // dispatch_entry_list
+        yylhs.value.emplace< ASTDispatchEntryList > ();
+        break;
+
+      case symbol_kind::S_environment_defn: // environment_defn
+        yylhs.value.emplace< ASTEnvironmentDefn > ();
+        break;
+
+      case symbol_kind::S_environment_defn_list: // environment_defn_list
+        yylhs.value.emplace< ASTEnvironmentDefnList > ();
+        break;
+
+      case symbol_kind::S_global_decl: // global_decl
+        yylhs.value.emplace< ASTGlobalDecl > ();
+        break;
+
+      case symbol_kind::S_global_decl_set: // global_decl_set
+      case symbol_kind::S_global_decl_list: // global_decl_list
+        yylhs.value.emplace< ASTGlobalDeclList > ();
+        break;
+
+      case symbol_kind::S_identifiable: // identifiable
+        yylhs.value.emplace< ASTIdentifiable > ();
         break;
 
-      case 56: // deduction_target_array
-        yylhs.value.build< ASTDeductionTargetArray > ();
+      case symbol_kind::S_identifier: // identifier
+        yylhs.value.emplace< ASTIdentifier > ();
         break;
 
-      case 57: // deduction_target_computed
-        yylhs.value.build< ASTDeductionTargetComputed > ();
+      case symbol_kind::S_import: // import
+        yylhs.value.emplace< ASTImport > ();
         break;
 
-      case 53: // deduction_target_list
-        yylhs.value.build< ASTDeductionTargetList > ();
+      case symbol_kind::S_import_list: // import_list
+        yylhs.value.emplace< ASTImportList > ();
         break;
 
-      case 55: // deduction_target_singular
-        yylhs.value.build< ASTDeductionTargetSingular > ();
+      case symbol_kind::S_inference_argument: // inference_argument
+        yylhs.value.emplace< ASTInferenceArgument > ();
         break;
 
-      case 34: // environment_defn
-        yylhs.value.build< ASTEnvironmentDefn > ();
+      case symbol_kind::S_argument_set: // argument_set
+      case symbol_kind::S_argument_list: // argument_list
+        yylhs.value.emplace< ASTInferenceArgumentList > ();
         break;
 
-      case 33: // environment_defn_list
-        yylhs.value.build< ASTEnvironmentDefnList > ();
+      case symbol_kind::S_inference_defn: // inference_defn
+        yylhs.value.emplace< ASTInferenceDefn > ();
         break;
 
-      case 39: // global_decl
-        yylhs.value.build< ASTGlobalDecl > ();
+      case symbol_kind::S_inference_defn_list: // inference_defn_list
+        yylhs.value.emplace< ASTInferenceDefnList > ();
         break;
 
-      case 37: // global_decl_set
-      case 38: // global_decl_list
-        yylhs.value.build< ASTGlobalDeclList > ();
+      case symbol_kind::S_premise_type_equality_defn: // premise_type_equality_defn
+        yylhs.value.emplace< ASTInferenceEqualityDefn > ();
         break;
 
-      case 51: // identifiable
-        yylhs.value.build< ASTIdentifiable > ();
+      case symbol_kind::S_inference_group: // inference_group
+        yylhs.value.emplace< ASTInferenceGroup > ();
         break;
 
-      case 52: // identifier
-        yylhs.value.build< ASTIdentifier > ();
+      case symbol_kind::S_inference_group_list: // inference_group_list
+        yylhs.value.emplace< ASTInferenceGroupList > ();
         break;
 
-      case 42: // inference_argument
-        yylhs.value.build< ASTInferenceArgument > ();
+      case symbol_kind::S_premise_type_inference_defn: // premise_type_inference_defn
+        yylhs.value.emplace< ASTInferencePremiseDefn > ();
         break;
 
-      case 40: // argument_set
-      case 41: // argument_list
-        yylhs.value.build< ASTInferenceArgumentList > ();
+      case symbol_kind::S_input: // input
+        yylhs.value.emplace< ASTModule > ();
         break;
 
-      case 36: // inference_defn
-        yylhs.value.build< ASTInferenceDefn > ();
+      case symbol_kind::S_premise_defn: // premise_defn
+        yylhs.value.emplace< ASTPremiseDefn > ();
         break;
 
-      case 35: // inference_defn_list
-        yylhs.value.build< ASTInferenceDefnList > ();
+      case symbol_kind::S_premise_set: // premise_set
+      case symbol_kind::S_premise_defn_list: // premise_defn_list
+        yylhs.value.emplace< ASTPremiseDefnList > ();
         break;
 
-      case 48: // premise_type_equality_defn
-        yylhs.value.build< ASTInferenceEqualityDefn > ();
+      case symbol_kind::S_proposition_defn: // proposition_defn
+        yylhs.value.emplace< ASTPropositionDefn > ();
         break;
 
-      case 32: // inference_group
-        yylhs.value.build< ASTInferenceGroup > ();
+      case symbol_kind::S_range_clause: // range_clause
+        yylhs.value.emplace< ASTRangeClause > ();
         break;
 
-      case 31: // inference_group_list
-        yylhs.value.build< ASTInferenceGroupList > ();
+      case symbol_kind::S_while_clause: // while_clause
+        yylhs.value.emplace< ASTWhileClause > ();
         break;
 
-      case 46: // premise_type_inference_defn
-        yylhs.value.build< ASTInferencePremiseDefn > ();
+      case symbol_kind::S_equality_operator: // equality_operator
+        yylhs.value.emplace< EqualityOperator > ();
         break;
 
-      case 30: // input
-        yylhs.value.build< ASTModule > ();
+      case symbol_kind::S_dispatch_inference_name_list: // dispatch_inference_name_list
+        yylhs.value.emplace< StringList > ();
         break;
 
-      case 45: // premise_defn
-        yylhs.value.build< ASTPremiseDefn > ();
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+      case symbol_kind::S_import_name: // import_name
+      case symbol_kind::S_base_inference_group: // base_inference_group
+        yylhs.value.emplace< std::string > ();
         break;
 
-      case 43: // premise_set
-      case 44: // premise_defn_list
-        yylhs.value.build< ASTPremiseDefnList > ();
-        break;
+      case symbol_kind::S_INTEGER_LITERAL: // INTEGER_LITERAL
+        yylhs.value.emplace< uint64_t > ();
+        break;
+
+      default:
+        break;
+    }
+
+
+      // Default location.
+      {
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
+      }
+
+      // Perform the reduction.
+      YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
+      try
+#endif // YY_EXCEPTIONS
+        {
+          switch (yyn)
+            {
+  case 2: // input: import_list inference_group_list
+#line 149 "parser.yy"
+        {
+            ASTModule module(std::move(yystack_[1].value.as < ASTImportList > ()), std::move(yystack_[0].value.as < ASTInferenceGroupList > ()));
+            driver.setModule(std::move(module));
+        }
+#line 1247 "precompiled/parser.tab.cc"
+    break;
+
+  case 3: // import_list: %empty
+#line 157 "parser.yy"
+        {
+            yylhs.value.as < ASTImportList > () = ASTImportList();
+        }
+#line 1255 "precompiled/parser.tab.cc"
+    break;
+
+  case 4: // import_list: import_list import
+#line 162 "parser.yy"
+        {
+            yystack_[1].value.as < ASTImportList > ().push_back(std::move(yystack_[0].value.as < ASTImport > ()));
+            yylhs.value.as < ASTImportList > () = std::move(yystack_[1].value.as < ASTImportList > ());
+        }
+#line 1264 "precompiled/parser.tab.cc"
+    break;
+
+  case 5: // import: IDENTIFIER import_name SEMICOLON
+#line 171 "parser.yy"
+        {
+            // "import" is a contextual keyword, so that it remains
+            // usable as an identifier everywhere else.
+            if (yystack_[2].value.as < std::string > () != "import") {
+                error(yystack_[2].location, "syntax error, unexpected \"" + yystack_[2].value.as < std::string > () + "\", expecting import");
+                YYERROR;
+            }
+            yylhs.value.as < ASTImport > () = ASTImport(std::move(yystack_[1].value.as < std::string > ()));
+        }
+#line 1278 "precompiled/parser.tab.cc"
+    break;
+
+  case 6: // import_name: IDENTIFIER
+#line 185 "parser.yy"
+        {
+            yylhs.value.as < std::string > () = std::move(yystack_[0].value.as < std::string > ());
+        }
+#line 1286 "precompiled/parser.tab.cc"
+    break;
 
-      case 50: // proposition_defn
-        yylhs.value.build< ASTPropositionDefn > ();
-        break;
+  case 7: // import_name: import_name DOT IDENTIFIER
+#line 190 "parser.yy"
+        {
+            yystack_[2].value.as < std::string > () += '.';
+            yystack_[2].value.as < std::string > () += yystack_[0].value.as < std::string > ();
+            yylhs.value.as < std::string > () = std::move(yystack_[2].value.as < std::string > ());
+        }
+#line 1296 "precompiled/parser.tab.cc"
+    break;
 
-      case 49: // range_clause
-        yylhs.value.build< ASTRangeClause > ();
-        break;
+  case 8: // inference_group_list: %empty
+#line 199 "parser.yy"
+        {
+            yylhs.value.as < ASTInferenceGroupList > () = ASTInferenceGroupList();
+        }
+#line 1304 "precompiled/parser.tab.cc"
+    break;
 
-      case 47: // while_clause
-        yylhs.value.build< ASTWhileClause > ();
-        break;
+  case 9: // inference_group_list: inference_group_list inference_group
+#line 204 "parser.yy"
+        {
+            yystack_[1].value.as < ASTInferenceGroupList > ().push_back(std::move(yystack_[0].value.as < ASTInferenceGroup > ()));
+            yylhs.value.as < ASTInferenceGroupList > () = std::move(yystack_[1].value.as < ASTInferenceGroupList > ());
+        }
+#line 1313 "precompiled/parser.tab.cc"
+    break;
 
-      case 58: // equality_operator
-        yylhs.value.build< EqualityOperator > ();
-        break;
+  case 10: // inference_group: KEYWORD_GROUP IDENTIFIER base_inference_group LBRACE environment_defn_list dispatch_set inference_defn_list RBRACE
+#line 217 "parser.yy"
+        {
+            yylhs.value.as < ASTInferenceGroup > () = ASTInferenceGroup(std::move(yystack_[6].value.as < std::string > ()), std::move(yystack_[5].value.as < std::string > ()), std::move(yystack_[3].value.as < ASTEnvironmentDefnList > ()), std::move(yystack_[2].value.as < ASTDispatchEntryList > ()), std::move(yystack_[1].value.as < ASTInferenceDefnList > ()));
+        }
+#line 1321 "precompiled/parser.tab.cc"
+    break;
 
-      case 3: // KEYWORD_GROUP
-      case 4: // KEYWORD_INFERENCE
-      case 5: // KEYWORD_ENVIRONMENT
-      case 6: // KEYWORD_ARGUMENTS
-      case 7: // KEYWORD_GLOBALS
-      case 8: // KEYWORD_WHILE
-      case 9: // KEYWORD_INRANGE
-      case 10: // KEYWORD_PREMISES
-      case 11: // KEYWORD_PROPOSITION
-      case 13: // IDENTIFIER
-      case 14: // DOT
-      case 15: // COMMA
-      case 16: // COLON
-      case 17: // SEMICOLON
-      case 18: // LBRACKET
-      case 19: // RBRACKET
-      case 20: // LBRACE
-      case 21: // RBRACE
-      case 22: // LPAREN
-      case 23: // RPAREN
-      case 24: // OPERATOR_EQ
-      case 25: // OPERATOR_NEQ
-      case 26: // OPERATOR_LT
-      case 27: // OPERATOR_LTE
-      case 28: // ELLIPSIS
-        yylhs.value.build< std::string > ();
-        break;
+  case 11: // base_inference_group: %empty
+#line 224 "parser.yy"
+        {
+            yylhs.value.as < std::string > () = StringType();
+        }
+#line 1329 "precompiled/parser.tab.cc"
+    break;
 
-      case 12: // INTEGER_LITERAL
-        yylhs.value.build< uint64_t > ();
-        break;
+  case 12: // base_inference_group: COLON IDENTIFIER
+#line 229 "parser.yy"
+        {
+            yylhs.value.as < std::string > () = std::move(yystack_[0].value.as < std::string > ());
+        }
+#line 1337 "precompiled/parser.tab.cc"
+    break;
 
-      default:
-        break;
-    }
+  case 13: // environment_defn_list: %empty
+#line 236 "parser.yy"
+        {
+            yylhs.value.as < ASTEnvironmentDefnList > () = ASTEnvironmentDefnList();
+        }
+#line 1345 "precompiled/parser.tab.cc"
+    break;
 
+  case 14: // environment_defn_list: environment_defn_list environment_defn
+#line 241 "parser.yy"
+        {
+            yystack_[1].value.as < ASTEnvironmentDefnList > ().push_back(std::move(yystack_[0].value.as < ASTEnvironmentDefn > ()));
+            yylhs.value.as < ASTEnvironmentDefnList > () = std::move(yystack_[1].value.as < ASTEnvironmentDefnList > ());
+        }
+#line 1354 "precompiled/parser.tab.cc"
+    break;
 
-      // Default location.
-      {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
-        yyerror_range[1].location = yylhs.location;
-      }
+  case 15: // environment_defn: IDENTIFIER COLON IDENTIFIER SEMICOLON
+#line 250 "parser.yy"
+        {
+            yylhs.value.as < ASTEnvironmentDefn > () = ASTEnvironmentDefn(std::move(yystack_[3].value.as < std::string > ()), std::move(yystack_[1].value.as < std::string > ()));
+        }
+#line 1362 "precompiled/parser.tab.cc"
+    break;
 
-      // Perform the reduction.
-      YY_REDUCE_PRINT (yyn);
-      try
+  case 16: // dispatch_set: %empty
+#line 257 "parser.yy"
         {
-          switch (yyn)
-            {
-  case 2:
-#line 139 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            ASTModule module(std::move(yystack_[0].value.as< ASTInferenceGroupList > ()));
-            driver.setModule(std::move(module));
+            yylhs.value.as < ASTDispatchEntryList > () = ASTDispatchEntryList();
         }
-#line 956 "parser.tab.cc" // lalr1.cc:860
+#line 1370 "precompiled/parser.tab.cc"
     break;
 
-  case 3:
-#line 147 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferenceGroupList > () = ASTInferenceGroupList();
+  case 17: // dispatch_set: IDENTIFIER COLON LBRACKET dispatch_entry_list RBRACKET
+#line 262 "parser.yy"
+        {
+            // "dispatch" is a contextual keyword, so that it remains
+            // usable as an identifier everywhere else.
+            if (yystack_[4].value.as < std::string > () != "dispatch") {
+                error(yystack_[4].location, "syntax error, unexpected section \"" + yystack_[4].value.as < std::string > () + "\", expecting dispatch");
+                YYERROR;
+            }
+            yylhs.value.as < ASTDispatchEntryList > () = std::move(yystack_[1].value.as < ASTDispatchEntryList > ());
         }
-#line 964 "parser.tab.cc" // lalr1.cc:860
+#line 1384 "precompiled/parser.tab.cc"
     break;
 
-  case 4:
-#line 152 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yystack_[1].value.as< ASTInferenceGroupList > ().push_back(yystack_[0].value.as< ASTInferenceGroup > ());
-            yylhs.value.as< ASTInferenceGroupList > () = std::move(yystack_[1].value.as< ASTInferenceGroupList > ());
+  case 18: // dispatch_entry_list: %empty
+#line 275 "parser.yy"
+        {
+            yylhs.value.as < ASTDispatchEntryList > () = ASTDispatchEntryList();
         }
-#line 973 "parser.tab.cc" // lalr1.cc:860
+#line 1392 "precompiled/parser.tab.cc"
     break;
 
-  case 5:
-#line 164 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferenceGroup > () = ASTInferenceGroup(std::move(yystack_[4].value.as< std::string > ()), std::move(yystack_[2].value.as< ASTEnvironmentDefnList > ()), std::move(yystack_[1].value.as< ASTInferenceDefnList > ()));
+  case 19: // dispatch_entry_list: dispatch_entry_list dispatch_entry
+#line 280 "parser.yy"
+        {
+            yystack_[1].value.as < ASTDispatchEntryList > ().push_back(std::move(yystack_[0].value.as < ASTDispatchEntry > ()));
+            yylhs.value.as < ASTDispatchEntryList > () = std::move(yystack_[1].value.as < ASTDispatchEntryList > ());
         }
-#line 981 "parser.tab.cc" // lalr1.cc:860
+#line 1401 "precompiled/parser.tab.cc"
     break;
 
-  case 6:
-#line 171 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTEnvironmentDefnList > () = ASTEnvironmentDefnList();
+  case 20: // dispatch_entry: IDENTIFIER COLON dispatch_inference_name_list SEMICOLON
+#line 289 "parser.yy"
+        {
+            yylhs.value.as < ASTDispatchEntry > () = ASTDispatchEntry(std::move(yystack_[3].value.as < std::string > ()), std::move(yystack_[1].value.as < StringList > ()));
         }
-#line 989 "parser.tab.cc" // lalr1.cc:860
+#line 1409 "precompiled/parser.tab.cc"
     break;
 
-  case 7:
-#line 176 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yystack_[1].value.as< ASTEnvironmentDefnList > ().push_back(yystack_[0].value.as< ASTEnvironmentDefn > ());
-            yylhs.value.as< ASTEnvironmentDefnList > () = std::move(yystack_[1].value.as< ASTEnvironmentDefnList > ());
+  case 21: // dispatch_inference_name_list: IDENTIFIER
+#line 297 "parser.yy"
+        {
+            StringList names;
+            names.push_back(std::move(yystack_[0].value.as < std::string > ()));
+            yylhs.value.as < StringList > () = std::move(names);
         }
-#line 998 "parser.tab.cc" // lalr1.cc:860
+#line 1419 "precompiled/parser.tab.cc"
     break;
 
-  case 8:
-#line 185 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTEnvironmentDefn > () = ASTEnvironmentDefn(std::move(yystack_[3].value.as< std::string > ()), std::move(yystack_[1].value.as< std::string > ()));
+  case 22: // dispatch_inference_name_list: dispatch_inference_name_list COMMA IDENTIFIER
+#line 304 "parser.yy"
+        {
+            yystack_[2].value.as < StringList > ().push_back(std::move(yystack_[0].value.as < std::string > ()));
+            yylhs.value.as < StringList > () = std::move(yystack_[2].value.as < StringList > ());
         }
-#line 1006 "parser.tab.cc" // lalr1.cc:860
+#line 1428 "precompiled/parser.tab.cc"
     break;
 
-  case 9:
-#line 192 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferenceDefnList > () = ASTInferenceDefnList();
+  case 23: // inference_defn_list: %empty
+#line 312 "parser.yy"
+        {
+            yylhs.value.as < ASTInferenceDefnList > () = ASTInferenceDefnList();
         }
-#line 1014 "parser.tab.cc" // lalr1.cc:860
+#line 1436 "precompiled/parser.tab.cc"
     break;
 
-  case 10:
-#line 197 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yystack_[1].value.as< ASTInferenceDefnList > ().push_back(yystack_[0].value.as< ASTInferenceDefn > ());
-            yylhs.value.as< ASTInferenceDefnList > () = std::move(yystack_[1].value.as< ASTInferenceDefnList > ());
+  case 24: // inference_defn_list: inference_defn_list inference_defn
+#line 317 "parser.yy"
+        {
+            yystack_[1].value.as < ASTInferenceDefnList > ().push_back(std::move(yystack_[0].value.as < ASTInferenceDefn > ()));
+            yylhs.value.as < ASTInferenceDefnList > () = std::move(yystack_[1].value.as < ASTInferenceDefnList > ());
         }
-#line 1023 "parser.tab.cc" // lalr1.cc:860
+#line 1445 "precompiled/parser.tab.cc"
     break;
 
-  case 11:
-#line 211 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferenceDefn > () = ASTInferenceDefn(std::move(yystack_[6].value.as< std::string > ()),
-                std::move(yystack_[4].value.as< ASTGlobalDeclList > ()),std::move(yystack_[3].value.as< ASTInferenceArgumentList > ()),std::move(yystack_[2].value.as< ASTPremiseDefnList > ()), std::move(yystack_[1].value.as< ASTPropositionDefn > ()));
+  case 25: // inference_defn: KEYWORD_INFERENCE IDENTIFIER LBRACE global_decl_set argument_set premise_set proposition_defn RBRACE
+#line 331 "parser.yy"
+        {
+            yylhs.value.as < ASTInferenceDefn > () = ASTInferenceDefn(std::move(yystack_[6].value.as < std::string > ()),
+                std::move(yystack_[4].value.as < ASTGlobalDeclList > ()),std::move(yystack_[3].value.as < ASTInferenceArgumentList > ()),std::move(yystack_[2].value.as < ASTPremiseDefnList > ()), std::move(yystack_[1].value.as < ASTPropositionDefn > ()));
         }
-#line 1032 "parser.tab.cc" // lalr1.cc:860
+#line 1454 "precompiled/parser.tab.cc"
     break;
 
-  case 12:
-#line 219 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTGlobalDeclList > () = ASTGlobalDeclList();
+  case 26: // global_decl_set: %empty
+#line 339 "parser.yy"
+        {
+            yylhs.value.as < ASTGlobalDeclList > () = ASTGlobalDeclList();
         }
-#line 1040 "parser.tab.cc" // lalr1.cc:860
+#line 1462 "precompiled/parser.tab.cc"
     break;
 
-  case 13:
-#line 224 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTGlobalDeclList > () = std::move(yystack_[1].value.as< ASTGlobalDeclList > ());
+  case 27: // global_decl_set: KEYWORD_GLOBALS COLON LBRACKET global_decl_list RBRACKET
+#line 344 "parser.yy"
+        {
+            yylhs.value.as < ASTGlobalDeclList > () = std::move(yystack_[1].value.as < ASTGlobalDeclList > ());
         }
-#line 1048 "parser.tab.cc" // lalr1.cc:860
+#line 1470 "precompiled/parser.tab.cc"
     break;
 
-  case 14:
-#line 232 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
+  case 28: // global_decl_list: global_decl
+#line 352 "parser.yy"
+        {
             ASTGlobalDeclList decls;
-            decls.push_back(yystack_[0].value.as< ASTGlobalDecl > ());
-            yylhs.value.as< ASTGlobalDeclList > () = std::move(decls);
+            decls.push_back(std::move(yystack_[0].value.as < ASTGlobalDecl > ()));
+            yylhs.value.as < ASTGlobalDeclList > () = std::move(decls);
         }
-#line 1058 "parser.tab.cc" // lalr1.cc:860
+#line 1480 "precompiled/parser.tab.cc"
     break;
 
-  case 15:
-#line 239 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yystack_[2].value.as< ASTGlobalDeclList > ().push_back(yystack_[0].value.as< ASTGlobalDecl > ());
-            yylhs.value.as< ASTGlobalDeclList > () = std::move(yystack_[2].value.as< ASTGlobalDeclList > ());
+  case 29: // global_decl_list: global_decl_list COMMA global_decl
+#line 359 "parser.yy"
+        {
+            yystack_[2].value.as < ASTGlobalDeclList > ().push_back(std::move(yystack_[0].value.as < ASTGlobalDecl > ()));
+            yylhs.value.as < ASTGlobalDeclList > () = std::move(yystack_[2].value.as < ASTGlobalDeclList > ());
         }
-#line 1067 "parser.tab.cc" // lalr1.cc:860
+#line 1489 "precompiled/parser.tab.cc"
     break;
 
-  case 16:
-#line 248 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTGlobalDecl > () = ASTGlobalDecl(std::move(yystack_[0].value.as< std::string > ()));
+  case 30: // global_decl: IDENTIFIER
+#line 368 "parser.yy"
+        {
+            yylhs.value.as < ASTGlobalDecl > () = ASTGlobalDecl(std::move(yystack_[0].value.as < std::string > ()));
         }
-#line 1075 "parser.tab.cc" // lalr1.cc:860
+#line 1497 "precompiled/parser.tab.cc"
     break;
 
-  case 17:
-#line 256 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferenceArgumentList > () = ASTInferenceArgumentList();
+  case 31: // argument_set: KEYWORD_ARGUMENTS COLON LBRACKET RBRACKET
+#line 376 "parser.yy"
+        {
+            yylhs.value.as < ASTInferenceArgumentList > () = ASTInferenceArgumentList();
         }
-#line 1083 "parser.tab.cc" // lalr1.cc:860
+#line 1505 "precompiled/parser.tab.cc"
     break;
 
-  case 18:
-#line 261 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferenceArgumentList > () = std::move(yystack_[1].value.as< ASTInferenceArgumentList > ());
+  case 32: // argument_set: KEYWORD_ARGUMENTS COLON LBRACKET argument_list RBRACKET
+#line 381 "parser.yy"
+        {
+            yylhs.value.as < ASTInferenceArgumentList > () = std::move(yystack_[1].value.as < ASTInferenceArgumentList > ());
         }
-#line 1091 "parser.tab.cc" // lalr1.cc:860
+#line 1513 "precompiled/parser.tab.cc"
     break;
 
-  case 19:
-#line 269 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
+  case 33: // argument_list: inference_argument
+#line 389 "parser.yy"
+        {
             ASTInferenceArgumentList arguments;
-            arguments.push_back(yystack_[0].value.as< ASTInferenceArgument > ());
-            yylhs.value.as< ASTInferenceArgumentList > () = std::move(arguments);
+            arguments.push_back(std::move(yystack_[0].value.as < ASTInferenceArgument > ()));
+            yylhs.value.as < ASTInferenceArgumentList > () = std::move(arguments);
         }
-#line 1101 "parser.tab.cc" // lalr1.cc:860
+#line 1523 "precompiled/parser.tab.cc"
     break;
 
-  case 20:
-#line 276 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yystack_[2].value.as< ASTInferenceArgumentList > ().push_back(yystack_[0].value.as< ASTInferenceArgument > ());
-            yylhs.value.as< ASTInferenceArgumentList > () = std::move(yystack_[2].value.as< ASTInferenceArgumentList > ());
+  case 34: // argument_list: argument_list COMMA inference_argument
+#line 396 "parser.yy"
+        {
+            yystack_[2].value.as < ASTInferenceArgumentList > ().push_back(std::move(yystack_[0].value.as < ASTInferenceArgument > ()));
+            yylhs.value.as < ASTInferenceArgumentList > () = std::move(yystack_[2].value.as < ASTInferenceArgumentList > ());
         }
-#line 1110 "parser.tab.cc" // lalr1.cc:860
+#line 1532 "precompiled/parser.tab.cc"
     break;
 
-  case 21:
-#line 285 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferenceArgument > () = ASTInferenceArgument(std::move(yystack_[2].value.as< std::string > ()), std::move(yystack_[0].value.as< std::string > ()));
+  case 35: // inference_argument: IDENTIFIER COLON IDENTIFIER
+#line 405 "parser.yy"
+        {
+            yylhs.value.as < ASTInferenceArgument > () = ASTInferenceArgument(std::move(yystack_[2].value.as < std::string > ()), std::move(yystack_[0].value.as < std::string > ()));
         }
-#line 1118 "parser.tab.cc" // lalr1.cc:860
+#line 1540 "precompiled/parser.tab.cc"
     break;
 
-  case 22:
-#line 293 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTPremiseDefnList > () = yystack_[1].value.as< ASTPremiseDefnList > ();
+  case 36: // premise_set: KEYWORD_PREMISES COLON LBRACKET premise_defn_list RBRACKET
+#line 413 "parser.yy"
+        {
+            yylhs.value.as < ASTPremiseDefnList > () = std::move(yystack_[1].value.as < ASTPremiseDefnList > ());
         }
-#line 1126 "parser.tab.cc" // lalr1.cc:860
+#line 1548 "precompiled/parser.tab.cc"
     break;
 
-  case 23:
-#line 300 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTPremiseDefnList > () = ASTPremiseDefnList();
+  case 37: // premise_defn_list: %empty
+#line 420 "parser.yy"
+        {
+            yylhs.value.as < ASTPremiseDefnList > () = ASTPremiseDefnList();
         }
-#line 1134 "parser.tab.cc" // lalr1.cc:860
+#line 1556 "precompiled/parser.tab.cc"
     break;
 
-  case 24:
-#line 305 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yystack_[1].value.as< ASTPremiseDefnList > ().push_back(yystack_[0].value.as< ASTPremiseDefn > ());
-            yylhs.value.as< ASTPremiseDefnList > () = std::move(yystack_[1].value.as< ASTPremiseDefnList > ());
+  case 38: // premise_defn_list: premise_defn_list premise_defn
+#line 425 "parser.yy"
+        {
+            yystack_[1].value.as < ASTPremiseDefnList > ().push_back(std::move(yystack_[0].value.as < ASTPremiseDefn > ()));
+            yylhs.value.as < ASTPremiseDefnList > () = std::move(yystack_[1].value.as < ASTPremiseDefnList > ());
         }
-#line 1143 "parser.tab.cc" // lalr1.cc:860
+#line 1565 "precompiled/parser.tab.cc"
     break;
 
-  case 25:
-#line 314 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTPremiseDefn > () = ASTPremiseDefn(std::move(yystack_[0].value.as< ASTInferencePremiseDefn > ()));
+  case 39: // premise_defn: premise_type_inference_defn
+#line 434 "parser.yy"
+        {
+            yylhs.value.as < ASTPremiseDefn > () = ASTPremiseDefn(std::move(yystack_[0].value.as < ASTInferencePremiseDefn > ()));
         }
-#line 1151 "parser.tab.cc" // lalr1.cc:860
+#line 1573 "precompiled/parser.tab.cc"
     break;
 
-  case 26:
-#line 319 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTPremiseDefn > () = ASTPremiseDefn(std::move(yystack_[0].value.as< ASTInferenceEqualityDefn > ()));
+  case 40: // premise_defn: premise_type_equality_defn
+#line 439 "parser.yy"
+        {
+            yylhs.value.as < ASTPremiseDefn > () = ASTPremiseDefn(std::move(yystack_[0].value.as < ASTInferenceEqualityDefn > ()));
         }
-#line 1159 "parser.tab.cc" // lalr1.cc:860
+#line 1581 "precompiled/parser.tab.cc"
     break;
 
-  case 27:
-#line 327 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferencePremiseDefn > () = ASTInferencePremiseDefn(std::move(yystack_[3].value.as< ASTIdentifiable > ()), std::move(yystack_[1].value.as< ASTDeductionTarget > ()));
+  case 41: // premise_type_inference_defn: identifiable COLON deduction_target SEMICOLON
+#line 447 "parser.yy"
+        {
+            yylhs.value.as < ASTInferencePremiseDefn > () = ASTInferencePremiseDefn(std::move(yystack_[3].value.as < ASTIdentifiable > ()), std::move(yystack_[1].value.as < ASTDeductionTarget > ()));
         }
-#line 1167 "parser.tab.cc" // lalr1.cc:860
+#line 1589 "precompiled/parser.tab.cc"
     break;
 
-  case 28:
-#line 332 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferencePremiseDefn > () = ASTInferencePremiseDefn(std::move(yystack_[4].value.as< ASTIdentifiable > ()), std::move(yystack_[2].value.as< ASTDeductionTarget > ()), std::move(yystack_[1].value.as< ASTWhileClause > ()));
+  case 42: // premise_type_inference_defn: identifiable COLON deduction_target while_clause SEMICOLON
+#line 452 "parser.yy"
+        {
+            yylhs.value.as < ASTInferencePremiseDefn > () = ASTInferencePremiseDefn(std::move(yystack_[4].value.as < ASTIdentifiable > ()), std::move(yystack_[2].value.as < ASTDeductionTarget > ()), std::move(yystack_[1].value.as < ASTWhileClause > ()));
         }
-#line 1175 "parser.tab.cc" // lalr1.cc:860
+#line 1597 "precompiled/parser.tab.cc"
     break;
 
-  case 29:
-#line 340 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTWhileClause > () = ASTWhileClause(std::move(yystack_[1].value.as< ASTPremiseDefnList > ()));
+  case 43: // while_clause: KEYWORD_WHILE LBRACE premise_defn_list RBRACE
+#line 460 "parser.yy"
+        {
+            yylhs.value.as < ASTWhileClause > () = ASTWhileClause(std::move(yystack_[1].value.as < ASTPremiseDefnList > ()));
         }
-#line 1183 "parser.tab.cc" // lalr1.cc:860
+#line 1605 "precompiled/parser.tab.cc"
     break;
 
-  case 30:
-#line 348 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferenceEqualityDefn > () = ASTInferenceEqualityDefn(std::move(yystack_[3].value.as< ASTDeductionTarget > ()), std::move(yystack_[1].value.as< ASTDeductionTarget > ()), yystack_[2].value.as< EqualityOperator > ());
+  case 44: // premise_type_equality_defn: deduction_target equality_operator deduction_target SEMICOLON
+#line 468 "parser.yy"
+        {
+            yylhs.value.as < ASTInferenceEqualityDefn > () = ASTInferenceEqualityDefn(std::move(yystack_[3].value.as < ASTDeductionTarget > ()), std::move(yystack_[1].value.as < ASTDeductionTarget > ()), yystack_[2].value.as < EqualityOperator > ());
         }
-#line 1191 "parser.tab.cc" // lalr1.cc:860
+#line 1613 "precompiled/parser.tab.cc"
     break;
 
-  case 31:
-#line 353 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTInferenceEqualityDefn > () = ASTInferenceEqualityDefn(std::move(yystack_[4].value.as< ASTDeductionTarget > ()), std::move(yystack_[2].value.as< ASTDeductionTarget > ()), yystack_[3].value.as< EqualityOperator > (), std::move(yystack_[1].value.as< ASTRangeClause > ()));
+  case 45: // premise_type_equality_defn: deduction_target equality_operator deduction_target range_clause SEMICOLON
+#line 473 "parser.yy"
+        {
+            yylhs.value.as < ASTInferenceEqualityDefn > () = ASTInferenceEqualityDefn(std::move(yystack_[4].value.as < ASTDeductionTarget > ()), std::move(yystack_[2].value.as < ASTDeductionTarget > ()), yystack_[3].value.as < EqualityOperator > (), std::move(yystack_[1].value.as < ASTRangeClause > ()));
         }
-#line 1199 "parser.tab.cc" // lalr1.cc:860
+#line 1621 "precompiled/parser.tab.cc"
     break;
 
-  case 32:
-#line 361 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTRangeClause > () = ASTRangeClause(yystack_[4].value.as< uint64_t > (), yystack_[2].value.as< uint64_t > (), std::move(yystack_[0].value.as< ASTDeductionTarget > ()));
+  case 46: // range_clause: KEYWORD_INRANGE INTEGER_LITERAL ELLIPSIS INTEGER_LITERAL ELLIPSIS deduction_target
+#line 481 "parser.yy"
+        {
+            yylhs.value.as < ASTRangeClause > () = ASTRangeClause(yystack_[4].value.as < uint64_t > (), yystack_[2].value.as < uint64_t > (), std::move(yystack_[0].value.as < ASTDeductionTarget > ()));
         }
-#line 1207 "parser.tab.cc" // lalr1.cc:860
+#line 1629 "precompiled/parser.tab.cc"
     break;
 
-  case 33:
-#line 369 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTPropositionDefn > () = ASTPropositionDefn(std::move(yystack_[1].value.as< ASTDeductionTarget > ()));
+  case 47: // proposition_defn: KEYWORD_PROPOSITION COLON deduction_target SEMICOLON
+#line 489 "parser.yy"
+        {
+            yylhs.value.as < ASTPropositionDefn > () = ASTPropositionDefn(std::move(yystack_[1].value.as < ASTDeductionTarget > ()));
         }
-#line 1215 "parser.tab.cc" // lalr1.cc:860
+#line 1637 "precompiled/parser.tab.cc"
     break;
 
-  case 34:
-#line 377 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
+  case 48: // identifiable: identifier
+#line 497 "parser.yy"
+        {
             ASTIdentifiable res;
-            res.add(yystack_[0].value.as< ASTIdentifier > ());
-            yylhs.value.as< ASTIdentifiable > () = std::move(res);
+            res.add(std::move(yystack_[0].value.as < ASTIdentifier > ()));
+            yylhs.value.as < ASTIdentifiable > () = std::move(res);
         }
-#line 1225 "parser.tab.cc" // lalr1.cc:860
+#line 1647 "precompiled/parser.tab.cc"
     break;
 
-  case 35:
-#line 384 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yystack_[2].value.as< ASTIdentifiable > ().add(yystack_[0].value.as< ASTIdentifier > ());
-            yylhs.value.as< ASTIdentifiable > () = yystack_[2].value.as< ASTIdentifiable > ();
+  case 49: // identifiable: identifiable DOT identifier
+#line 504 "parser.yy"
+        {
+            yystack_[2].value.as < ASTIdentifiable > ().add(std::move(yystack_[0].value.as < ASTIdentifier > ()));
+            yylhs.value.as < ASTIdentifiable > () = std::move(yystack_[2].value.as < ASTIdentifiable > ());
         }
-#line 1234 "parser.tab.cc" // lalr1.cc:860
+#line 1656 "precompiled/parser.tab.cc"
     break;
 
-  case 36:
-#line 393 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTIdentifier > () = ASTIdentifier(std::move(yystack_[0].value.as< std::string > ()));
+  case 50: // identifier: IDENTIFIER
+#line 513 "parser.yy"
+        {
+            yylhs.value.as < ASTIdentifier > () = ASTIdentifier(std::move(yystack_[0].value.as < std::string > ()));
         }
-#line 1242 "parser.tab.cc" // lalr1.cc:860
+#line 1664 "precompiled/parser.tab.cc"
     break;
 
-  case 37:
-#line 401 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
+  case 51: // deduction_target_list: deduction_target
+#line 521 "parser.yy"
+        {
             ASTDeductionTargetList list;
-            list.push_back(yystack_[0].value.as< ASTDeductionTarget > ());
-            yylhs.value.as< ASTDeductionTargetList > () = std::move(list);
+            list.push_back(std::move(yystack_[0].value.as < ASTDeductionTarget > ()));
+            yylhs.value.as < ASTDeductionTargetList > () = std::move(list);
         }
-#line 1252 "parser.tab.cc" // lalr1.cc:860
+#line 1674 "precompiled/parser.tab.cc"
     break;
 
-  case 38:
-#line 408 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yystack_[2].value.as< ASTDeductionTargetList > ().push_back(yystack_[0].value.as< ASTDeductionTarget > ());
-            yylhs.value.as< ASTDeductionTargetList > () = std::move(yystack_[2].value.as< ASTDeductionTargetList > ());
+  case 52: // deduction_target_list: deduction_target_list COMMA deduction_target
+#line 528 "parser.yy"
+        {
+            yystack_[2].value.as < ASTDeductionTargetList > ().push_back(std::move(yystack_[0].value.as < ASTDeductionTarget > ()));
+            yylhs.value.as < ASTDeductionTargetList > () = std::move(yystack_[2].value.as < ASTDeductionTargetList > ());
         }
-#line 1261 "parser.tab.cc" // lalr1.cc:860
+#line 1683 "precompiled/parser.tab.cc"
     break;
 
-  case 39:
-#line 417 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTDeductionTarget > () = ASTDeductionTarget(std::move(yystack_[0].value.as< ASTDeductionTargetSingular > ()));
+  case 53: // deduction_target: deduction_target_singular
+#line 537 "parser.yy"
+        {
+            yylhs.value.as < ASTDeductionTarget > () = ASTDeductionTarget(std::move(yystack_[0].value.as < ASTDeductionTargetSingular > ()));
         }
-#line 1269 "parser.tab.cc" // lalr1.cc:860
+#line 1691 "precompiled/parser.tab.cc"
     break;
 
-  case 40:
-#line 422 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTDeductionTarget > () = ASTDeductionTarget(std::move(yystack_[0].value.as< ASTDeductionTargetArray > ()));
+  case 54: // deduction_target: deduction_target_array
+#line 542 "parser.yy"
+        {
+            yylhs.value.as < ASTDeductionTarget > () = ASTDeductionTarget(std::move(yystack_[0].value.as < ASTDeductionTargetArray > ()));
         }
-#line 1277 "parser.tab.cc" // lalr1.cc:860
+#line 1699 "precompiled/parser.tab.cc"
     break;
 
-  case 41:
-#line 427 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTDeductionTarget > () = ASTDeductionTarget(std::move(yystack_[0].value.as< ASTDeductionTargetComputed > ()));
+  case 55: // deduction_target: deduction_target_computed
+#line 547 "parser.yy"
+        {
+            yylhs.value.as < ASTDeductionTarget > () = ASTDeductionTarget(std::move(yystack_[0].value.as < ASTDeductionTargetComputed > ()));
         }
-#line 1285 "parser.tab.cc" // lalr1.cc:860
+#line 1707 "precompiled/parser.tab.cc"
     break;
 
-  case 42:
-#line 435 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTDeductionTargetSingular > () = ASTDeductionTargetSingular(std::move(yystack_[0].value.as< std::string > ()));
+  case 56: // deduction_target_singular: IDENTIFIER
+#line 555 "parser.yy"
+        {
+            yylhs.value.as < ASTDeductionTargetSingular > () = ASTDeductionTargetSingular(std::move(yystack_[0].value.as < std::string > ()));
         }
-#line 1293 "parser.tab.cc" // lalr1.cc:860
+#line 1715 "precompiled/parser.tab.cc"
     break;
 
-  case 43:
-#line 443 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTDeductionTargetArray > () = ASTDeductionTargetArray(std::move(yystack_[2].value.as< std::string > ()));
+  case 57: // deduction_target_array: IDENTIFIER LBRACKET RBRACKET
+#line 563 "parser.yy"
+        {
+            yylhs.value.as < ASTDeductionTargetArray > () = ASTDeductionTargetArray(std::move(yystack_[2].value.as < std::string > ()));
         }
-#line 1301 "parser.tab.cc" // lalr1.cc:860
+#line 1723 "precompiled/parser.tab.cc"
     break;
 
-  case 44:
-#line 448 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTDeductionTargetArray > () = ASTDeductionTargetArray(std::move(yystack_[3].value.as< std::string > ()), std::move(yystack_[1].value.as< uint64_t > ()));
+  case 58: // deduction_target_array: IDENTIFIER LBRACKET INTEGER_LITERAL RBRACKET
+#line 568 "parser.yy"
+        {
+            yylhs.value.as < ASTDeductionTargetArray > () = ASTDeductionTargetArray(std::move(yystack_[3].value.as < std::string > ()), std::move(yystack_[1].value.as < uint64_t > ()));
         }
-#line 1309 "parser.tab.cc" // lalr1.cc:860
+#line 1731 "precompiled/parser.tab.cc"
     break;
 
-  case 45:
-#line 456 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
+  case 59: // deduction_target_computed: IDENTIFIER LPAREN RPAREN
+#line 576 "parser.yy"
+        {
             ASTDeductionTargetList arguments;
-            yylhs.value.as< ASTDeductionTargetComputed > () = ASTDeductionTargetComputed(std::move(yystack_[2].value.as< std::string > ()), std::move(arguments));
+            yylhs.value.as < ASTDeductionTargetComputed > () = ASTDeductionTargetComputed(std::move(yystack_[2].value.as < std::string > ()), std::move(arguments));
         }
-#line 1318 "parser.tab.cc" // lalr1.cc:860
+#line 1740 "precompiled/parser.tab.cc"
     break;
 
-  case 46:
-#line 462 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< ASTDeductionTargetComputed > () = ASTDeductionTargetComputed(std::move(yystack_[3].value.as< std::string > ()), std::move(yystack_[1].value.as< ASTDeductionTargetList > ()));
+  case 60: // deduction_target_computed: IDENTIFIER LPAREN deduction_target_list RPAREN
+#line 582 "parser.yy"
+        {
+            yylhs.value.as < ASTDeductionTargetComputed > () = ASTDeductionTargetComputed(std::move(yystack_[3].value.as < std::string > ()), std::move(yystack_[1].value.as < ASTDeductionTargetList > ()));
         }
-#line 1326 "parser.tab.cc" // lalr1.cc:860
+#line 1748 "precompiled/parser.tab.cc"
     break;
 
-  case 47:
-#line 470 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< EqualityOperator > () = EqualityOperator::OPERATOR_EQ;
+  case 61: // equality_operator: OPERATOR_EQ
+#line 590 "parser.yy"
+        {
+            yylhs.value.as < EqualityOperator > () = EqualityOperator::OPERATOR_EQ;
         }
-#line 1334 "parser.tab.cc" // lalr1.cc:860
+#line 1756 "precompiled/parser.tab.cc"
     break;
 
-  case 48:
-#line 475 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< EqualityOperator > () = EqualityOperator::OPERATOR_NEQ;
+  case 62: // equality_operator: OPERATOR_NEQ
+#line 595 "parser.yy"
+        {
+            yylhs.value.as < EqualityOperator > () = EqualityOperator::OPERATOR_NEQ;
         }
-#line 1342 "parser.tab.cc" // lalr1.cc:860
+#line 1764 "precompiled/parser.tab.cc"
     break;
 
-  case 49:
-#line 480 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< EqualityOperator > () = EqualityOperator::OPERATOR_LT;
+  case 63: // equality_operator: OPERATOR_LT
+#line 600 "parser.yy"
+        {
+            yylhs.value.as < EqualityOperator > () = EqualityOperator::OPERATOR_LT;
         }
-#line 1350 "parser.tab.cc" // lalr1.cc:860
+#line 1772 "precompiled/parser.tab.cc"
     break;
 
-  case 50:
-#line 485 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:860
-    {
-            yylhs.value.as< EqualityOperator > () = EqualityOperator::OPERATOR_LTE;
+  case 64: // equality_operator: OPERATOR_LTE
+#line 605 "parser.yy"
+        {
+            yylhs.value.as < EqualityOperator > () = EqualityOperator::OPERATOR_LTE;
         }
-#line 1358 "parser.tab.cc" // lalr1.cc:860
+#line 1780 "precompiled/parser.tab.cc"
     break;
 
 
-#line 1362 "parser.tab.cc" // lalr1.cc:860
+#line 1784 "precompiled/parser.tab.cc"
+
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -1386,7 +1812,9 @@ namespace yy {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1397,7 +1825,7 @@ namespace yy {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1414,68 +1842,81 @@ namespace yy {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -1483,6 +1924,7 @@ namespace yy {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1491,11 +1933,12 @@ namespace yy {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
         YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -1506,26 +1949,112 @@ namespace yy {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   Parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Parser::context.
+  Parser::context::context (const Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
 
+
+  int
+  Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1544,41 +2073,32 @@ namespace yy {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1587,6 +2107,7 @@ namespace yy {
         case N:                               \
           yyformat = S;                       \
         break
+      default: // Avoid compiler warnings.
         YYCASE_ (0, YY_("syntax error"));
         YYCASE_ (1, YY_("syntax error, unexpected %s"));
         YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
@@ -1598,11 +2119,11 @@ namespace yy {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1611,144 +2132,154 @@ namespace yy {
   }
 
 
-  const signed char Parser::yypact_ninf_ = -44;
+  const signed char Parser::yypact_ninf_ = -67;
 
-  const signed char Parser::yytable_ninf_ = -37;
+  const signed char Parser::yytable_ninf_ = -51;
 
   const signed char
   Parser::yypact_[] =
   {
-     -44,    38,    36,   -44,    27,   -44,    21,   -44,    30,    28,
-     -44,    -3,    32,    33,   -44,   -44,    31,    29,   -44,    40,
-      34,    45,    35,    39,    42,    41,    43,    44,    46,   -44,
-     -10,   -44,     6,    47,    48,    37,    41,   -44,    50,   -44,
-       2,   -44,   -44,    49,   -44,   -44,    54,    55,   -44,     9,
-      11,    52,   -44,   -44,   -44,   -44,   -44,    -8,   -44,   -44,
-     -44,   -44,    16,   -44,    10,     8,   -11,   -44,    57,    49,
-     -44,   -44,   -44,   -44,    49,    53,   -44,   -44,   -12,   -44,
-     -44,   -44,    -4,    -2,   -44,    49,   -44,    51,   -44,    56,
-      62,   -44,    58,   -44,   -44,   -44,    59,   -44,     3,    64,
-     -44,    60,    49,   -44
+     -67,    33,    23,   -67,    31,   -67,    46,   -67,    29,    38,
+     -67,    39,   -67,    37,   -67,    41,    35,   -67,   -67,    43,
+      42,   -67,   -67,    19,    -3,    40,   -67,    47,   -67,   -67,
+     -67,     6,    44,    45,   -67,   -67,    55,    50,    49,    60,
+     -67,    30,    51,    52,    57,    58,   -67,    59,    56,    54,
+      62,   -67,   -67,   -10,   -67,     9,    61,    64,    63,    59,
+     -67,    65,   -67,     2,   -67,   -67,    69,   -67,   -67,    70,
+      72,   -67,    16,    12,    71,   -67,   -67,   -67,   -67,   -67,
+      -8,   -67,   -67,   -67,   -67,    34,   -67,    14,     8,   -11,
+     -67,    73,    69,   -67,   -67,   -67,   -67,    69,    68,   -67,
+     -67,   -12,   -67,   -67,   -67,    -4,    -2,   -67,    69,   -67,
+      74,   -67,    75,    66,   -67,    76,   -67,   -67,   -67,    48,
+     -67,     3,    77,   -67,    67,    69,   -67
   };
 
-  const unsigned char
+  const signed char
   Parser::yydefact_[] =
   {
-       3,     0,     2,     1,     0,     4,     0,     6,     9,     0,
-       7,     0,     0,     0,     5,    10,     0,     0,     8,    12,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    16,
-       0,    14,     0,     0,     0,     0,     0,    13,     0,    17,
-       0,    19,    23,     0,    11,    15,     0,     0,    18,     0,
-      42,     0,    39,    40,    41,    21,    20,    42,    22,    24,
-      25,    26,     0,    34,     0,     0,     0,    33,     0,     0,
-      47,    48,    49,    50,     0,     0,    43,    45,     0,    37,
-      36,    35,     0,     0,    44,     0,    46,     0,    27,     0,
-       0,    30,     0,    38,    23,    28,     0,    31,     0,     0,
-      29,     0,     0,    32
+       3,     0,     8,     1,     0,     4,     2,     6,     0,     0,
+       9,     0,     5,    11,     7,     0,     0,    12,    13,    16,
+       0,    14,    23,     0,     0,     0,    18,     0,    10,    24,
+      15,     0,     0,     0,    17,    19,    26,     0,     0,     0,
+      21,     0,     0,     0,     0,     0,    20,     0,     0,     0,
+       0,    22,    30,     0,    28,     0,     0,     0,     0,     0,
+      27,     0,    31,     0,    33,    37,     0,    25,    29,     0,
+       0,    32,     0,    56,     0,    53,    54,    55,    35,    34,
+      56,    36,    38,    39,    40,     0,    48,     0,     0,     0,
+      47,     0,     0,    61,    62,    63,    64,     0,     0,    57,
+      59,     0,    51,    50,    49,     0,     0,    58,     0,    60,
+       0,    41,     0,     0,    44,     0,    52,    37,    42,     0,
+      45,     0,     0,    43,     0,     0,    46
   };
 
   const signed char
   Parser::yypgoto_[] =
   {
-     -44,   -44,   -44,   -44,   -44,   -44,   -44,   -44,   -44,   -44,
-      20,   -44,   -44,    61,   -44,   -31,   -44,   -44,   -44,   -44,
-     -44,   -44,   -44,    12,   -44,   -43,   -44,   -44,   -44,   -44
+     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
+     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,    18,   -67,
+     -67,     5,   -67,   -27,   -67,   -67,   -67,   -67,   -67,   -67,
+     -67,     0,   -67,   -66,   -67,   -67,   -67,   -67
   };
 
   const signed char
   Parser::yydefgoto_[] =
   {
-      -1,     1,     2,     5,     8,    10,    11,    15,    21,    30,
-      31,    24,    40,    41,    28,    49,    59,    60,    89,    61,
-      92,    35,    62,    63,    78,    64,    52,    53,    54,    74
+       0,     1,     2,     5,     8,     6,    10,    16,    19,    21,
+      22,    31,    35,    41,    24,    29,    39,    53,    54,    44,
+      63,    64,    50,    72,    82,    83,   112,    84,   115,    58,
+      85,    86,   101,    87,    75,    76,    77,    97
   };
 
   const signed char
   Parser::yytable_[] =
   {
-      51,    13,    50,    85,    87,    36,   -36,    90,   -36,    37,
-      65,    86,    77,    88,    66,    91,    57,    47,    14,    38,
-      75,    48,    57,    79,   100,    39,    82,    76,    58,    65,
-      68,    83,    69,    66,    70,    71,    72,    73,     3,     4,
-       6,     7,    93,     9,    12,    16,    17,    20,    18,    19,
-      22,    23,    27,    25,    29,    26,    45,    34,    44,   103,
-      33,    32,    50,    98,    43,    42,    46,    55,    38,    67,
-      80,    94,    84,    95,    96,    97,   101,     0,     0,     0,
-      81,     0,     0,     0,     0,     0,     0,    99,   102,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    56
+      74,    27,    73,   108,   110,    59,   -50,   113,   -50,    60,
+      88,   109,   100,   111,    89,   114,    80,    70,    28,    33,
+      98,    71,    61,   102,   123,    34,   105,    99,    62,    80,
+      88,   106,    25,     3,    89,    81,     4,    26,    93,    94,
+      95,    96,   116,    11,     7,    45,    12,    46,    91,     9,
+      92,    13,    14,    15,    17,    18,    20,    30,    23,   126,
+      32,    37,    38,    40,    36,    42,    43,    49,    48,    47,
+      56,    51,    52,    57,    55,    79,   122,    68,   119,    65,
+      66,    69,    73,    78,    67,    61,   103,   107,    90,   124,
+     121,   104,   118,   120,   117,   125
   };
 
   const signed char
   Parser::yycheck_[] =
   {
-      43,     4,    13,    15,     8,    15,    14,     9,    16,    19,
+      66,     4,    13,    15,     8,    15,    14,     9,    16,    19,
       18,    23,    23,    17,    22,    17,    13,    15,    21,    13,
-      12,    19,    13,    66,    21,    19,    69,    19,    19,    18,
-      14,    74,    16,    22,    24,    25,    26,    27,     0,     3,
-      13,    20,    85,    13,    16,    13,    13,     7,    17,    20,
-      16,     6,    10,    18,    13,    16,    36,    11,    21,   102,
-      16,    18,    13,    94,    16,    18,    16,    13,    13,    17,
-      13,    20,    19,    17,    12,    17,    12,    -1,    -1,    -1,
-      68,    -1,    -1,    -1,    -1,    -1,    -1,    28,    28,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    47
+      12,    19,    13,    89,    21,    19,    92,    19,    19,    13,
+      18,    97,    13,     0,    22,    19,    13,    18,    24,    25,
+      26,    27,   108,    14,    13,    15,    17,    17,    14,     3,
+      16,    13,    13,    16,    13,    20,    13,    17,    16,   125,
+      13,    16,     7,    13,    20,    16,     6,    10,    16,    18,
+      16,    13,    13,    11,    18,    70,    28,    59,    12,    18,
+      16,    16,    13,    13,    21,    13,    13,    19,    17,    12,
+     117,    91,    17,    17,    20,    28
   };
 
-  const unsigned char
+  const signed char
   Parser::yystos_[] =
   {
-       0,    30,    31,     0,     3,    32,    13,    20,    33,    13,
-      34,    35,    16,     4,    21,    36,    13,    13,    17,    20,
-       7,    37,    16,     6,    40,    18,    16,    10,    43,    13,
-      38,    39,    18,    16,    11,    50,    15,    19,    13,    19,
-      41,    42,    18,    16,    21,    39,    16,    15,    19,    44,
-      13,    54,    55,    56,    57,    13,    42,    13,    19,    45,
-      46,    48,    51,    52,    54,    18,    22,    17,    14,    16,
-      24,    25,    26,    27,    58,    12,    19,    23,    53,    54,
-      13,    52,    54,    54,    19,    15,    23,     8,    17,    47,
-       9,    17,    49,    54,    20,    17,    12,    17,    44,    28,
-      21,    12,    28,    54
+       0,    30,    31,     0,    13,    32,    34,    13,    33,     3,
+      35,    14,    17,    13,    13,    16,    36,    13,    20,    37,
+      13,    38,    39,    16,    43,    13,    18,     4,    21,    44,
+      17,    40,    13,    13,    19,    41,    20,    16,     7,    45,
+      13,    42,    16,     6,    48,    15,    17,    18,    16,    10,
+      51,    13,    13,    46,    47,    18,    16,    11,    58,    15,
+      19,    13,    19,    49,    50,    18,    16,    21,    47,    16,
+      15,    19,    52,    13,    62,    63,    64,    65,    13,    50,
+      13,    19,    53,    54,    56,    59,    60,    62,    18,    22,
+      17,    14,    16,    24,    25,    26,    27,    66,    12,    19,
+      23,    61,    62,    13,    60,    62,    62,    19,    15,    23,
+       8,    17,    55,     9,    17,    57,    62,    20,    17,    12,
+      17,    52,    28,    21,    12,    28,    62
   };
 
-  const unsigned char
+  const signed char
   Parser::yyr1_[] =
   {
-       0,    29,    30,    31,    31,    32,    33,    33,    34,    35,
-      35,    36,    37,    37,    38,    38,    39,    40,    40,    41,
-      41,    42,    43,    44,    44,    45,    45,    46,    46,    47,
-      48,    48,    49,    50,    51,    51,    52,    53,    53,    54,
-      54,    54,    55,    56,    56,    57,    57,    58,    58,    58,
-      58
+       0,    29,    30,    31,    31,    32,    33,    33,    34,    34,
+      35,    36,    36,    37,    37,    38,    39,    39,    40,    40,
+      41,    42,    42,    43,    43,    44,    45,    45,    46,    46,
+      47,    48,    48,    49,    49,    50,    51,    52,    52,    53,
+      53,    54,    54,    55,    56,    56,    57,    58,    59,    59,
+      60,    61,    61,    62,    62,    62,    63,    64,    64,    65,
+      65,    66,    66,    66,    66
   };
 
-  const unsigned char
+  const signed char
   Parser::yyr2_[] =
   {
-       0,     2,     1,     0,     2,     6,     0,     2,     4,     0,
-       2,     8,     0,     5,     1,     3,     1,     4,     5,     1,
-       3,     3,     5,     0,     2,     1,     1,     4,     5,     4,
-       4,     5,     6,     4,     1,     3,     1,     1,     3,     1,
-       1,     1,     1,     3,     4,     3,     4,     1,     1,     1,
-       1
+       0,     2,     2,     0,     2,     3,     1,     3,     0,     2,
+       8,     0,     2,     0,     2,     4,     0,     5,     0,     2,
+       4,     1,     3,     0,     2,     8,     0,     5,     1,     3,
+       1,     4,     5,     1,     3,     3,     5,     0,     2,     1,
+       1,     4,     5,     4,     4,     5,     6,     4,     1,     3,
+       1,     1,     3,     1,     1,     1,     1,     3,     4,     3,
+       4,     1,     1,     1,     1
   };
 
 
-
+#if YYDEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "KEYWORD_GROUP",
+  "\"end of file\"", "error", "\"invalid token\"", "KEYWORD_GROUP",
   "KEYWORD_INFERENCE", "KEYWORD_ENVIRONMENT", "KEYWORD_ARGUMENTS",
   "KEYWORD_GLOBALS", "KEYWORD_WHILE", "KEYWORD_INRANGE",
   "KEYWORD_PREMISES", "KEYWORD_PROPOSITION", "INTEGER_LITERAL",
   "IDENTIFIER", "DOT", "COMMA", "COLON", "SEMICOLON", "LBRACKET",
   "RBRACKET", "LBRACE", "RBRACE", "LPAREN", "RPAREN", "OPERATOR_EQ",
   "OPERATOR_NEQ", "OPERATOR_LT", "OPERATOR_LTE", "ELLIPSIS", "$accept",
-  "input", "inference_group_list", "inference_group",
-  "environment_defn_list", "environment_defn", "inference_defn_list",
+  "input", "import_list", "import", "import_name", "inference_group_list",
+  "inference_group", "base_inference_group", "environment_defn_list",
+  "environment_defn", "dispatch_set", "dispatch_entry_list",
+  "dispatch_entry", "dispatch_inference_name_list", "inference_defn_list",
   "inference_defn", "global_decl_set", "global_decl_list", "global_decl",
   "argument_set", "argument_list", "inference_argument", "premise_set",
   "premise_defn_list", "premise_defn", "premise_type_inference_defn",
@@ -1758,37 +2289,38 @@ namespace yy {
   "deduction_target_array", "deduction_target_computed",
   "equality_operator", YY_NULLPTR
   };
+#endif
+
 
 #if YYDEBUG
-  const unsigned short int
+  const short
   Parser::yyrline_[] =
   {
-       0,   138,   138,   147,   151,   160,   171,   175,   184,   192,
-     196,   205,   219,   223,   231,   238,   247,   255,   260,   268,
-     275,   284,   292,   300,   304,   313,   318,   326,   331,   339,
-     347,   352,   360,   368,   376,   383,   392,   400,   407,   416,
-     421,   426,   434,   442,   447,   455,   461,   469,   474,   479,
-     484
+       0,   148,   148,   157,   161,   170,   184,   189,   199,   203,
+     212,   224,   228,   236,   240,   249,   257,   261,   275,   279,
+     288,   296,   303,   312,   316,   325,   339,   343,   351,   358,
+     367,   375,   380,   388,   395,   404,   412,   420,   424,   433,
+     438,   446,   451,   459,   467,   472,   480,   488,   496,   503,
+     512,   520,   527,   536,   541,   546,   554,   562,   567,   575,
+     581,   589,   594,   599,   604
   };
 
-  // Print the state stack on the debug stream.
   void
-  Parser::yystack_print_ ()
+  Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Parser::yy_reduce_print_ (int yyrule)
+  Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -1801,10 +2333,10 @@ namespace yy {
 #endif // YYDEBUG
 
 
-
 } // yy
-#line 1807 "parser.tab.cc" // lalr1.cc:1166
-#line 490 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:1167
+#line 2338 "precompiled/parser.tab.cc"
+
+#line 610 "parser.yy"
 
 
 void
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.23-dbd16.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,22 +30,27 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+
 /**
- ** \file parser.tab.hh
+ ** \file precompiled/parser.tab.hh
  ** Define the yy::parser class.
  */
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
-#ifndef YY_YY_PARSER_TAB_HH_INCLUDED
-# define YY_YY_PARSER_TAB_HH_INCLUDED
-// //                    "%code requires" blocks.
-#line 43 "/Users/x/workspace/snowlake/src/parser/parser.yy" // lalr1.cc:392
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+#ifndef YY_YY_PRECOMPILED_PARSER_TAB_HH_INCLUDED
+# define YY_YY_PRECOMPILED_PARSER_TAB_HH_INCLUDED
+// "%code requires" blocks.
+#line 43 "parser.yy"
 
 class ParserDriver;
 #include "ast.h"
 
-#line 49 "parser.tab.hh" // lalr1.cc:392
+#line 54 "precompiled/parser.tab.hh"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -53,56 +58,87 @@ class ParserDriver;
 # include <stdexcept>
 # include <string>
 # include <vector>
-# include "stack.hh"
+
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
+// Support move semantics when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_MOVE           std::move
+# define YY_MOVE_OR_COPY   move
+# define YY_MOVE_REF(Type) Type&&
+# define YY_RVREF(Type)    Type&&
+# define YY_COPY(Type)     Type
+#else
+# define YY_MOVE
+# define YY_MOVE_OR_COPY   copy
+# define YY_MOVE_REF(Type) Type&
+# define YY_RVREF(Type)    const Type&
+# define YY_COPY(Type)     const Type&
+#endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef YY_ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define YY_ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -115,125 +151,224 @@ class ParserDriver;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
 /* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 1
 #endif
 
-
 namespace yy {
-#line 126 "parser.tab.hh" // lalr1.cc:392
+#line 194 "precompiled/parser.tab.hh"
 
 
 
-  /// A char[S] buffer to store and retrieve objects.
+
+  /// A Bison parser.
+  class Parser
+  {
+  public:
+#ifdef YYSTYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define YYSTYPE in C++, use %define api.value.type"
+# endif
+    typedef YYSTYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
-  /// via the current state.
-  template <size_t S>
-  struct variant
+  /// via the current parser state.
+  class value_type
   {
+  public:
     /// Type of *this.
-    typedef variant<S> self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    variant ()
-      : yytypeid_ (YY_NULLPTR)
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
+      , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    variant (const T& t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= S);
-      new (yyas_<T> ()) T (t);
+      YY_ASSERT (sizeof (T) <= size);
+      new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~variant ()
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      YY_ASSERT (!yytypeid_);
     }
 
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      YY_ASSERT (!yytypeid_);
+      YY_ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
     /// Instantiate an empty \a T in here.
     template <typename T>
     T&
-    build ()
+    emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      YY_ASSERT (!yytypeid_);
+      YY_ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
-      return *new (yyas_<T> ()) T;
+      return *new (yyas_<T> ()) T ();
     }
 
     /// Instantiate a \a T in here from \a t.
     template <typename T>
     T&
-    build (const T& t)
+    emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      YY_ASSERT (!yytypeid_);
+      YY_ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
+# endif
+
+    /// Instantiate an empty \a T in here.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build ()
+    {
+      return emplace<T> ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build (const T& t)
+    {
+      return emplace<T> (t);
+    }
 
     /// Accessor to a built \a T.
     template <typename T>
     T&
-    as ()
+    as () YY_NOEXCEPT
     {
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      YY_ASSERT (yytypeid_);
+      YY_ASSERT (*yytypeid_ == typeid (T));
+      YY_ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
     /// Const accessor to a built \a T (for %printer).
     template <typename T>
     const T&
-    as () const
+    as () const YY_NOEXCEPT
     {
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      YY_ASSERT (yytypeid_);
+      YY_ASSERT (*yytypeid_ == typeid (T));
+      YY_ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
-    /// Swap the content with \a other, of same type.
+    /// Swap the content with \a that, of same type.
     ///
     /// Both variants must be built beforehand, because swapping the actual
     /// data requires reading it (with as()), and this is not possible on
     /// unconstructed variants: it would require some dynamic testing, which
-    /// should not be the variant's responsability.
+    /// should not be the variant's responsibility.
     /// Swapping between built and (possibly) non-built is done with
-    /// variant::move ().
+    /// self_type::move ().
     template <typename T>
     void
-    swap (self_type& other)
+    swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *other.yytypeid_);
-      std::swap (as<T> (), other.as<T> ());
+      YY_ASSERT (yytypeid_);
+      YY_ASSERT (*yytypeid_ == *that.yytypeid_);
+      std::swap (as<T> (), that.as<T> ());
     }
 
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     ///
-    /// Destroys \a other.
+    /// Destroys \a that.
+    template <typename T>
+    void
+    move (self_type& that)
+    {
+# if 201103L <= YY_CPLUSPLUS
+      emplace<T> (std::move (that.as<T> ()));
+# else
+      emplace<T> ();
+      swap<T> (that);
+# endif
+      that.destroy<T> ();
+    }
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Move the content of \a that to this.
     template <typename T>
     void
-    move (self_type& other)
+    move (self_type&& that)
     {
-      build<T> ();
-      swap<T> (other);
-      other.destroy<T> ();
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
     }
+#endif
 
-    /// Copy the content of \a other to this.
+    /// Copy the content of \a that to this.
     template <typename T>
     void
-    copy (const self_type& other)
+    copy (const self_type& that)
     {
-      build<T> (other.as<T> ());
+      emplace<T> (that.as<T> ());
     }
 
     /// Destroy the stored \a T.
@@ -246,227 +381,314 @@ namespace yy {
     }
 
   private:
-    /// Prohibit blind copies.
-    self_type& operator=(const self_type&);
-    variant (const self_type&);
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
+    self_type& operator= (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
-    yyas_ ()
+    yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
     /// Const accessor to raw memory as \a T.
     template <typename T>
     const T*
-    yyas_ () const
+    yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
-    union
-    {
-      /// Strongest alignment constraints.
-      long double yyalign_me;
-      /// A buffer large enough to store any of the semantic values.
-      char yyraw[S];
-    } yybuffer_;
-
-    /// Whether the content is built: if defined, the name of the stored type.
-    const std::type_info *yytypeid_;
-  };
-
-
-  /// A Bison parser.
-  class Parser
-  {
-  public:
-#ifndef YYSTYPE
     /// An auxiliary type to compute the largest semantic type.
     union union_type
     {
       // deduction_target
-      char dummy1[sizeof(ASTDeductionTarget)];
+      char dummy1[sizeof (ASTDeductionTarget)];
 
       // deduction_target_array
-      char dummy2[sizeof(ASTDeductionTargetArray)];
+      char dummy2[sizeof (ASTDeductionTargetArray)];
 
       // deduction_target_computed
-      char dummy3[sizeof(ASTDeductionTargetComputed)];
+      char dummy3[sizeof (ASTDeductionTargetComputed)];
 
       // deduction_target_list
-      char dummy4[sizeof(ASTDeductionTargetList)];
+      char dummy4[sizeof (ASTDeductionTargetList)];
 
       // deduction_target_singular
-      char dummy5[sizeof(ASTDeductionTargetSingular)];
+      char dummy5[sizeof (ASTDeductionTargetSingular)];
+
+      // dispatch_entry
+      char dummy6[sizeof (ASTDispatchEntry)];
+
+      // dispatch_set
+      // dispatch_entry_list
+      char dummy7[sizeof (ASTDispatchEntryList)];
 
       // environment_defn
-      char dummy6[sizeof(ASTEnvironmentDefn)];
+      char dummy8[sizeof (ASTEnvironmentDefn)];
 
       // environment_defn_list
-      char dummy7[sizeof(ASTEnvironmentDefnList)];
+      char dummy9[sizeof (ASTEnvironmentDefnList)];
 
       // global_decl
-      char dummy8[sizeof(ASTGlobalDecl)];
+      char dummy10[sizeof (ASTGlobalDecl)];
 
       // global_decl_set
       // global_decl_list
-      char dummy9[sizeof(ASTGlobalDeclList)];
+      char dummy11[sizeof (ASTGlobalDeclList)];
 
       // identifiable
-      char dummy10[sizeof(ASTIdentifiable)];
+      char dummy12[sizeof (ASTIdentifiable)];
 
       // identifier
-      char dummy11[sizeof(ASTIdentifier)];
+      char dummy13[sizeof (ASTIdentifier)];
+
+      // import
+      char dummy14[sizeof (ASTImport)];
+
+      // import_list
+      char dummy15[sizeof (ASTImportList)];
 
       // inference_argument
-      char dummy12[sizeof(ASTInferenceArgument)];
+      char dummy16[sizeof (ASTInferenceArgument)];
 
       // argument_set
       // argument_list
-      char dummy13[sizeof(ASTInferenceArgumentList)];
+      char dummy17[sizeof (ASTInferenceArgumentList)];
 
       // inference_defn
-      char dummy14[sizeof(ASTInferenceDefn)];
+      char dummy18[sizeof (ASTInferenceDefn)];
 
       // inference_defn_list
-      char dummy15[sizeof(ASTInferenceDefnList)];
+      char dummy19[sizeof (ASTInferenceDefnList)];
 
       // premise_type_equality_defn
-      char dummy16[sizeof(ASTInferenceEqualityDefn)];
+      char dummy20[sizeof (ASTInferenceEqualityDefn)];
 
       // inference_group
-      char dummy17[sizeof(ASTInferenceGroup)];
+      char dummy21[sizeof (ASTInferenceGroup)];
 
       // inference_group_list
-      char dummy18[sizeof(ASTInferenceGroupList)];
+      char dummy22[sizeof (ASTInferenceGroupList)];
 
       // premise_type_inference_defn
-      char dummy19[sizeof(ASTInferencePremiseDefn)];
+      char dummy23[sizeof (ASTInferencePremiseDefn)];
 
       // input
-      char dummy20[sizeof(ASTModule)];
+      char dummy24[sizeof (ASTModule)];
 
       // premise_defn
-      char dummy21[sizeof(ASTPremiseDefn)];
+      char dummy25[sizeof (ASTPremiseDefn)];
 
       // premise_set
       // premise_defn_list
-      char dummy22[sizeof(ASTPremiseDefnList)];
+      char dummy26[sizeof (ASTPremiseDefnList)];
 
       // proposition_defn
-      char dummy23[sizeof(ASTPropositionDefn)];
+      char dummy27[sizeof (ASTPropositionDefn)];
 
       // range_clause
-      char dummy24[sizeof(ASTRangeClause)];
+      char dummy28[sizeof (ASTRangeClause)];
 
       // while_clause
-      char dummy25[sizeof(ASTWhileClause)];
+      char dummy29[sizeof (ASTWhileClause)];
 
       // equality_operator
-      char dummy26[sizeof(EqualityOperator)];
-
-      // KEYWORD_GROUP
-      // KEYWORD_INFERENCE
-      // KEYWORD_ENVIRONMENT
-      // KEYWORD_ARGUMENTS
-      // KEYWORD_GLOBALS
-      // KEYWORD_WHILE
-      // KEYWORD_INRANGE
-      // KEYWORD_PREMISES
-      // KEYWORD_PROPOSITION
+      char dummy30[sizeof (EqualityOperator)];
+
+      // dispatch_inference_name_list
+      char dummy31[sizeof (StringList)];
+
       // IDENTIFIER
-      // DOT
-      // COMMA
-      // COLON
-      // SEMICOLON
-      // LBRACKET
-      // RBRACKET
-      // LBRACE
-      // RBRACE
-      // LPAREN
-      // RPAREN
-      // OPERATOR_EQ
-      // OPERATOR_NEQ
-      // OPERATOR_LT
-      // OPERATOR_LTE
-      // ELLIPSIS
-      char dummy27[sizeof(std::string)];
+      // import_name
+      // base_inference_group
+      char dummy32[sizeof (std::string)];
 
       // INTEGER_LITERAL
-      char dummy28[sizeof(uint64_t)];
-};
+      char dummy33[sizeof (uint64_t)];
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+
+    /// Whether the content is built: if defined, the name of the stored type.
+    const std::type_info *yytypeid_;
+  };
 
-    /// Symbol semantic values.
-    typedef variant<sizeof(union_type)> semantic_type;
-#else
-    typedef YYSTYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
     /// Syntax errors thrown from user actions.
     struct syntax_error : std::runtime_error
     {
-      syntax_error (const location_type& l, const std::string& m);
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        END = 0,
-        KEYWORD_GROUP = 258,
-        KEYWORD_INFERENCE = 259,
-        KEYWORD_ENVIRONMENT = 260,
-        KEYWORD_ARGUMENTS = 261,
-        KEYWORD_GLOBALS = 262,
-        KEYWORD_WHILE = 263,
-        KEYWORD_INRANGE = 264,
-        KEYWORD_PREMISES = 265,
-        KEYWORD_PROPOSITION = 266,
-        INTEGER_LITERAL = 267,
-        IDENTIFIER = 268,
-        DOT = 269,
-        COMMA = 270,
-        COLON = 271,
-        SEMICOLON = 272,
-        LBRACKET = 273,
-        RBRACKET = 274,
-        LBRACE = 275,
-        RBRACE = 276,
-        LPAREN = 277,
-        RPAREN = 278,
-        OPERATOR_EQ = 279,
-        OPERATOR_NEQ = 280,
-        OPERATOR_LT = 281,
-        OPERATOR_LTE = 282,
-        ELLIPSIS = 283
+      enum token_kind_type
+      {
+        YYEMPTY = -2,
+    END = 0,                       // "end of file"
+    YYerror = 256,                 // error
+    YYUNDEF = 257,                 // "invalid token"
+    KEYWORD_GROUP = 258,           // KEYWORD_GROUP
+    KEYWORD_INFERENCE = 259,       // KEYWORD_INFERENCE
+    KEYWORD_ENVIRONMENT = 260,     // KEYWORD_ENVIRONMENT
+    KEYWORD_ARGUMENTS = 261,       // KEYWORD_ARGUMENTS
+    KEYWORD_GLOBALS = 262,         // KEYWORD_GLOBALS
+    KEYWORD_WHILE = 263,           // KEYWORD_WHILE
+    KEYWORD_INRANGE = 264,         // KEYWORD_INRANGE
+    KEYWORD_PREMISES = 265,        // KEYWORD_PREMISES
+    KEYWORD_PROPOSITION = 266,     // KEYWORD_PROPOSITION
+    INTEGER_LITERAL = 267,         // INTEGER_LITERAL
+    IDENTIFIER = 268,              // IDENTIFIER
+    DOT = 269,                     // DOT
+    COMMA = 270,                   // COMMA
+    COLON = 271,                   // COLON
+    SEMICOLON = 272,               // SEMICOLON
+    LBRACKET = 273,                // LBRACKET
+    RBRACKET = 274,                // RBRACKET
+    LBRACE = 275,                  // LBRACE
+    RBRACE = 276,                  // RBRACE
+    LPAREN = 277,                  // LPAREN
+    RPAREN = 278,                  // RPAREN
+    OPERATOR_EQ = 279,             // OPERATOR_EQ
+    OPERATOR_NEQ = 280,            // OPERATOR_NEQ
+    OPERATOR_LT = 281,             // OPERATOR_LT
+    OPERATOR_LTE = 282,            // OPERATOR_LTE
+    ELLIPSIS = 283                 // ELLIPSIS
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
+
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 29, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_KEYWORD_GROUP = 3,                     // KEYWORD_GROUP
+        S_KEYWORD_INFERENCE = 4,                 // KEYWORD_INFERENCE
+        S_KEYWORD_ENVIRONMENT = 5,               // KEYWORD_ENVIRONMENT
+        S_KEYWORD_ARGUMENTS = 6,                 // KEYWORD_ARGUMENTS
+        S_KEYWORD_GLOBALS = 7,                   // KEYWORD_GLOBALS
+        S_KEYWORD_WHILE = 8,                     // KEYWORD_WHILE
+        S_KEYWORD_INRANGE = 9,                   // KEYWORD_INRANGE
+        S_KEYWORD_PREMISES = 10,                 // KEYWORD_PREMISES
+        S_KEYWORD_PROPOSITION = 11,              // KEYWORD_PROPOSITION
+        S_INTEGER_LITERAL = 12,                  // INTEGER_LITERAL
+        S_IDENTIFIER = 13,                       // IDENTIFIER
+        S_DOT = 14,                              // DOT
+        S_COMMA = 15,                            // COMMA
+        S_COLON = 16,                            // COLON
+        S_SEMICOLON = 17,                        // SEMICOLON
+        S_LBRACKET = 18,                         // LBRACKET
+        S_RBRACKET = 19,                         // RBRACKET
+        S_LBRACE = 20,                           // LBRACE
+        S_RBRACE = 21,                           // RBRACE
+        S_LPAREN = 22,                           // LPAREN
+        S_RPAREN = 23,                           // RPAREN
+        S_OPERATOR_EQ = 24,                      // OPERATOR_EQ
+        S_OPERATOR_NEQ = 25,                     // OPERATOR_NEQ
+        S_OPERATOR_LT = 26,                      // OPERATOR_LT
+        S_OPERATOR_LTE = 27,                     // OPERATOR_LTE
+        S_ELLIPSIS = 28,                         // ELLIPSIS
+        S_YYACCEPT = 29,                         // $accept
+        S_input = 30,                            // input
+        S_import_list = 31,                      // import_list
+        S_import = 32,                           // import
+        S_import_name = 33,                      // import_name
+        S_inference_group_list = 34,             // inference_group_list
+        S_inference_group = 35,                  // inference_group
+        S_base_inference_group = 36,             // base_inference_group
+        S_environment_defn_list = 37,            // environment_defn_list
+        S_environment_defn = 38,                 // environment_defn
+        S_dispatch_set = 39,                     // dispatch_set
+        S_dispatch_entry_list = 40,              // dispatch_entry_list
+        S_dispatch_entry = 41,                   // dispatch_entry
+        S_dispatch_inference_name_list = 42,     // dispatch_inference_name_list
+        S_inference_defn_list = 43,              // inference_defn_list
+        S_inference_defn = 44,                   // inference_defn
+        S_global_decl_set = 45,                  // global_decl_set
+        S_global_decl_list = 46,                 // global_decl_list
+        S_global_decl = 47,                      // global_decl
+        S_argument_set = 48,                     // argument_set
+        S_argument_list = 49,                    // argument_list
+        S_inference_argument = 50,               // inference_argument
+        S_premise_set = 51,                      // premise_set
+        S_premise_defn_list = 52,                // premise_defn_list
+        S_premise_defn = 53,                     // premise_defn
+        S_premise_type_inference_defn = 54,      // premise_type_inference_defn
+        S_while_clause = 55,                     // while_clause
+        S_premise_type_equality_defn = 56,       // premise_type_equality_defn
+        S_range_clause = 57,                     // range_clause
+        S_proposition_defn = 58,                 // proposition_defn
+        S_identifiable = 59,                     // identifiable
+        S_identifier = 60,                       // identifier
+        S_deduction_target_list = 61,            // deduction_target_list
+        S_deduction_target = 62,                 // deduction_target
+        S_deduction_target_singular = 63,        // deduction_target_singular
+        S_deduction_target_array = 64,           // deduction_target_array
+        S_deduction_target_computed = 65,        // deduction_target_computed
+        S_equality_operator = 66                 // equality_operator
+      };
+    };
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -476,251 +698,948 @@ namespace yy {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ();
-
-      /// Copy constructor.
-      basic_symbol (const basic_symbol& other);
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_deduction_target: // deduction_target
+        value.move< ASTDeductionTarget > (std::move (that.value));
+        break;
 
-      /// Constructor for valueless symbols, and symbols from each type.
+      case symbol_kind::S_deduction_target_array: // deduction_target_array
+        value.move< ASTDeductionTargetArray > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const location_type& l);
+      case symbol_kind::S_deduction_target_computed: // deduction_target_computed
+        value.move< ASTDeductionTargetComputed > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTDeductionTarget v, const location_type& l);
+      case symbol_kind::S_deduction_target_list: // deduction_target_list
+        value.move< ASTDeductionTargetList > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTDeductionTargetArray v, const location_type& l);
+      case symbol_kind::S_deduction_target_singular: // deduction_target_singular
+        value.move< ASTDeductionTargetSingular > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTDeductionTargetComputed v, const location_type& l);
+      case symbol_kind::S_dispatch_entry: // dispatch_entry
+        value.move< ASTDispatchEntry > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTDeductionTargetList v, const location_type& l);
+      case symbol_kind::S_dispatch_set: // dispatch_set
+      case symbol_kind::S_dispatch_entry_list: // dispatch_entry_list
+        value.move< ASTDispatchEntryList > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTDeductionTargetSingular v, const location_type& l);
+      case symbol_kind::S_environment_defn: // environment_defn
+        value.move< ASTEnvironmentDefn > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTEnvironmentDefn v, const location_type& l);
+      case symbol_kind::S_environment_defn_list: // environment_defn_list
+        value.move< ASTEnvironmentDefnList > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTEnvironmentDefnList v, const location_type& l);
+      case symbol_kind::S_global_decl: // global_decl
+        value.move< ASTGlobalDecl > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTGlobalDecl v, const location_type& l);
+      case symbol_kind::S_global_decl_set: // global_decl_set
+      case symbol_kind::S_global_decl_list: // global_decl_list
+        value.move< ASTGlobalDeclList > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTGlobalDeclList v, const location_type& l);
+      case symbol_kind::S_identifiable: // identifiable
+        value.move< ASTIdentifiable > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTIdentifiable v, const location_type& l);
+      case symbol_kind::S_identifier: // identifier
+        value.move< ASTIdentifier > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTIdentifier v, const location_type& l);
+      case symbol_kind::S_import: // import
+        value.move< ASTImport > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTInferenceArgument v, const location_type& l);
+      case symbol_kind::S_import_list: // import_list
+        value.move< ASTImportList > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTInferenceArgumentList v, const location_type& l);
+      case symbol_kind::S_inference_argument: // inference_argument
+        value.move< ASTInferenceArgument > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTInferenceDefn v, const location_type& l);
+      case symbol_kind::S_argument_set: // argument_set
+      case symbol_kind::S_argument_list: // argument_list
+        value.move< ASTInferenceArgumentList > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTInferenceDefnList v, const location_type& l);
+      case symbol_kind::S_inference_defn: // inference_defn
+        value.move< ASTInferenceDefn > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTInferenceEqualityDefn v, const location_type& l);
+      case symbol_kind::S_inference_defn_list: // inference_defn_list
+        value.move< ASTInferenceDefnList > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTInferenceGroup v, const location_type& l);
+      case symbol_kind::S_premise_type_equality_defn: // premise_type_equality_defn
+        value.move< ASTInferenceEqualityDefn > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTInferenceGroupList v, const location_type& l);
+      case symbol_kind::S_inference_group: // inference_group
+        value.move< ASTInferenceGroup > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTInferencePremiseDefn v, const location_type& l);
+      case symbol_kind::S_inference_group_list: // inference_group_list
+        value.move< ASTInferenceGroupList > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTModule v, const location_type& l);
+      case symbol_kind::S_premise_type_inference_defn: // premise_type_inference_defn
+        value.move< ASTInferencePremiseDefn > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTPremiseDefn v, const location_type& l);
+      case symbol_kind::S_input: // input
+        value.move< ASTModule > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTPremiseDefnList v, const location_type& l);
+      case symbol_kind::S_premise_defn: // premise_defn
+        value.move< ASTPremiseDefn > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTPropositionDefn v, const location_type& l);
+      case symbol_kind::S_premise_set: // premise_set
+      case symbol_kind::S_premise_defn_list: // premise_defn_list
+        value.move< ASTPremiseDefnList > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTRangeClause v, const location_type& l);
+      case symbol_kind::S_proposition_defn: // proposition_defn
+        value.move< ASTPropositionDefn > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const ASTWhileClause v, const location_type& l);
+      case symbol_kind::S_range_clause: // range_clause
+        value.move< ASTRangeClause > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const EqualityOperator v, const location_type& l);
+      case symbol_kind::S_while_clause: // while_clause
+        value.move< ASTWhileClause > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const std::string v, const location_type& l);
+      case symbol_kind::S_equality_operator: // equality_operator
+        value.move< EqualityOperator > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const uint64_t v, const location_type& l);
+      case symbol_kind::S_dispatch_inference_name_list: // dispatch_inference_name_list
+        value.move< StringList > (std::move (that.value));
+        break;
 
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+      case symbol_kind::S_import_name: // import_name
+      case symbol_kind::S_base_inference_group: // base_inference_group
+        value.move< std::string > (std::move (that.value));
+        break;
 
-      /// Constructor for symbols with semantic value.
-      basic_symbol (typename Base::kind_type t,
-                    const semantic_type& v,
-                    const location_type& l);
+      case symbol_kind::S_INTEGER_LITERAL: // INTEGER_LITERAL
+        value.move< uint64_t > (std::move (that.value));
+        break;
 
-      /// Destroy the symbol.
-      ~basic_symbol ();
+      default:
+        break;
+    }
 
-      /// Destroy contents, and record that is empty.
-      void clear ();
+      }
+#endif
 
-      /// Whether empty.
-      bool empty () const;
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
+#endif
 
-      /// Destructive move, \a s is emptied into this.
-      void move (basic_symbol& s);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTDeductionTarget&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTDeductionTarget& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// The semantic value.
-      semantic_type value;
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTDeductionTargetArray&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTDeductionTargetArray& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// The location.
-      location_type location;
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTDeductionTargetComputed&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTDeductionTargetComputed& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    private:
-      /// Assignment operator.
-      basic_symbol& operator= (const basic_symbol& other);
-    };
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTDeductionTargetList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTDeductionTargetList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    /// Type access provider for token (enum) based symbols.
-    struct by_type
-    {
-      /// Default constructor.
-      by_type ();
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTDeductionTargetSingular&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTDeductionTargetSingular& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// Copy constructor.
-      by_type (const by_type& other);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTDispatchEntry&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTDispatchEntry& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTDispatchEntryList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTDispatchEntryList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTEnvironmentDefn&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTEnvironmentDefn& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// Record that this symbol is empty.
-      void clear ();
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTEnvironmentDefnList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTEnvironmentDefnList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTGlobalDecl&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTGlobalDecl& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// The (internal) type number (corresponding to \a type).
-      /// \a empty when empty.
-      symbol_number_type type_get () const;
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTGlobalDeclList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTGlobalDeclList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// The token.
-      token_type token () const;
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTIdentifiable&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTIdentifiable& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
-    };
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTIdentifier&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTIdentifier& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    /// "External" symbols: returned by the scanner.
-    typedef basic_symbol<by_type> symbol_type;
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTImport&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTImport& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    // Symbol constructors declarations.
-    static inline
-    symbol_type
-    make_END (const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTImportList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTImportList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_KEYWORD_GROUP (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTInferenceArgument&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTInferenceArgument& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_KEYWORD_INFERENCE (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTInferenceArgumentList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTInferenceArgumentList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_KEYWORD_ENVIRONMENT (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTInferenceDefn&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTInferenceDefn& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_KEYWORD_ARGUMENTS (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTInferenceDefnList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTInferenceDefnList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_KEYWORD_GLOBALS (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTInferenceEqualityDefn&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTInferenceEqualityDefn& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_KEYWORD_WHILE (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTInferenceGroup&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTInferenceGroup& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_KEYWORD_INRANGE (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTInferenceGroupList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTInferenceGroupList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_KEYWORD_PREMISES (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTInferencePremiseDefn&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTInferencePremiseDefn& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_KEYWORD_PROPOSITION (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTModule&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTModule& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_INTEGER_LITERAL (const uint64_t& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTPremiseDefn&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTPremiseDefn& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_IDENTIFIER (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTPremiseDefnList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTPremiseDefnList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_DOT (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTPropositionDefn&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTPropositionDefn& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_COMMA (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTRangeClause&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTRangeClause& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_COLON (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ASTWhileClause&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ASTWhileClause& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_SEMICOLON (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, EqualityOperator&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const EqualityOperator& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_LBRACKET (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, StringList&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const StringList& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_RBRACKET (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_LBRACE (const std::string& v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, uint64_t&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const uint64_t& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-    static inline
-    symbol_type
-    make_RBRACE (const std::string& v, const location_type& l);
+      /// Destroy the symbol.
+      ~basic_symbol ()
+      {
+        clear ();
+      }
 
-    static inline
-    symbol_type
-    make_LPAREN (const std::string& v, const location_type& l);
 
-    static inline
-    symbol_type
-    make_RPAREN (const std::string& v, const location_type& l);
 
-    static inline
-    symbol_type
-    make_OPERATOR_EQ (const std::string& v, const location_type& l);
+      /// Destroy contents, and record that is empty.
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_deduction_target: // deduction_target
+        value.template destroy< ASTDeductionTarget > ();
+        break;
 
-    static inline
-    symbol_type
-    make_OPERATOR_NEQ (const std::string& v, const location_type& l);
+      case symbol_kind::S_deduction_target_array: // deduction_target_array
+        value.template destroy< ASTDeductionTargetArray > ();
+        break;
 
-    static inline
-    symbol_type
-    make_OPERATOR_LT (const std::string& v, const location_type& l);
+      case symbol_kind::S_deduction_target_computed: // deduction_target_computed
+        value.template destroy< ASTDeductionTargetComputed > ();
+        break;
+
+      case symbol_kind::S_deduction_target_list: // deduction_target_list
+        value.template destroy< ASTDeductionTargetList > ();
+        break;
+
+      case symbol_kind::S_deduction_target_singular: // deduction_target_singular
+        value.template destroy< ASTDeductionTargetSingular > ();
+        break;
+
+      case symbol_kind::S_dispatch_entry: // dispatch_entry
+        value.template destroy< ASTDispatchEntry > ();
+        break;
+
+      case symbol_kind::S_dispatch_set: // dispatch_set
+      case symbol_kind::S_dispatch_entry_list: // dispatch_entry_list
+        value.template destroy< ASTDispatchEntryList > ();
+        break;
+
+      case symbol_kind::S_environment_defn: // environment_defn
+        value.template destroy< ASTEnvironmentDefn > ();
+        break;
+
+      case symbol_kind::S_environment_defn_list: // environment_defn_list
+        value.template destroy< ASTEnvironmentDefnList > ();
+        break;
+
+      case symbol_kind::S_global_decl: // global_decl
+        value.template destroy< ASTGlobalDecl > ();
+        break;
+
+      case symbol_kind::S_global_decl_set: // global_decl_set
+      case symbol_kind::S_global_decl_list: // global_decl_list
+        value.template destroy< ASTGlobalDeclList > ();
+        break;
+
+      case symbol_kind::S_identifiable: // identifiable
+        value.template destroy< ASTIdentifiable > ();
+        break;
+
+      case symbol_kind::S_identifier: // identifier
+        value.template destroy< ASTIdentifier > ();
+        break;
+
+      case symbol_kind::S_import: // import
+        value.template destroy< ASTImport > ();
+        break;
+
+      case symbol_kind::S_import_list: // import_list
+        value.template destroy< ASTImportList > ();
+        break;
+
+      case symbol_kind::S_inference_argument: // inference_argument
+        value.template destroy< ASTInferenceArgument > ();
+        break;
+
+      case symbol_kind::S_argument_set: // argument_set
+      case symbol_kind::S_argument_list: // argument_list
+        value.template destroy< ASTInferenceArgumentList > ();
+        break;
+
+      case symbol_kind::S_inference_defn: // inference_defn
+        value.template destroy< ASTInferenceDefn > ();
+        break;
+
+      case symbol_kind::S_inference_defn_list: // inference_defn_list
+        value.template destroy< ASTInferenceDefnList > ();
+        break;
+
+      case symbol_kind::S_premise_type_equality_defn: // premise_type_equality_defn
+        value.template destroy< ASTInferenceEqualityDefn > ();
+        break;
+
+      case symbol_kind::S_inference_group: // inference_group
+        value.template destroy< ASTInferenceGroup > ();
+        break;
+
+      case symbol_kind::S_inference_group_list: // inference_group_list
+        value.template destroy< ASTInferenceGroupList > ();
+        break;
+
+      case symbol_kind::S_premise_type_inference_defn: // premise_type_inference_defn
+        value.template destroy< ASTInferencePremiseDefn > ();
+        break;
+
+      case symbol_kind::S_input: // input
+        value.template destroy< ASTModule > ();
+        break;
+
+      case symbol_kind::S_premise_defn: // premise_defn
+        value.template destroy< ASTPremiseDefn > ();
+        break;
+
+      case symbol_kind::S_premise_set: // premise_set
+      case symbol_kind::S_premise_defn_list: // premise_defn_list
+        value.template destroy< ASTPremiseDefnList > ();
+        break;
+
+      case symbol_kind::S_proposition_defn: // proposition_defn
+        value.template destroy< ASTPropositionDefn > ();
+        break;
+
+      case symbol_kind::S_range_clause: // range_clause
+        value.template destroy< ASTRangeClause > ();
+        break;
+
+      case symbol_kind::S_while_clause: // while_clause
+        value.template destroy< ASTWhileClause > ();
+        break;
+
+      case symbol_kind::S_equality_operator: // equality_operator
+        value.template destroy< EqualityOperator > ();
+        break;
+
+      case symbol_kind::S_dispatch_inference_name_list: // dispatch_inference_name_list
+        value.template destroy< StringList > ();
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+      case symbol_kind::S_import_name: // import_name
+      case symbol_kind::S_base_inference_group: // base_inference_group
+        value.template destroy< std::string > ();
+        break;
+
+      case symbol_kind::S_INTEGER_LITERAL: // INTEGER_LITERAL
+        value.template destroy< uint64_t > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// Whether empty.
+      bool empty () const YY_NOEXCEPT;
+
+      /// Destructive move, \a s is emptied into this.
+      void move (basic_symbol& s);
 
-    static inline
-    symbol_type
-    make_OPERATOR_LTE (const std::string& v, const location_type& l);
+      /// The semantic value.
+      value_type value;
 
-    static inline
-    symbol_type
-    make_ELLIPSIS (const std::string& v, const location_type& l);
+      /// The location.
+      location_type location;
 
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment operator.
+      basic_symbol& operator= (const basic_symbol& that);
+#endif
+    };
+
+    /// Type access provider for token (enum) based symbols.
+    struct by_kind
+    {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
+      /// Default constructor.
+      by_kind () YY_NOEXCEPT;
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
+
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
+
+      /// Constructor from (external) token numbers.
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
+
+      /// The (internal) type number (corresponding to \a type).
+      /// \a empty when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
+    };
+
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
+    /// "External" symbols: returned by the scanner.
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
+
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
+
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT (tok == token::END
+                   || (token::YYerror <= tok && tok <= token::KEYWORD_PROPOSITION)
+                   || (token::DOT <= tok && tok <= token::ELLIPSIS));
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT (tok == token::IDENTIFIER);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, uint64_t v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const uint64_t& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        YY_ASSERT (tok == token::INTEGER_LITERAL);
+#endif
+      }
+    };
 
     /// Build a parser object.
     Parser (ParserDriver& driver_yyarg);
     virtual ~Parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    Parser (const Parser&) = delete;
+    /// Non copyable.
+    Parser& operator= (const Parser&) = delete;
+#endif
+
+    /// Parse.  An alias for parse ().
+    /// \returns  0 iff parsing succeeded.
+    int operator() ();
+
     /// Parse.
     /// \returns  0 iff parsing succeeded.
     virtual int parse ();
@@ -747,92 +1666,561 @@ namespace yy {
     /// Report a syntax error.
     void error (const syntax_error& err);
 
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
+
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_END (location_type l)
+      {
+        return symbol_type (token::END, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_END (const location_type& l)
+      {
+        return symbol_type (token::END, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYerror (location_type l)
+      {
+        return symbol_type (token::YYerror, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYerror (const location_type& l)
+      {
+        return symbol_type (token::YYerror, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_YYUNDEF (location_type l)
+      {
+        return symbol_type (token::YYUNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_YYUNDEF (const location_type& l)
+      {
+        return symbol_type (token::YYUNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_GROUP (location_type l)
+      {
+        return symbol_type (token::KEYWORD_GROUP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_GROUP (const location_type& l)
+      {
+        return symbol_type (token::KEYWORD_GROUP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_INFERENCE (location_type l)
+      {
+        return symbol_type (token::KEYWORD_INFERENCE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_INFERENCE (const location_type& l)
+      {
+        return symbol_type (token::KEYWORD_INFERENCE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_ENVIRONMENT (location_type l)
+      {
+        return symbol_type (token::KEYWORD_ENVIRONMENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_ENVIRONMENT (const location_type& l)
+      {
+        return symbol_type (token::KEYWORD_ENVIRONMENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_ARGUMENTS (location_type l)
+      {
+        return symbol_type (token::KEYWORD_ARGUMENTS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_ARGUMENTS (const location_type& l)
+      {
+        return symbol_type (token::KEYWORD_ARGUMENTS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_GLOBALS (location_type l)
+      {
+        return symbol_type (token::KEYWORD_GLOBALS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_GLOBALS (const location_type& l)
+      {
+        return symbol_type (token::KEYWORD_GLOBALS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_WHILE (location_type l)
+      {
+        return symbol_type (token::KEYWORD_WHILE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_WHILE (const location_type& l)
+      {
+        return symbol_type (token::KEYWORD_WHILE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_INRANGE (location_type l)
+      {
+        return symbol_type (token::KEYWORD_INRANGE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_INRANGE (const location_type& l)
+      {
+        return symbol_type (token::KEYWORD_INRANGE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_PREMISES (location_type l)
+      {
+        return symbol_type (token::KEYWORD_PREMISES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_PREMISES (const location_type& l)
+      {
+        return symbol_type (token::KEYWORD_PREMISES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYWORD_PROPOSITION (location_type l)
+      {
+        return symbol_type (token::KEYWORD_PROPOSITION, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYWORD_PROPOSITION (const location_type& l)
+      {
+        return symbol_type (token::KEYWORD_PROPOSITION, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTEGER_LITERAL (uint64_t v, location_type l)
+      {
+        return symbol_type (token::INTEGER_LITERAL, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTEGER_LITERAL (const uint64_t& v, const location_type& l)
+      {
+        return symbol_type (token::INTEGER_LITERAL, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IDENTIFIER (std::string v, location_type l)
+      {
+        return symbol_type (token::IDENTIFIER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IDENTIFIER (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::IDENTIFIER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DOT (location_type l)
+      {
+        return symbol_type (token::DOT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DOT (const location_type& l)
+      {
+        return symbol_type (token::DOT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMA (location_type l)
+      {
+        return symbol_type (token::COMMA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMA (const location_type& l)
+      {
+        return symbol_type (token::COMMA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COLON (location_type l)
+      {
+        return symbol_type (token::COLON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COLON (const location_type& l)
+      {
+        return symbol_type (token::COLON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SEMICOLON (location_type l)
+      {
+        return symbol_type (token::SEMICOLON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SEMICOLON (const location_type& l)
+      {
+        return symbol_type (token::SEMICOLON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LBRACKET (location_type l)
+      {
+        return symbol_type (token::LBRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LBRACKET (const location_type& l)
+      {
+        return symbol_type (token::LBRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RBRACKET (location_type l)
+      {
+        return symbol_type (token::RBRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RBRACKET (const location_type& l)
+      {
+        return symbol_type (token::RBRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LBRACE (location_type l)
+      {
+        return symbol_type (token::LBRACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LBRACE (const location_type& l)
+      {
+        return symbol_type (token::LBRACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RBRACE (location_type l)
+      {
+        return symbol_type (token::RBRACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RBRACE (const location_type& l)
+      {
+        return symbol_type (token::RBRACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LPAREN (location_type l)
+      {
+        return symbol_type (token::LPAREN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LPAREN (const location_type& l)
+      {
+        return symbol_type (token::LPAREN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RPAREN (location_type l)
+      {
+        return symbol_type (token::RPAREN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RPAREN (const location_type& l)
+      {
+        return symbol_type (token::RPAREN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPERATOR_EQ (location_type l)
+      {
+        return symbol_type (token::OPERATOR_EQ, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPERATOR_EQ (const location_type& l)
+      {
+        return symbol_type (token::OPERATOR_EQ, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPERATOR_NEQ (location_type l)
+      {
+        return symbol_type (token::OPERATOR_NEQ, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPERATOR_NEQ (const location_type& l)
+      {
+        return symbol_type (token::OPERATOR_NEQ, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPERATOR_LT (location_type l)
+      {
+        return symbol_type (token::OPERATOR_LT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPERATOR_LT (const location_type& l)
+      {
+        return symbol_type (token::OPERATOR_LT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPERATOR_LTE (location_type l)
+      {
+        return symbol_type (token::OPERATOR_LTE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPERATOR_LTE (const location_type& l)
+      {
+        return symbol_type (token::OPERATOR_LTE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ELLIPSIS (location_type l)
+      {
+        return symbol_type (token::ELLIPSIS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ELLIPSIS (const location_type& l)
+      {
+        return symbol_type (token::ELLIPSIS, l);
+      }
+#endif
+
+
+    class context
+    {
+    public:
+      context (const Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
   private:
-    /// This class is not copyable.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
     Parser (const Parser&);
+    /// Non copyable.
     Parser& operator= (const Parser&);
+#endif
 
-    /// State numbers.
-    typedef int state_type;
 
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
+    /// Stored state numbers (used for stacks).
+    typedef signed char state_type;
+
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
 
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
     /// Compute post-reduction state.
     /// \param yystate   the current state
     /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
     /// Whether the given \c yypact_ value indicates a defaulted state.
     /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
     /// Whether the given \c yytable_ value indicates a syntax error.
     /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
     static const signed char yypact_ninf_;
     static const signed char yytable_ninf_;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
+
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
 
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const signed char yypact_[];
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned char yydefact_[];
 
-  // YYPGOTO[NTERM-NUM].
-  static const signed char yypgoto_[];
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const signed char yypact_[];
 
-  // YYDEFGOTO[NTERM-NUM].
-  static const signed char yydefgoto_[];
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const signed char yydefact_[];
 
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const signed char yytable_[];
+    // YYPGOTO[NTERM-NUM].
+    static const signed char yypgoto_[];
 
-  static const signed char yycheck_[];
+    // YYDEFGOTO[NTERM-NUM].
+    static const signed char yydefgoto_[];
 
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned char yystos_[];
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const signed char yytable_[];
 
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned char yyr1_[];
+    static const signed char yycheck_[];
 
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const signed char yystos_[];
 
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const signed char yyr1_[];
 
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
 
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
 #if YYDEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short int yyrline_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
+    virtual void yy_stack_print_ () const;
 
-    // Debugging.
+    /// Debugging level.
     int yydebug_;
+    /// Debug stream.
     std::ostream* yycdebug_;
 
-    /// \brief Display a symbol type, value and location.
+    /// \brief Display a symbol kind, value and location.
     /// \param yyo    The output stream.
     /// \param yysym  The symbol.
     template <typename Base>
@@ -851,29 +2239,30 @@ namespace yy {
     struct by_state
     {
       /// Default constructor.
-      by_state ();
+      by_state () YY_NOEXCEPT;
 
-      /// The symbol type as needed by the constructor.
+      /// The symbol kind as needed by the constructor.
       typedef state_type kind_type;
 
       /// Constructor.
-      by_state (kind_type s);
+      by_state (kind_type s) YY_NOEXCEPT;
 
       /// Copy constructor.
-      by_state (const by_state& other);
+      by_state (const by_state& that) YY_NOEXCEPT;
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
+      /// Steal the symbol kind from \a that.
       void move (by_state& that);
 
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const;
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
       /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
       /// The state.
       /// \a empty when empty.
@@ -887,1187 +2276,613 @@ namespace yy {
       typedef basic_symbol<by_state> super_type;
       /// Construct an empty symbol.
       stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
       /// Steal the contents from \a sym to build this.
-      stack_symbol_type (state_type s, symbol_type& sym);
-      /// Assignment, needed by push_back.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
       stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
     };
 
-    /// Stack type.
-    typedef stack<stack_symbol_type> stack_type;
-
-    /// The stack.
-    stack_type yystack_;
-
-    /// Push a new state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param s    the symbol
-    /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, stack_symbol_type& s);
-
-    /// Push a new look ahead token on the state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param s    the state
-    /// \param sym  the symbol (for its value and location).
-    /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, state_type s, symbol_type& sym);
-
-    /// Pop \a n symbols the three stacks.
-    void yypop_ (unsigned n = 1);
-
-    /// Constants.
-    enum
-    {
-      yyeof_ = 0,
-      yylast_ = 108,     ///< Last index in yytable_.
-      yynnts_ = 30,  ///< Number of nonterminal symbols.
-      yyfinal_ = 3, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 29  ///< Number of tokens.
-    };
-
-
-    // User arguments.
-    ParserDriver& driver;
-  };
-
-  // Symbol number corresponding to token number t.
-  inline
-  Parser::token_number_type
-  Parser::yytranslate_ (token_type t)
-  {
-    static
-    const token_number_type
-    translate_table[] =
-    {
-     0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28
-    };
-    const unsigned int user_token_number_max_ = 283;
-    const token_number_type undef_token_ = 2;
-
-    if (static_cast<int>(t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned int> (t) <= user_token_number_max_)
-      return translate_table[t];
-    else
-      return undef_token_;
-  }
-
-  inline
-  Parser::syntax_error::syntax_error (const location_type& l, const std::string& m)
-    : std::runtime_error (m)
-    , location (l)
-  {}
-
-  // basic_symbol.
-  template <typename Base>
-  inline
-  Parser::basic_symbol<Base>::basic_symbol ()
-    : value ()
-  {}
-
-  template <typename Base>
-  inline
-  Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& other)
-    : Base (other)
-    , value ()
-    , location (other.location)
-  {
-      switch (other.type_get ())
-    {
-      case 54: // deduction_target
-        value.copy< ASTDeductionTarget > (other.value);
-        break;
-
-      case 56: // deduction_target_array
-        value.copy< ASTDeductionTargetArray > (other.value);
-        break;
-
-      case 57: // deduction_target_computed
-        value.copy< ASTDeductionTargetComputed > (other.value);
-        break;
-
-      case 53: // deduction_target_list
-        value.copy< ASTDeductionTargetList > (other.value);
-        break;
-
-      case 55: // deduction_target_singular
-        value.copy< ASTDeductionTargetSingular > (other.value);
-        break;
-
-      case 34: // environment_defn
-        value.copy< ASTEnvironmentDefn > (other.value);
-        break;
-
-      case 33: // environment_defn_list
-        value.copy< ASTEnvironmentDefnList > (other.value);
-        break;
-
-      case 39: // global_decl
-        value.copy< ASTGlobalDecl > (other.value);
-        break;
-
-      case 37: // global_decl_set
-      case 38: // global_decl_list
-        value.copy< ASTGlobalDeclList > (other.value);
-        break;
-
-      case 51: // identifiable
-        value.copy< ASTIdentifiable > (other.value);
-        break;
-
-      case 52: // identifier
-        value.copy< ASTIdentifier > (other.value);
-        break;
-
-      case 42: // inference_argument
-        value.copy< ASTInferenceArgument > (other.value);
-        break;
-
-      case 40: // argument_set
-      case 41: // argument_list
-        value.copy< ASTInferenceArgumentList > (other.value);
-        break;
-
-      case 36: // inference_defn
-        value.copy< ASTInferenceDefn > (other.value);
-        break;
-
-      case 35: // inference_defn_list
-        value.copy< ASTInferenceDefnList > (other.value);
-        break;
-
-      case 48: // premise_type_equality_defn
-        value.copy< ASTInferenceEqualityDefn > (other.value);
-        break;
-
-      case 32: // inference_group
-        value.copy< ASTInferenceGroup > (other.value);
-        break;
-
-      case 31: // inference_group_list
-        value.copy< ASTInferenceGroupList > (other.value);
-        break;
-
-      case 46: // premise_type_inference_defn
-        value.copy< ASTInferencePremiseDefn > (other.value);
-        break;
-
-      case 30: // input
-        value.copy< ASTModule > (other.value);
-        break;
-
-      case 45: // premise_defn
-        value.copy< ASTPremiseDefn > (other.value);
-        break;
-
-      case 43: // premise_set
-      case 44: // premise_defn_list
-        value.copy< ASTPremiseDefnList > (other.value);
-        break;
-
-      case 50: // proposition_defn
-        value.copy< ASTPropositionDefn > (other.value);
-        break;
-
-      case 49: // range_clause
-        value.copy< ASTRangeClause > (other.value);
-        break;
-
-      case 47: // while_clause
-        value.copy< ASTWhileClause > (other.value);
-        break;
-
-      case 58: // equality_operator
-        value.copy< EqualityOperator > (other.value);
-        break;
-
-      case 3: // KEYWORD_GROUP
-      case 4: // KEYWORD_INFERENCE
-      case 5: // KEYWORD_ENVIRONMENT
-      case 6: // KEYWORD_ARGUMENTS
-      case 7: // KEYWORD_GLOBALS
-      case 8: // KEYWORD_WHILE
-      case 9: // KEYWORD_INRANGE
-      case 10: // KEYWORD_PREMISES
-      case 11: // KEYWORD_PROPOSITION
-      case 13: // IDENTIFIER
-      case 14: // DOT
-      case 15: // COMMA
-      case 16: // COLON
-      case 17: // SEMICOLON
-      case 18: // LBRACKET
-      case 19: // RBRACKET
-      case 20: // LBRACE
-      case 21: // RBRACE
-      case 22: // LPAREN
-      case 23: // RPAREN
-      case 24: // OPERATOR_EQ
-      case 25: // OPERATOR_NEQ
-      case 26: // OPERATOR_LT
-      case 27: // OPERATOR_LTE
-      case 28: // ELLIPSIS
-        value.copy< std::string > (other.value);
-        break;
-
-      case 12: // INTEGER_LITERAL
-        value.copy< uint64_t > (other.value);
-        break;
-
-      default:
-        break;
-    }
-
-  }
-
-  template <typename Base>
-  inline
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const semantic_type& v, const location_type& l)
-    : Base (t)
-    , value ()
-    , location (l)
-  {
-    (void) v;
-      switch (this->type_get ())
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
     {
-      case 54: // deduction_target
-        value.copy< ASTDeductionTarget > (v);
-        break;
-
-      case 56: // deduction_target_array
-        value.copy< ASTDeductionTargetArray > (v);
-        break;
-
-      case 57: // deduction_target_computed
-        value.copy< ASTDeductionTargetComputed > (v);
-        break;
-
-      case 53: // deduction_target_list
-        value.copy< ASTDeductionTargetList > (v);
-        break;
-
-      case 55: // deduction_target_singular
-        value.copy< ASTDeductionTargetSingular > (v);
-        break;
-
-      case 34: // environment_defn
-        value.copy< ASTEnvironmentDefn > (v);
-        break;
-
-      case 33: // environment_defn_list
-        value.copy< ASTEnvironmentDefnList > (v);
-        break;
-
-      case 39: // global_decl
-        value.copy< ASTGlobalDecl > (v);
-        break;
-
-      case 37: // global_decl_set
-      case 38: // global_decl_list
-        value.copy< ASTGlobalDeclList > (v);
-        break;
-
-      case 51: // identifiable
-        value.copy< ASTIdentifiable > (v);
-        break;
-
-      case 52: // identifier
-        value.copy< ASTIdentifier > (v);
-        break;
-
-      case 42: // inference_argument
-        value.copy< ASTInferenceArgument > (v);
-        break;
-
-      case 40: // argument_set
-      case 41: // argument_list
-        value.copy< ASTInferenceArgumentList > (v);
-        break;
-
-      case 36: // inference_defn
-        value.copy< ASTInferenceDefn > (v);
-        break;
-
-      case 35: // inference_defn_list
-        value.copy< ASTInferenceDefnList > (v);
-        break;
-
-      case 48: // premise_type_equality_defn
-        value.copy< ASTInferenceEqualityDefn > (v);
-        break;
-
-      case 32: // inference_group
-        value.copy< ASTInferenceGroup > (v);
-        break;
-
-      case 31: // inference_group_list
-        value.copy< ASTInferenceGroupList > (v);
-        break;
-
-      case 46: // premise_type_inference_defn
-        value.copy< ASTInferencePremiseDefn > (v);
-        break;
-
-      case 30: // input
-        value.copy< ASTModule > (v);
-        break;
-
-      case 45: // premise_defn
-        value.copy< ASTPremiseDefn > (v);
-        break;
-
-      case 43: // premise_set
-      case 44: // premise_defn_list
-        value.copy< ASTPremiseDefnList > (v);
-        break;
-
-      case 50: // proposition_defn
-        value.copy< ASTPropositionDefn > (v);
-        break;
-
-      case 49: // range_clause
-        value.copy< ASTRangeClause > (v);
-        break;
-
-      case 47: // while_clause
-        value.copy< ASTWhileClause > (v);
-        break;
-
-      case 58: // equality_operator
-        value.copy< EqualityOperator > (v);
-        break;
-
-      case 3: // KEYWORD_GROUP
-      case 4: // KEYWORD_INFERENCE
-      case 5: // KEYWORD_ENVIRONMENT
-      case 6: // KEYWORD_ARGUMENTS
-      case 7: // KEYWORD_GLOBALS
-      case 8: // KEYWORD_WHILE
-      case 9: // KEYWORD_INRANGE
-      case 10: // KEYWORD_PREMISES
-      case 11: // KEYWORD_PROPOSITION
-      case 13: // IDENTIFIER
-      case 14: // DOT
-      case 15: // COMMA
-      case 16: // COLON
-      case 17: // SEMICOLON
-      case 18: // LBRACKET
-      case 19: // RBRACKET
-      case 20: // LBRACE
-      case 21: // RBRACE
-      case 22: // LPAREN
-      case 23: // RPAREN
-      case 24: // OPERATOR_EQ
-      case 25: // OPERATOR_NEQ
-      case 26: // OPERATOR_LT
-      case 27: // OPERATOR_LTE
-      case 28: // ELLIPSIS
-        value.copy< std::string > (v);
-        break;
-
-      case 12: // INTEGER_LITERAL
-        value.copy< uint64_t > (v);
-        break;
-
-      default:
-        break;
-    }
-}
-
-
-  // Implementation of basic_symbol constructor for each type.
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const location_type& l)
-    : Base (t)
-    , value ()
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTDeductionTarget v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTDeductionTargetArray v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTDeductionTargetComputed v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTDeductionTargetList v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTDeductionTargetSingular v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTEnvironmentDefn v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTEnvironmentDefnList v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTGlobalDecl v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTGlobalDeclList v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTIdentifiable v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTIdentifier v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTInferenceArgument v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTInferenceArgumentList v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTInferenceDefn v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTInferenceDefnList v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTInferenceEqualityDefn v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTInferenceGroup v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTInferenceGroupList v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTInferencePremiseDefn v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTModule v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTPremiseDefn v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTPremiseDefnList v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+    /// The stack.
+    stack_type yystack_;
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTPropositionDefn v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTRangeClause v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ASTWhileClause v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const EqualityOperator v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+    /// Constants.
+    enum
+    {
+      yylast_ = 95,     ///< Last index in yytable_.
+      yynnts_ = 38,  ///< Number of nonterminal symbols.
+      yyfinal_ = 3 ///< Termination state number.
+    };
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const std::string v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
 
-  template <typename Base>
-  Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const uint64_t v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
+    // User arguments.
+    ParserDriver& driver;
 
+  };
 
-  template <typename Base>
   inline
-  Parser::basic_symbol<Base>::~basic_symbol ()
+  Parser::symbol_kind_type
+  Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
-    clear ();
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const signed char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28
+    };
+    // Last valid token kind.
+    const int code_max = 283;
+
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
   }
 
+  // basic_symbol.
   template <typename Base>
-  inline
-  void
-  Parser::basic_symbol<Base>::clear ()
+  Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
   {
-    // User destructor.
-    symbol_number_type yytype = this->type_get ();
-    basic_symbol<Base>& yysym = *this;
-    (void) yysym;
-    switch (yytype)
+    switch (this->kind ())
     {
-   default:
-      break;
-    }
+      case symbol_kind::S_deduction_target: // deduction_target
+        value.copy< ASTDeductionTarget > (YY_MOVE (that.value));
+        break;
 
-    // Type destructor.
-    switch (yytype)
-    {
-      case 54: // deduction_target
-        value.template destroy< ASTDeductionTarget > ();
+      case symbol_kind::S_deduction_target_array: // deduction_target_array
+        value.copy< ASTDeductionTargetArray > (YY_MOVE (that.value));
         break;
 
-      case 56: // deduction_target_array
-        value.template destroy< ASTDeductionTargetArray > ();
+      case symbol_kind::S_deduction_target_computed: // deduction_target_computed
+        value.copy< ASTDeductionTargetComputed > (YY_MOVE (that.value));
         break;
 
-      case 57: // deduction_target_computed
-        value.template destroy< ASTDeductionTargetComputed > ();
+      case symbol_kind::S_deduction_target_list: // deduction_target_list
+        value.copy< ASTDeductionTargetList > (YY_MOVE (that.value));
         break;
 
-      case 53: // deduction_target_list
-        value.template destroy< ASTDeductionTargetList > ();
+      case symbol_kind::S_deduction_target_singular: // deduction_target_singular
+        value.copy< ASTDeductionTargetSingular > (YY_MOVE (that.value));
         break;
 
-      case 55: // deduction_target_singular
-        value.template destroy< ASTDeductionTargetSingular > ();
+      case symbol_kind::S_dispatch_entry: // dispatch_entry
+        value.copy< ASTDispatchEntry > (YY_MOVE (that.value));
         break;
 
-      case 34: // environment_defn
-        value.template destroy< ASTEnvironmentDefn > ();
+      case symbol_kind::S_dispatch_set: // dispatch_set
+      case symbol_kind::S_dispatch_entry_list: // dispatch_entry_list
+        value.copy< ASTDispatchEntryList > (YY_MOVE (that.value));
         break;
 
-      case 33: // environment_defn_list
-        value.template destroy< ASTEnvironmentDefnList > ();
+      case symbol_kind::S_environment_defn: // environment_defn
+        value.copy< ASTEnvironmentDefn > (YY_MOVE (that.value));
         break;
 
-      case 39: // global_decl
-        value.template destroy< ASTGlobalDecl > ();
+      case symbol_kind::S_environment_defn_list: // environment_defn_list
+        value.copy< ASTEnvironmentDefnList > (YY_MOVE (that.value));
         break;
 
-      case 37: // global_decl_set
-      case 38: // global_decl_list
-        value.template destroy< ASTGlobalDeclList > ();
+      case symbol_kind::S_global_decl: // global_decl
+        value.copy< ASTGlobalDecl > (YY_MOVE (that.value));
         break;
 
-      case 51: // identifiable
-        value.template destroy< ASTIdentifiable > ();
+      case symbol_kind::S_global_decl_set: // global_decl_set
+      case symbol_kind::S_global_decl_list: // global_decl_list
+        value.copy< ASTGlobalDeclList > (YY_MOVE (that.value));
         break;
 
-      case 52: // identifier
-        value.template destroy< ASTIdentifier > ();
+      case symbol_kind::S_identifiable: // identifiable
+        value.copy< ASTIdentifiable > (YY_MOVE (that.value));
         break;
 
-      case 42: // inference_argument
-        value.template destroy< ASTInferenceArgument > ();
+      case symbol_kind::S_identifier: // identifier
+        value.copy< ASTIdentifier > (YY_MOVE (that.value));
         break;
 
-      case 40: // argument_set
-      case 41: // argument_list
-        value.template destroy< ASTInferenceArgumentList > ();
+      case symbol_kind::S_import: // import
+        value.copy< ASTImport > (YY_MOVE (that.value));
         break;
 
-      case 36: // inference_defn
-        value.template destroy< ASTInferenceDefn > ();
+      case symbol_kind::S_import_list: // import_list
+        value.copy< ASTImportList > (YY_MOVE (that.value));
         break;
 
-      case 35: // inference_defn_list
-        value.template destroy< ASTInferenceDefnList > ();
+      case symbol_kind::S_inference_argument: // inference_argument
+        value.copy< ASTInferenceArgument > (YY_MOVE (that.value));
         break;
 
-      case 48: // premise_type_equality_defn
-        value.template destroy< ASTInferenceEqualityDefn > ();
+      case symbol_kind::S_argument_set: // argument_set
+      case symbol_kind::S_argument_list: // argument_list
+        value.copy< ASTInferenceArgumentList > (YY_MOVE (that.value));
         break;
 
-      case 32: // inference_group
-        value.template destroy< ASTInferenceGroup > ();
+      case symbol_kind::S_inference_defn: // inference_defn
+        value.copy< ASTInferenceDefn > (YY_MOVE (that.value));
         break;
 
-      case 31: // inference_group_list
-        value.template destroy< ASTInferenceGroupList > ();
+      case symbol_kind::S_inference_defn_list: // inference_defn_list
+        value.copy< ASTInferenceDefnList > (YY_MOVE (that.value));
         break;
 
-      case 46: // premise_type_inference_defn
-        value.template destroy< ASTInferencePremiseDefn > ();
+      case symbol_kind::S_premise_type_equality_defn: // premise_type_equality_defn
+        value.copy< ASTInferenceEqualityDefn > (YY_MOVE (that.value));
         break;
 
-      case 30: // input
-        value.template destroy< ASTModule > ();
+      case symbol_kind::S_inference_group: // inference_group
+        value.copy< ASTInferenceGroup > (YY_MOVE (that.value));
         break;
 
-      case 45: // premise_defn
-        value.template destroy< ASTPremiseDefn > ();
+      case symbol_kind::S_inference_group_list: // inference_group_list
+        value.copy< ASTInferenceGroupList > (YY_MOVE (that.value));
         break;
 
-      case 43: // premise_set
-      case 44: // premise_defn_list
-        value.template destroy< ASTPremiseDefnList > ();
+      case symbol_kind::S_premise_type_inference_defn: // premise_type_inference_defn
+        value.copy< ASTInferencePremiseDefn > (YY_MOVE (that.value));
         break;
 
-      case 50: // proposition_defn
-        value.template destroy< ASTPropositionDefn > ();
+      case symbol_kind::S_input: // input
+        value.copy< ASTModule > (YY_MOVE (that.value));
         break;
 
-      case 49: // range_clause
-        value.template destroy< ASTRangeClause > ();
+      case symbol_kind::S_premise_defn: // premise_defn
+        value.copy< ASTPremiseDefn > (YY_MOVE (that.value));
         break;
 
-      case 47: // while_clause
-        value.template destroy< ASTWhileClause > ();
+      case symbol_kind::S_premise_set: // premise_set
+      case symbol_kind::S_premise_defn_list: // premise_defn_list
+        value.copy< ASTPremiseDefnList > (YY_MOVE (that.value));
         break;
 
-      case 58: // equality_operator
-        value.template destroy< EqualityOperator > ();
+      case symbol_kind::S_proposition_defn: // proposition_defn
+        value.copy< ASTPropositionDefn > (YY_MOVE (that.value));
         break;
 
-      case 3: // KEYWORD_GROUP
-      case 4: // KEYWORD_INFERENCE
-      case 5: // KEYWORD_ENVIRONMENT
-      case 6: // KEYWORD_ARGUMENTS
-      case 7: // KEYWORD_GLOBALS
-      case 8: // KEYWORD_WHILE
-      case 9: // KEYWORD_INRANGE
-      case 10: // KEYWORD_PREMISES
-      case 11: // KEYWORD_PROPOSITION
-      case 13: // IDENTIFIER
-      case 14: // DOT
-      case 15: // COMMA
-      case 16: // COLON
-      case 17: // SEMICOLON
-      case 18: // LBRACKET
-      case 19: // RBRACKET
-      case 20: // LBRACE
-      case 21: // RBRACE
-      case 22: // LPAREN
-      case 23: // RPAREN
-      case 24: // OPERATOR_EQ
-      case 25: // OPERATOR_NEQ
-      case 26: // OPERATOR_LT
-      case 27: // OPERATOR_LTE
-      case 28: // ELLIPSIS
-        value.template destroy< std::string > ();
+      case symbol_kind::S_range_clause: // range_clause
+        value.copy< ASTRangeClause > (YY_MOVE (that.value));
         break;
 
-      case 12: // INTEGER_LITERAL
-        value.template destroy< uint64_t > ();
+      case symbol_kind::S_while_clause: // while_clause
+        value.copy< ASTWhileClause > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_equality_operator: // equality_operator
+        value.copy< EqualityOperator > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_dispatch_inference_name_list: // dispatch_inference_name_list
+        value.copy< StringList > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+      case symbol_kind::S_import_name: // import_name
+      case symbol_kind::S_base_inference_group: // base_inference_group
+        value.copy< std::string > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER_LITERAL: // INTEGER_LITERAL
+        value.copy< uint64_t > (YY_MOVE (that.value));
         break;
 
       default:
         break;
     }
 
-    Base::clear ();
   }
 
+
+
+
+  template <typename Base>
+  Parser::symbol_kind_type
+  Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
   template <typename Base>
-  inline
   bool
-  Parser::basic_symbol<Base>::empty () const
+  Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return Base::type_get () == empty_symbol;
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
   template <typename Base>
-  inline
   void
   Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
-    super_type::move(s);
-      switch (this->type_get ())
+    super_type::move (s);
+    switch (this->kind ())
     {
-      case 54: // deduction_target
-        value.move< ASTDeductionTarget > (s.value);
+      case symbol_kind::S_deduction_target: // deduction_target
+        value.move< ASTDeductionTarget > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_deduction_target_array: // deduction_target_array
+        value.move< ASTDeductionTargetArray > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_deduction_target_computed: // deduction_target_computed
+        value.move< ASTDeductionTargetComputed > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_deduction_target_list: // deduction_target_list
+        value.move< ASTDeductionTargetList > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_deduction_target_singular: // deduction_target_singular
+        value.move< ASTDeductionTargetSingular > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_dispatch_entry: // dispatch_entry
+        value.move< ASTDispatchEntry > (YY_MOVE (s.value));
         break;
 
-      case 56: // deduction_target_array
-        value.move< ASTDeductionTargetArray > (s.value);
+      case symbol_kind::S_dispatch_set: // dispatch_set
+      case symbol_kind::S_dispatch_entry_list: // dispatch_entry_list
+        value.move< ASTDispatchEntryList > (YY_MOVE (s.value));
         break;
 
-      case 57: // deduction_target_computed
-        value.move< ASTDeductionTargetComputed > (s.value);
+      case symbol_kind::S_environment_defn: // environment_defn
+        value.move< ASTEnvironmentDefn > (YY_MOVE (s.value));
         break;
 
-      case 53: // deduction_target_list
-        value.move< ASTDeductionTargetList > (s.value);
+      case symbol_kind::S_environment_defn_list: // environment_defn_list
+        value.move< ASTEnvironmentDefnList > (YY_MOVE (s.value));
         break;
 
-      case 55: // deduction_target_singular
-        value.move< ASTDeductionTargetSingular > (s.value);
+      case symbol_kind::S_global_decl: // global_decl
+        value.move< ASTGlobalDecl > (YY_MOVE (s.value));
         break;
 
-      case 34: // environment_defn
-        value.move< ASTEnvironmentDefn > (s.value);
+      case symbol_kind::S_global_decl_set: // global_decl_set
+      case symbol_kind::S_global_decl_list: // global_decl_list
+        value.move< ASTGlobalDeclList > (YY_MOVE (s.value));
         break;
 
-      case 33: // environment_defn_list
-        value.move< ASTEnvironmentDefnList > (s.value);
+      case symbol_kind::S_identifiable: // identifiable
+        value.move< ASTIdentifiable > (YY_MOVE (s.value));
         break;
 
-      case 39: // global_decl
-        value.move< ASTGlobalDecl > (s.value);
+      case symbol_kind::S_identifier: // identifier
+        value.move< ASTIdentifier > (YY_MOVE (s.value));
         break;
 
-      case 37: // global_decl_set
-      case 38: // global_decl_list
-        value.move< ASTGlobalDeclList > (s.value);
+      case symbol_kind::S_import: // import
+        value.move< ASTImport > (YY_MOVE (s.value));
         break;
 
-      case 51: // identifiable
-        value.move< ASTIdentifiable > (s.value);
+      case symbol_kind::S_import_list: // import_list
+        value.move< ASTImportList > (YY_MOVE (s.value));
         break;
 
-      case 52: // identifier
-        value.move< ASTIdentifier > (s.value);
+      case symbol_kind::S_inference_argument: // inference_argument
+        value.move< ASTInferenceArgument > (YY_MOVE (s.value));
         break;
 
-      case 42: // inference_argument
-        value.move< ASTInferenceArgument > (s.value);
+      case symbol_kind::S_argument_set: // argument_set
+      case symbol_kind::S_argument_list: // argument_list
+        value.move< ASTInferenceArgumentList > (YY_MOVE (s.value));
         break;
 
-      case 40: // argument_set
-      case 41: // argument_list
-        value.move< ASTInferenceArgumentList > (s.value);
+      case symbol_kind::S_inference_defn: // inference_defn
+        value.move< ASTInferenceDefn > (YY_MOVE (s.value));
         break;
 
-      case 36: // inference_defn
-        value.move< ASTInferenceDefn > (s.value);
+      case symbol_kind::S_inference_defn_list: // inference_defn_list
+        value.move< ASTInferenceDefnList > (YY_MOVE (s.value));
         break;
 
-      case 35: // inference_defn_list
-        value.move< ASTInferenceDefnList > (s.value);
+      case symbol_kind::S_premise_type_equality_defn: // premise_type_equality_defn
+        value.move< ASTInferenceEqualityDefn > (YY_MOVE (s.value));
         break;
 
-      case 48: // premise_type_equality_defn
-        value.move< ASTInferenceEqualityDefn > (s.value);
+      case symbol_kind::S_inference_group: // inference_group
+        value.move< ASTInferenceGroup > (YY_MOVE (s.value));
         break;
 
-      case 32: // inference_group
-        value.move< ASTInferenceGroup > (s.value);
+      case symbol_kind::S_inference_group_list: // inference_group_list
+        value.move< ASTInferenceGroupList > (YY_MOVE (s.value));
         break;
 
-      case 31: // inference_group_list
-        value.move< ASTInferenceGroupList > (s.value);
+      case symbol_kind::S_premise_type_inference_defn: // premise_type_inference_defn
+        value.move< ASTInferencePremiseDefn > (YY_MOVE (s.value));
         break;
 
-      case 46: // premise_type_inference_defn
-        value.move< ASTInferencePremiseDefn > (s.value);
+      case symbol_kind::S_input: // input
+        value.move< ASTModule > (YY_MOVE (s.value));
         break;
 
-      case 30: // input
-        value.move< ASTModule > (s.value);
+      case symbol_kind::S_premise_defn: // premise_defn
+        value.move< ASTPremiseDefn > (YY_MOVE (s.value));
         break;
 
-      case 45: // premise_defn
-        value.move< ASTPremiseDefn > (s.value);
+      case symbol_kind::S_premise_set: // premise_set
+      case symbol_kind::S_premise_defn_list: // premise_defn_list
+        value.move< ASTPremiseDefnList > (YY_MOVE (s.value));
         break;
 
-      case 43: // premise_set
-      case 44: // premise_defn_list
-        value.move< ASTPremiseDefnList > (s.value);
+      case symbol_kind::S_proposition_defn: // proposition_defn
+        value.move< ASTPropositionDefn > (YY_MOVE (s.value));
         break;
 
-      case 50: // proposition_defn
-        value.move< ASTPropositionDefn > (s.value);
+      case symbol_kind::S_range_clause: // range_clause
+        value.move< ASTRangeClause > (YY_MOVE (s.value));
         break;
 
-      case 49: // range_clause
-        value.move< ASTRangeClause > (s.value);
+      case symbol_kind::S_while_clause: // while_clause
+        value.move< ASTWhileClause > (YY_MOVE (s.value));
         break;
 
-      case 47: // while_clause
-        value.move< ASTWhileClause > (s.value);
+      case symbol_kind::S_equality_operator: // equality_operator
+        value.move< EqualityOperator > (YY_MOVE (s.value));
         break;
 
-      case 58: // equality_operator
-        value.move< EqualityOperator > (s.value);
+      case symbol_kind::S_dispatch_inference_name_list: // dispatch_inference_name_list
+        value.move< StringList > (YY_MOVE (s.value));
         break;
 
-      case 3: // KEYWORD_GROUP
-      case 4: // KEYWORD_INFERENCE
-      case 5: // KEYWORD_ENVIRONMENT
-      case 6: // KEYWORD_ARGUMENTS
-      case 7: // KEYWORD_GLOBALS
-      case 8: // KEYWORD_WHILE
-      case 9: // KEYWORD_INRANGE
-      case 10: // KEYWORD_PREMISES
-      case 11: // KEYWORD_PROPOSITION
-      case 13: // IDENTIFIER
-      case 14: // DOT
-      case 15: // COMMA
-      case 16: // COLON
-      case 17: // SEMICOLON
-      case 18: // LBRACKET
-      case 19: // RBRACKET
-      case 20: // LBRACE
-      case 21: // RBRACE
-      case 22: // LPAREN
-      case 23: // RPAREN
-      case 24: // OPERATOR_EQ
-      case 25: // OPERATOR_NEQ
-      case 26: // OPERATOR_LT
-      case 27: // OPERATOR_LTE
-      case 28: // ELLIPSIS
-        value.move< std::string > (s.value);
+      case symbol_kind::S_IDENTIFIER: // IDENTIFIER
+      case symbol_kind::S_import_name: // import_name
+      case symbol_kind::S_base_inference_group: // base_inference_group
+        value.move< std::string > (YY_MOVE (s.value));
         break;
 
-      case 12: // INTEGER_LITERAL
-        value.move< uint64_t > (s.value);
+      case symbol_kind::S_INTEGER_LITERAL: // INTEGER_LITERAL
+        value.move< uint64_t > (YY_MOVE (s.value));
         break;
 
       default:
         break;
     }
 
-    location = s.location;
+    location = YY_MOVE (s.location);
   }
 
-  // by_type.
+  // by_kind.
   inline
-  Parser::by_type::by_type ()
-    : type (empty_symbol)
+  Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
   {}
 
+#if 201103L <= YY_CPLUSPLUS
+  inline
+  Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {
+    that.clear ();
+  }
+#endif
+
   inline
-  Parser::by_type::by_type (const by_type& other)
-    : type (other.type)
+  Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {}
 
   inline
-  Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
+  Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
   {}
 
+
+
   inline
   void
-  Parser::by_type::clear ()
+  Parser::by_kind::clear () YY_NOEXCEPT
   {
-    type = empty_symbol;
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
   void
-  Parser::by_type::move (by_type& that)
+  Parser::by_kind::move (by_kind& that)
   {
-    type = that.type;
+    kind_ = that.kind_;
     that.clear ();
   }
 
   inline
-  int
-  Parser::by_type::type_get () const
-  {
-    return type;
-  }
-
-  inline
-  Parser::token_type
-  Parser::by_type::token () const
-  {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short int
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283
-    };
-    return static_cast<token_type> (yytoken_number_[type]);
-  }
-  // Implementation of make_symbol for each symbol type.
-  Parser::symbol_type
-  Parser::make_END (const location_type& l)
-  {
-    return symbol_type (token::END, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_KEYWORD_GROUP (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::KEYWORD_GROUP, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_KEYWORD_INFERENCE (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::KEYWORD_INFERENCE, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_KEYWORD_ENVIRONMENT (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::KEYWORD_ENVIRONMENT, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_KEYWORD_ARGUMENTS (const std::string& v, const location_type& l)
+  Parser::symbol_kind_type
+  Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return symbol_type (token::KEYWORD_ARGUMENTS, v, l);
+    return kind_;
   }
 
-  Parser::symbol_type
-  Parser::make_KEYWORD_GLOBALS (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::KEYWORD_GLOBALS, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_KEYWORD_WHILE (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::KEYWORD_WHILE, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_KEYWORD_INRANGE (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::KEYWORD_INRANGE, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_KEYWORD_PREMISES (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::KEYWORD_PREMISES, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_KEYWORD_PROPOSITION (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::KEYWORD_PROPOSITION, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_INTEGER_LITERAL (const uint64_t& v, const location_type& l)
-  {
-    return symbol_type (token::INTEGER_LITERAL, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_IDENTIFIER (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::IDENTIFIER, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_DOT (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::DOT, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_COMMA (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::COMMA, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_COLON (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::COLON, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_SEMICOLON (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::SEMICOLON, v, l);
-  }
 
-  Parser::symbol_type
-  Parser::make_LBRACKET (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::LBRACKET, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_RBRACKET (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::RBRACKET, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_LBRACE (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::LBRACE, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_RBRACE (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::RBRACE, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_LPAREN (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::LPAREN, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_RPAREN (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::RPAREN, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_OPERATOR_EQ (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::OPERATOR_EQ, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_OPERATOR_NEQ (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::OPERATOR_NEQ, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_OPERATOR_LT (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::OPERATOR_LT, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_OPERATOR_LTE (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::OPERATOR_LTE, v, l);
-  }
-
-  Parser::symbol_type
-  Parser::make_ELLIPSIS (const std::string& v, const location_type& l)
+  inline
+  Parser::symbol_kind_type
+  Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::ELLIPSIS, v, l);
+    return this->kind ();
   }
 
 
-
 } // yy
-#line 2069 "parser.tab.hh" // lalr1.cc:392
+#line 2884 "precompiled/parser.tab.hh"
 
 
 
 
-#endif // !YY_YY_PARSER_TAB_HH_INCLUDED
+#endif // !YY_YY_PRECOMPILED_PARSER_TAB_HH_INCLUDED
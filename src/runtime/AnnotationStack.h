@@ -0,0 +1,139 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * Stack of temporary type annotations, which synthesized code pushes for
+ * `while` clauses when an inference group specifies the
+ * `TypeAnnotationStack` environment definition.
+ *
+ * Each annotation maps a node, identified by address, to a type, and the
+ * proof method looks up the innermost annotation of a node with `find()`.
+ * A `while` clause is synthesized into an `AnnotationScope`, which marks the
+ * top of the stack when constructed and rolls back to it when the clause
+ * ends, or when the synthesized method returns early on a failed premise.
+ * Marking is constant time, and rolling back pops only the annotations
+ * pushed within the scope, without any snapshot of the state.
+ */
+
+namespace sl {
+namespace runtime {
+
+template <typename Type>
+class AnnotationStack
+{
+public:
+  typedef size_t Mark;
+
+  AnnotationStack()
+    : _entries()
+  {
+  }
+
+  void push(const void* node, const Type& type)
+  {
+    _entries.emplace_back(node, type);
+  }
+
+  /**
+   * Returns the innermost annotation of the node, or nullptr if there is
+   * none.
+   */
+  const Type* find(const void* node) const
+  {
+    for (auto itr = _entries.crbegin(); itr != _entries.crend(); ++itr) {
+      if (itr->first == node) {
+        return &itr->second;
+      }
+    }
+    return nullptr;
+  }
+
+  Mark mark() const
+  {
+    return _entries.size();
+  }
+
+  /**
+   * Pops every annotation pushed since the mark.
+   */
+  void rollback(Mark mark)
+  {
+    if (mark < _entries.size()) {
+      _entries.erase(_entries.begin() + mark, _entries.end());
+    }
+  }
+
+  size_t size() const
+  {
+    return _entries.size();
+  }
+
+private:
+  std::vector<std::pair<const void*, Type>> _entries;
+};
+
+// -----------------------------------------------------------------------------
+
+template <typename Type>
+class AnnotationScope
+{
+public:
+  explicit AnnotationScope(AnnotationStack<Type>& stack)
+    : _stack(&stack)
+    , _mark(stack.mark())
+  {
+  }
+
+  AnnotationScope(const AnnotationScope&) = delete;
+  AnnotationScope& operator=(const AnnotationScope&) = delete;
+
+  ~AnnotationScope()
+  {
+    rollback();
+  }
+
+  /**
+   * Rolls the stack back to where the scope started. Only the first call
+   * has any effect.
+   */
+  void rollback()
+  {
+    if (_stack) {
+      _stack->rollback(_mark);
+      _stack = nullptr;
+    }
+  }
+
+private:
+  AnnotationStack<Type>* _stack;
+  typename AnnotationStack<Type>::Mark _mark;
+};
+
+} /* end namespace runtime */
+} /* end namespace sl */
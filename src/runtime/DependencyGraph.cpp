@@ -0,0 +1,121 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/DependencyGraph.h"
+
+namespace sl {
+namespace runtime {
+
+// -----------------------------------------------------------------------------
+
+DependencyGraph::DependencyGraph()
+  : _nodesBySite()
+  , _sitesByNode()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+void
+DependencyGraph::beginSite(const void* site)
+{
+  const auto itr = _nodesBySite.find(site);
+  if (itr == _nodesBySite.end()) {
+    return;
+  }
+
+  for (const void* node : itr->second) {
+    const auto sitesItr = _sitesByNode.find(node);
+    if (sitesItr != _sitesByNode.end()) {
+      sitesItr->second.erase(site);
+      if (sitesItr->second.empty()) {
+        _sitesByNode.erase(sitesItr);
+      }
+    }
+  }
+
+  _nodesBySite.erase(itr);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+DependencyGraph::record(const void* site, const void* node)
+{
+  // Nodes consulted more than once by the same check are recorded once.
+  if (_sitesByNode[node].insert(site).second) {
+    _nodesBySite[site].push_back(node);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+DependencyGraph::dependentSites(const void* node,
+                                std::vector<const void*>* sites) const
+{
+  const auto itr = _sitesByNode.find(node);
+  if (itr != _sitesByNode.cend()) {
+    sites->insert(sites->end(), itr->second.cbegin(), itr->second.cend());
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+DependencyGraph::remove(const void* node)
+{
+  beginSite(node);
+
+  const auto itr = _sitesByNode.find(node);
+  if (itr == _sitesByNode.end()) {
+    return;
+  }
+
+  for (const void* site : itr->second) {
+    auto& nodes = _nodesBySite[site];
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      if (nodes[i] == node) {
+        nodes[i] = nodes.back();
+        nodes.pop_back();
+        break;
+      }
+    }
+  }
+
+  _sitesByNode.erase(itr);
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+DependencyGraph::dependencyCount(const void* site) const
+{
+  const auto itr = _nodesBySite.find(site);
+  return itr == _nodesBySite.cend() ? 0 : itr->second.size();
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace sl */
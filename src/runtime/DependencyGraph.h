@@ -0,0 +1,88 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Graph of the nodes that each checked site consulted, which synthesized code
+ * records when an inference group specifies the `DependencyGraph`
+ * environment definition.
+ *
+ * A site is the node passed as the first argument of a synthesized inference
+ * method. Each check of a site first forgets what the previous check of the
+ * site recorded, then records every node that is proven or annotated from
+ * the arguments, such as `call.callee`. When the type of a node changes, the
+ * sites that depend on it are the ones to check again. A site whose type
+ * changes as a result is a node in turn, so its own dependents can then be
+ * queried, which keeps rechecking to the rules actually affected.
+ *
+ * Nodes and sites are identified by address. The graph is not thread-safe.
+ */
+
+namespace sl {
+namespace runtime {
+
+class DependencyGraph
+{
+public:
+  DependencyGraph();
+
+  /**
+   * Forgets the dependencies recorded for the site.
+   */
+  void beginSite(const void* site);
+
+  /**
+   * Records that the check of the site consulted the node.
+   */
+  void record(const void* site, const void* node);
+
+  /**
+   * Appends the sites whose last check consulted the node, in no
+   * particular order.
+   */
+  void dependentSites(const void* node, std::vector<const void*>* sites) const;
+
+  /**
+   * Forgets the node, both as a site and as a dependency, such as when it
+   * is freed.
+   */
+  void remove(const void* node);
+
+  /**
+   * Number of nodes consulted by the last check of the site.
+   */
+  size_t dependencyCount(const void* site) const;
+
+private:
+  std::unordered_map<const void*, std::vector<const void*>> _nodesBySite;
+  std::unordered_map<const void*, std::unordered_set<const void*>> _sitesByNode;
+};
+
+} /* end namespace runtime */
+} /* end namespace sl */
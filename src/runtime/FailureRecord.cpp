@@ -0,0 +1,71 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/FailureRecord.h"
+
+#include <sstream>
+
+namespace sl {
+namespace runtime {
+
+// -----------------------------------------------------------------------------
+
+std::string
+describeFailure(const FailureRecord& record, const char* sourcePath,
+                const FailureRuleInfo* rules, size_t ruleCount)
+{
+  std::stringstream stream;
+  stream << sourcePath << ": ";
+
+  if (record.empty() || record.rule >= ruleCount) {
+    stream << "inference failed (unknown rule)";
+    return stream.str();
+  }
+
+  const auto& rule = rules[record.rule];
+  stream << rule.name << ": ";
+
+  if (record.premise >= rule.premiseCount) {
+    stream << "inference failed (unknown premise)";
+    return stream.str();
+  }
+
+  // Premises are numbered from 1 in messages.
+  stream << "premise " << record.premise + 1 << " failed: `"
+         << rule.premises[record.premise] << '`';
+
+  if (record.i != FailureRecord::kNone) {
+    stream << " (i = " << record.i;
+    if (record.j != FailureRecord::kNone) {
+      stream << ", j = " << record.j;
+    }
+    stream << ')';
+  }
+
+  return stream.str();
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace sl */
@@ -0,0 +1,93 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Compact record of why an inference failed, which synthesized code fills in
+ * when an inference group specifies the `FailureRecord` environment
+ * definition.
+ *
+ * Recording a failure only stores four integers: the index of the inference
+ * definition within its group, the index of the failed premise, and the loop
+ * indices at which a premise with a range clause failed. The text of the
+ * failed premise is only looked up when `describeFailure()` is called, so
+ * failures cost nothing more than an error code until they are reported.
+ */
+
+namespace sl {
+namespace runtime {
+
+struct FailureRecord
+{
+  static constexpr uint32_t kNone = UINT32_MAX;
+
+  uint32_t rule = kNone;
+  uint32_t premise = kNone;
+  uint32_t i = kNone;
+  uint32_t j = kNone;
+
+  void record(uint32_t rule_, uint32_t premise_, uint32_t i_ = kNone,
+              uint32_t j_ = kNone) noexcept
+  {
+    rule = rule_;
+    premise = premise_;
+    i = i_;
+    j = j_;
+  }
+
+  bool empty() const noexcept
+  {
+    return rule == kNone;
+  }
+
+  void clear() noexcept
+  {
+    record(kNone, kNone);
+  }
+};
+
+/**
+ * Source text of the premises of an inference definition, in the order they
+ * are written, which synthesized code provides to `describeFailure()`.
+ */
+struct FailureRuleInfo
+{
+  const char* name;
+  const char* const* premises;
+  size_t premiseCount;
+};
+
+/**
+ * Renders a failure record as a human-readable message, e.g.
+ *   "Input.sl: CallInference: premise 3 failed: `CalleeType = ExpectedType`"
+ */
+std::string describeFailure(const FailureRecord&, const char* sourcePath,
+                            const FailureRuleInfo* rules, size_t ruleCount);
+
+} /* end namespace runtime */
+} /* end namespace sl */
@@ -0,0 +1,50 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/Instrumentation.h"
+
+#include <ostream>
+
+namespace sl {
+namespace runtime {
+
+// -----------------------------------------------------------------------------
+
+void
+dumpRuleCounters(std::ostream& os, const char* clsName,
+                 const char* const* ruleNames, const RuleCounters* counters,
+                 size_t ruleCount)
+{
+  for (size_t i = 0; i < ruleCount; ++i) {
+    const auto& rule = counters[i];
+    os << clsName << "::" << ruleNames[i]
+       << " calls=" << rule.calls.load(std::memory_order_relaxed)
+       << " failures=" << rule.failures.load(std::memory_order_relaxed)
+       << " cycles=" << rule.cycles.load(std::memory_order_relaxed) << '\n';
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace sl */
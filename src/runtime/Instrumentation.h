@@ -0,0 +1,176 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define SL_RUNTIME_HAS_USDT 1
+#endif
+#endif
+
+/**
+ * Hooks that synthesized code places around each inference method when it is
+ * synthesized with `--emit-instrumentation`, and the counters they update.
+ *
+ * Every hook is a macro, so that it can be compiled out:
+ *
+ *   - `SL_INSTRUMENT_RULE(counters, rule)` starts each method. It counts the
+ *     call and adds the cycles spent in the method to `counters[rule]`.
+ *   - `SL_INSTRUMENT_FAILURE(counters, rule, premise)` precedes each failed
+ *     premise, and counts the failure.
+ *   - `SL_INSTRUMENT_PREMISE(rule, premise)` precedes each premise.
+ *
+ * The rule and failure hooks are enabled unless `SNOWLAKE_NO_INSTRUMENTATION`
+ * is defined. They cost a cycle counter read and a few relaxed atomic
+ * increments per call. The premise hooks are only enabled when
+ * `SNOWLAKE_INSTRUMENT_PREMISES` is defined.
+ *
+ * On Linux, when `<sys/sdt.h>` is available, the hooks also fire the USDT
+ * probes `snowlake:rule__entry`, `snowlake:rule__return`,
+ * `snowlake:rule__failure` and `snowlake:premise`, with the rule and premise
+ * indices as arguments. Probes are no-ops until a tracer attaches to them.
+ */
+
+#if defined(SL_RUNTIME_HAS_USDT)
+#define SL_RUNTIME_PROBE1(name, a) DTRACE_PROBE1(snowlake, name, a)
+#define SL_RUNTIME_PROBE2(name, a, b) DTRACE_PROBE2(snowlake, name, a, b)
+#else
+#define SL_RUNTIME_PROBE1(name, a) static_cast<void>(0)
+#define SL_RUNTIME_PROBE2(name, a, b) static_cast<void>(0)
+#endif
+
+#if !defined(SNOWLAKE_NO_INSTRUMENTATION)
+#define SL_INSTRUMENT_RULE(counters, rule)                                     \
+  ::sl::runtime::RuleScope slRuleScope((counters)[(rule)], (rule))
+#define SL_INSTRUMENT_FAILURE(counters, rule, premise)                         \
+  ::sl::runtime::recordRuleFailure((counters)[(rule)], (rule), (premise))
+#else
+#define SL_INSTRUMENT_RULE(counters, rule) static_cast<void>(0)
+#define SL_INSTRUMENT_FAILURE(counters, rule, premise) static_cast<void>(0)
+#endif
+
+#if defined(SNOWLAKE_INSTRUMENT_PREMISES)
+#define SL_INSTRUMENT_PREMISE(rule, premise)                                   \
+  SL_RUNTIME_PROBE2(premise, (rule), (premise))
+#else
+#define SL_INSTRUMENT_PREMISE(rule, premise) static_cast<void>(0)
+#endif
+
+namespace sl {
+namespace runtime {
+
+/**
+ * Counters of a single inference rule. Each is on a cache line of its own,
+ * since rules run concurrently when methods are given a context.
+ */
+struct alignas(64) RuleCounters
+{
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> failures{0};
+  std::atomic<uint64_t> cycles{0};
+};
+
+/**
+ * Reads the time stamp counter, or its closest equivalent on the target.
+ */
+inline uint64_t
+readCycleCounter() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t value;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+  return value;
+#else
+  return static_cast<uint64_t>(
+      std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ * Counts a call of a rule, and the cycles until the scope is left.
+ */
+class RuleScope
+{
+public:
+  RuleScope(RuleCounters& counters, uint32_t rule) noexcept
+    : _counters(counters)
+    , _rule(rule)
+    , _start(readCycleCounter())
+  {
+    SL_RUNTIME_PROBE1(rule__entry, _rule);
+  }
+
+  ~RuleScope()
+  {
+    const uint64_t cycles = readCycleCounter() - _start;
+    _counters.calls.fetch_add(1, std::memory_order_relaxed);
+    _counters.cycles.fetch_add(cycles, std::memory_order_relaxed);
+    SL_RUNTIME_PROBE2(rule__return, _rule, cycles);
+  }
+
+  RuleScope(const RuleScope&) = delete;
+  RuleScope& operator=(const RuleScope&) = delete;
+
+private:
+  RuleCounters& _counters;
+  uint32_t _rule;
+  uint64_t _start;
+};
+
+/**
+ * Counts a failure of a rule at the premise.
+ */
+inline void
+recordRuleFailure(RuleCounters& counters, uint32_t rule,
+                  uint32_t premise) noexcept
+{
+  counters.failures.fetch_add(1, std::memory_order_relaxed);
+  SL_RUNTIME_PROBE2(rule__failure, rule, premise);
+  static_cast<void>(rule);
+  static_cast<void>(premise);
+}
+
+/**
+ * Writes one line per rule with its counters, e.g.
+ *   "MyInference::CallInference calls=10 failures=2 cycles=12345"
+ */
+void dumpRuleCounters(std::ostream&, const char* clsName,
+                      const char* const* ruleNames,
+                      const RuleCounters* counters, size_t ruleCount);
+
+} /* end namespace runtime */
+} /* end namespace sl */
@@ -0,0 +1,224 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/ProofCache.h"
+
+namespace sl {
+namespace runtime {
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Number of slots probed for a node before giving up.
+const size_t kMaxProbeCount = 16;
+
+// Entry of a slot being reclaimed for another node. Its generation is 0,
+// which is never current.
+const uint64_t kReclaimedEntry = UINT32_MAX;
+
+size_t
+roundUpToPowerOfTwo(size_t n)
+{
+  size_t res = 1;
+  while (res < n) {
+    res <<= 1;
+  }
+  return res;
+}
+
+size_t
+hashNode(const void* node)
+{
+  // Finalizer of MurmurHash3, as nearby nodes differ in a few low bits only.
+  uint64_t h = reinterpret_cast<uintptr_t>(node);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return static_cast<size_t>(h);
+}
+
+uint64_t
+makeEntry(uint32_t generation, TypeHandle type)
+{
+  return (static_cast<uint64_t>(generation) << 32) | type.id();
+}
+
+} /* end anonymous namespace */
+
+// -----------------------------------------------------------------------------
+
+ProofCache::ProofCache(size_t pathCount, size_t slotsPerPath)
+  : _pathCount(pathCount)
+  , _slotsPerPath(roundUpToPowerOfTwo(slotsPerPath))
+  , _slots(new Slot[pathCount * _slotsPerPath])
+  , _generation(1)
+{
+  clear();
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+ProofCache::lookup(size_t path, const void* node, TypeHandle* type) const
+{
+  const Slot* slot = findSlot(path, node);
+  if (!slot) {
+    return false;
+  }
+  const uint64_t entry = slot->entry.load(std::memory_order_acquire);
+  // The slot may have been reclaimed for another node since it was found.
+  if (slot->node.load(std::memory_order_acquire) != node) {
+    return false;
+  }
+  if (static_cast<uint32_t>(entry >> 32) !=
+      _generation.load(std::memory_order_acquire)) {
+    return false;
+  }
+  *type = TypeHandle(static_cast<uint32_t>(entry));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+ProofCache::insert(size_t path, const void* node, TypeHandle type)
+{
+  if (path >= _pathCount || !node) {
+    return;
+  }
+
+  const uint32_t generation = _generation.load(std::memory_order_acquire);
+  const uint64_t newEntry = makeEntry(generation, type);
+
+  Slot* table = _slots.get() + path * _slotsPerPath;
+  const size_t mask = _slotsPerPath - 1;
+  size_t idx = hashNode(node) & mask;
+
+  for (size_t i = 0; i < kMaxProbeCount && i < _slotsPerPath; ++i) {
+    Slot& slot = table[idx];
+    const void* current = slot.node.load(std::memory_order_acquire);
+    // Another thread may claim the slot first, possibly for the same node.
+    if (!current &&
+        slot.node.compare_exchange_strong(current, node,
+                                          std::memory_order_acq_rel)) {
+      current = node;
+    }
+
+    uint64_t entry = slot.entry.load(std::memory_order_acquire);
+    if (current == node) {
+      // Give up if the slot is being, or has been, reclaimed for another
+      // node, which the compare-and-swap also guards against afterwards.
+      if (entry != kReclaimedEntry &&
+          slot.node.load(std::memory_order_acquire) == node) {
+        slot.entry.compare_exchange_strong(entry, newEntry,
+                                           std::memory_order_acq_rel);
+      }
+      return;
+    }
+
+    // A slot with a stale entry is reserved before it changes node, so that
+    // only one thread reclaims it, and its previous node can neither read
+    // nor write it meanwhile. Slots that have just been claimed, and have
+    // not been written to yet, are left to their node.
+    const uint32_t entryGeneration = static_cast<uint32_t>(entry >> 32);
+    if (entryGeneration && entryGeneration != generation &&
+        slot.entry.compare_exchange_strong(entry, kReclaimedEntry,
+                                           std::memory_order_acq_rel)) {
+      slot.node.store(node, std::memory_order_release);
+      slot.entry.store(newEntry, std::memory_order_release);
+      return;
+    }
+
+    idx = (idx + 1) & mask;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void
+ProofCache::invalidate()
+{
+  // Generation 0 marks slots that have never been written to.
+  uint32_t generation = _generation.load(std::memory_order_relaxed);
+  uint32_t next;
+  do {
+    next = generation + 1 ? generation + 1 : 1;
+  } while (!_generation.compare_exchange_weak(generation, next,
+                                              std::memory_order_acq_rel));
+}
+
+// -----------------------------------------------------------------------------
+
+uint32_t
+ProofCache::generation() const
+{
+  return _generation.load(std::memory_order_acquire);
+}
+
+// -----------------------------------------------------------------------------
+
+void
+ProofCache::clear()
+{
+  for (size_t i = 0; i < _pathCount * _slotsPerPath; ++i) {
+    _slots[i].node.store(nullptr, std::memory_order_relaxed);
+    _slots[i].entry.store(0, std::memory_order_relaxed);
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+
+const ProofCache::Slot*
+ProofCache::findSlot(size_t path, const void* node) const
+{
+  if (path >= _pathCount || !node) {
+    return nullptr;
+  }
+
+  const Slot* table = _slots.get() + path * _slotsPerPath;
+  const size_t mask = _slotsPerPath - 1;
+  size_t idx = hashNode(node) & mask;
+
+  for (size_t i = 0; i < kMaxProbeCount && i < _slotsPerPath; ++i) {
+    const Slot& slot = table[idx];
+    const void* current = slot.node.load(std::memory_order_acquire);
+    if (current == node) {
+      return &slot;
+    }
+    if (!current) {
+      return nullptr;
+    }
+    idx = (idx + 1) & mask;
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace sl */
@@ -0,0 +1,110 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include "runtime/TypeTable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * Concurrent cache of proof method results, which synthesized code consults
+ * before invoking the proof method when an inference group specifies the
+ * `ProofCache` environment definition.
+ *
+ * Results are keyed by the identity of the argument node the proof starts
+ * from, and by the ID of the member path followed from that node, which the
+ * synthesizer assigns statically to each distinct path in the group. Each
+ * path has a table of its own, so threads proving different paths never
+ * touch the same memory. Within a table, a slot is claimed for a node with
+ * a single compare-and-swap, so lookups and insertions are lock-free.
+ *
+ * Each entry is tagged with the generation it was inserted in. `invalidate()`
+ * starts a new generation, which makes every entry stale in constant time,
+ * and needs to be called whenever nodes are changed or freed. Results of
+ * proofs that are in flight while the cache is invalidated may still be
+ * inserted as current ones. Slots holding stale entries are reclaimed by the
+ * insertions of other nodes, so that the nodes of past generations do not
+ * keep them from being used.
+ */
+
+namespace sl {
+namespace runtime {
+
+class ProofCache
+{
+public:
+  /**
+   * Creates a cache for the given number of paths, with a fixed number of
+   * slots per path, rounded up to a power of two.
+   */
+  explicit ProofCache(size_t pathCount, size_t slotsPerPath = 1024);
+
+  ProofCache(const ProofCache&) = delete;
+  ProofCache& operator=(const ProofCache&) = delete;
+
+  /**
+   * Returns true and sets `type` if a result of the current generation is
+   * cached for the node and path.
+   */
+  bool lookup(size_t path, const void* node, TypeHandle* type) const;
+
+  /**
+   * Caches the result for the node and path. The result is dropped if the
+   * slots the node can occupy are all taken by current results of other
+   * nodes.
+   */
+  void insert(size_t path, const void* node, TypeHandle type);
+
+  /**
+   * Makes every cached result stale.
+   */
+  void invalidate();
+
+  uint32_t generation() const;
+
+  /**
+   * Releases every slot. Not safe to call concurrently with other methods.
+   */
+  void clear();
+
+private:
+  struct Slot
+  {
+    std::atomic<const void*> node;
+    std::atomic<uint64_t> entry;
+  };
+
+  const Slot* findSlot(size_t path, const void* node) const;
+
+  size_t _pathCount;
+  size_t _slotsPerPath;
+  std::unique_ptr<Slot[]> _slots;
+  std::atomic<uint32_t> _generation;
+};
+
+} /* end namespace runtime */
+} /* end namespace sl */
@@ -0,0 +1,109 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/SubtypeOracle.h"
+
+namespace sl {
+namespace runtime {
+
+// -----------------------------------------------------------------------------
+
+SubtypeOracle::SubtypeOracle()
+  : _indices()
+  , _words()
+  , _rowOffsets()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SubtypeOracle::addType(TypeHandle type,
+                       std::initializer_list<TypeHandle> supertypes)
+{
+  return addType(type, supertypes.begin(), supertypes.size());
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SubtypeOracle::addType(TypeHandle type, const TypeHandle* supertypes,
+                       size_t count)
+{
+  if (!type.isValid() || contains(type)) {
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (!contains(supertypes[i])) {
+      return false;
+    }
+  }
+
+  const uint32_t idx = static_cast<uint32_t>(_rowOffsets.size());
+  const size_t offset = _words.size();
+  const size_t wordCount = idx / 64 + 1;
+
+  _words.resize(offset + wordCount, 0);
+
+  // The ancestors of a type are the union of those of its supertypes,
+  // plus the type itself.
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t superIdx = indexOf(supertypes[i]);
+    const size_t superOffset = _rowOffsets[superIdx];
+    const size_t superWordCount = superIdx / 64 + 1;
+    for (size_t k = 0; k < superWordCount; ++k) {
+      _words[offset + k] |= _words[superOffset + k];
+    }
+  }
+  _words[offset + idx / 64] |= uint64_t(1) << (idx % 64);
+
+  _rowOffsets.push_back(offset);
+
+  if (type.id() >= _indices.size()) {
+    _indices.resize(type.id() + 1, kUnregistered);
+  }
+  _indices[type.id()] = idx;
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+SubtypeOracle::contains(TypeHandle type) const
+{
+  return indexOf(type) != kUnregistered;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+SubtypeOracle::size() const
+{
+  return _rowOffsets.size();
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace sl */
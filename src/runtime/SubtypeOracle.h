@@ -0,0 +1,114 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include "runtime/TypeTable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+/**
+ * Constant-time subtype queries over a registered type hierarchy, which
+ * synthesized code calls for `<` and `<=` premises when an inference group
+ * specifies the `SubtypeOracle` environment definition.
+ *
+ * Each registered type is encoded as a bit-vector of its ancestors,
+ * including itself. Since the supertypes of a type need to be registered
+ * before the type itself, the ancestors of the n-th type are all among the
+ * first n types, and its bit-vector only needs n bits. Registering a type
+ * costs time linear in the number of types registered before it; a query
+ * tests a single bit. Multiple supertypes are supported.
+ */
+
+namespace sl {
+namespace runtime {
+
+class SubtypeOracle
+{
+public:
+  SubtypeOracle();
+
+  /**
+   * Registers the type as a direct subtype of the given supertypes, which
+   * need to be registered already. Returns false, without registering the
+   * type, if it is registered already or any of the supertypes is not.
+   */
+  bool addType(TypeHandle type,
+               std::initializer_list<TypeHandle> supertypes = {});
+
+  bool addType(TypeHandle type, const TypeHandle* supertypes, size_t count);
+
+  bool contains(TypeHandle) const;
+
+  /**
+   * Whether `sub` is `super` or one of its transitive subtypes.
+   */
+  bool isSubtype(TypeHandle sub, TypeHandle super) const
+  {
+    if (sub == super) {
+      return true;
+    }
+    const uint32_t subIdx = indexOf(sub);
+    const uint32_t superIdx = indexOf(super);
+    if (subIdx == kUnregistered || superIdx == kUnregistered ||
+        superIdx > subIdx) {
+      return false;
+    }
+    const uint64_t word = _words[_rowOffsets[subIdx] + superIdx / 64];
+    return (word >> (superIdx % 64)) & 1;
+  }
+
+  /**
+   * Whether `sub` is one of the transitive subtypes of `super`.
+   */
+  bool isProperSubtype(TypeHandle sub, TypeHandle super) const
+  {
+    return sub != super && isSubtype(sub, super);
+  }
+
+  /**
+   * Number of types registered.
+   */
+  size_t size() const;
+
+private:
+  static constexpr uint32_t kUnregistered = UINT32_MAX;
+
+  uint32_t indexOf(TypeHandle type) const
+  {
+    return type.id() < _indices.size() ? _indices[type.id()] : kUnregistered;
+  }
+
+  // Maps handle IDs to registration order.
+  std::vector<uint32_t> _indices;
+
+  // Ancestor bit-vectors of all registered types, back to back.
+  std::vector<uint64_t> _words;
+  std::vector<size_t> _rowOffsets;
+};
+
+} /* end namespace runtime */
+} /* end namespace sl */
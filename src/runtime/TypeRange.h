@@ -0,0 +1,291 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * Reference implementation of the batched type comparison contract that
+ * synthesized code calls for `inrange` clauses when the `TypeRangeCmpMethod`
+ * environment definition is specified:
+ *
+ *   cmpTypeRange(lhs, lhsOffset, rhs, rhsOffset, count, op)
+ *
+ * It returns true if `op(lhs[lhsOffset + k], rhs[rhsOffset + k])` holds for
+ * every `k` in `[0, count)`.
+ *
+ * When the type class is a 32-bit integer type ID held in contiguous storage
+ * and `op` is one of the standard comparison functors, the comparison is
+ * vectorized with AVX2 or SSE2, whichever the translation unit is compiled
+ * for. Otherwise it falls back to a scalar loop over `op`.
+ */
+
+namespace sl {
+namespace runtime {
+
+namespace detail {
+
+enum class TypeRangeCmpKind : uint32_t
+{
+  kUnknown = 0x00,
+  kEqualTo,
+  kNotEqualTo,
+  kLess,
+  kLessEqual,
+  kGreater,
+  kGreaterEqual,
+};
+
+template <typename Compare>
+struct TypeRangeCmpKindOf
+  : std::integral_constant<TypeRangeCmpKind, TypeRangeCmpKind::kUnknown>
+{
+};
+
+// clang-format off
+template <typename T> struct TypeRangeCmpKindOf<std::equal_to<T>>      : std::integral_constant<TypeRangeCmpKind, TypeRangeCmpKind::kEqualTo> {};
+template <typename T> struct TypeRangeCmpKindOf<std::not_equal_to<T>>  : std::integral_constant<TypeRangeCmpKind, TypeRangeCmpKind::kNotEqualTo> {};
+template <typename T> struct TypeRangeCmpKindOf<std::less<T>>          : std::integral_constant<TypeRangeCmpKind, TypeRangeCmpKind::kLess> {};
+template <typename T> struct TypeRangeCmpKindOf<std::less_equal<T>>    : std::integral_constant<TypeRangeCmpKind, TypeRangeCmpKind::kLessEqual> {};
+template <typename T> struct TypeRangeCmpKindOf<std::greater<T>>       : std::integral_constant<TypeRangeCmpKind, TypeRangeCmpKind::kGreater> {};
+template <typename T> struct TypeRangeCmpKindOf<std::greater_equal<T>> : std::integral_constant<TypeRangeCmpKind, TypeRangeCmpKind::kGreaterEqual> {};
+// clang-format on
+
+template <typename Compare, typename T>
+struct IsCmpOnType : std::false_type
+{
+};
+
+template <template <typename> class Compare, typename T>
+struct IsCmpOnType<Compare<T>, T> : std::true_type
+{
+};
+
+template <template <typename> class Compare, typename T>
+struct IsCmpOnType<Compare<void>, T> : std::true_type
+{
+};
+
+template <typename Range>
+using TypeRangeValueType =
+    std::remove_cv_t<std::remove_reference_t<decltype(*std::data(
+        std::declval<const Range&>()))>>;
+
+template <typename Range, typename = void>
+struct IsContiguousTypeRange : std::false_type
+{
+};
+
+template <typename Range>
+struct IsContiguousTypeRange<
+    Range, std::void_t<decltype(std::data(std::declval<const Range&>()))>>
+  : std::true_type
+{
+};
+
+template <typename T>
+struct IsTypeId
+  : std::integral_constant<bool, std::is_integral<T>::value &&
+                                     sizeof(T) == sizeof(uint32_t)>
+{
+};
+
+/**
+ * Each comparison is reduced to one of three lane predicates: a == b, a < b
+ * or a > b. The range compares true if the predicate holds in every lane, or
+ * for the complementary comparisons, in no lane at all.
+ */
+enum class TypeIdLanePredicate : uint32_t
+{
+  kEqual,
+  kLess,
+  kGreater,
+};
+
+template <typename T>
+inline bool
+evalTypeIdLanePredicate(TypeIdLanePredicate predicate, T a, T b)
+{
+  switch (predicate) {
+    case TypeIdLanePredicate::kEqual:
+      return a == b;
+    case TypeIdLanePredicate::kLess:
+      return a < b;
+    case TypeIdLanePredicate::kGreater:
+      return a > b;
+  }
+  return false;
+}
+
+template <typename T>
+bool
+cmpTypeIdRange(const T* lhs, const T* rhs, size_t count,
+               TypeIdLanePredicate predicate, bool expected)
+{
+  size_t k = 0;
+
+#if defined(__AVX2__)
+  {
+    // Unsigned IDs are biased into signed range for the signed compare.
+    const __m256i bias = _mm256_set1_epi32(
+        std::is_signed<T>::value ? 0 : static_cast<int32_t>(0x80000000u));
+    const int expectedMask = expected ? 0xFF : 0x00;
+    for (; k + 8 <= count; k += 8) {
+      const __m256i a = _mm256_xor_si256(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + k)), bias);
+      const __m256i b = _mm256_xor_si256(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + k)), bias);
+      __m256i res;
+      switch (predicate) {
+        case TypeIdLanePredicate::kEqual:
+          res = _mm256_cmpeq_epi32(a, b);
+          break;
+        case TypeIdLanePredicate::kLess:
+          res = _mm256_cmpgt_epi32(b, a);
+          break;
+        case TypeIdLanePredicate::kGreater:
+        default:
+          res = _mm256_cmpgt_epi32(a, b);
+          break;
+      }
+      if (_mm256_movemask_ps(_mm256_castsi256_ps(res)) != expectedMask) {
+        return false;
+      }
+    }
+  }
+#elif defined(__SSE2__)
+  {
+    const __m128i bias = _mm_set1_epi32(
+        std::is_signed<T>::value ? 0 : static_cast<int32_t>(0x80000000u));
+    const int expectedMask = expected ? 0x0F : 0x00;
+    for (; k + 4 <= count; k += 4) {
+      const __m128i a = _mm_xor_si128(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + k)), bias);
+      const __m128i b = _mm_xor_si128(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + k)), bias);
+      __m128i res;
+      switch (predicate) {
+        case TypeIdLanePredicate::kEqual:
+          res = _mm_cmpeq_epi32(a, b);
+          break;
+        case TypeIdLanePredicate::kLess:
+          res = _mm_cmplt_epi32(a, b);
+          break;
+        case TypeIdLanePredicate::kGreater:
+        default:
+          res = _mm_cmpgt_epi32(a, b);
+          break;
+      }
+      if (_mm_movemask_ps(_mm_castsi128_ps(res)) != expectedMask) {
+        return false;
+      }
+    }
+  }
+#endif
+
+  for (; k < count; ++k) {
+    if (evalTypeIdLanePredicate(predicate, lhs[k], rhs[k]) != expected) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename T>
+bool
+cmpTypeIdRange(const T* lhs, const T* rhs, size_t count, TypeRangeCmpKind kind)
+{
+  switch (kind) {
+    case TypeRangeCmpKind::kEqualTo:
+      return cmpTypeIdRange(lhs, rhs, count, TypeIdLanePredicate::kEqual, true);
+    case TypeRangeCmpKind::kNotEqualTo:
+      return cmpTypeIdRange(lhs, rhs, count, TypeIdLanePredicate::kEqual,
+                            false);
+    case TypeRangeCmpKind::kLess:
+      return cmpTypeIdRange(lhs, rhs, count, TypeIdLanePredicate::kLess, true);
+    case TypeRangeCmpKind::kLessEqual:
+      return cmpTypeIdRange(lhs, rhs, count, TypeIdLanePredicate::kGreater,
+                            false);
+    case TypeRangeCmpKind::kGreater:
+      return cmpTypeIdRange(lhs, rhs, count, TypeIdLanePredicate::kGreater,
+                            true);
+    case TypeRangeCmpKind::kGreaterEqual:
+      return cmpTypeIdRange(lhs, rhs, count, TypeIdLanePredicate::kLess,
+                            false);
+    default:
+      break;
+  }
+  return false;
+}
+
+} /* end namespace detail */
+
+// -----------------------------------------------------------------------------
+
+template <typename LhsRange, typename RhsRange, typename Compare>
+bool
+cmpTypeRange(const LhsRange& lhs, size_t lhsOffset, const RhsRange& rhs,
+             size_t rhsOffset, size_t count, Compare cmp)
+{
+  using namespace detail;
+
+  constexpr TypeRangeCmpKind kind = TypeRangeCmpKindOf<Compare>::value;
+
+  if constexpr (kind != TypeRangeCmpKind::kUnknown &&
+                IsContiguousTypeRange<LhsRange>::value &&
+                IsContiguousTypeRange<RhsRange>::value) {
+    using LhsValueType = TypeRangeValueType<LhsRange>;
+    using RhsValueType = TypeRangeValueType<RhsRange>;
+    if constexpr (IsTypeId<LhsValueType>::value &&
+                  std::is_same<LhsValueType, RhsValueType>::value &&
+                  IsCmpOnType<Compare, LhsValueType>::value) {
+      return cmpTypeIdRange(std::data(lhs) + lhsOffset,
+                            std::data(rhs) + rhsOffset, count, kind);
+    }
+  }
+
+  for (size_t k = 0; k < count; ++k) {
+    if (!cmp(lhs[lhsOffset + k], rhs[rhsOffset + k])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace sl */
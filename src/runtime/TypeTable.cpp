@@ -0,0 +1,214 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/TypeTable.h"
+
+#include <cassert>
+
+namespace sl {
+namespace runtime {
+
+// -----------------------------------------------------------------------------
+
+static const size_t kInitialSlotCount = 64;
+
+// -----------------------------------------------------------------------------
+
+static inline uint32_t
+mixHash(uint32_t h, uint32_t value)
+{
+  // 32-bit finalizer of MurmurHash3, applied to each element in turn.
+  h ^= value;
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+// -----------------------------------------------------------------------------
+
+static uint32_t
+hashNode(uint32_t constructorId, const TypeHandle* arguments, size_t count)
+{
+  uint32_t h = mixHash(0x9e3779b9u, constructorId);
+  for (size_t i = 0; i < count; ++i) {
+    h = mixHash(h, arguments[i].id());
+  }
+  return mixHash(h, static_cast<uint32_t>(count));
+}
+
+// -----------------------------------------------------------------------------
+
+TypeTable::TypeTable()
+  : _constructors()
+  , _constructorIds()
+  , _nodes()
+  , _arguments()
+  , _slots(kInitialSlotCount, 0)
+{
+  // Index 0 is reserved for the invalid handle.
+  _nodes.push_back(TypeNode{0, 0, 0, 0});
+}
+
+// -----------------------------------------------------------------------------
+
+TypeHandle
+TypeTable::intern(const std::string& name)
+{
+  return intern(name, nullptr, 0);
+}
+
+// -----------------------------------------------------------------------------
+
+TypeHandle
+TypeTable::intern(const std::string& constructor,
+                  std::initializer_list<TypeHandle> arguments)
+{
+  return intern(constructor, arguments.begin(), arguments.size());
+}
+
+// -----------------------------------------------------------------------------
+
+TypeHandle
+TypeTable::intern(const std::string& constructor, const TypeHandle* arguments,
+                  size_t count)
+{
+  const uint32_t constructorId = internConstructor(constructor);
+  const uint32_t hash = hashNode(constructorId, arguments, count);
+
+  const size_t mask = _slots.size() - 1;
+  size_t slot = hash & mask;
+  while (_slots[slot] != 0) {
+    const TypeNode& node = _nodes[_slots[slot]];
+    if (node.hash == hash &&
+        isSameNode(node, constructorId, arguments, count)) {
+      return TypeHandle(_slots[slot]);
+    }
+    slot = (slot + 1) & mask;
+  }
+
+  const uint32_t id = static_cast<uint32_t>(_nodes.size());
+  _nodes.push_back(TypeNode{constructorId,
+                            static_cast<uint32_t>(_arguments.size()),
+                            static_cast<uint32_t>(count), hash});
+  _arguments.insert(_arguments.end(), arguments, arguments + count);
+  _slots[slot] = id;
+
+  // Keep the load factor at or below one half.
+  if (_nodes.size() * 2 > _slots.size()) {
+    grow();
+  }
+
+  return TypeHandle(id);
+}
+
+// -----------------------------------------------------------------------------
+
+const std::string&
+TypeTable::constructorOf(TypeHandle handle) const
+{
+  assert(handle.isValid() && handle.id() < _nodes.size());
+  return _constructors[_nodes[handle.id()].constructorId];
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+TypeTable::arityOf(TypeHandle handle) const
+{
+  assert(handle.isValid() && handle.id() < _nodes.size());
+  return _nodes[handle.id()].argumentCount;
+}
+
+// -----------------------------------------------------------------------------
+
+TypeHandle
+TypeTable::argumentOf(TypeHandle handle, size_t index) const
+{
+  assert(index < arityOf(handle));
+  return _arguments[_nodes[handle.id()].argumentOffset + index];
+}
+
+// -----------------------------------------------------------------------------
+
+size_t
+TypeTable::size() const
+{
+  return _nodes.size() - 1;
+}
+
+// -----------------------------------------------------------------------------
+
+uint32_t
+TypeTable::internConstructor(const std::string& constructor)
+{
+  const auto itr = _constructorIds.find(constructor);
+  if (itr != _constructorIds.cend()) {
+    return itr->second;
+  }
+  const uint32_t id = static_cast<uint32_t>(_constructors.size());
+  _constructors.push_back(constructor);
+  _constructorIds.emplace(constructor, id);
+  return id;
+}
+
+// -----------------------------------------------------------------------------
+
+bool
+TypeTable::isSameNode(const TypeNode& node, uint32_t constructorId,
+                      const TypeHandle* arguments, size_t count) const
+{
+  if (node.constructorId != constructorId || node.argumentCount != count) {
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (_arguments[node.argumentOffset + i] != arguments[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+void
+TypeTable::grow()
+{
+  std::vector<uint32_t> slots(_slots.size() * 2, 0);
+  const size_t mask = slots.size() - 1;
+  for (uint32_t id = 1; id < _nodes.size(); ++id) {
+    size_t slot = _nodes[id].hash & mask;
+    while (slots[slot] != 0) {
+      slot = (slot + 1) & mask;
+    }
+    slots[slot] = id;
+  }
+  _slots.swap(slots);
+}
+
+// -----------------------------------------------------------------------------
+
+} /* end namespace runtime */
+} /* end namespace sl */
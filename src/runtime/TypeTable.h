@@ -0,0 +1,200 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Interned type representation that synthesized code targets when an
+ * inference group specifies the `TypeRuntime : snowlake;` environment
+ * definition.
+ *
+ * Types are referred to by `TypeHandle`, a 32-bit index into the
+ * `TypeTable` that interned them. Structural types, i.e. a type constructor
+ * applied to argument types, are hash-consed, so two handles from the same
+ * table refer to structurally equal types if and only if they are equal,
+ * and type equality is a single integer comparison.
+ *
+ * The default constructed handle refers to no type, which is what
+ * synthesized code returns on failure.
+ */
+
+namespace sl {
+namespace runtime {
+
+class TypeHandle
+{
+public:
+  constexpr TypeHandle()
+    : _id(0)
+  {
+  }
+
+  constexpr explicit TypeHandle(uint32_t id)
+    : _id(id)
+  {
+  }
+
+  constexpr uint32_t id() const
+  {
+    return _id;
+  }
+
+  constexpr bool isValid() const
+  {
+    return _id != 0;
+  }
+
+private:
+  uint32_t _id;
+};
+
+// -----------------------------------------------------------------------------
+
+constexpr bool
+operator==(TypeHandle lhs, TypeHandle rhs)
+{
+  return lhs.id() == rhs.id();
+}
+
+constexpr bool
+operator!=(TypeHandle lhs, TypeHandle rhs)
+{
+  return lhs.id() != rhs.id();
+}
+
+// -----------------------------------------------------------------------------
+
+class TypeTable
+{
+public:
+  TypeTable();
+
+  /**
+   * Interns the nominal type with the given name, such as `int`.
+   */
+  TypeHandle intern(const std::string& name);
+
+  /**
+   * Interns the type constructor applied to the given argument types,
+   * such as `pointer(int)` or `function(int, bool)`. Returns the existing
+   * handle if a structurally equal type has been interned already.
+   */
+  TypeHandle intern(const std::string& constructor,
+                    std::initializer_list<TypeHandle> arguments);
+
+  TypeHandle intern(const std::string& constructor,
+                    const TypeHandle* arguments, size_t count);
+
+  const std::string& constructorOf(TypeHandle) const;
+
+  size_t arityOf(TypeHandle) const;
+
+  TypeHandle argumentOf(TypeHandle, size_t index) const;
+
+  /**
+   * Number of distinct types interned.
+   */
+  size_t size() const;
+
+private:
+  struct TypeNode
+  {
+    uint32_t constructorId;
+    uint32_t argumentOffset;
+    uint32_t argumentCount;
+    uint32_t hash;
+  };
+
+  uint32_t internConstructor(const std::string&);
+
+  bool isSameNode(const TypeNode&, uint32_t constructorId,
+                  const TypeHandle* arguments, size_t count) const;
+
+  void grow();
+
+  std::vector<std::string> _constructors;
+  std::unordered_map<std::string, uint32_t> _constructorIds;
+  std::vector<TypeNode> _nodes;
+  std::vector<TypeHandle> _arguments;
+
+  // Open addressing hash index into `_nodes`, where 0 marks an empty slot.
+  std::vector<uint32_t> _slots;
+};
+
+// -----------------------------------------------------------------------------
+
+/**
+ * Type comparison for interned types, for use as the `TypeCmpMethod`.
+ * Only equality is defined on handles themselves; ordering comparisons
+ * require a subtype relation, and do not compile against handles.
+ * Computed targets are compared with the transparent `std::equal_to<>`.
+ */
+inline bool
+cmpType(TypeHandle lhs, TypeHandle rhs, std::equal_to<TypeHandle>)
+{
+  return lhs == rhs;
+}
+
+inline bool
+cmpType(TypeHandle lhs, TypeHandle rhs, std::not_equal_to<TypeHandle>)
+{
+  return lhs != rhs;
+}
+
+inline bool
+cmpType(TypeHandle lhs, TypeHandle rhs, std::equal_to<>)
+{
+  return lhs == rhs;
+}
+
+inline bool
+cmpType(TypeHandle lhs, TypeHandle rhs, std::not_equal_to<>)
+{
+  return lhs != rhs;
+}
+
+} /* end namespace runtime */
+} /* end namespace sl */
+
+// -----------------------------------------------------------------------------
+
+namespace std {
+
+template <>
+struct hash<sl::runtime::TypeHandle>
+{
+  size_t operator()(sl::runtime::TypeHandle handle) const noexcept
+  {
+    return std::hash<uint32_t>()(handle.id());
+  }
+};
+
+} /* end namespace std */
@@ -0,0 +1,211 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Reference implementation of the executor contract that the batch entry
+ * points synthesized with the `ContextClass` environment definition call:
+ *
+ *   executor.parallelFor(count, fn)
+ *
+ * which invokes `fn(i, ctx)` exactly once for every `i` in `[0, count)`,
+ * where `ctx` is the context of the worker running it, and returns when
+ * all invocations have returned.
+ *
+ * There is one worker per context, and the calling thread is the first one.
+ * The other workers are threads started once by the constructor, which wait
+ * for batches in between, so a batch costs a wake-up of the workers it uses
+ * rather than the start of a thread each. The indices are split evenly
+ * among the workers. Each worker claims the indices of its own share one at
+ * a time, and then steals the remaining ones of the other shares, so a share
+ * of expensive call sites does not hold up the batch. `fn` must not throw.
+ * Batches are run one at a time, so `parallelFor` must not be called from
+ * several threads at once.
+ */
+
+namespace sl {
+namespace runtime {
+
+template <typename Context>
+class WorkStealingExecutor
+{
+public:
+  /**
+   * There must be at least one context, and their number must not change
+   * for the lifetime of the executor.
+   */
+  explicit WorkStealingExecutor(std::vector<Context>* contexts)
+    : _contexts(contexts)
+    , _mutex()
+    , _batchStarted()
+    , _batchDone()
+    , _generation(0)
+    , _batchWorkerCount(0)
+    , _pendingWorkerCount(0)
+    , _batch(nullptr)
+    , _runBatch(nullptr)
+    , _stopping(false)
+    , _threads()
+  {
+    assert(!_contexts->empty());
+    _threads.reserve(_contexts->size() - 1);
+    for (size_t w = 1; w < _contexts->size(); ++w) {
+      _threads.emplace_back(&WorkStealingExecutor::runWorker, this, w);
+    }
+  }
+
+  WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+  WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+  ~WorkStealingExecutor()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stopping = true;
+    }
+    _batchStarted.notify_all();
+    for (auto& thread : _threads) {
+      thread.join();
+    }
+  }
+
+  template <typename Fn>
+  void parallelFor(size_t count, Fn&& fn)
+  {
+    if (count == 0) {
+      return;
+    }
+
+    const size_t workerCount = std::min(_contexts->size(), count);
+
+    std::unique_ptr<Share[]> shares(new Share[workerCount]);
+    for (size_t w = 0; w < workerCount; ++w) {
+      shares[w].next.store(count * w / workerCount, std::memory_order_relaxed);
+      shares[w].end = count * (w + 1) / workerCount;
+    }
+
+    auto work = [&](size_t w) {
+      Context& ctx = (*_contexts)[w];
+      // The worker's own share first, then the others in turn.
+      for (size_t k = 0; k < workerCount; ++k) {
+        Share& share = shares[(w + k) % workerCount];
+        for (;;) {
+          const size_t i = share.next.fetch_add(1, std::memory_order_relaxed);
+          if (i >= share.end) {
+            break;
+          }
+          fn(i, ctx);
+        }
+      }
+    };
+
+    if (workerCount == 1) {
+      work(0);
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _batch = &work;
+      _runBatch = &RunBatch<decltype(work)>;
+      _batchWorkerCount = workerCount;
+      _pendingWorkerCount = workerCount - 1;
+      ++_generation;
+    }
+    _batchStarted.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _batchDone.wait(lock, [this] { return _pendingWorkerCount == 0; });
+    _batch = nullptr;
+  }
+
+private:
+  struct Share
+  {
+    std::atomic<size_t> next;
+    size_t end;
+  };
+
+  template <typename Work>
+  static void RunBatch(void* batch, size_t w)
+  {
+    (*static_cast<Work*>(batch))(w);
+  }
+
+  void runWorker(size_t w)
+  {
+    uint64_t generation = 0;
+    std::unique_lock<std::mutex> lock(_mutex);
+    for (;;) {
+      _batchStarted.wait(lock, [this, generation] {
+        return _stopping || _generation != generation;
+      });
+      if (_stopping) {
+        return;
+      }
+      generation = _generation;
+      // Batches with fewer indices than workers leave the last ones idle.
+      if (w >= _batchWorkerCount) {
+        continue;
+      }
+      void* batch = _batch;
+      void (*runBatch)(void*, size_t) = _runBatch;
+      lock.unlock();
+      runBatch(batch, w);
+      lock.lock();
+      if (--_pendingWorkerCount == 0) {
+        _batchDone.notify_one();
+      }
+    }
+  }
+
+  std::vector<Context>* _contexts;
+  std::mutex _mutex;
+  std::condition_variable _batchStarted;
+  std::condition_variable _batchDone;
+  // Incremented for every batch that runs on more than the calling thread.
+  uint64_t _generation;
+  size_t _batchWorkerCount;
+  size_t _pendingWorkerCount;
+  void* _batch;
+  void (*_runBatch)(void*, size_t);
+  bool _stopping;
+  std::vector<std::thread> _threads;
+};
+
+} /* end namespace runtime */
+} /* end namespace sl */
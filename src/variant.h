@@ -57,17 +57,18 @@ private:
     auto lhs_type_index = lhs._type_index;
     auto rhs_type_index = rhs._type_index;
 
-    // Create a temporary copy of the data storage.
+    // Move rhs data -> tmp data, lhs data -> rhs data, and tmp data -> lhs
+    // data, destroying each moved-from value, so that no value is copied.
     data_type tmpData;
 
-    // Copy rhs data -> tmp data
-    helper_type::copy(rhs_type_index, &rhs._data, &tmpData);
+    helper_type::move(rhs_type_index, &rhs._data, &tmpData);
+    helper_type::destroy(rhs_type_index, &rhs._data);
 
-    // Copy lhs data -> rhs data
-    helper_type::copy(lhs_type_index, &lhs._data, &rhs._data);
+    helper_type::move(lhs_type_index, &lhs._data, &rhs._data);
+    helper_type::destroy(lhs_type_index, &lhs._data);
 
-    // Copy tmp data -> lhs data
-    helper_type::copy(rhs_type_index, &tmpData, &lhs._data);
+    helper_type::move(rhs_type_index, &tmpData, &lhs._data);
+    helper_type::destroy(rhs_type_index, &tmpData);
 
     // Then we can swap the indices.
     std::swap(lhs._type_index, rhs._type_index);
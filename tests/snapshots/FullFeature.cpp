@@ -13,24 +13,24 @@ FullFeature::MethodStaticDispatch(const ASTExpr& StaticMethodCallStmt, std::erro
 
     std::vector<TypeCls> ParameterTypes = proveType(StaticMethodCallStmt.callee.parameter_types);
 
-    for (size_t i = 0, size_t j = 1; i < ParameterTypes.size(); ++i, ++j) {
+    for (size_t i = 0, j = 1; i < ParameterTypes.size(); ++i, ++j) {
         if (!cmpType(ArgumentsTypes[i], ParameterTypes[j], std::less_equal<TypeCls>())) {
-            *err = std::error_code(0, inference_error_category);
+            *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);
             return TypeCls();
         }
     }
 
     if (!cmpType(ArgumentsTypes, SELF_TYPE, std::not_equal_to<TypeCls>())) {
-        *err = std::error_code(0, inference_error_category);
+        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);
         return TypeCls();
     }
 
     // Type annotation setup.
     typeAnnotationSetup(StaticMethodCallStmt.caller_type, CLS_TYPE);
 
-    for (size_t i = 1, size_t j = 1; i < ParameterTypes.size(); ++i, ++j) {
+    for (size_t i = 1, j = 1; i < ParameterTypes.size(); ++i, ++j) {
         if (!cmpType(ArgumentsTypes[i], ParameterTypes[j], std::less_equal<TypeCls>())) {
-            *err = std::error_code(0, inference_error_category);
+            *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);
             return TypeCls();
         }
     }
@@ -38,7 +38,7 @@ FullFeature::MethodStaticDispatch(const ASTExpr& StaticMethodCallStmt, std::erro
     TypeCls var0 = getBaseType();
     TypeCls var1 = proveType(StaticMethodCallStmt.return_caller_type);
     if (!cmpType(var0, var1, std::equal_to<>())) {
-        *err = std::error_code(0, inference_error_category);
+        *err = std::error_code(InferenceErrorInferredTypeMismatch, inference_error_category);
         return TypeCls();
     }
 
@@ -48,7 +48,7 @@ FullFeature::MethodStaticDispatch(const ASTExpr& StaticMethodCallStmt, std::erro
     TypeCls var2 = getBaseType();
     TypeCls var3 = proveType(StaticMethodCallStmt.caller_type);
     if (!cmpType(var2, var3, std::equal_to<>())) {
-        *err = std::error_code(0, inference_error_category);
+        *err = std::error_code(InferenceErrorInferredTypeMismatch, inference_error_category);
         return TypeCls();
     }
 
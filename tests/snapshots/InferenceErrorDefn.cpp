@@ -17,6 +17,8 @@ class InferenceErrorCategory : public std::error_category
                 return "Inferred type does not match with expected.";
             case InferenceErrorTypeComparisonFailed:
                 return "Type comparison failed.";
+            case InferenceErrorNoApplicableRule:
+                return "No applicable inference rule.";
             default:
                 return "Inference failed (unknown error).";
         }
@@ -7,6 +7,7 @@ enum InferenceError
 {
     InferenceErrorInferredTypeMismatch = 0x01,
     InferenceErrorTypeComparisonFailed,
+    InferenceErrorNoApplicableRule,
 };
 
 class InferenceErrorCategory;
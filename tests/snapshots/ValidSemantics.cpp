@@ -12,7 +12,7 @@ ValidSemantics::MethodStaticDispatch(const ASTExpr& StaticMethodCallStmt, std::e
     std::vector<TypeCls> ArgumentsTypes = proveType(StaticMethodCallStmt.argument_types);
 
     if (!cmpType(ArgumentsTypes, SELF_TYPE, std::not_equal_to<TypeCls>())) {
-        *err = std::error_code(0, inference_error_category);
+        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);
         return TypeCls();
     }
     return lub(T1, T2);
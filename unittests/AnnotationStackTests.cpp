@@ -0,0 +1,130 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/AnnotationStack.h"
+
+#include <gtest/gtest.h>
+
+// -----------------------------------------------------------------------------
+
+using sl::runtime::AnnotationScope;
+using sl::runtime::AnnotationStack;
+
+// -----------------------------------------------------------------------------
+
+class AnnotationStackTests : public ::testing::Test
+{
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AnnotationStackTests, TestInnermostAnnotationIsFound)
+{
+  AnnotationStack<int> stack;
+
+  int node1 = 0;
+  int node2 = 0;
+
+  ASSERT_EQ(nullptr, stack.find(&node1));
+
+  stack.push(&node1, 1);
+  stack.push(&node2, 2);
+  stack.push(&node1, 3);
+
+  ASSERT_EQ(3, *stack.find(&node1));
+  ASSERT_EQ(2, *stack.find(&node2));
+  ASSERT_EQ(3, stack.size());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AnnotationStackTests, TestRollbackToMark)
+{
+  AnnotationStack<int> stack;
+
+  int node = 0;
+
+  stack.push(&node, 1);
+  const auto mark = stack.mark();
+  stack.push(&node, 2);
+  stack.push(&node, 3);
+
+  stack.rollback(mark);
+
+  ASSERT_EQ(1, stack.size());
+  ASSERT_EQ(1, *stack.find(&node));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AnnotationStackTests, TestNestedScopes)
+{
+  AnnotationStack<int> stack;
+
+  int node = 0;
+
+  {
+    AnnotationScope<int> outer(stack);
+    stack.push(&node, 1);
+    {
+      AnnotationScope<int> inner(stack);
+      stack.push(&node, 2);
+      ASSERT_EQ(2, *stack.find(&node));
+    }
+    ASSERT_EQ(1, *stack.find(&node));
+
+    outer.rollback();
+    ASSERT_EQ(nullptr, stack.find(&node));
+
+    // Annotations pushed after an explicit rollback are not the scope's.
+    stack.push(&node, 3);
+  }
+
+  ASSERT_EQ(1, stack.size());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(AnnotationStackTests, TestScopeRollsBackOnEarlyReturn)
+{
+  AnnotationStack<int> stack;
+
+  int node = 0;
+
+  auto check = [&stack, &node](bool fail) {
+    AnnotationScope<int> scope(stack);
+    stack.push(&node, 1);
+    if (fail) {
+      return false;
+    }
+    scope.rollback();
+    return true;
+  };
+
+  ASSERT_FALSE(check(true));
+  ASSERT_EQ(0, stack.size());
+  ASSERT_TRUE(check(false));
+  ASSERT_EQ(0, stack.size());
+}
+
+// -----------------------------------------------------------------------------
@@ -607,3 +607,28 @@ TEST_F(ArgumentParserTests, TestsWithInvalidNumberOfPositionalArguments)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(ArgumentParserTests, TestParseOptionsWithoutShorthands)
+{
+  ArgumentParser argparser;
+  bool bool_dst = false;
+  std::string str_dst;
+  uint32_t uint32_dst = 0;
+  argparser.addBooleanParameter("MD", '\0', "Boolean value", false,
+                                &bool_dst);
+  argparser.addStringParameter("MF", '\0', "String value", false, &str_dst);
+  argparser.addUint32Parameter("uint32", 'u', "UInt32 value", false,
+                               &uint32_dst);
+
+  const std::vector<char*> args{"MyProgram", "-MD", "-MF", "out.d",
+                                "-u",        "32"};
+
+  const bool res = argparser.parseArgs(args.size(), (char**)args.data());
+  ASSERT_TRUE(res);
+
+  ASSERT_TRUE(bool_dst);
+  ASSERT_STREQ("out.d", str_dst.c_str());
+  ASSERT_EQ(32, uint32_dst);
+}
+
+// -----------------------------------------------------------------------------
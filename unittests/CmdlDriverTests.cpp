@@ -43,6 +43,12 @@ TEST_F(CmdlDriverTests, TestDefaultInitialization)
   ASSERT_FALSE(driver.options().verbose);
   ASSERT_FALSE(driver.options().silent);
   ASSERT_FALSE(driver.options().suppressAnnotationComments);
+  ASSERT_FALSE(driver.options().usePolicyTemplate);
+  ASSERT_FALSE(driver.options().useColdFailurePaths);
+  ASSERT_FALSE(driver.options().emitInstrumentation);
+  ASSERT_FALSE(driver.options().useLightHeaders);
+  ASSERT_FALSE(driver.options().useSimdScanner);
+  ASSERT_FALSE(driver.options().useRecursiveDescentParser);
   ASSERT_STREQ("", driver.options().outputPath.c_str());
 }
 
@@ -57,6 +63,11 @@ TEST_F(CmdlDriverTests, TestRun)
                                 "--verbose",
                                 "--silent",
                                 "--no-annotation-comments",
+                                "--policy-template",
+                                "--cold-failure-paths",
+                                "--emit-instrumentation",
+                                "--simd-scanner",
+                                "--recursive-descent",
                                 "--output",
                                 "/tmp/out",
                                 "/tmp/in"};
@@ -71,6 +82,11 @@ TEST_F(CmdlDriverTests, TestRun)
   ASSERT_TRUE(driver.options().verbose);
   ASSERT_TRUE(driver.options().silent);
   ASSERT_TRUE(driver.options().suppressAnnotationComments);
+  ASSERT_TRUE(driver.options().usePolicyTemplate);
+  ASSERT_TRUE(driver.options().useColdFailurePaths);
+  ASSERT_TRUE(driver.options().emitInstrumentation);
+  ASSERT_TRUE(driver.options().useSimdScanner);
+  ASSERT_TRUE(driver.options().useRecursiveDescentParser);
   ASSERT_STREQ("/tmp/out", driver.options().outputPath.c_str());
   ASSERT_STREQ("/tmp/in", driver.options().inputPath.c_str());
 }
@@ -88,3 +104,77 @@ TEST_F(CmdlDriverTests, TestWithoutInputPathSpecified)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(CmdlDriverTests, TestRunWithDepfile)
+{
+  const std::vector<char*> args{"MyProgram", "-MD", "--output", "/tmp/out",
+                                "/tmp/in/types.sl"};
+
+  CmdlDriver driver;
+  const bool res = driver.run(args.size(), (char**)args.data());
+  ASSERT_TRUE(res);
+
+  ASSERT_TRUE(driver.options().emitDepfile);
+  ASSERT_STREQ("/tmp/out/types.d", driver.options().depfilePath.c_str());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CmdlDriverTests, TestRunWithDepfilePath)
+{
+  const std::vector<char*> args{"MyProgram", "-MF", "/tmp/deps/types.d",
+                                "--output", "/tmp/out", "/tmp/in/types.sl"};
+
+  CmdlDriver driver;
+  const bool res = driver.run(args.size(), (char**)args.data());
+  ASSERT_TRUE(res);
+
+  ASSERT_TRUE(driver.options().emitDepfile);
+  ASSERT_STREQ("/tmp/deps/types.d", driver.options().depfilePath.c_str());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CmdlDriverTests, TestRunWithOutputCache)
+{
+  const std::vector<char*> args{"MyProgram",        "--cache-dir", "/tmp/cache",
+                                "--cache-max-size", "64",          "--output",
+                                "/tmp/out",         "/tmp/in"};
+
+  CmdlDriver driver;
+  const bool res = driver.run(args.size(), (char**)args.data());
+  ASSERT_TRUE(res);
+
+  ASSERT_STREQ("/tmp/cache", driver.options().cacheDirpath.c_str());
+  ASSERT_EQ(64, driver.options().cacheMaxSize);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CmdlDriverTests, TestRunWithShards)
+{
+  const std::vector<char*> args{"MyProgram", "--shards", "4",
+                                "--output",  "/tmp/out", "/tmp/in"};
+
+  CmdlDriver driver;
+  const bool res = driver.run(args.size(), (char**)args.data());
+  ASSERT_TRUE(res);
+
+  ASSERT_EQ(4, driver.options().shards);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(CmdlDriverTests, TestRunWithLightHeaders)
+{
+  const std::vector<char*> args{"MyProgram", "--light-headers", "--output",
+                                "/tmp/out", "/tmp/in"};
+
+  CmdlDriver driver;
+  const bool res = driver.run(args.size(), (char**)args.data());
+  ASSERT_TRUE(res);
+
+  ASSERT_TRUE(driver.options().useLightHeaders);
+}
+
+// -----------------------------------------------------------------------------
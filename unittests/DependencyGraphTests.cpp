@@ -0,0 +1,153 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/DependencyGraph.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+using sl::runtime::DependencyGraph;
+
+// -----------------------------------------------------------------------------
+
+class DependencyGraphTests : public ::testing::Test
+{
+protected:
+  static std::vector<const void*> dependentSites(const DependencyGraph& graph,
+                                                 const void* node)
+  {
+    std::vector<const void*> sites;
+    graph.dependentSites(node, &sites);
+    std::sort(sites.begin(), sites.end());
+    return sites;
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(DependencyGraphTests, TestDependentSites)
+{
+  DependencyGraph graph;
+
+  int call1 = 0;
+  int call2 = 0;
+  int callee = 0;
+  int argument = 0;
+
+  graph.beginSite(&call1);
+  graph.record(&call1, &callee);
+  graph.record(&call1, &argument);
+  graph.record(&call1, &callee);
+
+  graph.beginSite(&call2);
+  graph.record(&call2, &callee);
+
+  ASSERT_EQ(2, graph.dependencyCount(&call1));
+  ASSERT_EQ(1, graph.dependencyCount(&call2));
+
+  std::vector<const void*> expected{&call1, &call2};
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(expected, dependentSites(graph, &callee));
+  ASSERT_EQ(std::vector<const void*>{&call1}, dependentSites(graph, &argument));
+  ASSERT_TRUE(dependentSites(graph, &call1).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(DependencyGraphTests, TestRecheckSupersedesDependencies)
+{
+  DependencyGraph graph;
+
+  int call = 0;
+  int callee = 0;
+  int argument = 0;
+
+  graph.beginSite(&call);
+  graph.record(&call, &callee);
+  graph.record(&call, &argument);
+
+  graph.beginSite(&call);
+  graph.record(&call, &argument);
+
+  ASSERT_EQ(1, graph.dependencyCount(&call));
+  ASSERT_TRUE(dependentSites(graph, &callee).empty());
+  ASSERT_EQ(std::vector<const void*>{&call}, dependentSites(graph, &argument));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(DependencyGraphTests, TestRulesTriedInTurnShareSite)
+{
+  DependencyGraph graph;
+
+  struct
+  {
+    int method = 0;
+    int function = 0;
+  } call;
+
+  // As the synthesized dispatch method does for rules sharing a key, the
+  // site is reset once, and the rules tried in turn leave it be, e.g.
+  //   deps.beginSite(&call);
+  //   MethodCallInference(call, &ec, false);  // Fails.
+  //   return FunctionCallInference(call, err, false);
+  graph.beginSite(&call);
+  graph.record(&call, &call.method);
+  graph.record(&call, &call.function);
+
+  // A change to the node consulted only by the rule that failed may let it
+  // succeed, so it invalidates the site too.
+  ASSERT_EQ(2, graph.dependencyCount(&call));
+  ASSERT_EQ(std::vector<const void*>{&call},
+            dependentSites(graph, &call.method));
+  ASSERT_EQ(std::vector<const void*>{&call},
+            dependentSites(graph, &call.function));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(DependencyGraphTests, TestRemoveNode)
+{
+  DependencyGraph graph;
+
+  int outer = 0;
+  int inner = 0;
+  int leaf = 0;
+
+  graph.beginSite(&inner);
+  graph.record(&inner, &leaf);
+  graph.beginSite(&outer);
+  graph.record(&outer, &inner);
+
+  graph.remove(&inner);
+
+  ASSERT_EQ(0, graph.dependencyCount(&inner));
+  ASSERT_EQ(0, graph.dependencyCount(&outer));
+  ASSERT_TRUE(dependentSites(graph, &leaf).empty());
+  ASSERT_TRUE(dependentSites(graph, &inner).empty());
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,105 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/FailureRecord.h"
+
+#include <gtest/gtest.h>
+
+// -----------------------------------------------------------------------------
+
+using sl::runtime::FailureRecord;
+using sl::runtime::FailureRuleInfo;
+
+// -----------------------------------------------------------------------------
+
+class FailureRecordTests : public ::testing::Test
+{
+protected:
+  static const char* const CALL_INFERENCE_PREMISES[];
+  static const FailureRuleInfo RULES[];
+};
+
+// -----------------------------------------------------------------------------
+
+const char* const FailureRecordTests::CALL_INFERENCE_PREMISES[] = {
+    "call.callee : CalleeType",
+    "call.arguments : ArgumentTypes[]",
+    "ArgumentTypes[] <= ParameterTypes[] inrange 0..0..ParameterTypes[]",
+};
+
+// -----------------------------------------------------------------------------
+
+const FailureRuleInfo FailureRecordTests::RULES[] = {
+    {"CallInference", FailureRecordTests::CALL_INFERENCE_PREMISES, 3},
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FailureRecordTests, TestRecordAndClear)
+{
+  FailureRecord record;
+  ASSERT_TRUE(record.empty());
+
+  record.record(0, 2, 1, 1);
+  ASSERT_FALSE(record.empty());
+  ASSERT_EQ(0, record.rule);
+  ASSERT_EQ(2, record.premise);
+  ASSERT_EQ(1, record.i);
+  ASSERT_EQ(1, record.j);
+
+  record.clear();
+  ASSERT_TRUE(record.empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FailureRecordTests, TestDescribeFailure)
+{
+  FailureRecord record;
+
+  record.record(0, 0);
+  ASSERT_EQ("Input.sl: CallInference: premise 1 failed: "
+            "`call.callee : CalleeType`",
+            describeFailure(record, "Input.sl", RULES, 1));
+
+  record.record(0, 2, 3, 3);
+  ASSERT_EQ("Input.sl: CallInference: premise 3 failed: "
+            "`ArgumentTypes[] <= ParameterTypes[] inrange "
+            "0..0..ParameterTypes[]` (i = 3, j = 3)",
+            describeFailure(record, "Input.sl", RULES, 1));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(FailureRecordTests, TestDescribeUnknownFailure)
+{
+  FailureRecord record;
+  ASSERT_EQ("Input.sl: inference failed (unknown rule)",
+            describeFailure(record, "Input.sl", RULES, 1));
+
+  record.record(0, 3);
+  ASSERT_EQ("Input.sl: CallInference: inference failed (unknown premise)",
+            describeFailure(record, "Input.sl", RULES, 1));
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,95 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/Instrumentation.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+// -----------------------------------------------------------------------------
+
+using sl::runtime::RuleCounters;
+
+// -----------------------------------------------------------------------------
+
+class InstrumentationTests : public ::testing::Test
+{
+protected:
+  static const char* const RULE_NAMES[];
+};
+
+// -----------------------------------------------------------------------------
+
+const char* const InstrumentationTests::RULE_NAMES[] = {
+    "CallInference",
+    "ReturnInference",
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrumentationTests, TestRuleCountersAreCacheLineAligned)
+{
+  ASSERT_EQ(64, alignof(RuleCounters));
+  ASSERT_EQ(64, sizeof(RuleCounters));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrumentationTests, TestRuleScopeCountsCallsAndFailures)
+{
+  RuleCounters counters[2];
+
+  for (uint32_t i = 0; i < 3; ++i) {
+    SL_INSTRUMENT_RULE(counters, 1);
+    SL_INSTRUMENT_PREMISE(1, i);
+    if (i == 2) {
+      SL_INSTRUMENT_FAILURE(counters, 1, i);
+    }
+  }
+
+  ASSERT_EQ(0, counters[0].calls.load());
+  ASSERT_EQ(0, counters[0].failures.load());
+  ASSERT_EQ(0, counters[0].cycles.load());
+  ASSERT_EQ(3, counters[1].calls.load());
+  ASSERT_EQ(1, counters[1].failures.load());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(InstrumentationTests, TestDumpRuleCounters)
+{
+  RuleCounters counters[2];
+  counters[0].calls = 10;
+  counters[0].failures = 2;
+  counters[0].cycles = 12345;
+
+  std::ostringstream os;
+  sl::runtime::dumpRuleCounters(os, "MyInference", RULE_NAMES, counters, 2);
+
+  ASSERT_EQ("MyInference::CallInference calls=10 failures=2 cycles=12345\n"
+            "MyInference::ReturnInference calls=0 failures=0 cycles=0\n",
+            os.str());
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,381 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "lsp/Json.h"
+#include "lsp/LanguageServer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+class LanguageServerTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const auto out = send("initialize", JsonValue::Object(), 1);
+    ASSERT_EQ(1, out.size());
+    send("initialized", JsonValue::Object());
+  }
+
+  std::vector<JsonValue> send(const char* method, JsonValue params,
+                              int id = -1)
+  {
+    JsonValue message;
+    message["jsonrpc"] = "2.0";
+    message["method"] = method;
+    message["params"] = std::move(params);
+    if (id >= 0) {
+      message["id"] = id;
+    }
+
+    std::vector<JsonValue> out;
+    server.handleMessage(message, &out);
+    return out;
+  }
+
+  static JsonValue position(int line, int character)
+  {
+    JsonValue position;
+    position["line"] = line;
+    position["character"] = character;
+    return position;
+  }
+
+  static JsonValue range(int startLine, int startCharacter, int endLine,
+                         int endCharacter)
+  {
+    JsonValue range;
+    range["start"] = position(startLine, startCharacter);
+    range["end"] = position(endLine, endCharacter);
+    return range;
+  }
+
+  JsonValue textDocumentPosition(int line, int character)
+  {
+    JsonValue params;
+    params["textDocument"]["uri"] = URI;
+    params["position"] = position(line, character);
+    return params;
+  }
+
+  std::vector<JsonValue> open(const char* text)
+  {
+    JsonValue params;
+    params["textDocument"]["uri"] = URI;
+    params["textDocument"]["languageId"] = "snowlake";
+    params["textDocument"]["version"] = 1;
+    params["textDocument"]["text"] = text;
+    return send("textDocument/didOpen", std::move(params));
+  }
+
+  std::vector<JsonValue> change(JsonValue range, const char* text)
+  {
+    JsonValue contentChange;
+    contentChange["range"] = std::move(range);
+    contentChange["text"] = text;
+
+    JsonValue params;
+    params["textDocument"]["uri"] = URI;
+    params["textDocument"]["version"] = 2;
+    params["contentChanges"] = JsonValue::Array{contentChange};
+    return send("textDocument/didChange", std::move(params));
+  }
+
+  /**
+   * Returns the diagnostics of the only notification in `out`.
+   */
+  static JsonValue::Array diagnostics(const std::vector<JsonValue>& out)
+  {
+    EXPECT_EQ(1, out.size());
+    EXPECT_EQ("textDocument/publishDiagnostics", out[0]["method"].asString());
+    EXPECT_EQ(URI, out[0]["params"]["uri"].asString());
+    return out[0]["params"]["diagnostics"].asArray();
+  }
+
+  static constexpr const char* URI = "file:///MyGroup.sl";
+
+  LanguageServer server;
+};
+
+// -----------------------------------------------------------------------------
+
+// clang-format off
+static const char* INPUT =
+  "group MyGroup {\n"
+  "  ClassName     : MyGroup;\n"
+  "  TypeClass     : TypeDefn;\n"
+  "  ProofMethod   : proveType;\n"
+  "  TypeCmpMethod : cmpType;\n"
+  "  DispatchKeyClass : ASTNode;\n"
+  "\n"
+  "  dispatch: [\n"
+  "    CallExpr : MethodCall;\n"
+  "  ]\n"
+  "\n"
+  "  inference MethodCall {\n"
+  "    globals: [\n"
+  "      SELF_TYPE\n"
+  "    ]\n"
+  "    arguments: [\n"
+  "      call : ASTExpr\n"
+  "    ]\n"
+  "    premises: [\n"
+  "      call.callee.return_type : ReturnType;\n"
+  "      ReturnType != SELF_TYPE;\n"
+  "    ]\n"
+  "    proposition : ReturnType;\n"
+  "  }\n"
+  "}\n";
+// clang-format on
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestInitialize)
+{
+  LanguageServer otherServer;
+  std::vector<JsonValue> out;
+
+  JsonValue request;
+  request["jsonrpc"] = "2.0";
+  request["id"] = 1;
+  request["method"] = "textDocument/definition";
+  ASSERT_TRUE(otherServer.handleMessage(request, &out));
+  ASSERT_EQ(1, out.size());
+  ASSERT_EQ(-32002, out[0]["error"]["code"].asNumber());
+
+  out.clear();
+  request["method"] = "initialize";
+  ASSERT_TRUE(otherServer.handleMessage(request, &out));
+  ASSERT_EQ(1, out.size());
+  ASSERT_EQ(1, out[0]["id"].asNumber());
+
+  const auto& capabilities = out[0]["result"]["capabilities"];
+  ASSERT_EQ(2, capabilities["textDocumentSync"]["change"].asNumber());
+  ASSERT_TRUE(capabilities["definitionProvider"].asBool());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestShutdownAndExit)
+{
+  auto out = send("unknownRequest", JsonValue::Object(), 2);
+  ASSERT_EQ(1, out.size());
+  ASSERT_EQ(-32601, out[0]["error"]["code"].asNumber());
+
+  ASSERT_TRUE(send("unknownNotification", JsonValue::Object()).empty());
+
+  out = send("shutdown", JsonValue(), 3);
+  ASSERT_EQ(1, out.size());
+  ASSERT_TRUE(out[0]["result"].isNull());
+
+  JsonValue exit;
+  exit["jsonrpc"] = "2.0";
+  exit["method"] = "exit";
+  ASSERT_FALSE(server.handleMessage(exit, &out));
+  ASSERT_EQ(0, server.exitCode());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestPublishingNoDiagnosticsForValidDocument)
+{
+  ASSERT_TRUE(diagnostics(open(INPUT)).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestPublishingSyntaxErrors)
+{
+  open(INPUT);
+
+  const auto syntaxErrors = diagnostics(change(range(22, 4, 22, 4), "; "));
+  ASSERT_FALSE(syntaxErrors.empty());
+  ASSERT_EQ(1, syntaxErrors[0]["severity"].asNumber());
+  ASSERT_EQ(22, syntaxErrors[0]["range"]["start"]["line"].asNumber());
+  ASSERT_EQ(4, syntaxErrors[0]["range"]["start"]["character"].asNumber());
+  ASSERT_EQ(22, syntaxErrors[0]["range"]["end"]["line"].asNumber());
+  ASSERT_EQ(5, syntaxErrors[0]["range"]["end"]["character"].asNumber());
+
+  ASSERT_TRUE(diagnostics(change(range(22, 4, 22, 6), "")).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestPublishingSemanticErrorsOfEditedInferenceDefn)
+{
+  open(INPUT);
+
+  // The proposition target is not deduced by any premise.
+  const auto semanticErrors =
+      diagnostics(change(range(22, 18, 22, 28), "OtherType"));
+  ASSERT_EQ(1, semanticErrors.size());
+  ASSERT_EQ(1, semanticErrors[0]["severity"].asNumber());
+  ASSERT_EQ("Invalid proposition target type in inference \"MethodCall\".",
+            semanticErrors[0]["message"].asString());
+  ASSERT_EQ(range(11, 2, 11, 22).serialize(),
+            semanticErrors[0]["range"].serialize());
+
+  ASSERT_TRUE(diagnostics(change(range(22, 18, 22, 27), "ReturnType")).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestPublishingSemanticErrorsOfEditedGroupSections)
+{
+  open(INPUT);
+
+  // The dispatch entry names no inference definition of the group.
+  const auto semanticErrors =
+      diagnostics(change(range(8, 15, 8, 25), "MethodCalls"));
+  ASSERT_EQ(1, semanticErrors.size());
+  ASSERT_EQ(range(1, 2, 9, 3).serialize(),
+            semanticErrors[0]["range"].serialize());
+
+  ASSERT_TRUE(diagnostics(change(range(8, 25, 8, 26), "")).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestPublishingImportErrors)
+{
+  // Imports resolve against the directory of the document.
+  const auto importErrors =
+      diagnostics(open("import snowlake_missing_module;\n"));
+  ASSERT_EQ(1, importErrors.size());
+  ASSERT_EQ(12, importErrors[0]["code"].asNumber());
+  ASSERT_EQ("Failed to open imported module \"snowlake_missing_module\" "
+            "(/snowlake_missing_module.sl).",
+            importErrors[0]["message"].asString());
+
+  ASSERT_TRUE(diagnostics(change(range(0, 0, 1, 0), "")).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestGoingToDefinition)
+{
+  open(INPUT);
+
+  auto definitionAt = [&](int line, int character) {
+    const auto out = send("textDocument/definition",
+                          textDocumentPosition(line, character), 4);
+    EXPECT_EQ(1, out.size());
+    EXPECT_EQ(4, out[0]["id"].asNumber());
+    return out[0]["result"];
+  };
+
+  // Global.
+  auto location = definitionAt(20, 22);
+  ASSERT_EQ(URI, location["uri"].asString());
+  ASSERT_EQ(range(13, 6, 13, 15).serialize(), location["range"].serialize());
+
+  // Argument.
+  location = definitionAt(19, 6);
+  ASSERT_EQ(range(16, 6, 16, 10).serialize(), location["range"].serialize());
+
+  // Deduction target.
+  location = definitionAt(22, 28);
+  ASSERT_EQ(range(19, 32, 19, 42).serialize(), location["range"].serialize());
+
+  // Inference definition named by a dispatch entry.
+  location = definitionAt(8, 16);
+  ASSERT_EQ(range(11, 2, 11, 22).serialize(), location["range"].serialize());
+
+  // Members of identifiables, and positions outside of any identifier.
+  ASSERT_TRUE(definitionAt(19, 12).isNull());
+  ASSERT_TRUE(definitionAt(10, 0).isNull());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestGoingToDefinitionAfterEdit)
+{
+  open(INPUT);
+
+  // Shifts the inference definition down by two lines.
+  change(range(5, 0, 5, 0), "\n\n");
+
+  const auto out =
+      send("textDocument/definition", textDocumentPosition(24, 22), 5);
+  ASSERT_EQ(1, out.size());
+  ASSERT_EQ(range(21, 32, 21, 42).serialize(),
+            out[0]["result"]["range"].serialize());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestPreviewingSynthesizedCode)
+{
+  open(INPUT);
+
+  auto out =
+      send("snowlake/synthesisPreview", textDocumentPosition(22, 4), 6);
+  ASSERT_EQ(1, out.size());
+
+  const auto& result = out[0]["result"];
+  ASSERT_EQ("MethodCall", result["inference"].asString());
+
+  bool foundDefinition = false;
+  for (const auto& file : result["files"].asArray()) {
+    if (file["name"].asString() == "MyGroup.cpp") {
+      foundDefinition = file["text"].asString().find(
+                            "MyGroup::MethodCall(") != std::string::npos;
+    }
+  }
+  ASSERT_TRUE(foundDefinition);
+
+  // Outside of any inference definition.
+  out = send("snowlake/synthesisPreview", textDocumentPosition(3, 4), 7);
+  ASSERT_EQ(1, out.size());
+  ASSERT_TRUE(out[0]["result"].isNull());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(LanguageServerTests, TestParsingAndSerializingJson)
+{
+  const std::string TEXT =
+      "{\"b\": [1, -2.5, true, false, null], "
+      "\"a\": \"\\\"x\\u00e9\\ud83d\\ude00\\n\"}";
+
+  JsonValue value;
+  ASSERT_TRUE(JsonValue::Parse(TEXT.data(), TEXT.size(), &value));
+  ASSERT_EQ(JsonValue::Type::Object, value.type());
+  ASSERT_EQ("\"x\xc3\xa9\xf0\x9f\x98\x80\n", value["a"].asString());
+  ASSERT_EQ(5, value["b"].asArray().size());
+  ASSERT_EQ(-2.5, value["b"].asArray()[1].asNumber());
+  ASSERT_TRUE(static_cast<const JsonValue&>(value)["c"].isNull());
+
+  ASSERT_EQ("{\"a\":\"\\\"x\xc3\xa9\xf0\x9f\x98\x80\\n\","
+            "\"b\":[1,-2.5,true,false,null]}",
+            value.serialize());
+
+  for (const char* invalid : {"", "{\"a\":}", "[1,]", "\"abc", "1 2", "tru"}) {
+    ASSERT_FALSE(JsonValue::Parse(invalid, strlen(invalid), &value));
+  }
+}
+
+// -----------------------------------------------------------------------------
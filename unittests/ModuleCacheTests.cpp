@@ -0,0 +1,385 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "ASTUtils.h"
+#include "CompilerErrorHandlerRegistrar.h"
+#include "ImportErrorCodes.h"
+#include "ModuleCache.h"
+#include "SemanticAnalysisErrorCodes.h"
+#include "SemanticAnalyzer.h"
+#include "parser/ParserDriver.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+// clang-format off
+static const char* BASE_MODULE =
+  "group BaseGroup {"
+    "ClassName                 : BaseInference;"
+    "TypeClass                 : TypeCls;"
+    "ProofMethod               : proveType;"
+    "TypeCmpMethod             : cmpType;"
+    ""
+    "inference BinaryInference {"
+      "arguments: ["
+        "expr : ASTExpr"
+      "]"
+      "premises: ["
+        "expr.lhs : LhsType;"
+      "]"
+      "proposition : LhsType;"
+    "}"
+  "}"
+  "";
+// clang-format on
+
+// -----------------------------------------------------------------------------
+
+class ModuleCacheTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dirpath[] = "/tmp/snowlake-module-cache-XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(dirpath));
+    _dirpath = dirpath;
+  }
+
+  void TearDown() override
+  {
+    for (auto itr = _paths.rbegin(); itr != _paths.rend(); ++itr) {
+      remove(itr->c_str());
+    }
+    rmdir(_dirpath.c_str());
+  }
+
+  /**
+   * Writes a module to a file, relative to the test directory.
+   */
+  void writeModule(const std::string& relpath, const char* input)
+  {
+    const auto pos = relpath.find('/');
+    if (pos != std::string::npos) {
+      const std::string subdirpath = _dirpath + "/" + relpath.substr(0, pos);
+      if (mkdir(subdirpath.c_str(), 0700) == 0) {
+        _paths.push_back(subdirpath);
+      }
+    }
+    const std::string filepath = _dirpath + "/" + relpath;
+    std::ofstream ofs(filepath, std::ofstream::out);
+    ofs << input;
+    ofs.close();
+    _paths.push_back(filepath);
+  }
+
+  /**
+   * Parses a module, resolves its imports against the test directory and
+   * analyzes it, collecting the errors reported.
+   */
+  bool resolveAndAnalyze(const char* input, ModuleCache* cache,
+                         ParserDriver* parser,
+                         std::vector<CompilerError>* errors)
+  {
+    ScopedCompilerErrorHandlerRegister scopedCompilerErrorHandlerRegister(
+        [&](CompilerError error) -> void { errors->push_back(error); });
+
+    if (parser->parseFromString(input) != 0) {
+      return false;
+    }
+    if (!cache->resolveImports(&parser->module(), _dirpath)) {
+      return false;
+    }
+    SemanticAnalyzer analyzer;
+    return analyzer.run(parser->module());
+  }
+
+  std::string _dirpath;
+  std::vector<std::string> _paths;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestGetImportPath)
+{
+  ASSERT_EQ("dir/common/base.sl",
+            ModuleCache::GetImportPath("common.base", "dir"));
+  ASSERT_EQ("dir/base.sl", ModuleCache::GetImportPath("base", "dir/"));
+  ASSERT_EQ("base.sl", ModuleCache::GetImportPath("base", ""));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestGetDirectoryOfPath)
+{
+  ASSERT_EQ("dir/common", ModuleCache::GetDirectoryOfPath("dir/common/a.sl"));
+  ASSERT_EQ("/", ModuleCache::GetDirectoryOfPath("/a.sl"));
+  ASSERT_EQ("", ModuleCache::GetDirectoryOfPath("a.sl"));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestLoadingEachModuleOnce)
+{
+  writeModule("common/base.sl", BASE_MODULE);
+  writeModule("lhs.sl", "import common.base;");
+  writeModule("rhs.sl", "import common.base;\n");
+  writeModule("same.sl", "import common.base;");
+
+  // clang-format off
+  const char* INPUT =
+    "import lhs;"
+    "import rhs;"
+    "import common.base;"
+    "import same;"
+    ""
+    "group MyGroup : BaseGroup {"
+      "ClassName                 : MyInference;"
+      "TypeClass                 : TypeCls;"
+      "ProofMethod               : proveType;"
+      "TypeCmpMethod             : cmpType;"
+    "}"
+    "";
+  // clang-format on
+
+  ModuleCache cache;
+  ParserDriver parser;
+  std::vector<CompilerError> errors;
+  ASSERT_TRUE(resolveAndAnalyze(INPUT, &cache, &parser, &errors));
+  ASSERT_TRUE(errors.empty());
+
+  ASSERT_EQ(3, cache.size());
+
+  const auto& imports = parser.module().imports();
+  const ASTModule* baseModule = imports[2].module();
+  ASSERT_NE(nullptr, baseModule);
+  ASSERT_EQ(baseModule, imports[0].module()->imports().front().module());
+  ASSERT_EQ(baseModule, imports[1].module()->imports().front().module());
+
+  // Modules with the same content in the same directory are the same.
+  ASSERT_EQ(imports[0].module(), imports[3].module());
+
+  ASSERT_EQ(&baseModule->inferenceGroups().front(),
+            parser.module().inferenceGroups().front().base());
+
+  // Every file read is listed once, whether or not its module was shared.
+  const std::vector<std::string> expectedFilepaths{
+      _dirpath + "/lhs.sl", _dirpath + "/common/base.sl",
+      _dirpath + "/rhs.sl", _dirpath + "/same.sl"};
+  ASSERT_EQ(expectedFilepaths,
+            ASTUtils::GetImportedFilepaths(parser.module()));
+
+  // Loading the same modules again hits the cache.
+  ParserDriver otherParser;
+  ASSERT_TRUE(resolveAndAnalyze(INPUT, &cache, &otherParser, &errors));
+  ASSERT_EQ(3, cache.size());
+  ASSERT_EQ(baseModule, otherParser.module().imports()[2].module());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestReloadingChangedModule)
+{
+  writeModule("base.sl", BASE_MODULE);
+
+  ModuleCache cache;
+  ParserDriver parser;
+  std::vector<CompilerError> errors;
+  ASSERT_TRUE(resolveAndAnalyze("import base;", &cache, &parser, &errors));
+  ASSERT_EQ(1, cache.size());
+
+  writeModule("base.sl", "");
+
+  ParserDriver otherParser;
+  ASSERT_TRUE(
+      resolveAndAnalyze("import base;", &cache, &otherParser, &errors));
+  ASSERT_EQ(2, cache.size());
+  ASSERT_TRUE(
+      otherParser.module().imports().front().module()->inferenceGroups().empty());
+
+  // The module loaded first is still valid.
+  ASSERT_EQ(
+      1,
+      parser.module().imports().front().module()->inferenceGroups().size());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestImportingMissingModule)
+{
+  ModuleCache cache;
+  ParserDriver parser;
+  std::vector<CompilerError> errors;
+  ASSERT_FALSE(
+      resolveAndAnalyze("import common.missing;", &cache, &parser, &errors));
+
+  ASSERT_EQ(1, errors.size());
+  ASSERT_EQ(kImportModuleNotFoundError, errors.front().code);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestImportingModulesCyclically)
+{
+  writeModule("lhs.sl", "import rhs;");
+  writeModule("rhs.sl", "import lhs;");
+
+  ModuleCache cache;
+  ParserDriver parser;
+  std::vector<CompilerError> errors;
+  ASSERT_FALSE(resolveAndAnalyze("import lhs;", &cache, &parser, &errors));
+
+  ASSERT_EQ(1, errors.size());
+  ASSERT_EQ(kImportCyclicImportError, errors.front().code);
+  ASSERT_EQ(0, errors.front().msg.find("In module imported from \""));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestImportingModuleWithSyntaxError)
+{
+  writeModule("base.sl", "group BaseGroup {");
+
+  ModuleCache cache;
+  ParserDriver parser;
+  std::vector<CompilerError> errors;
+  ASSERT_FALSE(resolveAndAnalyze("import base;", &cache, &parser, &errors));
+
+  ASSERT_EQ(1, errors.size());
+  ASSERT_EQ("In module imported from \"" + _dirpath +
+                "/base.sl\": Parser error: syntax error, unexpected end of "
+                "file, expecting KEYWORD_INFERENCE or RBRACE [1.18]",
+            errors.front().msg);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestDispatchingToBaseInferenceDefn)
+{
+  writeModule("base.sl", BASE_MODULE);
+
+  // clang-format off
+  const char* INPUT =
+    "import base;"
+    ""
+    "group MyGroup : BaseGroup {"
+      "ClassName                 : MyInference;"
+      "TypeClass                 : TypeCls;"
+      "ProofMethod               : proveType;"
+      "TypeCmpMethod             : cmpType;"
+      "DispatchKeyClass          : NodeKind;"
+      ""
+      "dispatch: ["
+        "BinaryExpr              : BinaryInference;"
+        "UnaryExpr               : UnaryInference;"
+      "]"
+      ""
+      "inference UnaryInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.operand : OperandType;"
+        "]"
+        "proposition : OperandType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  ModuleCache cache;
+  ParserDriver parser;
+  std::vector<CompilerError> errors;
+  ASSERT_TRUE(resolveAndAnalyze(INPUT, &cache, &parser, &errors));
+  ASSERT_TRUE(errors.empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestDerivingFromIncompatibleBaseInferenceGroup)
+{
+  writeModule("base.sl", BASE_MODULE);
+
+  // clang-format off
+  const char* INPUT =
+    "import base;"
+    ""
+    "group MyGroup : BaseGroup {"
+      "ClassName                 : BaseInference;"
+      "TypeClass                 : OtherTypeCls;"
+      "ProofMethod               : proveType;"
+      "TypeCmpMethod             : cmpType;"
+    "}"
+    "";
+  // clang-format on
+
+  ModuleCache cache;
+  ParserDriver parser;
+  std::vector<CompilerError> errors;
+  ASSERT_FALSE(resolveAndAnalyze(INPUT, &cache, &parser, &errors));
+
+  ASSERT_EQ(2, errors.size());
+  ASSERT_EQ(kSemanticAnalysisIncompatibleBaseInferenceGroupError,
+            errors[0].code);
+  ASSERT_EQ("Environment field \"TypeClass\" of inference group \"MyGroup\" "
+            "does not match with that of base inference group \"BaseGroup\".",
+            errors[0].msg);
+  ASSERT_EQ(kSemanticAnalysisIncompatibleBaseInferenceGroupError,
+            errors[1].code);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ModuleCacheTests, TestRedefiningImportedInferenceGroup)
+{
+  writeModule("base.sl", BASE_MODULE);
+
+  // clang-format off
+  const char* INPUT =
+    "import base;"
+    ""
+    "group BaseGroup {"
+      "ClassName                 : MyInference;"
+      "TypeClass                 : TypeCls;"
+      "ProofMethod               : proveType;"
+      "TypeCmpMethod             : cmpType;"
+    "}"
+    "";
+  // clang-format on
+
+  ModuleCache cache;
+  ParserDriver parser;
+  std::vector<CompilerError> errors;
+  ASSERT_FALSE(resolveAndAnalyze(INPUT, &cache, &parser, &errors));
+
+  ASSERT_EQ(1, errors.size());
+  ASSERT_EQ(kSemanticAnalysisDuplicateInferenceGroupIdentifierError,
+            errors.front().code);
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,185 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "OutputCache.h"
+
+#include <fstream>
+#include <ftw.h>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+class OutputCacheTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dirpath[] = "/tmp/snowlake-output-cache-XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(dirpath));
+    _dirpath = dirpath;
+    ASSERT_EQ(0, mkdir((_dirpath + "/out").c_str(), 0700));
+    ASSERT_EQ(0, mkdir((_dirpath + "/fetched").c_str(), 0700));
+  }
+
+  void TearDown() override
+  {
+    nftw(_dirpath.c_str(),
+         [](const char* path, const struct stat*, int,
+            struct FTW*) -> int { return remove(path); },
+         16, FTW_DEPTH | FTW_PHYS);
+  }
+
+  OutputCache::Options cacheOptions(uint64_t maxSize) const
+  {
+    return OutputCache::Options{.dirpath = _dirpath + "/cache",
+                                .maxSize = maxSize};
+  }
+
+  std::string writeOutput(const std::string& filename,
+                          const std::string& content) const
+  {
+    const std::string filepath = _dirpath + "/out/" + filename;
+    std::ofstream ofs(filepath, std::ofstream::out);
+    ofs << content;
+    ofs.close();
+    return filepath;
+  }
+
+  static std::string readFile(const std::string& filepath)
+  {
+    std::ifstream ifs(filepath);
+    return std::string((std::istreambuf_iterator<char>(ifs)),
+                       std::istreambuf_iterator<char>());
+  }
+
+  /**
+   * Keys whose entries fall in the same shard.
+   */
+  static std::vector<std::string> getKeysOfSameShard(size_t count)
+  {
+    std::vector<std::string> keys;
+    for (size_t i = 0; keys.size() < count; ++i) {
+      std::string key = "key " + std::to_string(i);
+      if (OutputCache::GetEntryName(key).front() == '0') {
+        keys.push_back(std::move(key));
+      }
+    }
+    return keys;
+  }
+
+  std::string _dirpath;
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(OutputCacheTests, TestNormalizeInput)
+{
+  ASSERT_EQ("group MyGroup { inference A { } }",
+            OutputCache::NormalizeInput("group MyGroup {\n"
+                                        "  inference A {}\n"
+                                        "}\n"));
+  ASSERT_EQ(OutputCache::NormalizeInput("x[0..1..y]"),
+            OutputCache::NormalizeInput(" x [ 00 .. 1 .. y ] "));
+  ASSERT_NE(OutputCache::NormalizeInput("a b"),
+            OutputCache::NormalizeInput("ab"));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(OutputCacheTests, TestFetchingStoredFiles)
+{
+  const std::vector<std::string> filepaths{writeOutput("A.h", "header"),
+                                           writeOutput("A.cpp", "source")};
+
+  const OutputCache cache(cacheOptions(1 << 20));
+  std::vector<std::string> fetchedFilepaths;
+  ASSERT_FALSE(cache.fetch("key", _dirpath + "/fetched", &fetchedFilepaths));
+  ASSERT_TRUE(cache.store("key", filepaths));
+
+  ASSERT_TRUE(cache.fetch("key", _dirpath + "/fetched", &fetchedFilepaths));
+  const std::vector<std::string> expectedFilepaths{
+      _dirpath + "/fetched/A.h", _dirpath + "/fetched/A.cpp"};
+  ASSERT_EQ(expectedFilepaths, fetchedFilepaths);
+  ASSERT_EQ("header", readFile(fetchedFilepaths[0]));
+  ASSERT_EQ("source", readFile(fetchedFilepaths[1]));
+
+  // Fetching again over the fetched files.
+  fetchedFilepaths.clear();
+  ASSERT_TRUE(cache.fetch("key", _dirpath + "/fetched", &fetchedFilepaths));
+  ASSERT_EQ(expectedFilepaths, fetchedFilepaths);
+  ASSERT_EQ("header", readFile(fetchedFilepaths[0]));
+
+  ASSERT_FALSE(
+      cache.fetch("other key", _dirpath + "/fetched", &fetchedFilepaths));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(OutputCacheTests, TestFetchingModifiedEntry)
+{
+  const std::vector<std::string> filepaths{writeOutput("A.h", "header")};
+
+  const OutputCache cache(cacheOptions(1 << 20));
+  ASSERT_TRUE(cache.store("key", filepaths));
+
+  // Writing to the output in place writes to the entry it is linked to.
+  writeOutput("A.h", "modified");
+
+  std::vector<std::string> fetchedFilepaths;
+  ASSERT_FALSE(cache.fetch("key", _dirpath + "/fetched", &fetchedFilepaths));
+  ASSERT_TRUE(fetchedFilepaths.empty());
+
+  // The entry was removed, and can be stored again.
+  writeOutput("A.h", "header");
+  ASSERT_TRUE(cache.store("key", filepaths));
+  ASSERT_TRUE(cache.fetch("key", _dirpath + "/fetched", &fetchedFilepaths));
+  ASSERT_EQ("header", readFile(fetchedFilepaths.front()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(OutputCacheTests, TestEvictingLeastRecentlyUsedEntries)
+{
+  const std::vector<std::string> keys = getKeysOfSameShard(3);
+  const std::vector<std::string> filepaths{
+      writeOutput("A.h", std::string(100, 'a'))};
+
+  // Room for two entries in each shard.
+  const OutputCache cache(cacheOptions(16 * 300));
+  std::vector<std::string> fetchedFilepaths;
+  ASSERT_TRUE(cache.store(keys[0], filepaths));
+  ASSERT_TRUE(cache.store(keys[1], filepaths));
+  ASSERT_TRUE(cache.fetch(keys[0], _dirpath + "/fetched", &fetchedFilepaths));
+
+  ASSERT_TRUE(cache.store(keys[2], filepaths));
+
+  ASSERT_TRUE(cache.fetch(keys[0], _dirpath + "/fetched", &fetchedFilepaths));
+  ASSERT_FALSE(cache.fetch(keys[1], _dirpath + "/fetched", &fetchedFilepaths));
+  ASSERT_TRUE(cache.fetch(keys[2], _dirpath + "/fetched", &fetchedFilepaths));
+}
+
+// -----------------------------------------------------------------------------
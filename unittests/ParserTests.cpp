@@ -41,19 +41,27 @@ TEST_F(ParserTests, TestDefaultInitialization)
   ASSERT_FALSE(driver.traceLexer());
   ASSERT_FALSE(driver.traceParser());
   ASSERT_FALSE(driver.suppressErrorMessages());
+  ASSERT_FALSE(driver.useSimdScanner());
+  ASSERT_FALSE(driver.useRecursiveDescentParser());
 }
 
 // -----------------------------------------------------------------------------
 
 TEST_F(ParserTests, TestInitializationWithOptions)
 {
-  ParserDriver::Options opts{
-      .traceLexer = true, .traceParser = true, .suppressErrorMessages = true};
+  ParserDriver::Options opts{.traceLexer = true,
+                             .traceParser = true,
+                             .suppressErrorMessages = true,
+                             .useSimdScanner = true,
+                             .useRecursiveDescentParser = true};
   ParserDriver driver(opts);
 
   ASSERT_EQ(opts.traceLexer, driver.traceLexer());
   ASSERT_EQ(opts.traceParser, driver.traceParser());
   ASSERT_EQ(opts.suppressErrorMessages, driver.suppressErrorMessages());
+  ASSERT_EQ(opts.useSimdScanner, driver.useSimdScanner());
+  ASSERT_EQ(opts.useRecursiveDescentParser,
+            driver.useRecursiveDescentParser());
 }
 
 // -----------------------------------------------------------------------------
@@ -337,3 +345,146 @@ TEST_F(ParserTests, TestParsingAndASTConstruction)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(ParserTests, TestParsingDispatchSection)
+{
+  ParserDriver driver;
+
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "TypeClass                 : TypeDefn;"
+      "DispatchKeyClass          : NodeKind;"
+      ""
+      "dispatch: ["
+        "BinaryExpr                : BinaryExprInference;"
+        "CallExpr                  : MethodCallInference, FunctionCallInference;"
+      "]"
+      ""
+      "inference BinaryExprInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+        "]"
+        "proposition : TypeDefn;"
+      "}"
+    "}"
+  "";
+  // clang-format on
+
+  int res;
+
+  res = driver.parseFromString(INPUT);
+
+  ASSERT_EQ(0, res);
+
+  const ASTInferenceGroup& inferenceGroup =
+      driver.module().inferenceGroups().front();
+
+  ASSERT_EQ(2, inferenceGroup.environmentDefns().size());
+  ASSERT_EQ(1, inferenceGroup.inferenceDefns().size());
+
+  const ASTDispatchEntryList& dispatchEntries =
+      inferenceGroup.dispatchEntries();
+  ASSERT_EQ(2, dispatchEntries.size());
+
+  ASSERT_EQ("BinaryExpr", dispatchEntries[0].key());
+  ASSERT_EQ(1, dispatchEntries[0].inferenceNames().size());
+  ASSERT_EQ("BinaryExprInference", dispatchEntries[0].inferenceNames()[0]);
+
+  ASSERT_EQ("CallExpr", dispatchEntries[1].key());
+  ASSERT_EQ(2, dispatchEntries[1].inferenceNames().size());
+  ASSERT_EQ("MethodCallInference", dispatchEntries[1].inferenceNames()[0]);
+  ASSERT_EQ("FunctionCallInference", dispatchEntries[1].inferenceNames()[1]);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ParserTests, TestParsingUnknownSectionInsteadOfDispatch)
+{
+  ParserDriver::Options opts{.suppressErrorMessages = true};
+  ParserDriver driver(opts);
+
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "TypeClass                 : TypeDefn;"
+      ""
+      "dispatches: ["
+        "BinaryExpr                : BinaryExprInference;"
+      "]"
+    "}"
+  "";
+  // clang-format on
+
+  int res;
+
+  res = driver.parseFromString(INPUT);
+
+  ASSERT_EQ(1, res);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ParserTests, TestParsingImportsAndBaseInferenceGroup)
+{
+  ParserDriver driver;
+
+  // clang-format off
+  const char* INPUT =
+    "import common.base;"
+    "import rules;"
+    ""
+    "group MyGroup : BaseGroup {"
+      "TypeClass                 : TypeDefn;"
+    "}"
+    ""
+    "group OtherGroup {"
+    "}"
+  "";
+  // clang-format on
+
+  int res;
+
+  res = driver.parseFromString(INPUT);
+
+  ASSERT_EQ(0, res);
+
+  const ASTImportList& imports = driver.module().imports();
+  ASSERT_EQ(2, imports.size());
+  ASSERT_EQ("common.base", imports[0].name());
+  ASSERT_EQ("rules", imports[1].name());
+  ASSERT_EQ(nullptr, imports[0].module());
+
+  const ASTInferenceGroupList& inferenceGroups =
+      driver.module().inferenceGroups();
+  ASSERT_EQ(2, inferenceGroups.size());
+  ASSERT_EQ("BaseGroup", inferenceGroups[0].baseName());
+  ASSERT_EQ(nullptr, inferenceGroups[0].base());
+  ASSERT_TRUE(inferenceGroups[1].baseName().empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ParserTests, TestParsingImportAfterInferenceGroup)
+{
+  ParserDriver::Options opts{.suppressErrorMessages = true};
+  ParserDriver driver(opts);
+
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+    "}"
+    "import common.base;"
+  "";
+  // clang-format on
+
+  int res;
+
+  res = driver.parseFromString(INPUT);
+
+  ASSERT_EQ(1, res);
+}
+
+// -----------------------------------------------------------------------------
@@ -22,9 +22,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *******************************************************************************/
 #include "ProgramDriver.h"
 
+#include <cstdio>
 #include <cstdlib>
+#include <fcntl.h>
 #include <fstream>
+#include <ftw.h>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -134,6 +142,7 @@ private:
 protected:
   const char* _outputFilepath = "./";
   const char* _inputFilepath = "test_input.txt";
+  const char* _depfilePath = "test_input.d";
 };
 
 // -----------------------------------------------------------------------------
@@ -185,3 +194,115 @@ TEST_F(ProgramDriverTests, TestRunWithNoArguments)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(ProgramDriverTests, TestRunWithDepfile)
+{
+  if (setupValidRun()) {
+    const std::vector<char*> args{"--errors",
+                                  "-MF",
+                                  const_cast<char*>(_depfilePath),
+                                  "--output",
+                                  const_cast<char*>(_outputFilepath),
+                                  const_cast<char*>(_inputFilepath)};
+
+    ProgramDriver driver;
+    const int res = driver.run(args.size(), (char**)args.data());
+    ASSERT_EQ(EXIT_SUCCESS, res);
+
+    std::ifstream ifs(_depfilePath);
+    ASSERT_TRUE(ifs.good());
+    const std::string actual((std::istreambuf_iterator<char>(ifs)),
+                             std::istreambuf_iterator<char>());
+
+    const std::string expected =
+        "./InferenceErrorDefn.h ./InferenceErrorDefn.cpp "
+        "./ProgramDriverTestOutput.h ./ProgramDriverTestOutput.cpp: \\\n"
+        "  test_input.txt\n";
+    ASSERT_EQ(expected, actual);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProgramDriverTests, TestRunWithOutputCache)
+{
+  char cacheDirpath[] = "/tmp/snowlake-program-driver-cache-XXXXXX";
+  ASSERT_NE(nullptr, mkdtemp(cacheDirpath));
+
+  if (setupValidRun()) {
+    const std::vector<char*> args{"--errors",
+                                  "--cache-dir",
+                                  cacheDirpath,
+                                  "--output",
+                                  const_cast<char*>(_outputFilepath),
+                                  const_cast<char*>(_inputFilepath)};
+
+    ProgramDriver driver;
+    ASSERT_EQ(EXIT_SUCCESS, driver.run(args.size(), (char**)args.data()));
+
+    std::ifstream ifs("./ProgramDriverTestOutput.h");
+    const std::string expected((std::istreambuf_iterator<char>(ifs)),
+                               std::istreambuf_iterator<char>());
+    ifs.close();
+    ASSERT_FALSE(expected.empty());
+
+    // The second run fetches the files stored by the first.
+    ASSERT_EQ(0, remove("./ProgramDriverTestOutput.h"));
+    ASSERT_EQ(EXIT_SUCCESS, driver.run(args.size(), (char**)args.data()));
+
+    ifs.open("./ProgramDriverTestOutput.h");
+    const std::string actual((std::istreambuf_iterator<char>(ifs)),
+                             std::istreambuf_iterator<char>());
+    ASSERT_EQ(expected, actual);
+  }
+
+  nftw(cacheDirpath,
+       [](const char* path, const struct stat*, int, struct FTW*) -> int {
+         return remove(path);
+       },
+       16, FTW_DEPTH | FTW_PHYS);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProgramDriverTests, TestRunWithOutputCacheAfterTouchingInput)
+{
+  char cacheDirpath[] = "/tmp/snowlake-program-driver-cache-XXXXXX";
+  ASSERT_NE(nullptr, mkdtemp(cacheDirpath));
+
+  if (setupValidRun()) {
+    const std::vector<char*> args{"--errors",
+                                  "--cache-dir",
+                                  cacheDirpath,
+                                  "--output",
+                                  const_cast<char*>(_outputFilepath),
+                                  const_cast<char*>(_inputFilepath)};
+
+    ProgramDriver driver;
+    ASSERT_EQ(EXIT_SUCCESS, driver.run(args.size(), (char**)args.data()));
+
+    // The output, and the entry it may be linked to, predate the input.
+    const struct timespec past[2] = {{0, UTIME_OMIT}, {1, 0}};
+    ASSERT_EQ(0, utimensat(AT_FDCWD, "./ProgramDriverTestOutput.h", past, 0));
+    ASSERT_EQ(0, utimensat(AT_FDCWD, _inputFilepath, nullptr, 0));
+
+    // The second run fetches the files stored by the first, which are then
+    // no older than the input.
+    ASSERT_EQ(EXIT_SUCCESS, driver.run(args.size(), (char**)args.data()));
+
+    struct stat inputSt, outputSt;
+    ASSERT_EQ(0, stat(_inputFilepath, &inputSt));
+    ASSERT_EQ(0, stat("./ProgramDriverTestOutput.h", &outputSt));
+    ASSERT_FALSE(
+        std::make_pair(inputSt.st_mtim.tv_sec, inputSt.st_mtim.tv_nsec) >
+        std::make_pair(outputSt.st_mtim.tv_sec, outputSt.st_mtim.tv_nsec));
+  }
+
+  nftw(cacheDirpath,
+       [](const char* path, const struct stat*, int, struct FTW*) -> int {
+         return remove(path);
+       },
+       16, FTW_DEPTH | FTW_PHYS);
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,182 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/ProofCache.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+using sl::runtime::ProofCache;
+using sl::runtime::TypeHandle;
+
+// -----------------------------------------------------------------------------
+
+class ProofCacheTests : public ::testing::Test
+{
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProofCacheTests, TestLookupAfterInsert)
+{
+  ProofCache cache(2);
+
+  int node1 = 0;
+  int node2 = 0;
+  TypeHandle type;
+
+  ASSERT_FALSE(cache.lookup(0, &node1, &type));
+
+  cache.insert(0, &node1, TypeHandle(7));
+  cache.insert(1, &node1, TypeHandle(8));
+
+  ASSERT_TRUE(cache.lookup(0, &node1, &type));
+  ASSERT_EQ(TypeHandle(7), type);
+  ASSERT_TRUE(cache.lookup(1, &node1, &type));
+  ASSERT_EQ(TypeHandle(8), type);
+  ASSERT_FALSE(cache.lookup(0, &node2, &type));
+
+  cache.insert(0, &node1, TypeHandle(9));
+  ASSERT_TRUE(cache.lookup(0, &node1, &type));
+  ASSERT_EQ(TypeHandle(9), type);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProofCacheTests, TestOutOfRangePathIsNeverCached)
+{
+  ProofCache cache(1);
+
+  int node = 0;
+  TypeHandle type;
+
+  cache.insert(1, &node, TypeHandle(7));
+  ASSERT_FALSE(cache.lookup(1, &node, &type));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProofCacheTests, TestInvalidateMakesEntriesStale)
+{
+  ProofCache cache(1);
+
+  int node = 0;
+  TypeHandle type;
+
+  const uint32_t generation = cache.generation();
+  cache.insert(0, &node, TypeHandle(7));
+  cache.invalidate();
+
+  ASSERT_NE(generation, cache.generation());
+  ASSERT_FALSE(cache.lookup(0, &node, &type));
+
+  cache.insert(0, &node, TypeHandle(8));
+  ASSERT_TRUE(cache.lookup(0, &node, &type));
+  ASSERT_EQ(TypeHandle(8), type);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProofCacheTests, TestInsertIsDroppedWhenTableIsFull)
+{
+  ProofCache cache(1, 4);
+
+  std::vector<int> nodes(5);
+  for (auto& node : nodes) {
+    cache.insert(0, &node, TypeHandle(1));
+  }
+
+  size_t hits = 0;
+  TypeHandle type;
+  for (const auto& node : nodes) {
+    hits += cache.lookup(0, &node, &type);
+  }
+  ASSERT_EQ(4, hits);
+
+  cache.clear();
+  ASSERT_FALSE(cache.lookup(0, &nodes[0], &type));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProofCacheTests, TestStaleSlotsAreReclaimed)
+{
+  ProofCache cache(1, 16);
+
+  // Every generation brings as many new nodes as there are slots, which only
+  // fit in the slots of the nodes of the previous generations.
+  std::vector<int> nodes(16 * 8);
+  for (size_t i = 0; i < nodes.size(); i += 16) {
+    cache.invalidate();
+    for (size_t j = i; j < i + 16; ++j) {
+      cache.insert(0, &nodes[j], TypeHandle(j + 1));
+    }
+
+    TypeHandle type;
+    for (size_t j = i; j < i + 16; ++j) {
+      ASSERT_TRUE(cache.lookup(0, &nodes[j], &type));
+      ASSERT_EQ(TypeHandle(j + 1), type);
+    }
+    if (i) {
+      ASSERT_FALSE(cache.lookup(0, &nodes[i - 1], &type));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ProofCacheTests, TestConcurrentInsertAndLookup)
+{
+  ProofCache cache(2, 4096);
+
+  std::vector<int> nodes(1000);
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache, &nodes, t]() {
+      for (size_t i = 0; i < nodes.size(); ++i) {
+        const size_t path = (i + t) % 2;
+        TypeHandle type;
+        if (cache.lookup(path, &nodes[i], &type)) {
+          ASSERT_EQ(TypeHandle(i + 1), type);
+        } else {
+          cache.insert(path, &nodes[i], TypeHandle(i + 1));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    TypeHandle type;
+    ASSERT_TRUE(cache.lookup(0, &nodes[i], &type));
+    ASSERT_EQ(TypeHandle(i + 1), type);
+  }
+}
+
+// -----------------------------------------------------------------------------
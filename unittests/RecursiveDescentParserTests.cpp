@@ -0,0 +1,652 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "CompilerErrorHandlerRegistrar.h"
+#include "ast.h"
+#include "parser/ParserDriver.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+class RecursiveDescentParserTests : public ::testing::Test
+{
+protected:
+  /**
+   * Parses `input` with the recursive-descent parser, collecting the error
+   * messages reported.
+   */
+  int parse(const char* input, ParserDriver* driver,
+            std::vector<std::string>* errors)
+  {
+    auto errorHandlerHook = [&](CompilerError error) -> void {
+      errors->push_back(error.msg);
+    };
+
+    ScopedCompilerErrorHandlerRegister scopedCompilerErrorHandlerRegister(
+        errorHandlerHook);
+
+    driver->setUseRecursiveDescentParser(true);
+
+    return driver->parseFromString(input);
+  }
+
+  /**
+   * Renders a module with every field of its nodes, so that two modules
+   * compare equal only if they are the same.
+   */
+  static std::string dump(const ASTModule& module)
+  {
+    std::string res;
+    for (const auto& import : module.imports()) {
+      res += "import " + import.name() + ";";
+    }
+    for (const auto& inferenceGroup : module.inferenceGroups()) {
+      res += "group " + inferenceGroup.name() + ":" +
+             inferenceGroup.baseName() + " {";
+      for (const auto& environmentDefn : inferenceGroup.environmentDefns()) {
+        res += environmentDefn.field() + ":" + environmentDefn.value() + ";";
+      }
+      res += "dispatch:[";
+      for (const auto& dispatchEntry : inferenceGroup.dispatchEntries()) {
+        res += dispatchEntry.key() + ":";
+        for (const auto& inferenceName : dispatchEntry.inferenceNames()) {
+          res += inferenceName + ",";
+        }
+        res += ";";
+      }
+      res += "]";
+      for (const auto& inferenceDefn : inferenceGroup.inferenceDefns()) {
+        res += "inference " + inferenceDefn.name() + " {globals:[";
+        for (const auto& globalDecl : inferenceDefn.globalDecls()) {
+          res += globalDecl.name() + ",";
+        }
+        res += "]arguments:[";
+        for (const auto& argument : inferenceDefn.arguments()) {
+          res += argument.name() + ":" + argument.typeName() + ",";
+        }
+        res += "]premises:[";
+        res += dump(inferenceDefn.premiseDefns());
+        res += "]proposition:";
+        res += dump(inferenceDefn.propositionDefn().target());
+        res += ";}";
+      }
+      res += "}";
+    }
+    return res;
+  }
+
+  static std::string dump(const ASTPremiseDefnList& premiseDefns)
+  {
+    std::string res;
+    for (const auto& premiseDefn : premiseDefns) {
+      if (premiseDefn.isType<ASTInferencePremiseDefn>()) {
+        const auto& defn = premiseDefn.value<ASTInferencePremiseDefn>();
+        for (const auto& identifier : defn.source().identifiers()) {
+          res += identifier.value() + ".";
+        }
+        res += ":" + dump(defn.deductionTarget());
+        if (defn.hasWhileClause()) {
+          res += " while {" + dump(defn.whileClause().premiseDefns()) + "}";
+        }
+      } else {
+        const auto& defn = premiseDefn.value<ASTInferenceEqualityDefn>();
+        res += dump(defn.lhs());
+        res += " " + std::to_string(static_cast<int>(defn.oprt())) + " ";
+        res += dump(defn.rhs());
+        if (defn.hasRangeClause()) {
+          const auto& rangeClause = defn.rangeClause();
+          res += " inrange " + std::to_string(rangeClause.lhsIdx()) + ".." +
+                 std::to_string(rangeClause.rhsIdx()) + ".." +
+                 dump(rangeClause.deductionTarget());
+        }
+      }
+      res += ";";
+    }
+    return res;
+  }
+
+  static std::string dump(const ASTDeductionTarget& deductionTarget)
+  {
+    if (deductionTarget.isType<ASTDeductionTargetSingular>()) {
+      return deductionTarget.value<ASTDeductionTargetSingular>().name();
+    }
+    if (deductionTarget.isType<ASTDeductionTargetArray>()) {
+      const auto& target = deductionTarget.value<ASTDeductionTargetArray>();
+      return target.name() + "[" +
+             (target.hasSizeLiteral() ? std::to_string(target.sizeLiteral())
+                                      : std::string()) +
+             "]";
+    }
+    const auto& target = deductionTarget.value<ASTDeductionTargetComputed>();
+    std::string res = target.name() + "(";
+    for (const auto& argument : target.arguments()) {
+      res += dump(argument) + ",";
+    }
+    return res + ")";
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestParsingSameModuleAsBisonParser)
+{
+  // clang-format off
+  const char* INPUT =
+    "import common.base;"
+    "import rules;"
+    ""
+    "group MyGroup {"
+      "TypeClass                 : TypeDefn;"
+      "ProofMethod               : proveType;"
+      ""
+      "dispatch: ["
+        "CallExpr                  : MethodCall, FunctionCall;"
+        "ReturnStmt                : Return;"
+      "]"
+      ""
+      "inference MethodCall {"
+        "globals: ["
+          "SELF_TYPE, VOID_TYPE"
+        "]"
+        "arguments: ["
+          "call                      : ASTExpr,"
+          "scope                     : Scope"
+        "]"
+        "premises: ["
+          "call.callee.argument_types : ArgumentTypes[];"
+          "call.callee : CalleeType while {"
+            "call.callee.return_type : ReturnType[2];"
+            "ReturnType[2] = SELF_TYPE;"
+          "};"
+          "ArgumentTypes[] <= ParameterTypes[] inrange 0..1..ParameterTypes[];"
+          "CalleeType != VOID_TYPE;"
+          "CalleeType < lookup(scope, CalleeType);"
+        "]"
+        "proposition : returnTypeOf(CalleeType, ArgumentTypes[]);"
+      "}"
+      ""
+      "inference FunctionCall {"
+        "arguments: []"
+        "premises: []"
+        "proposition : SELF_TYPE;"
+      "}"
+    "}"
+    ""
+    "group OtherGroup : BaseGroup {"
+      "inference Return {"
+        "arguments: ["
+          "stmt                      : ASTStmt"
+        "]"
+        "premises: ["
+          "stmt.value : ValueType;"
+        "]"
+        "proposition : ValueType;"
+      "}"
+    "}"
+  "";
+  // clang-format on
+
+  ParserDriver bisonDriver;
+  ASSERT_EQ(0, bisonDriver.parseFromString(INPUT));
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(0, parse(INPUT, &driver, &errors));
+  ASSERT_TRUE(errors.empty());
+
+  ASSERT_EQ(2, driver.module().imports().size());
+  ASSERT_EQ(2, driver.module().inferenceGroups().size());
+  ASSERT_EQ(dump(bisonDriver.module()), dump(driver.module()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestParsingEmptyInput)
+{
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(0, parse("", &driver, &errors));
+  ASSERT_TRUE(errors.empty());
+  ASSERT_TRUE(driver.module().inferenceGroups().empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestReportingEverySyntaxError)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {\n"
+    "  TypeClass : TypeDefn\n"
+    "  inference A {\n"
+    "    arguments: [ expr : ASTExpr ]\n"
+    "    premises: [\n"
+    "      expr.type : ExprType\n"
+    "      ExprType == OtherType;\n"
+    "      ExprType = OtherType;\n"
+    "    ]\n"
+    "    proposition : ExprType;\n"
+    "  }\n"
+    "  inference B {\n"
+    "    arguments: [ expr ASTExpr ]\n"
+    "    premises: []\n"
+    "    proposition ExprType;\n"
+    "  }\n"
+    "}\n"
+    "group\n";
+  // clang-format on
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(1, parse(INPUT, &driver, &errors));
+
+  const std::vector<std::string> EXPECTED_ERRORS{
+      "Parser error: syntax error, unexpected KEYWORD_INFERENCE, expecting "
+      "SEMICOLON [3.3-11]",
+      "Parser error: syntax error, unexpected IDENTIFIER, expecting "
+      "KEYWORD_WHILE or SEMICOLON [7.7-14]",
+      "Parser error: syntax error, unexpected IDENTIFIER, expecting COLON "
+      "[13.23-29]",
+      "Parser error: syntax error, unexpected IDENTIFIER, expecting COLON "
+      "[15.17-24]",
+      "Parser error: syntax error, unexpected end of file, expecting "
+      "IDENTIFIER [19.1]",
+  };
+  ASSERT_EQ(EXPECTED_ERRORS, errors);
+
+  // The module is left as it was when any error is found.
+  ASSERT_TRUE(driver.module().inferenceGroups().empty());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestRecoveringInsideWhileClause)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {\n"
+    "  inference A {\n"
+    "    arguments: []\n"
+    "    premises: [\n"
+    "      expr : ExprType while {\n"
+    "        ExprType ; OtherType = ExprType;\n"
+    "      };\n"
+    "      ExprType = ;\n"
+    "    ]\n"
+    "    proposition : ExprType;\n"
+    "  }\n"
+    "}\n";
+  // clang-format on
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(1, parse(INPUT, &driver, &errors));
+
+  const std::vector<std::string> EXPECTED_ERRORS{
+      "Parser error: syntax error, unexpected SEMICOLON, expecting "
+      "OPERATOR_EQ or OPERATOR_NEQ or OPERATOR_LT or OPERATOR_LTE [6.18]",
+      "Parser error: syntax error, unexpected SEMICOLON, expecting "
+      "IDENTIFIER [8.18]",
+  };
+  ASSERT_EQ(EXPECTED_ERRORS, errors);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestRecoveringAfterSkippedBlock)
+{
+  // Same as tests/fixtures/invalid_keyword.sl.
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {\n"
+    "  ClassName                      : MyInference;\n"
+    "  TypeClass                      : TypeCls;\n"
+    "  ProofMethod                    : proveType;\n"
+    "  TypeCmpMethod                  : cmpType;\n"
+    "\n"
+    "  inference MethodStaticDispatch {\n"
+    "    arguments: [\n"
+    "    ]\n"
+    "\n"
+    "    premises: [\n"
+    "      StaticMethodCallStmt.function_arguments  : ArgumentsTypes[] if {\n"
+    "        StaticMethodCallStmt.callee            : CalleeType;\n"
+    "      };\n"
+    "      StaticMethodCallStmt.callee.return_type  : ReturnType;\n"
+    "    ]\n"
+    "\n"
+    "    proposition : ReturnType;\n"
+    "  }\n"
+    "}\n";
+  // clang-format on
+
+  ParserDriver::Options opts{.suppressErrorMessages = true};
+  ParserDriver bisonDriver(opts);
+  ASSERT_EQ(1, bisonDriver.parseFromString(INPUT));
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(1, parse(INPUT, &driver, &errors));
+
+  // The `}` closing the skipped block does not end the premises.
+  ASSERT_EQ(1, errors.size());
+  ASSERT_EQ(1, bisonDriver.syntaxErrors().size());
+  ASSERT_EQ(bisonDriver.syntaxErrors().front().message,
+            driver.syntaxErrors().front().message);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestParsingUnknownSectionInsteadOfDispatch)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {\n"
+    "  TypeClass : TypeDefn;\n"
+    "  dispatches: [\n"
+    "    BinaryExpr : BinaryExprInference;\n"
+    "  ]\n"
+    "}\n";
+  // clang-format on
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(1, parse(INPUT, &driver, &errors));
+
+  const std::vector<std::string> EXPECTED_ERRORS{
+      "Parser error: syntax error, unexpected section \"dispatches\", "
+      "expecting dispatch [3.3-12]",
+  };
+  ASSERT_EQ(EXPECTED_ERRORS, errors);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestReportingSameExpectedTokensAsBison)
+{
+  // clang-format off
+  const char* INPUTS[] = {
+    // The value of an environment definition, or a dispatch section.
+    "group MyGroup {\n"
+    "  ClassName : ;\n"
+    "}\n",
+    // A member of the source of a premise, or its deduction target.
+    "group MyGroup {\n"
+    "  inference A {\n"
+    "    arguments: []\n"
+    "    premises: [\n"
+    "      expr.type Type;\n"
+    "    ]\n"
+    "    proposition : Type;\n"
+    "  }\n"
+    "}\n",
+    // The size of an array, or the end of it.
+    "group MyGroup {\n"
+    "  inference A {\n"
+    "    arguments: []\n"
+    "    premises: [\n"
+    "      expr : Types[N];\n"
+    "    ]\n"
+    "    proposition : Type;\n"
+    "  }\n"
+    "}\n",
+  };
+  // clang-format on
+
+  const char* EXPECTED_ERRORS[] = {
+      "Parser error: syntax error, unexpected SEMICOLON, expecting "
+      "IDENTIFIER or LBRACKET [2.15]",
+      "Parser error: syntax error, unexpected IDENTIFIER, expecting DOT or "
+      "COLON [5.17-20]",
+      "Parser error: syntax error, unexpected IDENTIFIER, expecting "
+      "INTEGER_LITERAL or RBRACKET [5.20]",
+  };
+
+  for (size_t i = 0; i < sizeof(INPUTS) / sizeof(INPUTS[0]); ++i) {
+    ParserDriver::Options opts{.suppressErrorMessages = true};
+    ParserDriver bisonDriver(opts);
+    ASSERT_EQ(1, bisonDriver.parseFromString(INPUTS[i]));
+
+    ParserDriver driver;
+    std::vector<std::string> errors;
+    ASSERT_EQ(1, parse(INPUTS[i], &driver, &errors));
+
+    ASSERT_EQ(EXPECTED_ERRORS[i], errors.front());
+    ASSERT_EQ(1, bisonDriver.syntaxErrors().size());
+    ASSERT_EQ(bisonDriver.syntaxErrors().front().message,
+              driver.syntaxErrors().front().message);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestParsingUnknownSectionWithSyntaxError)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {\n"
+    "  ClassName : [\n"
+    "    CallExpr : CallInference\n"
+    "  ]\n"
+    "}\n";
+  // clang-format on
+
+  ParserDriver::Options opts{.suppressErrorMessages = true};
+  ParserDriver bisonDriver(opts);
+  ASSERT_EQ(1, bisonDriver.parseFromString(INPUT));
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(1, parse(INPUT, &driver, &errors));
+
+  // The name of the section is checked once the section has been parsed, so
+  // the first error is the same as the one of the bison parser.
+  const std::vector<std::string> EXPECTED_ERRORS{
+      "Parser error: syntax error, unexpected RBRACKET, expecting COMMA or "
+      "SEMICOLON [4.3]",
+      "Parser error: syntax error, unexpected section \"ClassName\", "
+      "expecting dispatch [2.3-11]",
+  };
+  ASSERT_EQ(EXPECTED_ERRORS, errors);
+  ASSERT_EQ(1, bisonDriver.syntaxErrors().size());
+  ASSERT_EQ(bisonDriver.syntaxErrors().front().message,
+            driver.syntaxErrors().front().message);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestParsingUnknownDirectiveInsteadOfImport)
+{
+  // clang-format off
+  const char* INPUT =
+    "import common.base;\n"
+    "include common.rules;\n"
+    "group MyGroup : BaseGroup {\n"
+    "}\n";
+  // clang-format on
+
+  ParserDriver::Options opts{.suppressErrorMessages = true};
+  ParserDriver bisonDriver(opts);
+  ASSERT_EQ(1, bisonDriver.parseFromString(INPUT));
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(1, parse(INPUT, &driver, &errors));
+
+  // Same first error as the bison parser.
+  const std::vector<std::string> EXPECTED_ERRORS{
+      "Parser error: syntax error, unexpected \"include\", expecting import "
+      "[2.1-7]",
+  };
+  ASSERT_EQ(EXPECTED_ERRORS, errors);
+  ASSERT_EQ(1, bisonDriver.syntaxErrors().size());
+  ASSERT_EQ(bisonDriver.syntaxErrors().front().message,
+            driver.syntaxErrors().front().message);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestReparsingInferenceDefn)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {\n"
+    "  TypeClass : TypeDefn;\n"
+    "  inference A {\n"
+    "    arguments: []\n"
+    "    premises: []\n"
+    "    proposition : TypeA;\n"
+    "  }\n"
+    "  inference B {\n"
+    "    arguments: []\n"
+    "    premises: []\n"
+    "    proposition : TypeB;\n"
+    "  }\n"
+    "}\n";
+  // clang-format on
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(0, parse(INPUT, &driver, &errors));
+
+  const auto& inferenceDefns =
+      driver.module().inferenceGroups()[0].inferenceDefns();
+  const ASTInferenceDefn* inferenceDefnA = &inferenceDefns[0];
+  const ASTPropositionDefn* propositionDefnA =
+      &inferenceDefns[0].propositionDefn();
+
+  const std::string input(INPUT);
+  ASSERT_EQ(0, driver.reparse(ParserDriver::TextEdit{
+                   input.rfind("premises: []"), 12,
+                   "premises: [\n      call.args : ArgTypes[];\n    ]"}));
+  ASSERT_EQ(0, driver.reparse(ParserDriver::TextEdit{
+                   driver.input().find("TypeB"), 5, "TypeC"}));
+
+  // Only the edited inference definition is replaced.
+  ASSERT_EQ(inferenceDefnA, &inferenceDefns[0]);
+  ASSERT_EQ(propositionDefnA, &inferenceDefns[0].propositionDefn());
+
+  ASSERT_EQ(1, inferenceDefns[1].premiseDefns().size());
+  ASSERT_EQ("TypeC", inferenceDefns[1]
+                         .propositionDefn()
+                         .target()
+                         .value<ASTDeductionTargetSingular>()
+                         .name());
+
+  ParserDriver expectedDriver;
+  ASSERT_EQ(0, expectedDriver.parseFromString(driver.input().c_str()));
+  ASSERT_EQ(dump(expectedDriver.module()), dump(driver.module()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestReparsingGroupSections)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {\n"
+    "  TypeClass : TypeDefn;\n"
+    "  inference A {\n"
+    "    arguments: []\n"
+    "    premises: []\n"
+    "    proposition : TypeA;\n"
+    "  }\n"
+    "}\n";
+  // clang-format on
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(0, parse(INPUT, &driver, &errors));
+
+  const auto& inferenceGroup = driver.module().inferenceGroups()[0];
+  const ASTInferenceDefn* inferenceDefn = &inferenceGroup.inferenceDefns()[0];
+
+  const std::string input(INPUT);
+  ASSERT_EQ(0, driver.reparse(ParserDriver::TextEdit{
+                   input.find("TypeDefn;") + 9, 0,
+                   "\n  dispatch: [\n    CallExpr : A;\n  ]"}));
+
+  ASSERT_EQ(1, inferenceGroup.environmentDefns().size());
+  ASSERT_EQ(1, inferenceGroup.dispatchEntries().size());
+  ASSERT_EQ("CallExpr", inferenceGroup.dispatchEntries()[0].key());
+  ASSERT_EQ(inferenceDefn, &inferenceGroup.inferenceDefns()[0]);
+
+  // Blanks between inference definitions are not reparsed.
+  const size_t offset = driver.input().find("  inference");
+  ASSERT_EQ(0, driver.reparse(ParserDriver::TextEdit{offset, 0, "\n\n"}));
+  ASSERT_EQ(inferenceDefn, &inferenceGroup.inferenceDefns()[0]);
+
+  ParserDriver expectedDriver;
+  ASSERT_EQ(0, expectedDriver.parseFromString(driver.input().c_str()));
+  ASSERT_EQ(dump(expectedDriver.module()), dump(driver.module()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(RecursiveDescentParserTests, TestReparsingWholeInput)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {\n"
+    "  inference A {\n"
+    "    arguments: []\n"
+    "    premises: []\n"
+    "    proposition : TypeA;\n"
+    "  }\n"
+    "}\n";
+  // clang-format on
+
+  ParserDriver driver;
+  std::vector<std::string> errors;
+  ASSERT_EQ(0, parse(INPUT, &driver, &errors));
+
+  // The name of a group is outside of any part that can be reparsed.
+  ASSERT_EQ(0, driver.reparse(ParserDriver::TextEdit{6, 7, "OtherGroup"}));
+  ASSERT_EQ("OtherGroup", driver.module().inferenceGroups()[0].name());
+
+  // An edit that breaks an inference definition reports the error from the
+  // whole input.
+  auto errorHandlerHook = [&](CompilerError error) -> void {
+    errors.push_back(error.msg);
+  };
+
+  ScopedCompilerErrorHandlerRegister scopedCompilerErrorHandlerRegister(
+      errorHandlerHook);
+
+  const size_t offset = driver.input().find("TypeA;") + 5;
+  ASSERT_EQ(1, driver.reparse(ParserDriver::TextEdit{offset, 1, ""}));
+
+  const std::vector<std::string> EXPECTED_ERRORS{
+      "Parser error: syntax error, unexpected RBRACE, expecting SEMICOLON "
+      "[6.3]",
+  };
+  ASSERT_EQ(EXPECTED_ERRORS, errors);
+
+  ASSERT_EQ(-1, driver.reparse(ParserDriver::TextEdit{
+                    driver.input().size(), 1, ""}));
+}
+
+// -----------------------------------------------------------------------------
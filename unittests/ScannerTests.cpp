@@ -0,0 +1,204 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "parser/ParserDriver.h"
+#include "parser/Scanner.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+typedef yy::Parser::symbol_kind SymbolKind;
+
+// -----------------------------------------------------------------------------
+
+class ScannerTests : public ::testing::Test
+{
+protected:
+  std::vector<SymbolKind::symbol_kind_type> scanKinds(const char* input) const
+  {
+    std::vector<SymbolKind::symbol_kind_type> kinds;
+    Scanner scanner(input, strlen(input));
+    for (;;) {
+      const auto symbol = scanner.next();
+      kinds.push_back(symbol.kind());
+      if (symbol.kind() == SymbolKind::S_YYEOF) {
+        break;
+      }
+    }
+    return kinds;
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ScannerTests, TestKeywordsAndIdentifiers)
+{
+  const std::vector<SymbolKind::symbol_kind_type> EXPECTED_KINDS{
+      SymbolKind::S_KEYWORD_GROUP,       SymbolKind::S_KEYWORD_INFERENCE,
+      SymbolKind::S_KEYWORD_ENVIRONMENT, SymbolKind::S_KEYWORD_ARGUMENTS,
+      SymbolKind::S_KEYWORD_GLOBALS,     SymbolKind::S_KEYWORD_WHILE,
+      SymbolKind::S_KEYWORD_INRANGE,     SymbolKind::S_KEYWORD_PREMISES,
+      SymbolKind::S_KEYWORD_PROPOSITION, SymbolKind::S_IDENTIFIER,
+      SymbolKind::S_IDENTIFIER,          SymbolKind::S_IDENTIFIER,
+      SymbolKind::S_IDENTIFIER,          SymbolKind::S_YYEOF,
+  };
+
+  ASSERT_EQ(EXPECTED_KINDS,
+            scanKinds("group inference environment arguments globals while "
+                      "inrange premises proposition groups Group dispatch "
+                      "_while9"));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ScannerTests, TestPunctuationAndOperators)
+{
+  const std::vector<SymbolKind::symbol_kind_type> EXPECTED_KINDS{
+      SymbolKind::S_COLON,        SymbolKind::S_SEMICOLON,
+      SymbolKind::S_OPERATOR_EQ,  SymbolKind::S_OPERATOR_NEQ,
+      SymbolKind::S_OPERATOR_LT,  SymbolKind::S_OPERATOR_LTE,
+      SymbolKind::S_DOT,          SymbolKind::S_ELLIPSIS,
+      SymbolKind::S_COMMA,        SymbolKind::S_LBRACKET,
+      SymbolKind::S_RBRACKET,     SymbolKind::S_LBRACE,
+      SymbolKind::S_RBRACE,       SymbolKind::S_LPAREN,
+      SymbolKind::S_RPAREN,       SymbolKind::S_OPERATOR_NEQ,
+      SymbolKind::S_OPERATOR_EQ,  SymbolKind::S_YYEOF,
+  };
+
+  ASSERT_EQ(EXPECTED_KINDS, scanKinds(":;=!=<<=. ..,[]{}()!=="));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ScannerTests, TestIdentifierAndIntegerValues)
+{
+  const char* INPUT =
+      "StaticMethodCallStmt.function_arguments_of_a_very_long_call_expression"
+      "[16] 0 007 9223372036854775807 9223372036854775808";
+  Scanner scanner(INPUT, strlen(INPUT));
+
+  const auto source = scanner.next();
+  ASSERT_EQ(SymbolKind::S_IDENTIFIER, source.kind());
+  ASSERT_EQ("StaticMethodCallStmt", source.value.as<std::string>());
+
+  ASSERT_EQ(SymbolKind::S_DOT, scanner.next().kind());
+
+  const auto member = scanner.next();
+  ASSERT_EQ(SymbolKind::S_IDENTIFIER, member.kind());
+  ASSERT_EQ("function_arguments_of_a_very_long_call_expression",
+            member.value.as<std::string>());
+
+  ASSERT_EQ(SymbolKind::S_LBRACKET, scanner.next().kind());
+
+  const auto arraySize = scanner.next();
+  ASSERT_EQ(SymbolKind::S_INTEGER_LITERAL, arraySize.kind());
+  ASSERT_EQ(16, arraySize.value.as<uint64_t>());
+
+  ASSERT_EQ(SymbolKind::S_RBRACKET, scanner.next().kind());
+
+  ASSERT_EQ(0, scanner.next().value.as<uint64_t>());
+  ASSERT_EQ(7, scanner.next().value.as<uint64_t>());
+  ASSERT_EQ(9223372036854775807ull, scanner.next().value.as<uint64_t>());
+
+  // Out of the range of `long`.
+  ASSERT_EQ(0, scanner.next().value.as<uint64_t>());
+
+  ASSERT_EQ(SymbolKind::S_YYEOF, scanner.next().kind());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ScannerTests, TestLocations)
+{
+  const char* INPUT = "group\tMyGroup {\n\n  ClassName @: MyClass;\r\n}";
+  Scanner scanner(INPUT, strlen(INPUT));
+
+  const auto assertLocation = [&](int beginLine, int beginColumn,
+                                  int endLine, int endColumn) {
+    const auto symbol = scanner.next();
+    ASSERT_EQ(beginLine, symbol.location.begin.line);
+    ASSERT_EQ(beginColumn, symbol.location.begin.column);
+    ASSERT_EQ(endLine, symbol.location.end.line);
+    ASSERT_EQ(endColumn, symbol.location.end.column);
+  };
+
+  assertLocation(1, 1, 1, 6);   // group
+  assertLocation(1, 7, 1, 14);  // MyGroup
+  assertLocation(1, 15, 1, 16); // {
+  assertLocation(3, 3, 3, 12);  // ClassName
+
+  // Ignored characters count towards the location of the next token.
+  assertLocation(3, 13, 3, 15); // @:
+
+  assertLocation(3, 16, 3, 23); // MyClass
+  assertLocation(3, 23, 3, 24); // ;
+  assertLocation(4, 1, 4, 2);   // }
+  assertLocation(4, 2, 4, 2);   // end of file
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(ScannerTests, TestParsingWithScanner)
+{
+  ParserDriver::Options opts{.traceLexer = false,
+                             .traceParser = false,
+                             .suppressErrorMessages = false,
+                             .useSimdScanner = true};
+  ParserDriver driver(opts);
+
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "TypeClass                 : TypeDefn;"
+      ""
+      "inference MethodStaticDispatch {"
+        "arguments: ["
+          "call                   : ASTExpr"
+        "]"
+        "premises: ["
+          "call.argument_types    : ArgumentTypes[2];"
+          "ArgumentTypes[] <= ParameterTypes[] inrange 0..1..ParameterTypes[];"
+        "]"
+        "proposition : ReturnType;"
+      "}"
+    "}"
+  "";
+  // clang-format on
+
+  ASSERT_EQ(0, driver.parseFromString(INPUT));
+
+  const auto& inferenceGroups = driver.module().inferenceGroups();
+  ASSERT_EQ(1, inferenceGroups.size());
+  ASSERT_EQ("MyGroup", inferenceGroups[0].name());
+
+  const auto& inferenceDefns = inferenceGroups[0].inferenceDefns();
+  ASSERT_EQ(1, inferenceDefns.size());
+  ASSERT_EQ("MethodStaticDispatch", inferenceDefns[0].name());
+  ASSERT_EQ(2, inferenceDefns[0].premiseDefns().size());
+}
+
+// -----------------------------------------------------------------------------
@@ -481,3 +481,417 @@ TEST_F(SemanticAnalyzerTests, TestValidInputWithAllComputedTargetTypes)
 }
 
 // --------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithValidDispatchSection)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeClass          : TypeCls;"
+      "ProofMethod        : proveType;"
+      "TypeCmpMethod      : cmpType;"
+      "DispatchKeyClass   : NodeKind;"
+      ""
+      "dispatch: ["
+        "BinaryExpr : BinaryExprInference;"
+        "UnaryExpr  : BinaryExprInference;"
+      "]"
+      ""
+      "inference BinaryExprInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.lhs : LhsType;"
+        "]"
+        "proposition : LhsType;"
+      "}"
+      ""
+      "inference CallExprInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  assertNoError(INPUT);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithDispatchSectionWithoutKeyClass)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeClass          : TypeCls;"
+      "ProofMethod        : proveType;"
+      "TypeCmpMethod      : cmpType;"
+      ""
+      "dispatch: ["
+        "BinaryExpr : BinaryExprInference;"
+      "]"
+      ""
+      "inference BinaryExprInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.lhs : LhsType;"
+        "]"
+        "proposition : LhsType;"
+      "}"
+      ""
+      "inference CallExprInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  const char* msg =
+      "Missing required environment definition field \"DispatchKeyClass\".";
+
+  assertFirstError(INPUT, msg);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithRepeatedDispatchKey)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeClass          : TypeCls;"
+      "ProofMethod        : proveType;"
+      "TypeCmpMethod      : cmpType;"
+      "DispatchKeyClass   : NodeKind;"
+      ""
+      "dispatch: ["
+        "BinaryExpr : BinaryExprInference;"
+        "BinaryExpr : BinaryExprInference;"
+      "]"
+      ""
+      "inference BinaryExprInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.lhs : LhsType;"
+        "]"
+        "proposition : LhsType;"
+      "}"
+      ""
+      "inference CallExprInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  const char* msg = "Found repeated dispatch key \"BinaryExpr\".";
+
+  assertFirstError(INPUT, msg);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithUnknownInferenceInDispatchSection)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeClass          : TypeCls;"
+      "ProofMethod        : proveType;"
+      "TypeCmpMethod      : cmpType;"
+      "DispatchKeyClass   : NodeKind;"
+      ""
+      "dispatch: ["
+        "BinaryExpr : UnaryExprInference;"
+      "]"
+      ""
+      "inference BinaryExprInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.lhs : LhsType;"
+        "]"
+        "proposition : LhsType;"
+      "}"
+      ""
+      "inference CallExprInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  const char* msg = "Unknown inference \"UnaryExprInference\" used in "
+                    "dispatch key \"BinaryExpr\".";
+
+  assertFirstError(INPUT, msg);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithIncompatibleInferencesInDispatchSection)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeClass          : TypeCls;"
+      "ProofMethod        : proveType;"
+      "TypeCmpMethod      : cmpType;"
+      "DispatchKeyClass   : NodeKind;"
+      ""
+      "dispatch: ["
+        "BinaryExpr : BinaryExprInference;"
+        "CallExpr   : CallExprInference;"
+      "]"
+      ""
+      "inference BinaryExprInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.lhs : LhsType;"
+        "]"
+        "proposition : LhsType;"
+      "}"
+      ""
+      "inference CallExprInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  const char* msg = "Arguments of inference \"CallExprInference\" do not "
+                    "match with those of inference \"BinaryExprInference\" "
+                    "in dispatch.";
+
+  assertFirstError(INPUT, msg);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithIncompatibleInferencesInTryAllMethod)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeClass          : TypeCls;"
+      "ProofMethod        : proveType;"
+      "TypeCmpMethod      : cmpType;"
+      "TryAllMethod       : tryAll;"
+      ""
+      "inference BinaryExprInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.lhs : LhsType;"
+        "]"
+        "proposition : LhsType;"
+      "}"
+      ""
+      "inference UnaryExprInference {"
+        "arguments: ["
+          "operand : ASTExpr"
+        "]"
+        "premises: ["
+          "operand.value : ValueType;"
+        "]"
+        "proposition : ValueType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  const char* msg = "Arguments of inference \"UnaryExprInference\" do not "
+                    "match with those of inference \"BinaryExprInference\" "
+                    "in try-all method.";
+
+  assertFirstError(INPUT, msg);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithSnowlakeTypeRuntime)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeRuntime        : snowlake;"
+      "ProofMethod        : proveType;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  assertNoError(INPUT);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithUnsupportedTypeRuntime)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeRuntime        : boost;"
+      "ProofMethod        : proveType;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  const char* msg = "Unsupported type runtime \"boost\".";
+
+  assertFirstError(INPUT, msg);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithProofCacheWithoutTypeRuntime)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeClass          : TypeCls;"
+      "ProofMethod        : proveType;"
+      "TypeCmpMethod      : cmpType;"
+      "ProofCache         : proofCache;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  const char* msg =
+      "Environment field \"ProofCache\" requires field \"TypeRuntime\".";
+
+  assertFirstError(INPUT, msg);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithSubtypeComparisonWithoutSubtypeOracle)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup {"
+      "ClassName          : MyGroup;"
+      "TypeRuntime        : snowlake;"
+      "ProofMethod        : proveType;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.caller_type : CallerType while {"
+            "call.expected : ExpectedType;"
+            "CalleeType <= ExpectedType;"
+          "};"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  const char* msg = "Subtype comparisons with environment field "
+                    "\"TypeRuntime\" require field \"SubtypeOracle\".";
+
+  assertFirstError(INPUT, msg);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SemanticAnalyzerTests, TestWithUnknownBaseInferenceGroup)
+{
+  // clang-format off
+  const char* INPUT =
+    "group MyGroup : BaseGroup {"
+      "ClassName          : MyGroup;"
+      "TypeClass          : TypeCls;"
+      "ProofMethod        : proveType;"
+      "TypeCmpMethod      : cmpType;"
+    "}"
+    "";
+  // clang-format on
+
+  const char* msg = "Unknown base inference group \"BaseGroup\".";
+
+  assertFirstError(INPUT, msg);
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,159 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/SubtypeOracle.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+using sl::runtime::SubtypeOracle;
+using sl::runtime::TypeHandle;
+using sl::runtime::TypeTable;
+
+// -----------------------------------------------------------------------------
+
+class SubtypeOracleTests : public ::testing::Test
+{
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SubtypeOracleTests, TestSingleInheritanceChain)
+{
+  TypeTable table;
+  SubtypeOracle oracle;
+
+  const TypeHandle object = table.intern("Object");
+  const TypeHandle number = table.intern("Number");
+  const TypeHandle integer = table.intern("Integer");
+
+  ASSERT_TRUE(oracle.addType(object));
+  ASSERT_TRUE(oracle.addType(number, {object}));
+  ASSERT_TRUE(oracle.addType(integer, {number}));
+  ASSERT_EQ(3, oracle.size());
+
+  ASSERT_TRUE(oracle.isSubtype(integer, integer));
+  ASSERT_TRUE(oracle.isSubtype(integer, number));
+  ASSERT_TRUE(oracle.isSubtype(integer, object));
+  ASSERT_TRUE(oracle.isSubtype(number, object));
+  ASSERT_FALSE(oracle.isSubtype(object, number));
+  ASSERT_FALSE(oracle.isSubtype(number, integer));
+
+  ASSERT_FALSE(oracle.isProperSubtype(integer, integer));
+  ASSERT_TRUE(oracle.isProperSubtype(integer, object));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SubtypeOracleTests, TestMultipleSupertypes)
+{
+  TypeTable table;
+  SubtypeOracle oracle;
+
+  const TypeHandle object = table.intern("Object");
+  const TypeHandle readable = table.intern("Readable");
+  const TypeHandle writable = table.intern("Writable");
+  const TypeHandle stream = table.intern("Stream");
+
+  ASSERT_TRUE(oracle.addType(object));
+  ASSERT_TRUE(oracle.addType(readable, {object}));
+  ASSERT_TRUE(oracle.addType(writable, {object}));
+  ASSERT_TRUE(oracle.addType(stream, {readable, writable}));
+
+  ASSERT_TRUE(oracle.isSubtype(stream, readable));
+  ASSERT_TRUE(oracle.isSubtype(stream, writable));
+  ASSERT_TRUE(oracle.isSubtype(stream, object));
+  ASSERT_FALSE(oracle.isSubtype(readable, writable));
+  ASSERT_FALSE(oracle.isSubtype(writable, readable));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SubtypeOracleTests, TestRejectsInvalidRegistrations)
+{
+  TypeTable table;
+  SubtypeOracle oracle;
+
+  const TypeHandle object = table.intern("Object");
+  const TypeHandle number = table.intern("Number");
+
+  ASSERT_FALSE(oracle.addType(TypeHandle()));
+  ASSERT_FALSE(oracle.addType(number, {object}));
+  ASSERT_FALSE(oracle.contains(number));
+
+  ASSERT_TRUE(oracle.addType(object));
+  ASSERT_FALSE(oracle.addType(object));
+  ASSERT_EQ(1, oracle.size());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SubtypeOracleTests, TestUnregisteredTypesAreOnlySubtypesOfThemselves)
+{
+  TypeTable table;
+  SubtypeOracle oracle;
+
+  const TypeHandle object = table.intern("Object");
+  const TypeHandle unknown = table.intern("Unknown");
+
+  ASSERT_TRUE(oracle.addType(object));
+
+  ASSERT_TRUE(oracle.isSubtype(unknown, unknown));
+  ASSERT_FALSE(oracle.isSubtype(unknown, object));
+  ASSERT_FALSE(oracle.isSubtype(object, unknown));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SubtypeOracleTests, TestDeepHierarchyAcrossWordBoundaries)
+{
+  TypeTable table;
+  SubtypeOracle oracle;
+
+  // A chain of 200 types, each a subtype of the previous one, alongside
+  // an unrelated root, which spans several words per ancestor bit-vector.
+  std::vector<TypeHandle> chain;
+  for (int i = 0; i < 200; ++i) {
+    const TypeHandle type = table.intern("T" + std::to_string(i));
+    if (chain.empty()) {
+      ASSERT_TRUE(oracle.addType(type));
+    } else {
+      ASSERT_TRUE(oracle.addType(type, {chain.back()}));
+    }
+    chain.push_back(type);
+  }
+
+  const TypeHandle other = table.intern("Other");
+  ASSERT_TRUE(oracle.addType(other));
+
+  ASSERT_TRUE(oracle.isSubtype(chain[199], chain[0]));
+  ASSERT_TRUE(oracle.isSubtype(chain[130], chain[64]));
+  ASSERT_TRUE(oracle.isSubtype(chain[64], chain[63]));
+  ASSERT_FALSE(oracle.isSubtype(chain[63], chain[64]));
+  ASSERT_FALSE(oracle.isSubtype(chain[199], other));
+  ASSERT_FALSE(oracle.isSubtype(other, chain[0]));
+}
+
+// -----------------------------------------------------------------------------
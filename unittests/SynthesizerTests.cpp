@@ -39,6 +39,12 @@ class SynthesizerTests : public ::testing::Test
 {
 protected:
   void testSynthesisWithSuccess(const char* input)
+  {
+    testSynthesisWithSuccess(input, defaultOptions());
+  }
+
+  void testSynthesisWithSuccess(const char* input,
+                                const Synthesizer::Options& opts)
   {
     ASTModule module;
     bool res;
@@ -48,16 +54,24 @@ protected:
     res = analyzer.run(module);
     ASSERT_TRUE(res);
 
-    Synthesizer::Options opts{
+    Synthesizer synthesizer(opts);
+
+    res = synthesizer.run(module);
+    ASSERT_TRUE(res);
+  }
+
+  Synthesizer::Options defaultOptions() const
+  {
+    return Synthesizer::Options{
         .useException = false,
         .suppressAnnotationComments = false,
+        .usePolicyTemplate = false,
+        .useColdFailurePaths = false,
+        .emitInstrumentation = false,
+        .useLightHeaders = false,
         .inputFilepath = "./SampleInput.sl", // give it a dummy filepath
         .outputPath = outputPath,
     };
-    Synthesizer synthesizer(opts);
-
-    res = synthesizer.run(module);
-    ASSERT_TRUE(res);
   }
 
   std::tuple<ASTModule, bool> parseFromString(const char* input) const
@@ -223,15 +237,15 @@ TEST_F(SynthesizerTests, TestSynthesisWithSuccess)
       "    // This corresponds to the 2nd premise rule in the inference definition.\n"
       "    std::vector<TypeCls> ParameterTypes = proveType(StaticMethodCallStmt.callee.parameter_types);\n"
       "\n"
-      "    for (size_t i = 0, size_t j = 1; i < ParameterTypes.size(); ++i, ++j) {\n"
+      "    for (size_t i = 0, j = 1; i < ParameterTypes.size(); ++i, ++j) {\n"
       "        if (!cmpType(ArgumentsTypes[i], ParameterTypes[j], std::less_equal<TypeCls>())) {\n"
-      "            *err = std::error_code(0, inference_error_category);\n"
+      "            *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
       "            return TypeCls();\n"
       "        }\n"
       "    }\n"
       "\n"
       "    if (!cmpType(ArgumentsTypes, SELF_TYPE, std::not_equal_to<TypeCls>())) {\n"
-      "        *err = std::error_code(0, inference_error_category);\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
       "        return TypeCls();\n"
       "    }\n"
       "    // This corresponds to the 3rd premise rule in the inference definition.\n"
@@ -239,9 +253,9 @@ TEST_F(SynthesizerTests, TestSynthesisWithSuccess)
       "    // Type annotation setup.\n"
       "    typeAnnotationSetup(StaticMethodCallStmt.caller_type, CLS_TYPE);\n"
       "\n"
-      "    for (size_t i = 1, size_t j = 1; i < ParameterTypes.size(); ++i, ++j) {\n"
+      "    for (size_t i = 1, j = 1; i < ParameterTypes.size(); ++i, ++j) {\n"
       "        if (!cmpType(ArgumentsTypes[i], ParameterTypes[j], std::less_equal<TypeCls>())) {\n"
-      "            *err = std::error_code(0, inference_error_category);\n"
+      "            *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
       "            return TypeCls();\n"
       "        }\n"
       "    }\n"
@@ -253,7 +267,7 @@ TEST_F(SynthesizerTests, TestSynthesisWithSuccess)
       "    TypeCls var0 = getBaseType();\n"
       "    TypeCls var1 = proveType(StaticMethodCallStmt.caller_type);\n"
       "    if (!cmpType(var0, var1, std::equal_to<>())) {\n"
-      "        *err = std::error_code(0, inference_error_category);\n"
+      "        *err = std::error_code(InferenceErrorInferredTypeMismatch, inference_error_category);\n"
       "        return TypeCls();\n"
       "    }\n"
       "\n"
@@ -296,6 +310,7 @@ TEST_F(SynthesizerTests, TestSynthesisWithSuccess)
       "{\n"
       "    InferenceErrorInferredTypeMismatch = 0x01,\n"
       "    InferenceErrorTypeComparisonFailed,\n"
+      "    InferenceErrorNoApplicableRule,\n"
       "};\n"
       "\n"
       "class InferenceErrorCategory;\n"
@@ -330,6 +345,8 @@ TEST_F(SynthesizerTests, TestSynthesisWithSuccess)
       "                return \"Inferred type does not match with expected.\";\n"
       "            case InferenceErrorTypeComparisonFailed:\n"
       "                return \"Type comparison failed.\";\n"
+      "            case InferenceErrorNoApplicableRule:\n"
+      "                return \"No applicable inference rule.\";\n"
       "            default:\n"
       "                return \"Inference failed (unknown error).\";\n"
       "        }\n"
@@ -346,3 +363,2534 @@ TEST_F(SynthesizerTests, TestSynthesisWithSuccess)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithPolicyTemplate)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyPolicyInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      ""
+      "inference BinaryExpressionInference {"
+      ""
+        "globals: ["
+          "INT_TYPE"
+        "]"
+        ""
+        "arguments: ["
+          "expr : Expr"
+        "]"
+        ""
+        "premises: ["
+          "expr.lhs   : LhsType;"
+          "LhsType != INT_TYPE;"
+          "expr.rhs   : getBaseType();"
+        "]"
+        ""
+        "proposition  : LhsType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+  opts.usePolicyTemplate = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "template <typename Policy>\n"
+      "class MyPolicyInference\n"
+      "{\n"
+      "public:\n"
+      "    static TypeCls BinaryExpressionInference(const Expr& expr, std::error_code* err)\n"
+      "    {\n"
+      "        TypeCls LhsType = Policy::proveType(expr.lhs);\n"
+      "\n"
+      "        if (!Policy::cmpType(LhsType, Policy::INT_TYPE, std::not_equal_to<TypeCls>())) {\n"
+      "            *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "            return TypeCls();\n"
+      "        }\n"
+      "        TypeCls var0 = Policy::getBaseType();\n"
+      "        TypeCls var1 = Policy::proveType(expr.rhs);\n"
+      "        if (!Policy::cmpType(var0, var1, std::equal_to<>())) {\n"
+      "            *err = std::error_code(InferenceErrorInferredTypeMismatch, inference_error_category);\n"
+      "            return TypeCls();\n"
+      "        }\n"
+      "\n"
+      "        return LhsType;\n"
+      "    }\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyPolicyInference.h");
+  }
+
+  // No out-of-line definitions are synthesized.
+  {
+    std::ifstream ifs("./MyPolicyInference.cpp");
+    ASSERT_FALSE(ifs.good());
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithFixedCapacityArrays)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyArrayInference;"
+      "TypeClass                      : TypeCls;"
+      "TypeArrayClass                 : TypeSpan;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      ""
+      "inference CallInference {"
+      ""
+        "arguments: ["
+          "call : CallExpr"
+        "]"
+        ""
+        "premises: ["
+          "call.argument_types          : ArgumentsTypes[];"
+          "call.operands                : OperandTypes[2];"
+        "]"
+        ""
+        "proposition  : getReturnType();"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <array>\n"
+      "#include <system_error>\n"
+      "\n"
+      "class MyArrayInference\n"
+      "{\n"
+      "public:\n"
+      "    TypeCls CallInference(const CallExpr& call, std::error_code*);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyArrayInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyArrayInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyArrayInference::CallInference(const CallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    TypeSpan ArgumentsTypes = proveType(call.argument_types);\n"
+      "\n"
+      "    std::array<TypeCls, 2> OperandTypes;\n"
+      "    proveType(call.operands, OperandTypes.data(), OperandTypes.size());\n"
+      "\n"
+      "    return getReturnType();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyArrayInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithBatchedRangeComparison)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyRangeInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      "TypeRangeCmpMethod             : cmpTypeRange;"
+      ""
+      "inference CallInference {"
+      ""
+        "arguments: ["
+          "call : CallExpr"
+        "]"
+        ""
+        "premises: ["
+          "call.argument_types          : ArgumentsTypes[];"
+          "call.callee.parameter_types  : ParameterTypes[];"
+          "ArgumentsTypes[] <= ParameterTypes[] inrange 0..0..ParameterTypes[];"
+          "ArgumentsTypes[] = ParameterTypes[] inrange 1..2..ArgumentsTypes[];"
+        "]"
+        ""
+        "proposition  : getReturnType();"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyRangeInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyRangeInference::CallInference(const CallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    std::vector<TypeCls> ArgumentsTypes = proveType(call.argument_types);\n"
+      "\n"
+      "    std::vector<TypeCls> ParameterTypes = proveType(call.callee.parameter_types);\n"
+      "\n"
+      "    if (!cmpTypeRange(ArgumentsTypes, 0, ParameterTypes, 0, ParameterTypes.size(), std::less_equal<TypeCls>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "\n"
+      "    if (!cmpTypeRange(ArgumentsTypes, 1, ParameterTypes, 2, (ArgumentsTypes.size() > 1 ? ArgumentsTypes.size() - 1 : 0), std::equal_to<TypeCls>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "\n"
+      "    return getReturnType();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyRangeInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithStaticallySizedRangeClauses)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyUnrolledInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      ""
+      "inference BinaryInference {"
+      ""
+        "arguments: ["
+          "expr : BinaryExpr"
+        "]"
+        ""
+        "premises: ["
+          "expr.operand_types           : OperandTypes[2];"
+          "expr.expected_types          : ExpectedTypes[3];"
+          "OperandTypes[] <= ExpectedTypes[] inrange 0..1..OperandTypes[2];"
+          "expr.element_types           : ElementTypes[9];"
+          "expr.expected_element_types  : ExpectedElementTypes[9];"
+          "ElementTypes[] = ExpectedElementTypes[] inrange 0..0..ElementTypes[9];"
+        "]"
+        ""
+        "proposition  : getReturnType();"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyUnrolledInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyUnrolledInference::BinaryInference(const BinaryExpr& expr, std::error_code* err)\n"
+      "{\n"
+      "    std::array<TypeCls, 2> OperandTypes;\n"
+      "    proveType(expr.operand_types, OperandTypes.data(), OperandTypes.size());\n"
+      "\n"
+      "    std::array<TypeCls, 3> ExpectedTypes;\n"
+      "    proveType(expr.expected_types, ExpectedTypes.data(), ExpectedTypes.size());\n"
+      "\n"
+      "    if (!cmpType(OperandTypes[0], ExpectedTypes[1], std::less_equal<TypeCls>()) ||\n"
+      "        !cmpType(OperandTypes[1], ExpectedTypes[2], std::less_equal<TypeCls>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "\n"
+      "    std::array<TypeCls, 9> ElementTypes;\n"
+      "    proveType(expr.element_types, ElementTypes.data(), ElementTypes.size());\n"
+      "\n"
+      "    std::array<TypeCls, 9> ExpectedElementTypes;\n"
+      "    proveType(expr.expected_element_types, ExpectedElementTypes.data(), ExpectedElementTypes.size());\n"
+      "\n"
+      "    for (size_t i = 0, j = 0; i < 9; ++i, ++j) {\n"
+      "        if (!cmpType(ElementTypes[i], ExpectedElementTypes[j], std::equal_to<TypeCls>())) {\n"
+      "            *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "            return TypeCls();\n"
+      "        }\n"
+      "    }\n"
+      "\n"
+      "    return getReturnType();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyUnrolledInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithDispatch)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyDispatchInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      "DispatchKeyClass               : NodeKind;"
+      "DispatchMethod                 : infer;"
+      ""
+      "dispatch: ["
+        "BinaryExpr                   : BinaryInference;"
+        "CallExpr                     : MethodCallInference, FunctionCallInference;"
+      "]"
+      ""
+      "inference BinaryInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.lhs : LhsType;"
+        "]"
+        "proposition : LhsType;"
+      "}"
+      ""
+      "inference MethodCallInference {"
+        "arguments: ["
+          "call : ASTExpr"
+        "]"
+        "premises: ["
+          "call.method : MethodType;"
+        "]"
+        "proposition : MethodType;"
+      "}"
+      ""
+      "inference FunctionCallInference {"
+        "arguments: ["
+          "call : ASTExpr"
+        "]"
+        "premises: ["
+          "call.function : FunctionType;"
+        "]"
+        "proposition : FunctionType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "class MyDispatchInference\n"
+      "{\n"
+      "public:\n"
+      "    TypeCls BinaryInference(const ASTExpr& expr, std::error_code*);\n"
+      "\n"
+      "    TypeCls MethodCallInference(const ASTExpr& call, std::error_code*);\n"
+      "\n"
+      "    TypeCls FunctionCallInference(const ASTExpr& call, std::error_code*);\n"
+      "\n"
+      "    TypeCls infer(NodeKind dispatchKey, const ASTExpr& expr, std::error_code*);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyDispatchInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyDispatchInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyDispatchInference::BinaryInference(const ASTExpr& expr, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls LhsType = proveType(expr.lhs);\n"
+      "\n"
+      "    return LhsType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyDispatchInference::MethodCallInference(const ASTExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls MethodType = proveType(call.method);\n"
+      "\n"
+      "    return MethodType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyDispatchInference::FunctionCallInference(const ASTExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls FunctionType = proveType(call.function);\n"
+      "\n"
+      "    return FunctionType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyDispatchInference::infer(NodeKind dispatchKey, const ASTExpr& expr, std::error_code* err)\n"
+      "{\n"
+      "    switch (dispatchKey) {\n"
+      "        case NodeKind::BinaryExpr:\n"
+      "            return BinaryInference(expr, err);\n"
+      "        case NodeKind::CallExpr:\n"
+      "            {\n"
+      "                std::error_code ec;\n"
+      "                const TypeCls res = MethodCallInference(expr, &ec);\n"
+      "                if (!ec) {\n"
+      "                    return res;\n"
+      "                }\n"
+      "            }\n"
+      "            return FunctionCallInference(expr, err);\n"
+      "        default:\n"
+      "            break;\n"
+      "    }\n"
+      "\n"
+      "    *err = std::error_code(InferenceErrorNoApplicableRule, inference_error_category);\n"
+      "    return TypeCls();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyDispatchInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithTryAllMethod)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName : MyTryAllInference;"
+      "TypeClass : TypeCls;"
+      "ProofMethod : proveType;"
+      "TypeCmpMethod : cmpType;"
+      "TryAllMethod : tryAll;"
+      ""
+      "inference MethodCall {"
+        "arguments: [ node : ASTExpr ]"
+        "premises: ["
+          "node.argument_types : ArgumentsTypes[];"
+          "node.callee : CalleeType;"
+          "CalleeType = MethodType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+      ""
+      "inference FunctionCall {"
+        "arguments: [ node : ASTExpr ]"
+        "premises: ["
+          "node.argument_types : ArgumentsTypes[];"
+          "node.callee : CalleeType;"
+          "CalleeType = FunctionType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+      ""
+      "inference Literal {"
+        "arguments: [ node : ASTExpr ]"
+        "premises: ["
+          "node.value : ValueType;"
+        "]"
+        "proposition : ValueType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "class MyTryAllInference\n"
+      "{\n"
+      "public:\n"
+      "    TypeCls MethodCall(const ASTExpr& node, std::error_code*);\n"
+      "\n"
+      "    TypeCls FunctionCall(const ASTExpr& node, std::error_code*);\n"
+      "\n"
+      "    TypeCls Literal(const ASTExpr& node, std::error_code*);\n"
+      "\n"
+      "    TypeCls tryAll(const ASTExpr& node, std::error_code*);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyTryAllInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyTryAllInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyTryAllInference::MethodCall(const ASTExpr& node, std::error_code* err)\n"
+      "{\n"
+      "    std::vector<TypeCls> ArgumentsTypes = proveType(node.argument_types);\n"
+      "\n"
+      "    TypeCls CalleeType = proveType(node.callee);\n"
+      "\n"
+      "    if (!cmpType(CalleeType, MethodType, std::equal_to<TypeCls>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyTryAllInference::FunctionCall(const ASTExpr& node, std::error_code* err)\n"
+      "{\n"
+      "    std::vector<TypeCls> ArgumentsTypes = proveType(node.argument_types);\n"
+      "\n"
+      "    TypeCls CalleeType = proveType(node.callee);\n"
+      "\n"
+      "    if (!cmpType(CalleeType, FunctionType, std::equal_to<TypeCls>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyTryAllInference::Literal(const ASTExpr& node, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls ValueType = proveType(node.value);\n"
+      "\n"
+      "    return ValueType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyTryAllInference::tryAll(const ASTExpr& node, std::error_code* err)\n"
+      "{\n"
+      "    {\n"
+      "        std::vector<TypeCls> ArgumentsTypes = proveType(node.argument_types);\n"
+      "\n"
+      "        TypeCls CalleeType = proveType(node.callee);\n"
+      "\n"
+      "        {\n"
+      "            if (!cmpType(CalleeType, MethodType, std::equal_to<TypeCls>())) {\n"
+      "                goto next1;\n"
+      "            }\n"
+      "            return CalleeType;\n"
+      "        }\n"
+      "        next1:;\n"
+      "        {\n"
+      "            if (!cmpType(CalleeType, FunctionType, std::equal_to<TypeCls>())) {\n"
+      "                goto next2;\n"
+      "            }\n"
+      "            return CalleeType;\n"
+      "        }\n"
+      "        next2:;\n"
+      "    }\n"
+      "    {\n"
+      "        TypeCls ValueType = proveType(node.value);\n"
+      "\n"
+      "        return ValueType;\n"
+      "    }\n"
+      "\n"
+      "    *err = std::error_code(InferenceErrorNoApplicableRule, inference_error_category);\n"
+      "    return TypeCls();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyTryAllInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithTryAllMethodAndWhileClause)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName : MyTryAllWhileInference;"
+      "TypeClass : TypeCls;"
+      "ProofMethod : proveType;"
+      "TypeCmpMethod : cmpType;"
+      "TypeAnnotationSetupMethod : setup;"
+      "TypeAnnotationTeardownMethod : teardown;"
+      "TryAllMethod : tryAll;"
+      ""
+      "inference MethodCall {"
+        "globals: [ SELF_TYPE, CLS_TYPE ]"
+        "arguments: [ node : ASTExpr ]"
+        "premises: ["
+          "node.recv : SELF_TYPE while {"
+            "node.callee : CalleeType;"
+            "node.cls : CLS_TYPE while {"
+              "CalleeType = MethodType;"
+            "};"
+          "};"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+      ""
+      "inference Literal {"
+        "globals: [ SELF_TYPE, CLS_TYPE ]"
+        "arguments: [ node : ASTExpr ]"
+        "premises: ["
+          "node.value : ValueType;"
+        "]"
+        "proposition : ValueType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // A failed premise tears down the annotations of the while-clauses it is
+  // in, innermost first, before moving on to the next inference definition.
+  {
+    // clang-format off
+    const char* EXPECTED_TRY_ALL_RES =
+      "TypeCls\n"
+      "MyTryAllWhileInference::tryAll(const ASTExpr& node, std::error_code* err)\n"
+      "{\n"
+      "    {\n"
+      "\n"
+      "        // Type annotation setup.\n"
+      "        setup(node.recv, SELF_TYPE);\n"
+      "\n"
+      "        TypeCls CalleeType = proveType(node.callee);\n"
+      "\n"
+      "\n"
+      "        // Type annotation setup.\n"
+      "        setup(node.cls, CLS_TYPE);\n"
+      "\n"
+      "        if (!cmpType(CalleeType, MethodType, std::equal_to<TypeCls>())) {\n"
+      "            teardown(node.cls, CLS_TYPE);\n"
+      "            teardown(node.recv, SELF_TYPE);\n"
+      "            goto next0;\n"
+      "        }\n"
+      "        // Type annotation teardown.\n"
+      "        teardown(node.cls, CLS_TYPE);\n"
+      "\n"
+      "        // Type annotation teardown.\n"
+      "        teardown(node.recv, SELF_TYPE);\n"
+      "\n"
+      "        return CalleeType;\n"
+      "    }\n"
+      "    next0:;\n"
+      "    {\n"
+      "        TypeCls ValueType = proveType(node.value);\n"
+      "\n"
+      "        return ValueType;\n"
+      "    }\n"
+      "\n"
+      "    *err = std::error_code(InferenceErrorNoApplicableRule, inference_error_category);\n"
+      "    return TypeCls();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    const std::string cpp = readFromOutputFile("./MyTryAllWhileInference.cpp");
+    const size_t pos = cpp.find("TypeCls\nMyTryAllWhileInference::tryAll(");
+    ASSERT_NE(std::string::npos, pos);
+    ASSERT_EQ(EXPECTED_TRY_ALL_RES, cpp.substr(pos));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithSnowlakeTypeRuntime)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyRuntimeInference;"
+      "TypeRuntime                    : snowlake;"
+      "ProofMethod                    : proveType;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.expected : ExpectedType;"
+          "CalleeType = ExpectedType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "#include \"runtime/TypeTable.h\"\n"
+      "\n"
+      "class MyRuntimeInference\n"
+      "{\n"
+      "public:\n"
+      "    sl::runtime::TypeHandle CallInference(const ASTCallExpr& call, std::error_code*);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyRuntimeInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyRuntimeInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "sl::runtime::TypeHandle\n"
+      "MyRuntimeInference::CallInference(const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    sl::runtime::TypeHandle CalleeType = proveType(call.callee);\n"
+      "\n"
+      "    sl::runtime::TypeHandle ExpectedType = proveType(call.expected);\n"
+      "\n"
+      "    if (!sl::runtime::cmpType(CalleeType, ExpectedType, std::equal_to<sl::runtime::TypeHandle>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return sl::runtime::TypeHandle();\n"
+      "    }\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyRuntimeInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithRuntimeComputedTarget)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyComputedInference;"
+      "TypeRuntime                    : snowlake;"
+      "ProofMethod                    : proveType;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.caller_type : getBaseType();"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyComputedInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "sl::runtime::TypeHandle\n"
+      "MyComputedInference::CallInference(const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    sl::runtime::TypeHandle CalleeType = proveType(call.callee);\n"
+      "\n"
+      "    sl::runtime::TypeHandle var0 = getBaseType();\n"
+      "    sl::runtime::TypeHandle var1 = proveType(call.caller_type);\n"
+      "    if (!sl::runtime::cmpType(var0, var1, std::equal_to<>())) {\n"
+      "        *err = std::error_code(InferenceErrorInferredTypeMismatch, inference_error_category);\n"
+      "        return sl::runtime::TypeHandle();\n"
+      "    }\n"
+      "\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyComputedInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithSubtypeOracle)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyOracleInference;"
+      "TypeRuntime                    : snowlake;"
+      "ProofMethod                    : proveType;"
+      "SubtypeOracle                  : subtypes;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.expected : ExpectedType;"
+          "CalleeType <= ExpectedType;"
+          "CalleeType != ExpectedType;"
+          "call.argument_types : ArgumentTypes[2];"
+          "call.parameter_types : ParameterTypes[2];"
+          "ArgumentTypes[] < ParameterTypes[] inrange 0..0..ArgumentTypes[2];"
+          "call.element_types : ElementTypes[9];"
+          "call.expected_element_types : ExpectedElementTypes[9];"
+          "ElementTypes[] <= ExpectedElementTypes[] inrange 0..0..ElementTypes[9];"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyOracleInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "sl::runtime::TypeHandle\n"
+      "MyOracleInference::CallInference(const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    sl::runtime::TypeHandle CalleeType = proveType(call.callee);\n"
+      "\n"
+      "    sl::runtime::TypeHandle ExpectedType = proveType(call.expected);\n"
+      "\n"
+      "    if (!subtypes.isSubtype(CalleeType, ExpectedType)) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return sl::runtime::TypeHandle();\n"
+      "    }\n"
+      "    if (!sl::runtime::cmpType(CalleeType, ExpectedType, std::not_equal_to<sl::runtime::TypeHandle>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return sl::runtime::TypeHandle();\n"
+      "    }\n"
+      "    std::array<sl::runtime::TypeHandle, 2> ArgumentTypes;\n"
+      "    proveType(call.argument_types, ArgumentTypes.data(), ArgumentTypes.size());\n"
+      "\n"
+      "    std::array<sl::runtime::TypeHandle, 2> ParameterTypes;\n"
+      "    proveType(call.parameter_types, ParameterTypes.data(), ParameterTypes.size());\n"
+      "\n"
+      "    if (!subtypes.isProperSubtype(ArgumentTypes[0], ParameterTypes[0]) ||\n"
+      "        !subtypes.isProperSubtype(ArgumentTypes[1], ParameterTypes[1])) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return sl::runtime::TypeHandle();\n"
+      "    }\n"
+      "\n"
+      "    std::array<sl::runtime::TypeHandle, 9> ElementTypes;\n"
+      "    proveType(call.element_types, ElementTypes.data(), ElementTypes.size());\n"
+      "\n"
+      "    std::array<sl::runtime::TypeHandle, 9> ExpectedElementTypes;\n"
+      "    proveType(call.expected_element_types, ExpectedElementTypes.data(), ExpectedElementTypes.size());\n"
+      "\n"
+      "    for (size_t i = 0, j = 0; i < 9; ++i, ++j) {\n"
+      "        if (!subtypes.isSubtype(ElementTypes[i], ExpectedElementTypes[j])) {\n"
+      "            *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "            return sl::runtime::TypeHandle();\n"
+      "        }\n"
+      "    }\n"
+      "\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyOracleInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithProofCache)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyCachedInference;"
+      "TypeRuntime                    : snowlake;"
+      "ProofMethod                    : proveType;"
+      "ProofCache                     : proofCache;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.expected : ExpectedType;"
+          "CalleeType = ExpectedType;"
+          "call.argument_types : ArgumentTypes[2];"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+      ""
+      "inference MethodCallInference {"
+        "globals: ["
+          "ReturnType"
+        "]"
+        "arguments: ["
+          "expr : ASTCallExpr"
+        "]"
+        "premises: ["
+          "expr.expected : ExpectedType;"
+          "ReturnType : CalleeType;"
+        "]"
+        "proposition : ExpectedType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <array>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "#include \"runtime/TypeTable.h\"\n"
+      "\n"
+      "class MyCachedInference\n"
+      "{\n"
+      "public:\n"
+      "    sl::runtime::TypeHandle CallInference(const ASTCallExpr& call, std::error_code*);\n"
+      "\n"
+      "    sl::runtime::TypeHandle MethodCallInference(const ASTCallExpr& expr, std::error_code*);\n"
+      "\n"
+      "    static constexpr size_t ProofCachePathCount = 2;\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyCachedInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyCachedInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "sl::runtime::TypeHandle\n"
+      "MyCachedInference::CallInference(const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    sl::runtime::TypeHandle CalleeType;\n"
+      "    if (!proofCache.lookup(0, &call, &CalleeType)) {\n"
+      "        CalleeType = proveType(call.callee);\n"
+      "        proofCache.insert(0, &call, CalleeType);\n"
+      "    }\n"
+      "\n"
+      "    sl::runtime::TypeHandle ExpectedType;\n"
+      "    if (!proofCache.lookup(1, &call, &ExpectedType)) {\n"
+      "        ExpectedType = proveType(call.expected);\n"
+      "        proofCache.insert(1, &call, ExpectedType);\n"
+      "    }\n"
+      "\n"
+      "    if (!sl::runtime::cmpType(CalleeType, ExpectedType, std::equal_to<sl::runtime::TypeHandle>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return sl::runtime::TypeHandle();\n"
+      "    }\n"
+      "    std::array<sl::runtime::TypeHandle, 2> ArgumentTypes;\n"
+      "    proveType(call.argument_types, ArgumentTypes.data(), ArgumentTypes.size());\n"
+      "\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "\n"
+      "sl::runtime::TypeHandle\n"
+      "MyCachedInference::MethodCallInference(const ASTCallExpr& expr, std::error_code* err)\n"
+      "{\n"
+      "    sl::runtime::TypeHandle ExpectedType;\n"
+      "    if (!proofCache.lookup(1, &expr, &ExpectedType)) {\n"
+      "        ExpectedType = proveType(expr.expected);\n"
+      "        proofCache.insert(1, &expr, ExpectedType);\n"
+      "    }\n"
+      "\n"
+      "    sl::runtime::TypeHandle CalleeType = proveType(ReturnType);\n"
+      "\n"
+      "    return ExpectedType;\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyCachedInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithDependencyGraph)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyTrackedInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      "DependencyGraph                : deps;"
+      "TypeAnnotationSetupMethod      : setup;"
+      "TypeAnnotationTeardownMethod   : teardown;"
+      ""
+      "inference CallInference {"
+        "globals: ["
+          "ReturnType"
+        "]"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.caller_type : CLS_TYPE while {"
+            "call.expected : ExpectedType;"
+          "};"
+          "ReturnType : GlobalType;"
+          "CalleeType = ExpectedType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyTrackedInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyTrackedInference::CallInference(const ASTCallExpr& call, std::error_code* err, bool resetSite)\n"
+      "{\n"
+      "    if (resetSite) {\n"
+      "        deps.beginSite(&call);\n"
+      "    }\n"
+      "\n"
+      "    deps.record(&call, &call.callee);\n"
+      "    TypeCls CalleeType = proveType(call.callee);\n"
+      "\n"
+      "\n"
+      "    // Type annotation setup.\n"
+      "    deps.record(&call, &call.caller_type);\n"
+      "    setup(call.caller_type, CLS_TYPE);\n"
+      "\n"
+      "    deps.record(&call, &call.expected);\n"
+      "    TypeCls ExpectedType = proveType(call.expected);\n"
+      "\n"
+      "    // Type annotation teardown.\n"
+      "    teardown(call.caller_type, CLS_TYPE);\n"
+      "\n"
+      "    TypeCls GlobalType = proveType(ReturnType);\n"
+      "\n"
+      "    if (!cmpType(CalleeType, ExpectedType, std::equal_to<TypeCls>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyTrackedInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithDependencyGraphAndSharedDispatchKey)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyTrackedDispatch;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      "DependencyGraph                : deps;"
+      "DispatchKeyClass               : NodeKind;"
+      ""
+      "dispatch: ["
+        "CallExpr                     : MethodCallInference, FunctionCallInference;"
+        "NameExpr                     : NameInference;"
+      "]"
+      ""
+      "inference MethodCallInference {"
+        "arguments: ["
+          "call : ASTExpr"
+        "]"
+        "premises: ["
+          "call.method : MethodType;"
+        "]"
+        "proposition : MethodType;"
+      "}"
+      ""
+      "inference FunctionCallInference {"
+        "arguments: ["
+          "call : ASTExpr"
+        "]"
+        "premises: ["
+          "call.function : FunctionType;"
+        "]"
+        "proposition : FunctionType;"
+      "}"
+      ""
+      "inference NameInference {"
+        "arguments: ["
+          "call : ASTExpr"
+        "]"
+        "premises: ["
+          "call.decl : DeclType;"
+        "]"
+        "proposition : DeclType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .h file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "class MyTrackedDispatch\n"
+      "{\n"
+      "public:\n"
+      "    TypeCls MethodCallInference(const ASTExpr& call, std::error_code*, bool resetSite = true);\n"
+      "\n"
+      "    TypeCls FunctionCallInference(const ASTExpr& call, std::error_code*, bool resetSite = true);\n"
+      "\n"
+      "    TypeCls NameInference(const ASTExpr& call, std::error_code*, bool resetSite = true);\n"
+      "\n"
+      "    TypeCls dispatch(NodeKind dispatchKey, const ASTExpr& call, std::error_code*);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyTrackedDispatch.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyTrackedDispatch.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyTrackedDispatch::MethodCallInference(const ASTExpr& call, std::error_code* err, bool resetSite)\n"
+      "{\n"
+      "    if (resetSite) {\n"
+      "        deps.beginSite(&call);\n"
+      "    }\n"
+      "\n"
+      "    deps.record(&call, &call.method);\n"
+      "    TypeCls MethodType = proveType(call.method);\n"
+      "\n"
+      "    return MethodType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyTrackedDispatch::FunctionCallInference(const ASTExpr& call, std::error_code* err, bool resetSite)\n"
+      "{\n"
+      "    if (resetSite) {\n"
+      "        deps.beginSite(&call);\n"
+      "    }\n"
+      "\n"
+      "    deps.record(&call, &call.function);\n"
+      "    TypeCls FunctionType = proveType(call.function);\n"
+      "\n"
+      "    return FunctionType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyTrackedDispatch::NameInference(const ASTExpr& call, std::error_code* err, bool resetSite)\n"
+      "{\n"
+      "    if (resetSite) {\n"
+      "        deps.beginSite(&call);\n"
+      "    }\n"
+      "\n"
+      "    deps.record(&call, &call.decl);\n"
+      "    TypeCls DeclType = proveType(call.decl);\n"
+      "\n"
+      "    return DeclType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyTrackedDispatch::dispatch(NodeKind dispatchKey, const ASTExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    switch (dispatchKey) {\n"
+      "        case NodeKind::CallExpr:\n"
+      "            deps.beginSite(&call);\n"
+      "\n"
+      "            {\n"
+      "                std::error_code ec;\n"
+      "                const TypeCls res = MethodCallInference(call, &ec, false);\n"
+      "                if (!ec) {\n"
+      "                    return res;\n"
+      "                }\n"
+      "            }\n"
+      "            return FunctionCallInference(call, err, false);\n"
+      "        case NodeKind::NameExpr:\n"
+      "            return NameInference(call, err);\n"
+      "        default:\n"
+      "            break;\n"
+      "    }\n"
+      "\n"
+      "    *err = std::error_code(InferenceErrorNoApplicableRule, inference_error_category);\n"
+      "    return TypeCls();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyTrackedDispatch.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithContextClass)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyReentrantInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      "ContextClass                   : CheckerContext;"
+      "TypeAnnotationSetupMethod      : setup;"
+      "TypeAnnotationTeardownMethod   : teardown;"
+      "DispatchKeyClass               : NodeKind;"
+      ""
+      "dispatch: ["
+        "CallExpr                     : CallInference;"
+      "]"
+      ""
+      "inference CallInference {"
+        "globals: ["
+          "SELF_TYPE"
+        "]"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.caller_type : SELF_TYPE while {"
+            "call.expected : ExpectedType;"
+          "};"
+          "CalleeType = ExpectedType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "class MyReentrantInference\n"
+      "{\n"
+      "public:\n"
+      "    static TypeCls CallInference(CheckerContext& ctx, const ASTCallExpr& call, std::error_code*);\n"
+      "\n"
+      "    template <typename Executor>\n"
+      "    static void CallInferenceBatch(const ASTCallExpr* const* call, TypeCls* results, std::error_code* errs, size_t count, Executor& executor)\n"
+      "    {\n"
+      "        executor.parallelFor(count, [&](size_t i, CheckerContext& ctx) {\n"
+      "            results[i] = CallInference(ctx, *call[i], &errs[i]);\n"
+      "        });\n"
+      "    }\n"
+      "\n"
+      "    static TypeCls dispatch(CheckerContext& ctx, NodeKind dispatchKey, const ASTCallExpr& call, std::error_code*);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyReentrantInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyReentrantInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyReentrantInference::CallInference(CheckerContext& ctx, const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls CalleeType = ctx.proveType(call.callee);\n"
+      "\n"
+      "\n"
+      "    // Type annotation setup.\n"
+      "    ctx.setup(call.caller_type, ctx.SELF_TYPE);\n"
+      "\n"
+      "    TypeCls ExpectedType = ctx.proveType(call.expected);\n"
+      "\n"
+      "    // Type annotation teardown.\n"
+      "    ctx.teardown(call.caller_type, ctx.SELF_TYPE);\n"
+      "\n"
+      "    if (!ctx.cmpType(CalleeType, ExpectedType, std::equal_to<TypeCls>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyReentrantInference::dispatch(CheckerContext& ctx, NodeKind dispatchKey, const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    switch (dispatchKey) {\n"
+      "        case NodeKind::CallExpr:\n"
+      "            return CallInference(ctx, call, err);\n"
+      "        default:\n"
+      "            break;\n"
+      "    }\n"
+      "\n"
+      "    *err = std::error_code(InferenceErrorNoApplicableRule, inference_error_category);\n"
+      "    return TypeCls();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyReentrantInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithContextClassAndSharedDispatchKey)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyCtxDispatchInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      "ContextClass                   : CheckerContext;"
+      "DispatchKeyClass               : NodeKind;"
+      ""
+      "dispatch: ["
+        "CallExpr                     : MethodCallInference, FunctionCallInference;"
+      "]"
+      ""
+      "inference MethodCallInference {"
+        "arguments: ["
+          "call : ASTExpr"
+        "]"
+        "premises: ["
+          "call.method : MethodType;"
+        "]"
+        "proposition : MethodType;"
+      "}"
+      ""
+      "inference FunctionCallInference {"
+        "arguments: ["
+          "call : ASTExpr"
+        "]"
+        "premises: ["
+          "call.function : FunctionType;"
+        "]"
+        "proposition : FunctionType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyCtxDispatchInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyCtxDispatchInference::MethodCallInference(CheckerContext& ctx, const ASTExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls MethodType = ctx.proveType(call.method);\n"
+      "\n"
+      "    return MethodType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyCtxDispatchInference::FunctionCallInference(CheckerContext& ctx, const ASTExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls FunctionType = ctx.proveType(call.function);\n"
+      "\n"
+      "    return FunctionType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyCtxDispatchInference::dispatch(CheckerContext& ctx, NodeKind dispatchKey, const ASTExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    switch (dispatchKey) {\n"
+      "        case NodeKind::CallExpr:\n"
+      "            {\n"
+      "                std::error_code ec;\n"
+      "                const TypeCls res = MethodCallInference(ctx, call, &ec);\n"
+      "                if (!ec) {\n"
+      "                    return res;\n"
+      "                }\n"
+      "            }\n"
+      "            return FunctionCallInference(ctx, call, err);\n"
+      "        default:\n"
+      "            break;\n"
+      "    }\n"
+      "\n"
+      "    *err = std::error_code(InferenceErrorNoApplicableRule, inference_error_category);\n"
+      "    return TypeCls();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyCtxDispatchInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithTypeAnnotationStack)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyScopedInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      "TypeAnnotationStack            : annotations;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.caller_type : CLS_TYPE while {"
+            "call.expected : ExpectedType;"
+          "};"
+          "CalleeType = ExpectedType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .h file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "#include \"runtime/AnnotationStack.h\"\n"
+      "\n"
+      "class MyScopedInference\n"
+      "{\n"
+      "public:\n"
+      "    TypeCls CallInference(const ASTCallExpr& call, std::error_code*);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyScopedInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyScopedInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyScopedInference::CallInference(const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls CalleeType = proveType(call.callee);\n"
+      "\n"
+      "\n"
+      "    // Type annotation setup.\n"
+      "    sl::runtime::AnnotationScope scope0(annotations);\n"
+      "    annotations.push(&call.caller_type, CLS_TYPE);\n"
+      "\n"
+      "    TypeCls ExpectedType = proveType(call.expected);\n"
+      "\n"
+      "    // Type annotation teardown.\n"
+      "    scope0.rollback();\n"
+      "\n"
+      "    if (!cmpType(CalleeType, ExpectedType, std::equal_to<TypeCls>())) {\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyScopedInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithColdFailurePaths)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyColdInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.expected : ExpectedType;"
+          "CalleeType = ExpectedType;"
+          "CalleeType <= ExpectedType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+  opts.useColdFailurePaths = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .h file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "class MyColdInference\n"
+      "{\n"
+      "public:\n"
+      "    TypeCls CallInference(const ASTCallExpr& call, std::error_code*);\n"
+      "\n"
+      "    [[gnu::cold, gnu::noinline]] static TypeCls CallInferenceFailure(size_t, int, std::error_code*);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyColdInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyColdInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyColdInference::CallInference(const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls CalleeType = proveType(call.callee);\n"
+      "\n"
+      "    TypeCls ExpectedType = proveType(call.expected);\n"
+      "\n"
+      "    if (__builtin_expect(!cmpType(CalleeType, ExpectedType, std::equal_to<TypeCls>()), 0)) {\n"
+      "        return CallInferenceFailure(2, InferenceErrorTypeComparisonFailed, err);\n"
+      "    }\n"
+      "    if (__builtin_expect(!cmpType(CalleeType, ExpectedType, std::less_equal<TypeCls>()), 0)) {\n"
+      "        return CallInferenceFailure(3, InferenceErrorTypeComparisonFailed, err);\n"
+      "    }\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyColdInference::CallInferenceFailure(size_t /* premise */, int error, std::error_code* err)\n"
+      "{\n"
+      "    *err = std::error_code(error, inference_error_category);\n"
+      "    return TypeCls();\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyColdInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithFailureRecord)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyDiagnosedInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      "FailureRecord                  : failure;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.argument_types : ArgumentTypes[];"
+          "call.parameter_types : ParameterTypes[];"
+          "ArgumentTypes[] <= ParameterTypes[] inrange 0..0..ParameterTypes[];"
+          "call.callee : CalleeType;"
+          "CalleeType != VOID_TYPE;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+      ""
+      "inference NullInference {"
+        "arguments: ["
+          "expr : ASTNullExpr"
+        "]"
+        "premises: ["
+          "expr.value : ValueType;"
+        "]"
+        "proposition : ValueType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .h file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "#include \"runtime/FailureRecord.h\"\n"
+      "\n"
+      "class MyDiagnosedInference\n"
+      "{\n"
+      "public:\n"
+      "    TypeCls CallInference(const ASTCallExpr& call, std::error_code*);\n"
+      "\n"
+      "    TypeCls NullInference(const ASTNullExpr& expr, std::error_code*);\n"
+      "\n"
+      "    static std::string describeFailure(const sl::runtime::FailureRecord&);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyDiagnosedInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyDiagnosedInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyDiagnosedInference::CallInference(const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    std::vector<TypeCls> ArgumentTypes = proveType(call.argument_types);\n"
+      "\n"
+      "    std::vector<TypeCls> ParameterTypes = proveType(call.parameter_types);\n"
+      "\n"
+      "    for (size_t i = 0, j = 0; i < ParameterTypes.size(); ++i, ++j) {\n"
+      "        if (!cmpType(ArgumentTypes[i], ParameterTypes[j], std::less_equal<TypeCls>())) {\n"
+      "            failure.record(0, 2, i, j);\n"
+      "            *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "            return TypeCls();\n"
+      "        }\n"
+      "    }\n"
+      "\n"
+      "    TypeCls CalleeType = proveType(call.callee);\n"
+      "\n"
+      "    if (!cmpType(CalleeType, VOID_TYPE, std::not_equal_to<TypeCls>())) {\n"
+      "        failure.record(0, 4);\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyDiagnosedInference::NullInference(const ASTNullExpr& expr, std::error_code* err)\n"
+      "{\n"
+      "    TypeCls ValueType = proveType(expr.value);\n"
+      "\n"
+      "    return ValueType;\n"
+      "}\n"
+      "\n"
+      "std::string\n"
+      "MyDiagnosedInference::describeFailure(const sl::runtime::FailureRecord& record)\n"
+      "{\n"
+      "    static const char* const CallInferencePremises[] = {\n"
+      "        \"call.argument_types : ArgumentTypes[]\",\n"
+      "        \"call.parameter_types : ParameterTypes[]\",\n"
+      "        \"ArgumentTypes[] <= ParameterTypes[] inrange 0..0..ParameterTypes[]\",\n"
+      "        \"call.callee : CalleeType\",\n"
+      "        \"CalleeType != VOID_TYPE\",\n"
+      "    };\n"
+      "\n"
+      "    static const char* const NullInferencePremises[] = {\n"
+      "        \"expr.value : ValueType\",\n"
+      "    };\n"
+      "\n"
+      "    static const sl::runtime::FailureRuleInfo rules[] = {\n"
+      "        {\"CallInference\", CallInferencePremises, 5},\n"
+      "        {\"NullInference\", NullInferencePremises, 1},\n"
+      "    };\n"
+      "\n"
+      "    return sl::runtime::describeFailure(record, \"./SampleInput.sl\", rules, 2);\n"
+      "}\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyDiagnosedInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithInstrumentation)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyInstrumentedInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.expected : ExpectedType;"
+          "CalleeType <= ExpectedType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+      ""
+      "inference ReturnInference {"
+        "arguments: ["
+          "stmt : ASTReturnStmt"
+        "]"
+        "premises: ["
+          "stmt.expr : ExprType;"
+        "]"
+        "proposition : ExprType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+  opts.emitInstrumentation = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check .h file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "#include \"runtime/Instrumentation.h\"\n"
+      "\n"
+      "class MyInstrumentedInference\n"
+      "{\n"
+      "public:\n"
+      "    TypeCls CallInference(const ASTCallExpr& call, std::error_code*);\n"
+      "\n"
+      "    TypeCls ReturnInference(const ASTReturnStmt& stmt, std::error_code*);\n"
+      "\n"
+      "    inline static sl::runtime::RuleCounters ruleCounters[2];\n"
+      "\n"
+      "    static void dumpInstrumentation(std::ostream&);\n"
+      "\n"
+      "};\n";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyInstrumentedInference.h");
+  }
+
+  // Check .cpp file content.
+  {
+    // clang-format off
+    const char* EXPECTED_CPP_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#include \"MyInstrumentedInference.h\"\n"
+      "#include \"InferenceErrorDefn.h\"\n"
+      "\n"
+      "TypeCls\n"
+      "MyInstrumentedInference::CallInference(const ASTCallExpr& call, std::error_code* err)\n"
+      "{\n"
+      "    SL_INSTRUMENT_RULE(ruleCounters, 0);\n"
+      "\n"
+      "    SL_INSTRUMENT_PREMISE(0, 0);\n"
+      "    TypeCls CalleeType = proveType(call.callee);\n"
+      "\n"
+      "    SL_INSTRUMENT_PREMISE(0, 1);\n"
+      "    TypeCls ExpectedType = proveType(call.expected);\n"
+      "\n"
+      "    SL_INSTRUMENT_PREMISE(0, 2);\n"
+      "    if (!cmpType(CalleeType, ExpectedType, std::less_equal<TypeCls>())) {\n"
+      "        SL_INSTRUMENT_FAILURE(ruleCounters, 0, 2);\n"
+      "        *err = std::error_code(InferenceErrorTypeComparisonFailed, inference_error_category);\n"
+      "        return TypeCls();\n"
+      "    }\n"
+      "    return CalleeType;\n"
+      "}\n"
+      "\n"
+      "TypeCls\n"
+      "MyInstrumentedInference::ReturnInference(const ASTReturnStmt& stmt, std::error_code* err)\n"
+      "{\n"
+      "    SL_INSTRUMENT_RULE(ruleCounters, 1);\n"
+      "\n"
+      "    SL_INSTRUMENT_PREMISE(1, 0);\n"
+      "    TypeCls ExprType = proveType(stmt.expr);\n"
+      "\n"
+      "    return ExprType;\n"
+      "}\n"
+      "\n"
+      "void\n"
+      "MyInstrumentedInference::dumpInstrumentation(std::ostream& os)\n"
+      "{\n"
+      "    static const char* const names[] = {\n"
+      "        \"CallInference\",\n"
+      "        \"ReturnInference\",\n"
+      "    };\n"
+      "\n"
+      "    sl::runtime::dumpRuleCounters(os, \"MyInstrumentedInference\", names, ruleCounters, 2);\n"
+      "}\n";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_CPP_RES, "MyInstrumentedInference.cpp");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithBaseInferenceGroup)
+{
+  // clang-format off
+  static const char* BASE_INPUT =
+    "group BaseGroup {"
+      "ClassName                      : MyBaseInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      ""
+      "inference BinaryInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.lhs : LhsType;"
+        "]"
+        "proposition : LhsType;"
+      "}"
+    "}"
+    "";
+
+  static const char* INPUT =
+    "import base;"
+    ""
+    "group MyGroup : BaseGroup {"
+      "ClassName                      : MyDerivedInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      "DispatchKeyClass               : NodeKind;"
+      ""
+      "dispatch: ["
+        "BinaryExpr                   : BinaryInference;"
+        "UnaryExpr                    : UnaryInference;"
+      "]"
+      ""
+      "inference UnaryInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.operand : OperandType;"
+        "]"
+        "proposition : OperandType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  ASTModule baseModule;
+  ASTModule module;
+  bool res;
+  std::tie(baseModule, res) = parseFromString(BASE_INPUT);
+  ASSERT_EQ(0, res);
+  std::tie(module, res) = parseFromString(INPUT);
+  ASSERT_EQ(0, res);
+
+  // Resolve the import by hand.
+  module.imports().front().setModule(&baseModule);
+  module.inferenceGroups().front().setBase(
+      &baseModule.inferenceGroups().front());
+
+  SemanticAnalyzer analyzer;
+  ASSERT_TRUE(analyzer.run(module));
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  Synthesizer synthesizer(opts);
+  ASSERT_TRUE(synthesizer.run(module));
+
+  // Check header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "#include \"MyBaseInference.h\"\n"
+      "\n"
+      "class MyDerivedInference : public MyBaseInference\n"
+      "{\n"
+      "public:\n"
+      "    TypeCls UnaryInference(const ASTExpr& expr, std::error_code*);\n"
+      "\n"
+      "    TypeCls dispatch(NodeKind dispatchKey, const ASTExpr& expr, std::error_code*);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyDerivedInference.h");
+  }
+
+  // The inherited inference definitions are only dispatched to.
+  {
+    const auto actual_res = readFromOutputFile("./MyDerivedInference.cpp");
+    ASSERT_NE(std::string::npos,
+              actual_res.find("return BinaryInference(expr, err);\n"));
+    ASSERT_EQ(std::string::npos,
+              actual_res.find("MyDerivedInference::BinaryInference("));
+  }
+
+  // Policy templates cannot derive from one another.
+  opts.usePolicyTemplate = true;
+  Synthesizer policySynthesizer(opts);
+  ASSERT_FALSE(policySynthesizer.run(module));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithShards)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyShardedInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      ""
+      "inference UnaryInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.operand : OperandType;"
+        "]"
+        "proposition : OperandType;"
+      "}"
+      ""
+      "inference BinaryInference {"
+        "arguments: ["
+          "expr : ASTExpr"
+        "]"
+        "premises: ["
+          "expr.lhs : LhsType;"
+          "expr.rhs : RhsType;"
+        "]"
+        "proposition : LhsType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+  const std::string unsharded =
+      readFromOutputFile("./MyShardedInference.cpp");
+
+  opts.shards = 3;
+  testSynthesisWithSuccess(INPUT, opts);
+  const std::string shards[] = {
+      readFromOutputFile("./MyShardedInference_0.cpp"),
+      readFromOutputFile("./MyShardedInference_1.cpp"),
+      readFromOutputFile("./MyShardedInference_2.cpp")};
+
+  // Each shard includes what the unsharded file does, and holds a run of its
+  // definitions.
+  const std::string includes = "#include \"InferenceErrorDefn.h\"\n";
+  const size_t defnsPos = unsharded.find(includes) + includes.size();
+  std::string defns;
+  for (const auto& shard : shards) {
+    ASSERT_EQ(unsharded.substr(0, defnsPos), shard.substr(0, defnsPos));
+    defns.append(shard.substr(defnsPos));
+  }
+  ASSERT_EQ(unsharded.substr(defnsPos), defns);
+
+  // Definitions keep the order of the input.
+  ASSERT_NE(std::string::npos,
+            shards[0].find("MyShardedInference::UnaryInference("));
+  ASSERT_NE(std::string::npos,
+            shards[2].find("MyShardedInference::BinaryInference("));
+  ASSERT_EQ(std::string::npos,
+            shards[2].find("MyShardedInference::UnaryInference("));
+}
+
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithLightHeaders)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyLightInference;"
+      "TypeRuntime                    : snowlake;"
+      "ProofMethod                    : proveType;"
+      "ContextClass                   : CheckerContext;"
+      "FailureRecord                  : failure;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+          "call.expected : ExpectedType;"
+          "CalleeType = ExpectedType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+  opts.emitInstrumentation = true;
+  opts.useLightHeaders = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+
+  // Check header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include <cstddef>\n"
+      "#include <system_error>\n"
+      "#include <string>\n"
+      "#include <iosfwd>\n"
+      "\n"
+      "namespace sl {\n"
+      "namespace runtime {\n"
+      "class TypeHandle;\n"
+      "struct FailureRecord;\n"
+      "struct RuleCounters;\n"
+      "} // namespace runtime\n"
+      "} // namespace sl\n"
+      "\n"
+      "class MyLightInference\n"
+      "{\n"
+      "public:\n"
+      "    static sl::runtime::TypeHandle CallInference(CheckerContext& ctx, const ASTCallExpr& call, std::error_code*);\n"
+      "\n"
+      "    template <typename Executor>\n"
+      "    static void CallInferenceBatch(const ASTCallExpr* const* call, sl::runtime::TypeHandle* results, std::error_code* errs, size_t count, Executor& executor);\n"
+      "\n"
+      "    static std::string describeFailure(const sl::runtime::FailureRecord&);\n"
+      "\n"
+      "    static sl::runtime::RuleCounters ruleCounters[1];\n"
+      "\n"
+      "    static void dumpInstrumentation(std::ostream&);\n"
+      "\n"
+      "};\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_HEADER_RES, "MyLightInference.h");
+  }
+
+  // Check implementation-detail header file content.
+  {
+    // clang-format off
+    const char* EXPECTED_DETAIL_HEADER_RES =
+      "/**\n"
+      " * Auto-generated by Snowlake compiler (version 0.1.2).\n"
+      " */\n"
+      "\n"
+      "\n"
+      "#pragma once\n"
+      "\n"
+      "#include \"MyLightInference.h\"\n"
+      "\n"
+      "#include <cstdlib>\n"
+      "#include <cstddef>\n"
+      "#include <vector>\n"
+      "#include <system_error>\n"
+      "\n"
+      "#include \"runtime/TypeTable.h\"\n"
+      "\n"
+      "#include \"runtime/FailureRecord.h\"\n"
+      "\n"
+      "#include \"runtime/Instrumentation.h\"\n"
+      "\n"
+      "template <typename Executor>\n"
+      "void\n"
+      "MyLightInference::CallInferenceBatch(const ASTCallExpr* const* call, sl::runtime::TypeHandle* results, std::error_code* errs, size_t count, Executor& executor)\n"
+      "{\n"
+      "    executor.parallelFor(count, [&](size_t i, CheckerContext& ctx) {\n"
+      "        results[i] = CallInference(ctx, *call[i], &errs[i]);\n"
+      "    });\n"
+      "}\n"
+      "\n"
+      "";
+    // clang-format on
+
+    assertOutputFileContent(EXPECTED_DETAIL_HEADER_RES,
+                            "MyLightInferenceDetail.h");
+  }
+
+  // The .cpp file includes the implementation-detail header file, and
+  // defines the counters.
+  {
+    const std::string cpp = readFromOutputFile("./MyLightInference.cpp");
+    ASSERT_NE(std::string::npos,
+              cpp.find("#include \"MyLightInferenceDetail.h\"\n"));
+    ASSERT_EQ(std::string::npos, cpp.find("#include \"MyLightInference.h\"\n"));
+    ASSERT_NE(std::string::npos,
+              cpp.find("sl::runtime::RuleCounters "
+                       "MyLightInference::ruleCounters[1];\n"));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(SynthesizerTests, TestSynthesisWithLightHeadersAndPolicyTemplate)
+{
+  // clang-format off
+  static const char* INPUT =
+    "group MyGroup {"
+      "ClassName                      : MyLightTemplateInference;"
+      "TypeClass                      : TypeCls;"
+      "ProofMethod                    : proveType;"
+      "TypeCmpMethod                  : cmpType;"
+      ""
+      "inference CallInference {"
+        "arguments: ["
+          "call : ASTCallExpr"
+        "]"
+        "premises: ["
+          "call.callee : CalleeType;"
+        "]"
+        "proposition : CalleeType;"
+      "}"
+    "}"
+    "";
+  // clang-format on
+
+  auto opts = defaultOptions();
+  opts.suppressAnnotationComments = true;
+  opts.usePolicyTemplate = true;
+
+  testSynthesisWithSuccess(INPUT, opts);
+  const std::string header = readFromOutputFile("./MyLightTemplateInference.h");
+
+  // Policy templates are header-only, so light headers leave them as is.
+  opts.useLightHeaders = true;
+  remove("./MyLightTemplateInference.h");
+
+  testSynthesisWithSuccess(INPUT, opts);
+  ASSERT_EQ(header, readFromOutputFile("./MyLightTemplateInference.h"));
+  ASSERT_FALSE(std::ifstream("./MyLightTemplateInferenceDetail.h").good());
+}
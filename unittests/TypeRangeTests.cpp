@@ -0,0 +1,206 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+#include "runtime/TypeRange.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <gtest/gtest.h>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+class TypeRangeTests : public ::testing::Test
+{
+protected:
+  template <typename T, typename Compare>
+  bool cmpTypeRangeScalar(const std::vector<T>& lhs, size_t lhsOffset,
+                          const std::vector<T>& rhs, size_t rhsOffset,
+                          size_t count, Compare cmp) const
+  {
+    for (size_t k = 0; k < count; ++k) {
+      if (!cmp(lhs[lhsOffset + k], rhs[rhsOffset + k])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename T, typename Compare>
+  void assertMatchesScalar(const std::vector<T>& lhs,
+                           const std::vector<T>& rhs, Compare cmp) const
+  {
+    for (size_t lhsOffset = 0; lhsOffset < 3; ++lhsOffset) {
+      for (size_t rhsOffset = 0; rhsOffset < 3; ++rhsOffset) {
+        const size_t count =
+            std::min(lhs.size() - lhsOffset, rhs.size() - rhsOffset);
+        ASSERT_EQ(
+            cmpTypeRangeScalar(lhs, lhsOffset, rhs, rhsOffset, count, cmp),
+            sl::runtime::cmpTypeRange(lhs, lhsOffset, rhs, rhsOffset, count,
+                                      cmp));
+      }
+    }
+  }
+
+  template <typename T>
+  void assertAllComparisonsMatchScalar(const std::vector<T>& lhs,
+                                       const std::vector<T>& rhs) const
+  {
+    assertMatchesScalar(lhs, rhs, std::equal_to<T>());
+    assertMatchesScalar(lhs, rhs, std::not_equal_to<T>());
+    assertMatchesScalar(lhs, rhs, std::less<T>());
+    assertMatchesScalar(lhs, rhs, std::less_equal<T>());
+    assertMatchesScalar(lhs, rhs, std::greater<T>());
+    assertMatchesScalar(lhs, rhs, std::greater_equal<T>());
+    assertMatchesScalar(lhs, rhs, std::equal_to<>());
+    assertMatchesScalar(lhs, rhs, std::less_equal<>());
+  }
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeRangeTests, TestEmptyRange)
+{
+  const std::vector<uint32_t> lhs{1, 2, 3};
+  const std::vector<uint32_t> rhs{4, 5, 6};
+
+  ASSERT_TRUE(
+      sl::runtime::cmpTypeRange(lhs, 0, rhs, 0, 0, std::equal_to<uint32_t>()));
+  ASSERT_TRUE(
+      sl::runtime::cmpTypeRange(lhs, 3, rhs, 3, 0, std::less<uint32_t>()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeRangeTests, TestEqualRangesWithOffsets)
+{
+  std::vector<uint32_t> lhs(37);
+  std::vector<uint32_t> rhs(38);
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    lhs[i] = static_cast<uint32_t>(i * 7);
+    rhs[i + 1] = static_cast<uint32_t>(i * 7);
+  }
+
+  ASSERT_TRUE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 1, lhs.size(),
+                                        std::equal_to<uint32_t>()));
+  ASSERT_FALSE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 0, lhs.size(),
+                                         std::equal_to<uint32_t>()));
+  ASSERT_TRUE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 1, lhs.size(),
+                                        std::less_equal<uint32_t>()));
+  ASSERT_FALSE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 1, lhs.size(),
+                                         std::less<uint32_t>()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeRangeTests, TestMismatchAtEveryPosition)
+{
+  for (size_t pos = 0; pos < 37; ++pos) {
+    std::vector<uint32_t> lhs(37, 42);
+    std::vector<uint32_t> rhs(37, 42);
+    rhs[pos] = 43;
+
+    assertAllComparisonsMatchScalar(lhs, rhs);
+    ASSERT_FALSE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 0, lhs.size(),
+                                           std::equal_to<uint32_t>()));
+    ASSERT_TRUE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 0, lhs.size(),
+                                          std::less_equal<uint32_t>()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeRangeTests, TestUnsignedTypeIdsWithHighBitSet)
+{
+  const std::vector<uint32_t> lhs{1, 0x80000000u, 0xFFFFFFFFu, 5,
+                                  6, 7,           0x7FFFFFFFu, 9,
+                                  10};
+  const std::vector<uint32_t> rhs{0xFFFFFFFFu, 0x80000001u, 0xFFFFFFFFu,
+                                  5,           0x90000000u, 8,
+                                  0x80000000u, 9,           11};
+
+  assertAllComparisonsMatchScalar(lhs, rhs);
+  ASSERT_TRUE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 0, lhs.size(),
+                                        std::less_equal<uint32_t>()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeRangeTests, TestSignedTypeIds)
+{
+  const std::vector<int32_t> lhs{-1, -5, 3, 0, 8, -9, 10, 11, 12, -13};
+  const std::vector<int32_t> rhs{-1, -4, 3, 1, 8, -8, 10, 12, 12, -12};
+
+  assertAllComparisonsMatchScalar(lhs, rhs);
+  ASSERT_TRUE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 0, lhs.size(),
+                                        std::less_equal<int32_t>()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeRangeTests, TestFixedCapacityArrays)
+{
+  const std::array<uint32_t, 4> lhs{1, 2, 3, 4};
+  const std::array<uint32_t, 5> rhs{0, 1, 2, 3, 4};
+
+  ASSERT_TRUE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 1, lhs.size(),
+                                        std::equal_to<uint32_t>()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeRangeTests, TestFallbackWithNonIntegralTypeClass)
+{
+  struct TypeCls
+  {
+    int id;
+
+    bool operator==(const TypeCls& other) const
+    {
+      return id == other.id;
+    }
+  };
+
+  const std::vector<TypeCls> lhs{{1}, {2}, {3}, {4}, {5}};
+  const std::vector<TypeCls> rhs{{1}, {2}, {3}, {4}, {6}};
+
+  ASSERT_TRUE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 0, 4,
+                                        std::equal_to<TypeCls>()));
+  ASSERT_FALSE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 0, 5,
+                                         std::equal_to<TypeCls>()));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeRangeTests, TestFallbackWithCustomComparator)
+{
+  const std::vector<uint32_t> lhs{2, 4, 6, 8, 10, 12, 14, 16, 18};
+  const std::vector<uint32_t> rhs{1, 3, 5, 7, 9, 11, 13, 15, 17};
+
+  auto cmp = [](uint32_t a, uint32_t b) { return a == b + 1; };
+
+  ASSERT_TRUE(sl::runtime::cmpTypeRange(lhs, 0, rhs, 0, lhs.size(), cmp));
+  ASSERT_FALSE(sl::runtime::cmpTypeRange(lhs, 1, rhs, 0, 8, cmp));
+}
+
+// -----------------------------------------------------------------------------
@@ -0,0 +1,160 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/TypeTable.h"
+
+#include <functional>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+using sl::runtime::TypeHandle;
+using sl::runtime::TypeTable;
+
+// -----------------------------------------------------------------------------
+
+class TypeTableTests : public ::testing::Test
+{
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeTableTests, TestDefaultHandleIsInvalid)
+{
+  TypeHandle handle;
+
+  ASSERT_FALSE(handle.isValid());
+  ASSERT_EQ(TypeHandle(), handle);
+  ASSERT_EQ(sizeof(uint32_t), sizeof(TypeHandle));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeTableTests, TestInternNominalTypes)
+{
+  TypeTable table;
+
+  const TypeHandle intType = table.intern("int");
+  const TypeHandle boolType = table.intern("bool");
+
+  ASSERT_TRUE(intType.isValid());
+  ASSERT_TRUE(boolType.isValid());
+  ASSERT_NE(intType, boolType);
+  ASSERT_EQ(intType, table.intern("int"));
+  ASSERT_EQ(2, table.size());
+
+  ASSERT_EQ("int", table.constructorOf(intType));
+  ASSERT_EQ(0, table.arityOf(intType));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeTableTests, TestStructuralTypesAreHashConsed)
+{
+  TypeTable table;
+
+  const TypeHandle intType = table.intern("int");
+  const TypeHandle boolType = table.intern("bool");
+
+  const TypeHandle fn1 = table.intern("function", {intType, boolType});
+  const TypeHandle fn2 = table.intern("function", {intType, boolType});
+  const TypeHandle fn3 = table.intern("function", {boolType, intType});
+  const TypeHandle ptr = table.intern("pointer", {fn1});
+
+  ASSERT_EQ(fn1, fn2);
+  ASSERT_NE(fn1, fn3);
+  ASSERT_EQ(ptr, table.intern("pointer", {fn2}));
+  ASSERT_EQ(5, table.size());
+
+  ASSERT_EQ("function", table.constructorOf(fn1));
+  ASSERT_EQ(2, table.arityOf(fn1));
+  ASSERT_EQ(intType, table.argumentOf(fn1, 0));
+  ASSERT_EQ(boolType, table.argumentOf(fn1, 1));
+  ASSERT_EQ(fn1, table.argumentOf(ptr, 0));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeTableTests, TestNominalAndNullaryStructuralTypesCoincide)
+{
+  TypeTable table;
+
+  const TypeHandle unitType = table.intern("unit");
+
+  ASSERT_EQ(unitType, table.intern("unit", {}));
+  ASSERT_NE(unitType, table.intern("unit", {unitType}));
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeTableTests, TestInternManyTypes)
+{
+  TypeTable table;
+
+  std::vector<TypeHandle> handles;
+
+  TypeHandle type = table.intern("int");
+  handles.push_back(type);
+  for (size_t i = 0; i < 10000; ++i) {
+    type = table.intern("pointer", {type});
+    handles.push_back(type);
+  }
+
+  ASSERT_EQ(handles.size(), table.size());
+
+  // Re-interning yields the same handles, and no new types.
+  type = table.intern("int");
+  for (size_t i = 0; i < 10000; ++i) {
+    type = table.intern("pointer", {type});
+    ASSERT_EQ(handles[i + 1], type);
+  }
+
+  ASSERT_EQ(handles.size(), table.size());
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(TypeTableTests, TestCmpType)
+{
+  TypeTable table;
+
+  const TypeHandle intType = table.intern("int");
+  const TypeHandle boolType = table.intern("bool");
+
+  ASSERT_TRUE(sl::runtime::cmpType(intType, table.intern("int"),
+                                   std::equal_to<TypeHandle>()));
+  ASSERT_FALSE(
+      sl::runtime::cmpType(intType, boolType, std::equal_to<TypeHandle>()));
+  ASSERT_TRUE(
+      sl::runtime::cmpType(intType, boolType, std::not_equal_to<TypeHandle>()));
+
+  // Computed targets are compared with the transparent comparators.
+  ASSERT_TRUE(sl::runtime::cmpType(intType, table.intern("int"),
+                                   std::equal_to<>()));
+  ASSERT_FALSE(sl::runtime::cmpType(intType, boolType, std::equal_to<>()));
+  ASSERT_TRUE(sl::runtime::cmpType(intType, boolType, std::not_equal_to<>()));
+}
+
+// -----------------------------------------------------------------------------
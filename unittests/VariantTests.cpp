@@ -582,3 +582,43 @@ TEST_F(VariantMemoryIntegrityUnitTest, TestWithCopySemantics)
 }
 
 // -----------------------------------------------------------------------------
+
+TEST_F(VariantMemoryIntegrityUnitTest, TestAssignmentMovesValues)
+{
+  struct CopyCounted
+  {
+    explicit CopyCounted(size_t* copies)
+      : copies(copies)
+    {
+    }
+
+    CopyCounted(const CopyCounted& other)
+      : copies(other.copies)
+    {
+      ++(*copies);
+    }
+
+    CopyCounted(CopyCounted&& other) = default;
+
+    size_t* copies;
+  };
+
+  using MyVariantType = sl::variant::variant<CopyCounted, int>;
+
+  size_t copies = 0;
+
+  MyVariantType v(1);
+  v = CopyCounted(&copies);
+  ASSERT_EQ(true, v.is<CopyCounted>());
+
+  MyVariantType v2(2);
+  v2 = std::move(v);
+  ASSERT_EQ(true, v2.is<CopyCounted>());
+
+  v2 = 3;
+  ASSERT_EQ(true, v2.is<int>());
+
+  ASSERT_EQ(0, copies);
+}
+
+// -----------------------------------------------------------------------------
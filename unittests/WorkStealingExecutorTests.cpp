@@ -0,0 +1,155 @@
+/*******************************************************************************
+The MIT License (MIT)
+
+Copyright (c) 2020 Tomiko
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*******************************************************************************/
+
+#include "runtime/WorkStealingExecutor.h"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+
+using sl::runtime::WorkStealingExecutor;
+
+// -----------------------------------------------------------------------------
+
+class WorkStealingExecutorTests : public ::testing::Test
+{
+protected:
+  struct Context
+  {
+    size_t processed = 0;
+  };
+};
+
+// -----------------------------------------------------------------------------
+
+TEST_F(WorkStealingExecutorTests, TestEachIndexRunsOnce)
+{
+  std::vector<Context> contexts(4);
+  WorkStealingExecutor<Context> executor(&contexts);
+
+  const size_t count = 10000;
+  std::vector<std::atomic<int>> hits(count);
+
+  executor.parallelFor(count, [&hits](size_t i, Context& ctx) {
+    hits[i].fetch_add(1);
+    ++ctx.processed;
+  });
+
+  size_t processed = 0;
+  for (const auto& ctx : contexts) {
+    processed += ctx.processed;
+  }
+  ASSERT_EQ(count, processed);
+  for (size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(1, hits[i].load());
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(WorkStealingExecutorTests, TestFewerIndicesThanWorkers)
+{
+  std::vector<Context> contexts(8);
+  WorkStealingExecutor<Context> executor(&contexts);
+
+  std::vector<std::atomic<int>> hits(3);
+  executor.parallelFor(3, [&hits](size_t i, Context&) { hits[i].fetch_add(1); });
+
+  for (const auto& hit : hits) {
+    ASSERT_EQ(1, hit.load());
+  }
+
+  executor.parallelFor(0, [](size_t, Context&) { FAIL(); });
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(WorkStealingExecutorTests, TestConsecutiveBatches)
+{
+  std::vector<Context> contexts(4);
+  WorkStealingExecutor<Context> executor(&contexts);
+
+  // Batches of every size up to beyond the number of workers, each of which
+  // must have returned before the next one starts.
+  size_t expected = 0;
+  for (size_t count = 0; count < 64; ++count) {
+    std::vector<std::atomic<int>> hits(count);
+    executor.parallelFor(count, [&hits](size_t i, Context& ctx) {
+      hits[i].fetch_add(1);
+      ++ctx.processed;
+    });
+    for (const auto& hit : hits) {
+      ASSERT_EQ(1, hit.load());
+    }
+    expected += count;
+  }
+
+  size_t processed = 0;
+  for (const auto& ctx : contexts) {
+    processed += ctx.processed;
+  }
+  ASSERT_EQ(expected, processed);
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(WorkStealingExecutorTests, TestWorkersAreReusedAcrossBatches)
+{
+  std::vector<Context> contexts(4);
+  WorkStealingExecutor<Context> executor(&contexts);
+
+  // Each context is used by the same thread in every batch, although a
+  // worker may find its share stolen before it gets to run.
+  std::vector<std::thread::id> threads(contexts.size());
+  for (size_t batch = 0; batch < 100; ++batch) {
+    executor.parallelFor(contexts.size(), [&](size_t, Context& ctx) {
+      auto& thread = threads[&ctx - contexts.data()];
+      if (thread == std::thread::id()) {
+        thread = std::this_thread::get_id();
+      } else {
+        ASSERT_EQ(thread, std::this_thread::get_id());
+      }
+    });
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+TEST_F(WorkStealingExecutorTests, TestSingleContextRunsOnCallingThread)
+{
+  std::vector<Context> contexts(1);
+  WorkStealingExecutor<Context> executor(&contexts);
+
+  const auto callingThread = std::this_thread::get_id();
+  executor.parallelFor(100, [&callingThread](size_t, Context& ctx) {
+    ASSERT_EQ(callingThread, std::this_thread::get_id());
+    ++ctx.processed;
+  });
+
+  ASSERT_EQ(100, contexts.front().processed);
+}
+
+// -----------------------------------------------------------------------------